@@ -55,6 +55,13 @@ enum
 #define IsSetJoinFloodNoticed(x) ((x)->flags & JOIN_FLOOD_NOTICED)
 #define ClearJoinFloodNoticed(x) ((x)->flags &= ~JOIN_FLOOD_NOTICED)
 
+/* Flags for channel_member_who() */
+enum
+{
+  WHO_SHOW_INVISIBLE = 1 << 0,  /* List invisible members as well */
+  WHO_OPERS_ONLY     = 1 << 1   /* List IRC operators only */
+};
+
 struct Client;
 
 /*! \brief Mode structure for channels */
@@ -65,6 +72,29 @@ struct Mode
   char key[KEYLEN + 1];    /**< +k key */
 };
 
+/*! \brief Entry of a MemberArray */
+struct MemberEntry
+{
+  struct Client *client;  /**< Same as member->client, saves a dereference when fanning out */
+  struct ChannelMember *member;  /**< Membership this entry stands for */
+};
+
+/*! \brief Densely packed, unordered array of channel members. Entries are
+ *         removed by moving the last entry into the freed slot. */
+struct MemberArray
+{
+  struct MemberEntry *entry;  /**< Array of MemberArray::size items */
+  unsigned int count;  /**< Number of entries in use */
+  unsigned int size;  /**< Number of entries allocated */
+};
+
+/*! \brief Number of members of a channel reached through one server link */
+struct ChannelRoute
+{
+  struct Client *link;  /**< Directly connected server the members are behind */
+  unsigned int count;  /**< Number of members behind ChannelRoute::link */
+};
+
 /*! \brief Channel structure */
 struct Channel
 {
@@ -81,13 +111,15 @@ struct Channel
   uintmax_t last_knock_time;  /**< Don't allow knock to flood; monotonic time */
   uintmax_t last_invite_time;  /**< Monotonic time */
   uintmax_t last_join_time;  /**< Monotonic time */
-  uintmax_t first_received_message_time;  /*!< Channel flood control; monotonic time */
+  uintmax_t serial;  /*!< Used by channel_common() to mark channels */
   unsigned int flags;
-  unsigned int received_number_of_privmsgs;
 
-  dlink_list members_local;  /*!< local members are here too */
-  dlink_list members;
+  struct MemberArray members_local;  /*!< local members are here too */
+  struct MemberArray members;
+  struct ChannelRoute *routes;  /*!< links with at least one remote member */
+  unsigned int routes_count;  /*!< number of items in Channel::routes */
   dlink_list invites;
+  dlink_list streams;  /*!< ChannelStream items walking Channel::members */
   dlink_list banlist;
   dlink_list exceptlist;
   dlink_list invexlist;
@@ -101,12 +133,12 @@ struct Channel
 /*! \brief ChannelMember structure */
 struct ChannelMember
 {
-  dlink_node locchannode;  /**< link to channel->members_local */
-  dlink_node channode;  /**< link to channel->members */
   dlink_node usernode;  /**< link to client->channel */
   struct Channel *channel;  /**< Channel pointer */
   struct Client *client;  /**< Client pointer */
   unsigned int flags;  /**< user/channel flags, e.g. CHFL_CHANOP */
+  unsigned int index;  /**< Position in channel->members */
+  unsigned int local_index;  /**< Position in channel->members_local, if local */
 };
 
 enum { BANSTRLEN = 200 }; /* XXX */
@@ -115,6 +147,9 @@ enum { BANSTRLEN = 200 }; /* XXX */
 struct Ban
 {
   dlink_node node;
+  dlink_node hnode;  /**< Node in the ban hash table; see find_ban() */
+  dlink_list *list;  /**< The ban/except/invex list this ban is on */
+  unsigned int hashv;  /**< Bucket of the ban hash table this ban is in */
   unsigned int extban;
   char banstr[BANSTRLEN];
   char name[NICKLEN + 1];
@@ -137,10 +172,13 @@ extern int has_member_flags(const struct ChannelMember *, const unsigned int);
 
 extern void channel_do_join(struct Client *, char *, char *);
 extern void channel_do_part(struct Client *, char *, const char *);
+extern struct Ban *find_ban(const dlink_list *, const char *);
+extern void add_ban(struct Ban *, dlink_list *);
 extern void remove_ban(struct Ban *, dlink_list *);
 extern void add_user_to_channel(struct Channel *, struct Client *, unsigned int, bool);
 extern void remove_user_from_channel(struct ChannelMember *);
 extern void channel_member_names(struct Client *, struct Channel *, bool);
+extern void channel_member_who(struct Client *, struct Channel *, const char *, unsigned int);
 extern void channel_send_modes(struct Client *, const struct Channel *);
 extern void channel_modes(const struct Channel *, const struct Client *, char *, char *);
 extern void check_spambot_warning(struct Client *, const char *);
@@ -151,4 +189,5 @@ extern const char *get_member_status(const struct ChannelMember *, bool);
 
 extern struct Channel *channel_make(const char *);
 extern struct ChannelMember *find_channel_link(const struct Client *, const struct Channel *);
+extern bool channel_common(const struct Client *, const struct Client *);
 #endif  /* INCLUDED_channel_h */
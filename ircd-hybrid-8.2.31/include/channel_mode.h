@@ -129,4 +129,5 @@ extern const char *add_id(struct Client *, struct Channel *, const char *, dlink
 extern void channel_mode_set(struct Client *, struct Channel *,
                              struct ChannelMember *, int, char **);
 extern void clear_ban_cache_list(dlink_list *);
+extern void clear_ban_cache_channel(struct Channel *);
 #endif /* INCLUDED_channel_mode_h */
@@ -0,0 +1,58 @@
+/*
+ *  ircd-hybrid: an advanced, lightweight Internet Relay Chat Daemon (ircd)
+ *
+ *  Copyright (c) 2020 ircd-hybrid development team
+ *
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301
+ *  USA
+ */
+
+/*! \file channel_stream.h
+ * \brief Replies walking the member list of a channel, sent as the sendq drains.
+ * \version $Id$
+ */
+
+#ifndef INCLUDED_channel_stream_h
+#define INCLUDED_channel_stream_h
+
+#include "list.h"
+#include "ircd_defs.h"
+
+struct Client;
+struct Channel;
+
+/*! \brief ChannelStream structure */
+struct ChannelStream
+{
+  dlink_node node;  /**< Link in Connection::channel_streams */
+  dlink_node channel_node;  /**< Link in Channel::streams */
+  struct Client *client;  /**< Local client the replies go to */
+  struct Channel *channel;  /**< Channel being listed; NULL once it has been destroyed */
+  unsigned int index;  /**< Next entry of Channel::members to reply with */
+  unsigned int flags;  /**< Up to the handler */
+  bool (*handler)(struct ChannelStream *);  /**< Replies with more members; returns true when done */
+  void (*finish)(struct ChannelStream *);  /**< Sends the end of list numeric */
+  char name[CHANNELLEN + 1];  /**< Name reported by ChannelStream::finish */
+};
+
+extern dlink_list streaming_client_list;
+
+extern void channel_stream_start(struct Client *, struct Channel *, const char *, unsigned int,
+                                 bool (*)(struct ChannelStream *), void (*)(struct ChannelStream *));
+extern void channel_stream_run(struct Client *);
+extern void channel_stream_run_all(void);
+extern void channel_stream_clear(struct Client *);
+extern void channel_stream_channel_free(struct Channel *);
+#endif  /* INCLUDED_channel_stream_h */
@@ -255,6 +255,19 @@ enum addr_mask_type
   MASK_IP   /**< IP is masked. 255.255.255.255 is shown instead */
 };
 
+/*! \brief An entry on the accept list of a caller ID (+g/+G) client */
+struct AcceptItem
+{
+  dlink_node node;  /**< Entry in Connection::acceptlist */
+  dlink_node lnode;  /**< Entry in the accept hash table, or in Connection::acceptlist_wild */
+  struct Client *owner;  /**< Client whose accept list this is */
+  bool wild;  /**< Whether any of the masks has a wildcard */
+  unsigned int hashv;  /**< Bucket in the accept hash table */
+  char *nickptr;
+  char *userptr;
+  char *hostptr;
+};
+
 /*! \brief Server structure */
 struct Server
 {
@@ -304,16 +317,17 @@ struct Connection
   uintmax_t created_real;  /**< Time client was created; real time */
   uintmax_t created_monotonic;  /**< Time client was created; monotonic time */
   uintmax_t last_caller_id_time;  /**< Monotonic time */
-  uintmax_t first_received_message_time;  /**< Monotonic time */
   uintmax_t last_privmsg;  /**< Last time we got a PRIVMSG; monotonic time */
   uintmax_t last_join_time;  /**< When this client last joined a channel; monotonic time */
   uintmax_t last_leave_time;  /**< When this client last left a channel; monotonic time */
 
   unsigned int join_leave_count;  /**< Count of JOIN/LEAVE in less than MIN_JOIN_LEAVE_TIME seconds */
   unsigned int oper_warn_count_down;  /**< Warn opers of this possible spambot every time this gets to 0 */
-  unsigned int received_number_of_privmsgs;
 
   struct ListTask  *list_task;
+  dlink_list channel_streams;  /**< Queued NAMES/WHO replies; the first one is running */
+  dlink_node stream_node;  /**< Link in streaming_client_list while channel_streams isn't empty */
+  dlink_node flush_node;  /**< Node in the list of clients with output to flush */
 
   struct dbuf_queue buf_sendq;
   struct dbuf_queue buf_recvq;
@@ -333,6 +347,7 @@ struct Connection
   struct AuthRequest *auth;
   struct Listener *listener;  /**< Listener accepted from */
   dlink_list acceptlist;  /**< Clients I'll allow to talk to me */
+  dlink_list acceptlist_wild;  /**< Entries of acceptlist that need match() */
   dlink_list watches;  /**< Chain of Watch pointer blocks */
   dlink_list confs;  /**< Configuration record associated */
   dlink_list invited;  /**< Chain of invite pointer blocks */
@@ -349,39 +364,61 @@ struct Connection
   char *password;  /**< Password supplied by the client/server */
 };
 
-/*! \brief Client structure */
-struct Client
+/*! \brief Parts of a client that are rarely looked at; see Client::cold */
+struct ClientCold
 {
-  dlink_node node;
-  dlink_node lnode;  /**< Used for Server->servers/users */
+  dlink_list whowas_list;
+  dlink_list svstags;  /**< List of ServicesTag items */
 
-  struct Connection *connection;  /**< Connection structure associated with this client */
-  struct Client *hnext;  /**< For client hash table lookups by name */
-  struct Client *idhnext;  /**< For SID hash table lookups by sid */
-  struct Server *serv;  /**< ...defined, if this is a server */
-  struct Client *servptr;  /**< Points to server this Client is on */
-  struct Client *from;  /**< == self, if Local Client, *NEVER* NULL! */
+  char *certfp;  /**< TLS certificate fingerprint */
+  char *away;  /**< Client's AWAY message, NULL if not away. Can be set/unset via AWAY command */
 
-  uintmax_t tsinfo;  /**< Timestamp on this nick; real time */
+  /*
+   * realhost contains the resolved name or ip address as a string
+   * for the user. Once a client has registered, this field should be
+   * considered read-only. Interned; see intern.c
+   */
+  const char *realhost;  /**< Client's real hostname */
 
-  unsigned int flags;  /**< Client flags */
-  unsigned int umodes;  /**< User modes this client has set */
-  unsigned int hopcount;  /**< Number of servers to this 0 = local */
-  unsigned int status;  /**< Client type */
-  unsigned int handler;  /**< Handler index */
+  /*
+   * sockhost contains the ip address gotten from the socket as a
+   * string, this field should be considered read-only once the connection
+   * has been made. (set in s_bsd.c only). Interned; see intern.c
+   */
+  const char *sockhost;  /**< This is the host name from the socket ip address as string */
 
-  dlink_list whowas_list;
-  dlink_list channel;  /**< Chain of channel pointer blocks */
-  dlink_list svstags;  /**< List of ServicesTag items */
+  char account[ACCOUNTLEN + 1];  /**< Services account */
 
-  struct irc_ssaddr ip;  /**< Real IP address */
+  /*
+   * info for unix clients will normally contain the info from the
+   * gcos field in /etc/passwd but anything can go here.
+   */
+  char info[REALLEN + 1];  /**< Free form additional client info */
+};
 
-  char *certfp;  /**< TLS certificate fingerprint */
+/*! \brief Client structure */
+struct Client
+{
+  /*
+   * The fields looked at for every member a channel message is fanned
+   * out to come first and fit in CLIENT_HOT_SIZE bytes, so fan-out
+   * touches one or two adjacent cache lines per member.  Everything
+   * else is in struct ClientCold.
+   */
+  struct Client *from;  /**< == self, if Local Client, *NEVER* NULL! */
+  struct Connection *connection;  /**< Connection structure associated with this client */
+  unsigned int flags;  /**< Client flags */
+  unsigned int umodes;  /**< User modes this client has set */
+  unsigned int status;  /**< Client type */
+  unsigned int hopcount;  /**< Number of servers to this 0 = local */
+  struct Client *servptr;  /**< Points to server this Client is on */
+  struct Client *hnext;  /**< For client hash table lookups by name */
+  struct Client *idhnext;  /**< For SID hash table lookups by sid */
+  uintmax_t tsinfo;  /**< Timestamp on this nick; real time */
 
-  char away[AWAYLEN + 1];  /**< Client's AWAY message. Can be set/unset via AWAY command */
+  /* What the prefix of a message from this client, and lookups by name, need */
   char name[HOSTLEN + 1];  /**< Unique name for a client nick or host */
   char id[IDLEN + 1];  /**< Client ID, unique ID per client */
-  char account[ACCOUNTLEN + 1];  /**< Services account */
 
   /*
    * client->username is the username from ident or the USER message,
@@ -395,32 +432,27 @@ struct Client
   /*
    * client->host contains the resolved name or ip address as a string
    * for the user, it may be fiddled with for oper spoofing etc.
-   * once it's changed the *real* address goes away.
+   * once it's changed the *real* address goes away. Interned; see intern.c
    */
-  char host[HOSTLEN + 1];  /**< Client's hostname. Can be faked/spoofed */
+  const char *host;  /**< Client's hostname. Can be faked/spoofed */
 
-  /*
-   * client->realhost contains the resolved name or ip address as a string
-   * for the user. Once a client has registered, this field should be
-   * considered read-only.
-   */
-  char realhost[HOSTLEN + 1];  /**< Client's real hostname */
+  struct Server *serv;  /**< ...defined, if this is a server */
+  unsigned int handler;  /**< Handler index */
 
+  dlink_node node;
+  dlink_node lnode;  /**< Used for Server->servers/users */
+  dlink_list channel;  /**< Chain of channel pointer blocks */
 
-  /*
-   * client->info for unix clients will normally contain the info from the
-   * gcos field in /etc/passwd but anything can go here.
-   */
-  char info[REALLEN + 1];  /**< Free form additional client info */
+  struct irc_ssaddr ip;  /**< Real IP address */
 
-  /*
-   * client->sockhost contains the ip address gotten from the socket as a
-   * string, this field should be considered read-only once the connection
-   * has been made. (set in s_bsd.c only)
-   */
-  char sockhost[HOSTIPLEN + 1];  /**< This is the host name from the socket ip address as string */
+  struct ClientCold *cold;  /**< Allocated along with the client */
 };
 
+/** Size of the part of struct Client every channel member is looked at for */
+enum { CLIENT_HOT_SIZE = 64 };
+_Static_assert(offsetof(struct Client, tsinfo) + sizeof(uintmax_t) <= CLIENT_HOT_SIZE,
+               "The fan-out fields of struct Client must fit in CLIENT_HOT_SIZE bytes");
+
 
 extern struct Client me;
 extern dlink_list listing_client_list;
@@ -433,10 +465,9 @@ extern dlink_list oper_list;          /* our opers, duplicated in local_client_l
 
 extern bool accept_message(struct Client *, struct Client *);
 extern unsigned int client_get_idle_time(const struct Client *, const struct Client *);
-extern struct split_nuh_item *find_accept(const char *, const char *,
-                                          const char *, struct Client *,
-                                          int (*)(const char *, const char *));
-extern void del_accept(struct split_nuh_item *, struct Client *);
+extern struct AcceptItem *find_accept(const char *, const char *, const char *, struct Client *);
+extern void add_accept(const char *, const char *, const char *, struct Client *);
+extern void del_accept(struct AcceptItem *, struct Client *);
 extern void del_all_accepts(struct Client *);
 extern void exit_client(struct Client *, const char *);
 extern void conf_try_ban(struct Client *, int, const char *);
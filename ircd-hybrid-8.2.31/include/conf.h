@@ -38,7 +38,7 @@ enum
   TK_MINUTES
 };
 
-enum { CLEANUP_TKLINES_TIME = 60 };
+enum { CLEANUP_TKLINES_TIME = 1 };
 
 enum maskitem_type
 {
@@ -168,6 +168,7 @@ struct config_general_entry
   const char *xlinefile;
   const char *dlinefile;
   const char *resvfile;
+  char *perf_export_file;
 
   unsigned int dline_min_cidr;
   unsigned int dline_min_cidr6;
@@ -209,6 +210,7 @@ struct config_general_entry
   unsigned int kill_chase_time_limit;
   unsigned int default_floodcount;
   unsigned int default_floodtime;
+  unsigned int perf_export_delay;
   unsigned int throttle_count;
   unsigned int throttle_time;
   unsigned int ping_cookie;
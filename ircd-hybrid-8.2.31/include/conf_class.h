@@ -40,6 +40,7 @@ struct ClassItem
   char *name;
   dlink_node node;
   bool active;
+  bool ip_limit_rebuild;  /**< CIDR limits changed; see class_ip_limit_rebuild_marked() */
   void *ip_tree_v6;  /**< Pointer to 'patricia_tree_t' item */
   void *ip_tree_v4;  /**< Pointer to 'patricia_tree_t' item */
   unsigned int ref_count;
@@ -77,4 +78,5 @@ extern void class_delete_marked(void);
 extern bool class_ip_limit_add(struct ClassItem *, void *, bool);
 extern bool class_ip_limit_remove(struct ClassItem *, void *);
 extern void class_ip_limit_rebuild(struct ClassItem *);
+extern void class_ip_limit_rebuild_marked(void);
 #endif  /* INCLUDED_conf_class_h */
@@ -0,0 +1,43 @@
+/*
+ *  ircd-hybrid: an advanced, lightweight Internet Relay Chat Daemon (ircd)
+ *
+ *  Copyright (c) 2020 ircd-hybrid development team
+ *
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301
+ *  USA
+ */
+
+/*! \file conf_expire.h
+ * \brief Deadline ordered queue of temporary K/D/X-lines and RESVs.
+ * \version $Id$
+ */
+
+#ifndef INCLUDED_conf_expire_h
+#define INCLUDED_conf_expire_h
+
+/** A temporary ban waiting for its expiration time */
+struct ExpireItem
+{
+  uintmax_t until;  /**< Expiration time; calendar time */
+  unsigned int index;  /**< Position in the queue plus one; 0 while not queued */
+  void (*handler)(void *);  /**< Function removing the ban once it is due */
+  void *data;  /**< The ban passed to 'handler' */
+};
+
+extern void conf_expire_add(struct ExpireItem *, uintmax_t, void (*)(void *), void *);
+extern void conf_expire_delete(struct ExpireItem *);
+extern void conf_expire_run(void);
+extern void conf_expire_get_stats(unsigned int *const, size_t *const);
+#endif  /* INCLUDED_conf_expire_h */
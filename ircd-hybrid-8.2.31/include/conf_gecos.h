@@ -27,9 +27,12 @@
 #ifndef INCLUDED_conf_gecos_h
 #define INCLUDED_conf_gecos_h
 
+#include "conf_expire.h"
+
 struct GecosItem
 {
   dlink_node node;
+  struct ExpireItem expire_item;
   char *mask;
   char *reason;
   uintmax_t expire;
@@ -42,5 +45,5 @@ extern void gecos_delete(struct GecosItem *, bool);
 extern struct GecosItem *gecos_make(void);
 extern struct GecosItem *gecos_find(const char *, int (*)(const char *, const char *));
 extern void gecos_clear(void);
-extern void gecos_expire(void);
+extern void gecos_set_expire(struct GecosItem *, uintmax_t);
 #endif  /* INCLUDED_conf_gecos_h */
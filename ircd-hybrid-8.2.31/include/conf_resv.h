@@ -27,11 +27,14 @@
 #ifndef INCLUDED_conf_resv_h
 #define INCLUDED_conf_resv_h
 
+#include "conf_expire.h"
+
 struct ResvItem
 {
   dlink_node node;
   dlink_list *list;
   dlink_list exempt_list;
+  struct ExpireItem expire_item;
   char *mask;
   char *reason;
   uintmax_t expire;
@@ -57,5 +60,5 @@ extern struct ResvItem *resv_make(const char *, const char *, const dlink_list *
 extern bool resv_exempt_find(const struct Client *, const struct ResvItem *);
 extern struct ResvItem *resv_find(const char *, int (*)(const char *, const char *));
 extern void resv_clear(void);
-extern void resv_expire(void);
+extern void resv_set_expire(struct ResvItem *, uintmax_t);
 #endif  /* INCLUDED_conf_resv_h */
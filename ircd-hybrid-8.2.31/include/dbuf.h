@@ -39,13 +39,24 @@ struct dbuf_block
   char data[DBUF_BLOCK_SIZE];
 };
 
+/** Bytes held by all queues of one kind, e.g.\ every sendq */
+struct dbuf_total
+{
+  size_t size;
+  size_t peak;
+};
+
 struct dbuf_queue
 {
   dlink_list blocks;
   size_t total_size;
   size_t pos;
+  struct dbuf_total *total;  /**< Kept up to date with total_size; may be NULL */
 };
 
+extern struct dbuf_total dbuf_sendq_total;
+extern struct dbuf_total dbuf_recvq_total;
+
 extern struct dbuf_block *dbuf_alloc(void);
 extern void dbuf_ref_free(struct dbuf_block *);
 extern void dbuf_add(struct dbuf_queue *, struct dbuf_block *);
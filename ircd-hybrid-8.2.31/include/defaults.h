@@ -69,6 +69,8 @@
 #define MPATH     ETCPATH "/ircd.motd"  /* MOTD file */
 #define LPATH     LOGPATH "/ircd.log"  /* ircd logfile */
 #define PPATH     RUNPATH "/ircd.pid"  /* pid file */
+#define PERFPATH  RUNPATH "/ircd.perf"  /* default instrumentation export */
+#define UPGRADEPATH RUNPATH "/ircd.upgrade"  /* state handed over by RESTART UPGRADE */
 
 /*
  * This file is included to supply default values for things which
@@ -28,12 +28,14 @@
 #define INCLUDED_event_h
 
 #include "list.h"
+#include "perf.h"
 
 struct event_base
 {
   struct
   {
     uintmax_t sec_real, sec_monotonic;
+    uintmax_t msec_monotonic;
   } time;
 };
 
@@ -52,6 +54,7 @@ struct event
   void *data;
   bool active;
   dlink_node node;
+  struct PerfHistogram runtime;
 };
 
 extern const dlink_list *event_get_list(void);
@@ -60,4 +63,5 @@ extern void event_addish(struct event *, void *);
 extern void event_delete(struct event *);
 extern void event_run(void);
 extern void event_time_set(void);
+extern uintmax_t event_time_ns(void);
 #endif /* INCLUDED_event_h */
@@ -27,6 +27,8 @@
 #ifndef INCLUDED_hostmask_h
 #define INCLUDED_hostmask_h
 
+#include "conf_expire.h"
+
 enum { ATABLE_SIZE = 0x1000 };
 
 enum hostmask_type
@@ -64,6 +66,9 @@ struct AddressRec
   struct MaskItem *conf;
 
   dlink_node node;
+  dlink_list *list;  /* The atable bucket 'node' is linked into */
+  bool stale;  /* From the configuration being reloaded, and not yet seen again */
+  struct ExpireItem expire_item;  /* Queued if this is a temporary K/D-line */
 };
 
 extern dlink_list atable[ATABLE_SIZE];
@@ -73,11 +78,12 @@ extern bool match_ipv4(const struct irc_ssaddr *, const struct irc_ssaddr *, int
 
 extern struct AddressRec *add_conf_by_address(const unsigned int, struct MaskItem *);
 extern void delete_one_address_conf(const char *, struct MaskItem *);
-extern void clear_out_address_conf(void);
-extern void hostmask_expire_temporary(void);
+extern void address_conf_mark_stale(void);
+extern void address_conf_sweep_stale(unsigned int *const, unsigned int *const, unsigned int *const);
 
 extern struct MaskItem *find_address_conf(const char *, const char *, const struct irc_ssaddr *, const char *);
 extern struct MaskItem *find_dline_conf(const struct irc_ssaddr *);
+extern struct MaskItem *find_conf_by_mask(unsigned int, const char *, const char *);
 extern struct MaskItem *find_conf_by_address(const char *, const struct irc_ssaddr *,
                                              unsigned int, const char *, const char *, int);
 #endif /* INCLUDED_hostmask_h */
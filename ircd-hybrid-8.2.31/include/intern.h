@@ -0,0 +1,38 @@
+/*
+ *  ircd-hybrid: an advanced, lightweight Internet Relay Chat Daemon (ircd)
+ *
+ *  Copyright (c) 2020 ircd-hybrid development team
+ *
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301
+ *  USA
+ */
+
+/*! \file intern.h
+ * \brief Shared, reference counted copies of strings that repeat between clients.
+ * \version $Id$
+ */
+
+#ifndef INCLUDED_intern_h
+#define INCLUDED_intern_h
+
+/** Number of buckets of the table of interned strings */
+enum { INTERN_HASH_SIZE = 65536 };
+
+extern const char *intern_get(const char *, size_t);
+extern const char *intern_ref(const char *);
+extern void intern_put(const char *);
+extern void intern_set(const char **, const char *, size_t);
+extern void intern_get_stats(unsigned int *const, size_t *const);
+#endif  /* INCLUDED_intern_h */
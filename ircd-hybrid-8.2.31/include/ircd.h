@@ -43,6 +43,10 @@ struct SetOptions
   unsigned int joinfloodcount;
   unsigned int spam_num;
   unsigned int spam_time;
+  unsigned int tls_session_cache;  /* Size of the server side TLS session cache */
+  unsigned int perf_export;  /* Interval of the instrumentation export; 0 disables it */
+  unsigned int prefix_rate;  /* Connections per second regained by each network prefix; 0 disables it */
+  unsigned int prefix_burst;  /* Connections a network prefix may make at once */
 };
 
 /*
@@ -71,6 +75,8 @@ struct ServerStatistics
   unsigned int    is_kill; /* number of kills generated on collisions */
   unsigned int    is_asuc; /* successful auth requests */
   unsigned int    is_abad; /* bad auth requests */
+  unsigned int    is_tls;  /* completed TLS handshakes */
+  unsigned int    is_tlsr; /* TLS handshakes that resumed a previous session */
 };
 
 struct Counter
@@ -86,6 +92,8 @@ struct Counter
 struct ServerState_t
 {
   bool foreground;
+  bool reuseport;  /**< Share client ports with other ircd processes */
+  bool deferaccept;  /**< Have the kernel hold back connections until they sent data */
 };
 
 extern char **myargv;
@@ -37,6 +37,9 @@ enum
   LISTENER_SERVER = 1 << 2
 };
 
+/** Time in seconds the kernel holds back a connection until its first data with -deferaccept */
+enum { LISTENER_DEFER_ACCEPT = 10 };
+
 struct Listener
 {
   dlink_node node;           /**< Doubly linked list node */
@@ -52,6 +55,7 @@ struct Listener
 extern const dlink_list *listener_get_list(void);
 extern void listener_add(int, const char *, unsigned int);
 extern void listener_release(struct Listener *);
+extern void listener_mark_for_deletion(void);
 extern void listener_close_marked(void);
 extern const char *listener_get_name(const struct Listener *);
 extern void listener_count_memory(unsigned int *, size_t *);
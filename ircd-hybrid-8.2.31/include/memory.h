@@ -27,10 +27,52 @@
 #ifndef INCLUDED_memory_h
 #define INCLUDED_memory_h
 
+/** Subsystems whose allocations are accounted for separately */
+enum MemoryTag
+{
+  MEMORY_CLIENT,
+  MEMORY_CLIENT_COLD,
+  MEMORY_CONNECTION,
+  MEMORY_SERVER,
+  MEMORY_AWAY,
+  MEMORY_CHANNEL,
+  MEMORY_MEMBER,
+  MEMORY_MEMBER_ARRAY,
+  MEMORY_CHANNEL_ROUTE,
+  MEMORY_BAN,
+  MEMORY_INVITE,
+  MEMORY_LIST_TASK,
+  MEMORY_CHANNEL_STREAM,
+  MEMORY_WATCH,
+  MEMORY_WHOWAS,
+  MEMORY_INTERN,
+  MEMORY_DBUF,
+  MEMORY_DLINK,
+  MEMORY_DNS,
+  MEMORY_TLS,
+  MEMORY_TAG_LAST
+};
+
+struct MemoryStats
+{
+  const char *name;  /**< Shown in STATS z */
+  size_t count;  /**< Allocations currently live */
+  size_t bytes;  /**< Bytes currently allocated */
+  size_t peak;  /**< Highest value 'bytes' ever had */
+};
+
 extern void outofmemory(void);
 extern void *xcalloc(size_t);
 extern void *xrealloc(void *, size_t);
 extern void xfree(void *);
 extern void *xstrdup(const char *);
 extern void *xstrndup(const char *, size_t);
+extern void *xcalloc_tag(enum MemoryTag, size_t);
+extern void *xrealloc_tag(enum MemoryTag, void *, size_t, size_t);
+extern void xfree_tag(enum MemoryTag, void *, size_t);
+extern void *xstrndup_tag(enum MemoryTag, const char *, size_t);
+extern void xfree_str_tag(enum MemoryTag, void *);
+extern void memory_tag_add(enum MemoryTag, size_t);
+extern void memory_tag_sub(enum MemoryTag, size_t);
+extern const struct MemoryStats *memory_get_stats(enum MemoryTag);
 #endif /* INCLUDED_memory_h */
@@ -45,6 +45,9 @@ struct module_path
   char *path;
 };
 
+extern const char *module_core_path;
+extern const char *module_auto_path;
+
 extern dlink_list *modules_get_list(void);
 /* add a path */
 extern void mod_add_path(const char *);
@@ -28,6 +28,8 @@
 #ifndef INCLUDED_motd_h
 #define INCLUDED_motd_h
 
+#include "send.h"
+
 /** Type of MOTD. */
 enum MotdType
 {
@@ -67,7 +69,7 @@ struct MotdCache
   unsigned int maxcount;  /**< Number of lines allocated for message. */
   unsigned int count;  /**< Actual number of lines used in message. */
   uintmax_t modtime;  /**< Last modification time from file. */
-  char motd[][MOTD_LINESIZE];  /**< Message body. */
+  struct Reply reply;  /**< Complete RPL_MOTDSTART..RPL_ENDOFMOTD reply. */
 };
 
 /* motd_send sends a MOTD off to a user */
@@ -29,6 +29,8 @@
 
 #include "fdlist.h"
 
+struct dbuf_queue;
+
 /*
  * This hides in here rather than in defaults.h because it really shouldn't
  * be tweaked unless you *REALLY REALLY* know what you're doing!
@@ -51,7 +53,9 @@ enum
   MAX_FLOOD_BURST = MAX_FLOOD * 8
 };
 
+extern size_t extract_one_line(struct dbuf_queue *, char *);
 extern void read_packet(fde_t *, void *);
+extern void parse_client_queued(struct Client *);
 extern void flood_recalc(fde_t *, void *);
 extern void flood_endgrace(struct Client *);
 #endif  /* INCLUDED_packet_h */
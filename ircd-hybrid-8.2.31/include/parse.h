@@ -27,6 +27,9 @@
 #ifndef INCLUDED_parse_h
 #define INCLUDED_parse_h
 
+#include "list.h"
+#include "perf.h"
+
 struct Client;
 
 
@@ -70,7 +73,9 @@ typedef enum HandlerType
  */
 struct Message
 {
+  dlink_node node;  /* node in the list of registered commands */
   const char *cmd;
+  size_t length;  /* strlen(cmd), set by mod_add_cmd() */
   void *extra;
   unsigned int count;      /* number of times command used */
   unsigned int rcount;     /* number of times command used by server */
@@ -81,6 +86,7 @@ struct Message
   unsigned int args_max;    /* maximum permitted parameters */
   unsigned int flags;
   uintmax_t bytes;  /* bytes received for this message */
+  struct PerfHistogram latency;  /* nanoseconds spent in the handlers */
 
   /* handlers:
    * UNREGISTERED, CLIENT, SERVER, ENCAP, OPER, LAST
@@ -100,6 +106,7 @@ extern void parse(struct Client *, char *, char *);
 extern void mod_add_cmd(struct Message *);
 extern void mod_del_cmd(struct Message *);
 extern struct Message *find_command(const char *);
+extern const dlink_list *command_get_list(void);
 extern void report_messages(struct Client *);
 
 /* generic handlers */
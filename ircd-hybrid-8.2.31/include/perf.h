@@ -0,0 +1,61 @@
+/*
+ *  ircd-hybrid: an advanced, lightweight Internet Relay Chat Daemon (ircd)
+ *
+ *  Copyright (c) 1997-2020 ircd-hybrid development team
+ *
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301
+ *  USA
+ */
+
+/*! \file perf.h
+ * \brief Low overhead instrumentation of hot code paths.
+ * \version $Id$
+ */
+
+#ifndef INCLUDED_perf_h
+#define INCLUDED_perf_h
+
+struct Client;
+
+/** Number of buckets of a PerfHistogram */
+enum { PERF_BUCKETS = 32 };
+
+/** Log2 histogram of samples; nanoseconds for timings, counts otherwise */
+struct PerfHistogram
+{
+  uintmax_t count;  /**< Number of samples */
+  uintmax_t total;  /**< Sum of all samples */
+  uintmax_t max;  /**< Largest sample */
+  uintmax_t bucket[PERF_BUCKETS];  /**< bucket[n] counts samples below 2^n, but not below 2^(n-1) */
+};
+
+struct PerfStatistics
+{
+  struct PerfHistogram loop;  /**< Busy time of one io_loop() iteration */
+  struct PerfHistogram select;  /**< Time comm_select() spent dispatching I/O */
+  struct PerfHistogram wait;  /**< Time spent waiting for I/O in the poller */
+  struct PerfHistogram fanout;  /**< Recipients of sendto_channel_butone() */
+  struct PerfHistogram split;  /**< Time spent processing a netsplit */
+  uintmax_t wait_last;  /**< Duration of the most recent wait */
+};
+
+extern struct PerfStatistics PerfStats;
+
+extern void perf_add(struct PerfHistogram *, uintmax_t);
+extern void perf_wait(uintmax_t);
+extern uintmax_t perf_percentile(const struct PerfHistogram *, unsigned int);
+extern void perf_report(struct Client *);
+extern void perf_set_export(unsigned int);
+#endif  /* INCLUDED_perf_h */
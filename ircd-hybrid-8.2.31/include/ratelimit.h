@@ -0,0 +1,87 @@
+/*
+ *  ircd-hybrid: an advanced, lightweight Internet Relay Chat Daemon (ircd)
+ *
+ *  Copyright (c) 2020 ircd-hybrid development team
+ *
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301
+ *  USA
+ */
+
+/*! \file ratelimit.h
+ * \brief Sliding window event rates kept in fixed size count-min sketches.
+ * \version $Id$
+ */
+
+#ifndef INCLUDED_ratelimit_h
+#define INCLUDED_ratelimit_h
+
+#include "ircd_defs.h"
+
+struct Client;
+
+/** Number of rows of a sketch; each key is counted once per row */
+enum { RATE_DEPTH = 4 };
+/** Number of counters in each row of a sketch */
+enum { RATE_WIDTH = 16384 };
+/** Number of busiest keys a sketch remembers for STATS w */
+enum { RATE_TOP = 8 };
+/** Longest key a sketch remembers for STATS w */
+enum { RATE_KEYLEN = CHANNELLEN + 1 };
+/** Prefix length IPv4 addresses are accounted by */
+enum { RATE_PREFIX_V4 = 24 };
+/** Prefix length IPv6 addresses are accounted by */
+enum { RATE_PREFIX_V6 = 64 };
+/** Size of a key made by ratelimit_prefix_key() */
+enum { RATE_PREFIX_KEYLEN = 1 + RATE_PREFIX_V6 / 8 };
+/** A network prefix may send as many messages as this many clients at their limit */
+enum { RATE_PREFIX_SOURCES = 4 };
+
+/** A key that has recently been among the busiest of its sketch */
+struct RateTop
+{
+  char key[RATE_KEYLEN];  /**< The key; not necessarily NUL terminated */
+  size_t len;  /**< Length of RateTop::key; 0 if the slot is unused */
+  unsigned int count;  /**< Highest estimated number of events recorded */
+  unsigned int rejected;  /**< Number of events refused for being over the limit */
+  uintmax_t when;  /**< When last recorded; monotonic time in milliseconds */
+};
+
+/** Number of events per key over a sliding window, at fixed memory */
+struct RateSketch
+{
+  const char *name;  /**< Shown by STATS w */
+  void (*format)(const struct RateTop *, char *, size_t);  /**< Turns a key into something readable */
+  bool casefold;  /**< Keys are IRC names that differ in case only */
+  uint64_t seed;  /**< Keeps keys that collide unpredictable */
+  uintmax_t window;  /**< Length of a window in milliseconds */
+  uintmax_t epoch;  /**< Number of the window the current counters belong to */
+  uintmax_t events;  /**< Number of events counted in total */
+  uintmax_t rejected;  /**< Number of events refused for being over the limit */
+  unsigned short counter[2][RATE_DEPTH][RATE_WIDTH];  /**< Counters of the current and the previous window */
+  struct RateTop top[RATE_TOP];  /**< Busiest keys seen recently */
+};
+
+extern struct RateSketch rate_sources;
+extern struct RateSketch rate_targets;
+extern struct RateSketch rate_prefixes;
+extern struct RateSketch rate_connects;
+
+extern unsigned int ratelimit_hit(struct RateSketch *, unsigned int, unsigned int, const void *, size_t);
+extern unsigned int ratelimit_estimate(struct RateSketch *, unsigned int, const void *, size_t);
+extern size_t ratelimit_prefix_key(const struct irc_ssaddr *, unsigned char *);
+extern void ratelimit_report(struct Client *);
+extern void ratelimit_get_stats(unsigned int *const, size_t *const);
+extern void ratelimit_init(void);
+#endif  /* INCLUDED_ratelimit_h */
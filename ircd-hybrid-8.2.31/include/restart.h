@@ -28,4 +28,5 @@
 #define INCLUDED_restart_h
 
 extern void server_die(const char *, bool);
+extern void server_upgrade(const char *);
 #endif  /* INCLUDED_restart_h */
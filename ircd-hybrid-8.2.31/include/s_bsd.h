@@ -49,6 +49,9 @@ enum
 /* How long can comm_select() wait for network events [milliseconds] */
 enum { SELECT_DELAY = 500 };
 
+/* How long a new connection may stay silent before it is dropped [seconds] */
+enum { ACCEPT_IDLE_TIMEOUT = 30 };
+
 struct Client;
 struct Listener;
 
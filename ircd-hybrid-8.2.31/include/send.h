@@ -27,6 +27,8 @@
 #ifndef INCLUDED_send_h
 #define INCLUDED_send_h
 
+#include "list.h"
+#include "dbuf.h"
 #include "fdlist.h"
 #include "numeric.h"
 
@@ -44,6 +46,24 @@ enum
   SEND_LOCOPS
 };
 
+/* Number of bytes queued per recipient before flushing a netsplit or netjoin
+ * batch, and the sendq size at which send_message() writes right away instead
+ * of leaving it to send_queued_all() */
+enum { BATCH_FLUSH_SIZE = 16384 };
+
+/* Parts of a ChannelBatch, sent in this order */
+enum
+{
+  BATCH_JOIN,           /* JOINs for clients without extended-join */
+  BATCH_JOIN_EXTENDED,  /* JOINs for clients with extended-join */
+  BATCH_AWAY,           /* AWAYs for clients with away-notify */
+  BATCH_MODE,           /* MODEs for everybody */
+  BATCH_PARTS
+};
+
+/* Most forms of one message sendto_server_variants() can send */
+enum { SERVER_VARIANT_MAX = 4 };
+
 /* Used when sending to $#mask or $$mask */
 enum
 {
@@ -57,21 +77,73 @@ enum
 struct Channel;
 struct Client;
 
+/** A numeric whose parameters have been formatted in advance. */
+struct ReplyLine
+{
+  dlink_node node;  /**< Next line in Reply::lines. */
+  enum irc_numerics numeric;  /**< Numeric to send the line as. */
+  size_t len;  /**< Length of ReplyLine::text. */
+  char text[];  /**< Everything following the recipient's name. */
+};
+
+/** A sequence of preformatted numerics, such as the MOTD, optionally followed
+ *  by a line that is set anew for every recipient, such as the lines of NAMES,
+ *  WHO and LIST. */
+struct Reply
+{
+  dlink_list lines;  /**< List of ReplyLine items. */
+  size_t len;  /**< Sum of the ReplyLine::len of all lines. */
+  enum irc_numerics body_numeric;  /**< Numeric to send Reply::body as; 0 if there is no body. */
+  size_t body_len;  /**< Length of Reply::body. */
+  char body[IRCD_BUFSIZE];  /**< Parameters set by reply_body(), sent after Reply::lines. */
+};
+
+/** One form of a message to servers, for links with a given combination of
+ *  capabilities. A list of them ends with an item whose format is NULL. */
+struct ServerVariant
+{
+  unsigned int caps;  /**< Capabilities a link needs to get this form. */
+  unsigned int nocaps;  /**< Capabilities a link must not have to get this form. */
+  const char *format;  /**< Format string; all forms of a message take the same arguments. */
+};
+
+/** Lines for the local members of a channel, queued with channel_batch_add()
+ *  and sent by sendto_channel_batch() in a single pass over the members. */
+struct ChannelBatch
+{
+  struct dbuf_queue part[BATCH_PARTS];  /**< Text of each part. */
+  unsigned int lines[BATCH_PARTS];  /**< Number of lines in each part. */
+};
+
 /* send.c prototypes */
+extern bool exceeding_sendq(const struct Client *);
 extern void sendq_unblocked(fde_t *, void *);
 extern void send_queued_write(struct Client *);
+extern void send_queued_all(void);
+extern void send_queued_cancel(struct Client *);
 extern void sendto_one(struct Client *, const char *, ...) AFP(2,3);
 extern void sendto_one_numeric(struct Client *, const struct Client *, enum irc_numerics, ...);
+extern void sendto_one_variants(struct Client *, const struct ServerVariant *, ...);
+extern void sendto_one_reply(struct Client *, const struct Reply *);
+extern void reply_add(struct Reply *, enum irc_numerics, ...);
+extern void reply_clear(struct Reply *);
+extern void reply_body(struct Reply *, enum irc_numerics, ...);
+extern size_t reply_body_room(const struct Client *, const struct Reply *);
 extern void sendto_one_notice(struct Client *, const struct Client *, const char *, ...) AFP(3,4);
 extern void sendto_channel_butone(struct Client *, const struct Client *,
                                   struct Channel *, unsigned int,
                                   const char *, ...) AFP(5,6);
+extern void sendto_split_quits(struct Client *const *, unsigned int, const char *);
+extern void channel_batch_add(struct ChannelBatch *, unsigned int, const char *, ...) AFP(3,4);
+extern void sendto_channel_batch(struct Channel *, struct ChannelBatch *);
 extern void sendto_common_channels_local(struct Client *, bool, unsigned int, unsigned int,
                                          const char *, ...) AFP(5,6);
 extern void sendto_channel_local(const struct Client *, struct Channel *, unsigned int,
                                  unsigned int, unsigned int, const char *, ...)  AFP(6,7);
+extern void send_links_changed(void);
 extern void sendto_server(const struct Client *, const unsigned int,
                           const unsigned int, const char *, ...) AFP(4,5);
+extern void sendto_server_variants(const struct Client *, const struct ServerVariant *, ...);
 extern void sendto_match_butone(const struct Client *, const struct Client *,
                                 const char *, int, const char *, ...) AFP(5,6);
 extern void sendto_match_servs(const struct Client *, const char *, unsigned int,
@@ -0,0 +1,38 @@
+/*
+ *  ircd-hybrid: an advanced, lightweight Internet Relay Chat Daemon (ircd)
+ *
+ *  Copyright (c) 2020 ircd-hybrid development team
+ *
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301
+ *  USA
+ */
+
+/*! \file throttle.h
+ * \brief Rate limiting of incoming connections per network prefix.
+ * \version $Id$
+ */
+
+#ifndef INCLUDED_throttle_h
+#define INCLUDED_throttle_h
+
+#include "ircd_defs.h"
+
+/** Default number of connections per second a prefix gets back. 0 disables the limiter. */
+enum { THROTTLE_RATE = 10 };
+/** Default number of connections a prefix may make in a burst */
+enum { THROTTLE_BURST = 60 };
+
+extern bool throttle_check(const struct irc_ssaddr *);
+#endif  /* INCLUDED_throttle_h */
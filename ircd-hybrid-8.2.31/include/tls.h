@@ -40,6 +40,9 @@
 #endif
 
 enum { TLS_HANDSHAKE_TIMEOUT = 5 };  /**< Time in seconds for the TLS handshake to time out */
+enum { TLS_TICKET_KEY_ROTATE = 3600 };  /**< Time in seconds after which a new session ticket key is generated */
+enum { TLS_SESSION_TIMEOUT = TLS_TICKET_KEY_ROTATE };  /**< Lifetime in seconds of cached sessions and session tickets */
+enum { TLS_SESSION_CACHE_SIZE = 20480 };  /**< Default size of the server side session cache */
 
 typedef enum _tls_role
 {
@@ -67,6 +70,9 @@ extern bool tls_new(tls_data_t *, int, tls_role_t);
 extern void tls_free(tls_data_t *);
 
 extern tls_handshake_status_t tls_handshake(tls_data_t *, tls_role_t, const char **);
+extern bool tls_session_reused(tls_data_t *);
+extern void tls_set_session_cache(unsigned int);
+extern void tls_rotate_ticket_keys(void *);
 extern ssize_t tls_read(tls_data_t *, char *, size_t, bool *);
 extern ssize_t tls_write(tls_data_t *, const char *, size_t, bool *);
 
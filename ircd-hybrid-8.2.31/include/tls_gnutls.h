@@ -48,6 +48,7 @@ struct gnutls_context
   gnutls_certificate_credentials_t x509_cred;
   gnutls_priority_t priorities;
   gnutls_dh_params_t dh_params;
+  gnutls_datum_t ticket_key;  /**< Master key used to encrypt session tickets */
   unsigned int refs;
 };
 
@@ -0,0 +1,41 @@
+/*
+ *  ircd-hybrid: an advanced, lightweight Internet Relay Chat Daemon (ircd)
+ *
+ *  Copyright (c) 2020 ircd-hybrid development team
+ *
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301
+ *  USA
+ */
+
+/*! \file upgrade.h
+ * \brief Hands listeners, clients and channels over to a newly executed ircd.
+ * \version $Id$
+ */
+
+#ifndef INCLUDED_upgrade_h
+#define INCLUDED_upgrade_h
+
+#include "ircd_defs.h"
+
+/** Maximum number of listening sockets that can be handed over */
+enum { UPGRADE_LISTENERS_MAX = 64 };
+
+extern bool upgrade_save(const char *);
+extern void upgrade_set_cloexec(void);
+extern void upgrade_cancel(const char *);
+extern void upgrade_load(const char *);
+extern int upgrade_listener_take(const struct irc_ssaddr *);
+extern void upgrade_restore(void);
+#endif  /* INCLUDED_upgrade_h */
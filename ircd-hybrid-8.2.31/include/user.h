@@ -27,6 +27,8 @@
 #ifndef INCLUDED_user_h
 #define INCLUDED_user_h
 
+#include "send.h"
+
 struct Client;
 
 enum
@@ -42,11 +44,13 @@ struct user_modes
 
 extern const struct user_modes *umode_map[];
 extern const struct user_modes  umode_tab[];
+extern const struct ServerVariant uid_variants[];
 
 extern void user_modes_init(void);
 extern void send_umode(struct Client *, bool, unsigned int, char *);
 extern void send_umode_out(struct Client *, unsigned int);
 extern void show_lusers(struct Client *);
+extern void show_who(struct Client *, const struct Client *, const char *, const char *);
 
 extern void register_local_user(struct Client *);
 extern void register_remote_user(struct Client *);
@@ -43,6 +43,5 @@ extern void watch_add_to_hash_table(const char *, struct Client *);
 extern void watch_del_from_hash_table(const char *, struct Client *);
 extern void watch_check_hash(const struct Client *, const enum irc_numerics);
 extern void watch_del_watch_list(struct Client *);
-extern void watch_count_memory(unsigned int *const, size_t *const);
 extern struct Watch *watch_find_hash(const char *);
 #endif  /* INCLUDED_watch_h */
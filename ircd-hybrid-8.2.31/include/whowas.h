@@ -34,7 +34,7 @@
 struct Whowas
 {
   dlink_node hnode;  /**< List node; linked into whowas_hash */
-  dlink_node cnode;  /**< List node; linked into client->whowas_list */
+  dlink_node cnode;  /**< List node; linked into client->cold->whowas_list */
   dlink_node lnode;  /**< List node; linked into whowas_list */
   unsigned int hash_value;  /**< Hash value derived from Whowas::name */
   uintmax_t logoff;  /**< When the client logged off; real time */
@@ -42,11 +42,11 @@ struct Whowas
   char account[ACCOUNTLEN + 1];  /**< Services account */
   char name[NICKLEN + 1];  /**< Client's nick name */
   char username[USERLEN + 1];  /**< Client's user name */
-  char hostname[HOSTLEN + 1];  /**< Client's host name */
-  char realhost[HOSTLEN + 1];  /**< Client's real host name */
-  char sockhost[HOSTIPLEN + 1];  /**< Client's IP address as string */
+  const char *hostname;  /**< Client's host name; interned */
+  const char *realhost;  /**< Client's real host name; interned */
+  const char *sockhost;  /**< Client's IP address as string; interned */
   char realname[REALLEN + 1];  /**< Client's real name/gecos */
-  char servername[HOSTLEN + 1];  /**< Name of the server the client is using */
+  const char *servername;  /**< Name of the server the client is using; interned */
   struct Client *online;  /**< Pointer to new nick name for chasing or NULL */
 };
 
@@ -55,5 +55,4 @@ extern void whowas_trim(void);
 extern void whowas_add_history(struct Client *, bool);
 extern void whowas_off_history(struct Client *);
 extern struct Client *whowas_get_history(const char *, uintmax_t);
-extern void whowas_count_memory(unsigned int *const, size_t *const);
 #endif  /* INCLUDED_whowas_h */
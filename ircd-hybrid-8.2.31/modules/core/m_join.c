@@ -195,16 +195,16 @@ ms_join(struct Client *source_p, int parc, char *parv[])
 
     sendto_channel_local(NULL, channel, 0, CAP_EXTENDED_JOIN, 0, ":%s!%s@%s JOIN %s %s :%s",
                          source_p->name, source_p->username,
-                         source_p->host, channel->name, source_p->account, source_p->info);
+                         source_p->host, channel->name, source_p->cold->account, source_p->cold->info);
     sendto_channel_local(NULL, channel, 0, 0, CAP_EXTENDED_JOIN, ":%s!%s@%s JOIN :%s",
                          source_p->name, source_p->username,
                          source_p->host, channel->name);
 
-    if (source_p->away[0])
+    if (source_p->cold->away)
       sendto_channel_local(source_p, channel, 0, CAP_AWAY_NOTIFY, 0,
                            ":%s!%s@%s AWAY :%s",
                            source_p->name, source_p->username,
-                           source_p->host, source_p->away);
+                           source_p->host, source_p->cold->away);
   }
 
   sendto_server(source_p, 0, 0, ":%s JOIN %ju %s +",
@@ -332,7 +332,6 @@ remove_our_modes(struct Channel *channel, struct Client *source_p)
 static void
 remove_a_mode(struct Channel *channel, struct Client *source_p, int mask, const char flag)
 {
-  dlink_node *node = NULL;
   char lmodebuf[MODEBUFLEN];
   char sendbuf[MODEBUFLEN];
   const char *lpara[MAXMODEPARAMS];
@@ -346,9 +345,9 @@ remove_a_mode(struct Channel *channel, struct Client *source_p, int mask, const
 
   sendbuf[0] = '\0';
 
-  DLINK_FOREACH(node, channel->members.head)
+  for (unsigned int i = 0; i < channel->members.count; ++i)
   {
-    struct ChannelMember *member = node->data;
+    struct ChannelMember *member = channel->members.entry[i].member;
 
     if ((member->flags & mask) == 0)
       continue;
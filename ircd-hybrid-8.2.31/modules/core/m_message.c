@@ -39,6 +39,7 @@
 #include "irc_string.h"
 #include "hash.h"
 #include "packet.h"
+#include "ratelimit.h"
 
 
 enum
@@ -107,17 +108,13 @@ flood_attack_client(bool notice, struct Client *source_p, struct Client *target_
   if (HasFlag(source_p, FLAGS_SERVICE | FLAGS_CANFLOOD))
     return false;
 
-  if (target_p->connection->first_received_message_time + GlobalSetOptions.floodtime < event_base->time.sec_monotonic)
-  {
-    if (target_p->connection->received_number_of_privmsgs)
-      target_p->connection->received_number_of_privmsgs = 0;
-    else
-      DelFlag(target_p, FLAGS_FLOOD_NOTICED);
-
-    target_p->connection->first_received_message_time = event_base->time.sec_monotonic;
-  }
+  const unsigned int count = ratelimit_hit(&rate_targets, GlobalSetOptions.floodtime,
+                                           GlobalSetOptions.floodcount,
+                                           target_p->id, strlen(target_p->id));
+  if (count == 0)
+    DelFlag(target_p, FLAGS_FLOOD_NOTICED);
 
-  if (target_p->connection->received_number_of_privmsgs >= GlobalSetOptions.floodcount)
+  if (count >= GlobalSetOptions.floodcount)
   {
     if (!HasFlag(target_p, FLAGS_FLOOD_NOTICED))
     {
@@ -133,10 +130,57 @@ flood_attack_client(bool notice, struct Client *source_p, struct Client *target_
     return true;
   }
 
-  ++target_p->connection->received_number_of_privmsgs;
   return false;
 }
 
+/* flood_attack_source()
+ *
+ * inputs       - flag 0 if PRIVMSG 1 if NOTICE. RFC
+ *                says NOTICE must not auto reply
+ *              - pointer to source Client
+ * output       - 1 if source or its network prefix is flooding
+ * side effects - the message is counted against the sending client and
+ *                against the network prefix it comes from
+ */
+static bool
+flood_attack_source(bool notice, struct Client *source_p)
+{
+  unsigned char key[RATE_PREFIX_KEYLEN];
+
+  if (!(GlobalSetOptions.floodcount && GlobalSetOptions.floodtime))
+    return false;
+
+  if (HasUMode(source_p, UMODE_OPER))
+    return false;
+
+  if (HasFlag(source_p, FLAGS_SERVICE | FLAGS_CANFLOOD))
+    return false;
+
+  /* Messages from remote clients are counted, but only local ones are refused */
+  const bool local = MyClient(source_p);
+  const unsigned int limit = GlobalSetOptions.floodcount;
+  const unsigned int prefix_limit = limit * RATE_PREFIX_SOURCES;
+
+  bool flood = ratelimit_hit(&rate_sources, GlobalSetOptions.floodtime, local ? limit : 0,
+                             source_p->id, strlen(source_p->id)) >= limit;
+
+  if (flood == false || local == false)
+  {
+    const size_t len = ratelimit_prefix_key(&source_p->ip, key);
+
+    if (len && ratelimit_hit(&rate_prefixes, GlobalSetOptions.floodtime, local ? prefix_limit : 0,
+                             key, len) >= prefix_limit)
+      flood = true;
+  }
+
+  if (flood == false || local == false)
+    return false;
+
+  if (notice == false)
+    sendto_one_notice(source_p, &me, ":*** Message throttled due to flooding");
+  return true;
+}
+
 /* flood_attack_channel()
  *
  * inputs       - flag 0 if PRIVMSG 1 if NOTICE. RFC
@@ -158,17 +202,14 @@ flood_attack_channel(bool notice, struct Client *source_p, struct Channel *chann
   if (HasFlag(source_p, FLAGS_SERVICE | FLAGS_CANFLOOD))
     return false;
 
-  if (channel->first_received_message_time + GlobalSetOptions.floodtime < event_base->time.sec_monotonic)
-  {
-    if (channel->received_number_of_privmsgs)
-      channel->received_number_of_privmsgs = 0;
-    else
-      ClearFloodNoticed(channel);
-
-    channel->first_received_message_time = event_base->time.sec_monotonic;
-  }
+  /* Messages from remote clients are counted, but only local ones are refused */
+  const unsigned int count = ratelimit_hit(&rate_targets, GlobalSetOptions.floodtime,
+                                           MyClient(source_p) ? GlobalSetOptions.floodcount : 0,
+                                           channel->name, strlen(channel->name));
+  if (count == 0)
+    ClearFloodNoticed(channel);
 
-  if (channel->received_number_of_privmsgs >= GlobalSetOptions.floodcount)
+  if (count >= GlobalSetOptions.floodcount)
   {
     if (!IsSetFloodNoticed(channel))
     {
@@ -187,7 +228,6 @@ flood_attack_channel(bool notice, struct Client *source_p, struct Channel *chann
     }
   }
 
-  ++channel->received_number_of_privmsgs;
   return false;
 }
 
@@ -253,8 +293,8 @@ msg_client(bool notice, struct Client *source_p, struct Client *target_p,
 {
   if (MyClient(source_p))
   {
-    if (target_p->away[0] && notice == false)
-      sendto_one_numeric(source_p, &me, RPL_AWAY, target_p->name, target_p->away);
+    if (target_p->cold->away && notice == false)
+      sendto_one_numeric(source_p, &me, RPL_AWAY, target_p->name, target_p->cold->away);
 
     if (HasUMode(target_p, UMODE_REGONLY) && target_p != source_p)
     {
@@ -575,6 +615,9 @@ m_message(bool notice, struct Client *source_p, int parc, char *parv[])
 
   build_target_list(notice, source_p, parv[1], parv[2]);
 
+  if (ntargets && IsClient(source_p) && flood_attack_source(notice, source_p) == true)
+    return;
+
   for (unsigned int i = 0; i < ntargets; ++i)
   {
     switch (targets[i].type)
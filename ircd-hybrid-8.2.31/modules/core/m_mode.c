@@ -119,7 +119,7 @@ set_user_mode(struct Client *source_p, const int parc, char *parv[])
           {
             dlink_node *node;
 
-            svstag_detach(&source_p->svstags, RPL_WHOISOPERATOR);
+            svstag_detach(&source_p->cold->svstags, RPL_WHOISOPERATOR);
             conf_detach(source_p, CONF_OPER);
 
             ClrOFlag(source_p);
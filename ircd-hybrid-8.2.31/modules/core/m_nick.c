@@ -29,6 +29,7 @@
 #include "hash.h"
 #include "fdlist.h"
 #include "irc_string.h"
+#include "intern.h"
 #include "ircd.h"
 #include "numeric.h"
 #include "conf.h"
@@ -345,24 +346,24 @@ uid_from_server(struct Client *source_p, int parc, char *parv[])
   client_p->tsinfo = strtoumax(parv[3], NULL, 10);
 
   strlcpy(client_p->name, parv[1], sizeof(client_p->name));
-  strlcpy(client_p->info, parv[parc - 1], sizeof(client_p->info));
-  strlcpy(client_p->host, parv[6], sizeof(client_p->host));
+  strlcpy(client_p->cold->info, parv[parc - 1], sizeof(client_p->cold->info));
+  intern_set(&client_p->host, parv[6], HOSTLEN);
   strlcpy(client_p->username, parv[5], sizeof(client_p->username));
 
   /* TBR: compatibility mode */
   const int does_rhost = parc == 12;
 
-  strlcpy(client_p->realhost, parv[6 + does_rhost], sizeof(client_p->realhost));
-  strlcpy(client_p->sockhost, parv[7 + does_rhost], sizeof(client_p->sockhost));
+  intern_set(&client_p->cold->realhost, parv[6 + does_rhost], HOSTLEN);
+  intern_set(&client_p->cold->sockhost, parv[7 + does_rhost], HOSTIPLEN);
   strlcpy(client_p->id, parv[8 + does_rhost], sizeof(client_p->id));
-  strlcpy(client_p->account, parv[9 + does_rhost], sizeof(client_p->account));
+  strlcpy(client_p->cold->account, parv[9 + does_rhost], sizeof(client_p->cold->account));
 
   struct addrinfo hints, *res;
   memset(&hints, 0, sizeof(hints));
   hints.ai_family = AF_UNSPEC;
   hints.ai_flags = AI_PASSIVE | AI_NUMERICHOST;
 
-  if (getaddrinfo(client_p->sockhost, NULL, &hints, &res) == 0)
+  if (getaddrinfo(client_p->cold->sockhost, NULL, &hints, &res) == 0)
   {
     memcpy(&client_p->ip, res->ai_addr, res->ai_addrlen);
     client_p->ip.ss_len = res->ai_addrlen;
@@ -467,7 +468,7 @@ perform_uid_introduction_collides(struct Client *source_p, struct Client *target
 
   /* The timestamps are different */
   bool sameuser = irccmp(target_p->username, parv[5]) == 0 &&
-                  irccmp(target_p->sockhost, parv[7 + does_rhost]) == 0;
+                  irccmp(target_p->cold->sockhost, parv[7 + does_rhost]) == 0;
 
   /*
    * If the users are the same (loaded a client on a different server)
@@ -552,7 +553,7 @@ perform_nick_change_collides(struct Client *source_p, struct Client *target_p,
 
   /* The timestamps are different */
   bool sameuser = irccmp(target_p->username, source_p->username) == 0 &&
-                  irccmp(target_p->sockhost, source_p->sockhost) == 0;
+                  irccmp(target_p->cold->sockhost, source_p->cold->sockhost) == 0;
 
   if ((sameuser == true && newts < target_p->tsinfo) || (sameuser == false && newts > target_p->tsinfo))
   {
@@ -130,32 +130,22 @@ server_send_client(struct Client *client_p, struct Client *target_p)
     buf[1] = '\0';
   }
 
-    /* TBR: compatibility mode */
-  if (IsCapable(client_p, CAPAB_RHOST))
-    sendto_one(client_p, ":%s UID %s %u %ju %s %s %s %s %s %s %s :%s",
-               target_p->servptr->id,
-               target_p->name, target_p->hopcount + 1,
-               target_p->tsinfo,
-               buf, target_p->username, target_p->host, target_p->realhost,
-               target_p->sockhost, target_p->id,
-               target_p->account, target_p->info);
-  else
-    sendto_one(client_p, ":%s UID %s %u %ju %s %s %s %s %s %s :%s",
-               target_p->servptr->id,
-               target_p->name, target_p->hopcount + 1,
-               target_p->tsinfo,
-               buf, target_p->username, target_p->host,
-               target_p->sockhost, target_p->id,
-               target_p->account, target_p->info);
+  sendto_one_variants(client_p, uid_variants,
+                      target_p->servptr->id,
+                      target_p->name, target_p->hopcount + 1,
+                      target_p->tsinfo,
+                      buf, target_p->username, target_p->host, target_p->cold->realhost,
+                      target_p->cold->sockhost, target_p->id,
+                      target_p->cold->account, target_p->cold->info);
 
-  if (!EmptyString(target_p->certfp))
-    sendto_one(client_p, ":%s CERTFP %s", target_p->id, target_p->certfp);
+  if (!EmptyString(target_p->cold->certfp))
+    sendto_one(client_p, ":%s CERTFP %s", target_p->id, target_p->cold->certfp);
 
-  if (target_p->away[0])
-    sendto_one(client_p, ":%s AWAY :%s", target_p->id, target_p->away);
+  if (target_p->cold->away)
+    sendto_one(client_p, ":%s AWAY :%s", target_p->id, target_p->cold->away);
 
 
-  DLINK_FOREACH(node, target_p->svstags.head)
+  DLINK_FOREACH(node, target_p->cold->svstags.head)
   {
     const struct ServicesTag *svstag = node->data;
     char *m = buf;
@@ -193,7 +183,7 @@ server_burst(struct Client *client_p)
   {
     const struct Channel *channel = node->data;
 
-    if (dlink_list_length(&channel->members))
+    if (channel->members.count)
     {
       channel_send_modes(client_p, channel);
 
@@ -234,7 +224,7 @@ server_estab(struct Client *client_p)
     sendto_one(client_p, "CAPAB :%s", capab_get(NULL));
 
     sendto_one(client_p, "SERVER %s 1 :%s%s",
-               me.name, ConfigServerHide.hidden ? "(H) " : "", me.info);
+               me.name, ConfigServerHide.hidden ? "(H) " : "", me.cold->info);
   }
 
   sendto_one(client_p, ":%s SVINFO %u %u 0 :%ju", me.id, TS_CURRENT, TS_MIN,
@@ -251,6 +241,7 @@ server_estab(struct Client *client_p)
   assert(dlinkFind(&unknown_list, client_p));
   dlink_move_node(&client_p->connection->lclient_node,
                   &unknown_list, &local_server_list);
+  send_links_changed();
 
   dlinkAdd(client_p, &client_p->node, &global_server_list);
 
@@ -308,7 +299,7 @@ server_estab(struct Client *client_p)
 
   sendto_server(client_p, 0, 0, ":%s SID %s 2 %s :%s%s",
                 me.id, client_p->name, client_p->id,
-                IsHidden(client_p) ? "(H) " : "", client_p->info);
+                IsHidden(client_p) ? "(H) " : "", client_p->cold->info);
 
   /*
    * Pass on my client information to the new server
@@ -336,7 +327,7 @@ server_estab(struct Client *client_p)
     sendto_one(client_p, ":%s SID %s %u %s :%s%s",
                target_p->servptr->id, target_p->name, target_p->hopcount+1,
                target_p->id, IsHidden(target_p) ? "(H) " : "",
-               target_p->info);
+               target_p->cold->info);
   }
 
   server_burst(client_p);
@@ -375,9 +366,9 @@ server_set_gecos(struct Client *client_p, const char *info)
   }
 
   if (!EmptyString(s))
-    strlcpy(client_p->info, s, sizeof(client_p->info));
+    strlcpy(client_p->cold->info, s, sizeof(client_p->cold->info));
   else
-    strlcpy(client_p->info, "(Unknown Location)", sizeof(client_p->info));
+    strlcpy(client_p->cold->info, "(Unknown Location)", sizeof(client_p->cold->info));
 }
 
 enum
@@ -408,13 +399,13 @@ server_check(const char *name, struct Client *client_p)
     error = SERVER_CHECK_INVALID_HOST;
 
     if (!irccmp(conf->host, client_p->host) ||
-        !irccmp(conf->host, client_p->sockhost))
+        !irccmp(conf->host, client_p->cold->sockhost))
     {
       if (match_conf_password(client_p->connection->password, conf) == false)
         return SERVER_CHECK_INVALID_PASSWORD;
 
       if (!EmptyString(conf->certfp))
-        if (EmptyString(client_p->certfp) || strcasecmp(client_p->certfp, conf->certfp))
+        if (EmptyString(client_p->cold->certfp) || strcasecmp(client_p->cold->certfp, conf->certfp))
           return SERVER_CHECK_INVALID_CERTIFICATE;
 
       conf_attach(client_p, conf);
@@ -579,7 +570,7 @@ mr_server(struct Client *source_p, int parc, char *parv[])
   if (parc == 6)  /* TBR: compatibility 'mode' */
   {
     strlcpy(source_p->id, sid, sizeof(source_p->id));
-    strlcpy(source_p->info, parv[parc - 1], sizeof(source_p->info));
+    strlcpy(source_p->cold->info, parv[parc - 1], sizeof(source_p->cold->info));
     server_set_flags(source_p, parv[4]);
   }
   else
@@ -764,7 +755,7 @@ ms_sid(struct Client *source_p, int parc, char *parv[])
 
   if (parc == 6)  /* TBR: compatibility 'mode' */
   {
-    strlcpy(target_p->info, parv[parc - 1], sizeof(target_p->info));
+    strlcpy(target_p->cold->info, parv[parc - 1], sizeof(target_p->cold->info));
     server_set_flags(target_p, parv[4]);
   }
   else
@@ -783,7 +774,7 @@ ms_sid(struct Client *source_p, int parc, char *parv[])
 
   sendto_server(source_p->from, 0, 0, ":%s SID %s %u %s :%s%s",
                 source_p->id, target_p->name, target_p->hopcount + 1,
-                target_p->id, IsHidden(target_p) ? "(H) " : "", target_p->info);
+                target_p->id, IsHidden(target_p) ? "(H) " : "", target_p->cold->info);
   sendto_realops_flags(UMODE_EXTERNAL, L_ALL, SEND_NOTICE,
                        "Server %s being introduced by %s",
                        target_p->name, source_p->name);
@@ -47,6 +47,38 @@ static void remove_our_modes(struct Channel *, struct Client *);
 static void remove_a_mode(struct Channel *, struct Client *, int, char);
 static void remove_ban_list(struct Channel *, struct Client *, dlink_list *, char);
 
+/* Lines for local members, sent once per SJOIN by sendto_channel_batch() */
+static struct ChannelBatch batch;
+
+
+/* sjoin_is_member()
+ *
+ * inputs	- client named in an SJOIN
+ *		- channel being joined
+ *		- whether the SJOIN created the channel
+ * output	- true if the client already is on the channel
+ * side effects	- NONE
+ *
+ * add_user_to_channel() puts the new membership at the head of the
+ * client's channel list and an SJOIN only ever adds members to a single
+ * channel, so if the channel was created by this very SJOIN, the only
+ * way for the client to already be on it is a duplicate entry in the
+ * nick list, which is found by looking at that head alone. Otherwise
+ * find_channel_link() walks the shorter of both lists, which for a
+ * bursted client is its own short channel list rather than the channel.
+ */
+static bool
+sjoin_is_member(const struct Client *client, const struct Channel *channel, bool isnew)
+{
+  if (isnew == true)
+  {
+    const dlink_node *node = client->channel.head;
+    return node && ((const struct ChannelMember *)node->data)->channel == channel;
+  }
+
+  return IsMember(client, channel);
+}
+
 
 /* ms_sjoin()
  *
@@ -58,7 +90,9 @@ static void remove_ban_list(struct Channel *, struct Client *, dlink_list *, cha
  *
  * process a SJOIN, taking the TS's into account to either ignore the
  * incoming modes or undo the existing ones or merge them, and JOIN
- * all the specified users while sending JOIN/MODEs to local clients
+ * all the specified users while sending JOIN/MODEs to local clients.
+ * The JOIN, AWAY and MODE lines are collected for the whole nick list
+ * and sent to the local members with a single sendto_channel_batch().
  */
 static void
 ms_sjoin(struct Client *source_p, int parc, char *parv[])
@@ -203,7 +237,7 @@ ms_sjoin(struct Client *source_p, int parc, char *parv[])
     remove_ban_list(channel, source_p, &channel->exceptlist, 'e');
     remove_ban_list(channel, source_p, &channel->invexlist, 'I');
 
-    clear_ban_cache_list(&channel->members_local);
+    clear_ban_cache_channel(channel);
     invite_clear_list(&channel->invites);
 
     if (channel->topic[0])
@@ -346,22 +380,21 @@ ms_sjoin(struct Client *source_p, int parc, char *parv[])
 
     uid_ptr += sprintf(uid_ptr, "%s%s ", uid_prefix, target_p->id);
 
-    if (!IsMember(target_p, channel))
+    if (sjoin_is_member(target_p, channel, isnew) == false)
     {
       add_user_to_channel(channel, target_p, fl, have_many_uids == false);
 
-      sendto_channel_local(NULL, channel, 0, CAP_EXTENDED_JOIN, 0, ":%s!%s@%s JOIN %s %s :%s",
-                           target_p->name, target_p->username,
-                           target_p->host, channel->name, target_p->account, target_p->info);
-      sendto_channel_local(NULL, channel, 0, 0, CAP_EXTENDED_JOIN, ":%s!%s@%s JOIN :%s",
-                           target_p->name, target_p->username,
-                           target_p->host, channel->name);
-
-      if (target_p->away[0])
-        sendto_channel_local(target_p, channel, 0, CAP_AWAY_NOTIFY, 0,
-                             ":%s!%s@%s AWAY :%s",
-                             target_p->name, target_p->username,
-                             target_p->host, target_p->away);
+      channel_batch_add(&batch, BATCH_JOIN_EXTENDED, ":%s!%s@%s JOIN %s %s :%s",
+                        target_p->name, target_p->username,
+                        target_p->host, channel->name, target_p->cold->account, target_p->cold->info);
+      channel_batch_add(&batch, BATCH_JOIN, ":%s!%s@%s JOIN :%s",
+                        target_p->name, target_p->username,
+                        target_p->host, channel->name);
+
+      if (target_p->cold->away)
+        channel_batch_add(&batch, BATCH_AWAY, ":%s!%s@%s AWAY :%s",
+                          target_p->name, target_p->username,
+                          target_p->host, target_p->cold->away);
     }
 
     if (fl & CHFL_CHANOP)
@@ -389,8 +422,8 @@ ms_sjoin(struct Client *source_p, int parc, char *parv[])
           sptr += slen;  /* ready for next */
         }
 
-        sendto_channel_local(NULL, channel, 0, 0, 0, ":%s MODE %s %s%s",
-                             servername, channel->name, modebuf, sendbuf);
+        channel_batch_add(&batch, BATCH_MODE, ":%s MODE %s %s%s",
+                          servername, channel->name, modebuf, sendbuf);
         mbuf = modebuf;
         *mbuf++ = '+';
 
@@ -415,8 +448,8 @@ ms_sjoin(struct Client *source_p, int parc, char *parv[])
           sptr += slen;
         }
 
-        sendto_channel_local(NULL, channel, 0, 0, 0, ":%s MODE %s %s%s",
-                             servername, channel->name, modebuf, sendbuf);
+        channel_batch_add(&batch, BATCH_MODE, ":%s MODE %s %s%s",
+                          servername, channel->name, modebuf, sendbuf);
 
         mbuf = modebuf;
         *mbuf++ = '+';
@@ -442,8 +475,8 @@ ms_sjoin(struct Client *source_p, int parc, char *parv[])
           sptr += slen;
         }
 
-        sendto_channel_local(NULL, channel, 0, 0, 0, ":%s MODE %s %s%s",
-                             servername, channel->name, modebuf, sendbuf);
+        channel_batch_add(&batch, BATCH_MODE, ":%s MODE %s %s%s",
+                          servername, channel->name, modebuf, sendbuf);
 
         mbuf = modebuf;
         *mbuf++ = '+';
@@ -490,10 +523,12 @@ ms_sjoin(struct Client *source_p, int parc, char *parv[])
       sptr += slen;
     }
 
-    sendto_channel_local(NULL, channel, 0, 0, 0, ":%s MODE %s %s%s",
-                         servername, channel->name, modebuf, sendbuf);
+    channel_batch_add(&batch, BATCH_MODE, ":%s MODE %s %s%s",
+                      servername, channel->name, modebuf, sendbuf);
   }
 
+  sendto_channel_batch(channel, &batch);
+
   /*
    * If this happens, it's the result of a malformed SJOIN
    * a remnant from the old persistent channel code. *sigh*
@@ -501,7 +536,7 @@ ms_sjoin(struct Client *source_p, int parc, char *parv[])
    * and leaving us with a channel formed just as the client parts.
    * - Dianora
    */
-  if (dlink_list_length(&channel->members) == 0 && isnew == true)
+  if (channel->members.count == 0 && isnew == true)
   {
     channel_free(channel);
     return;
@@ -602,7 +637,6 @@ static void
 remove_a_mode(struct Channel *channel, struct Client *source_p,
              int mask, char flag)
 {
-  dlink_node *node = NULL;
   char lmodebuf[MODEBUFLEN];
   char sendbuf[MODEBUFLEN];
   char *sp = sendbuf;
@@ -614,9 +648,9 @@ remove_a_mode(struct Channel *channel, struct Client *source_p,
   *mbuf++ = '-';
   *sp = '\0';
 
-  DLINK_FOREACH(node, channel->members.head)
+  for (unsigned int i = 0; i < channel->members.count; ++i)
   {
-    struct ChannelMember *member = node->data;
+    struct ChannelMember *member = channel->members.entry[i].member;
 
     if ((member->flags & mask) == 0)
       continue;
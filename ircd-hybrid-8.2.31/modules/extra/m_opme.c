@@ -57,7 +57,6 @@ mo_opme(struct Client *source_p, int parc, char *parv[])
   const char *const name = parv[1];
   struct Channel *channel = NULL;
   struct ChannelMember *member = NULL;
-  dlink_node *node = NULL;
 
   if (EmptyString(name))
   {
@@ -83,9 +82,9 @@ mo_opme(struct Client *source_p, int parc, char *parv[])
     return;
   }
 
-  DLINK_FOREACH(node, channel->members.head)
+  for (unsigned int i = 0; i < channel->members.count; ++i)
   {
-    if (((struct ChannelMember *)node->data)->flags & CHFL_CHANOP)
+    if (channel->members.entry[i].member->flags & CHFL_CHANOP)
     {
       sendto_one_notice(source_p, &me, ":Cannot use OPME on %s: channel is not opless",
                         channel->name);
@@ -34,7 +34,6 @@
 #include "send.h"
 #include "parse.h"
 #include "modules.h"
-#include "memory.h"
 
 
 /*! \brief Creates and sends a list of nick!user\@host masks a Client
@@ -55,7 +54,7 @@ list_accepts(struct Client *source_p)
 
   DLINK_FOREACH(node, source_p->connection->acceptlist.head)
   {
-    const struct split_nuh_item *accept_p = node->data;
+    const struct AcceptItem *accept_p = node->data;
     size_t masklen = strlen(accept_p->nickptr) +
                      strlen(accept_p->userptr) +
                      strlen(accept_p->hostptr) + 3;  /* +3 for ! + @ + space */
@@ -82,26 +81,6 @@ list_accepts(struct Client *source_p)
   sendto_one_numeric(source_p, &me, RPL_ENDOFACCEPT);
 }
 
-/*! \brief Allocates and adds a split_nuh_item holding a nick!user\@host
- *         mask to a Client's acceptlist.
- *
- * \param nuh      A split_nuh_item already prepared with required masks.
- * \param source_p The actual Client the new accept is added to.
- */
-static void
-add_accept(const struct split_nuh_item *nuh, struct Client *source_p)
-{
-  struct split_nuh_item *accept_p = xcalloc(sizeof(*accept_p));
-
-  accept_p->nickptr = xstrdup(nuh->nickptr);
-  accept_p->userptr = xstrdup(nuh->userptr);
-  accept_p->hostptr = xstrdup(nuh->hostptr);
-
-  dlinkAdd(accept_p, &accept_p->node, &source_p->connection->acceptlist);
-
-  list_accepts(source_p);
-}
-
 /*! \brief ACCEPT command handler
  *
  * \param source_p Pointer to allocated Client struct from which the message
@@ -117,7 +96,7 @@ static void
 m_accept(struct Client *source_p, int parc, char *parv[])
 {
   struct split_nuh_item nuh;
-  struct split_nuh_item *accept_p = NULL;
+  struct AcceptItem *accept_p = NULL;
   char nick[NICKLEN + 1] = "";
   char user[USERLEN + 1] = "";
   char host[HOSTLEN + 1] = "";
@@ -146,7 +125,7 @@ m_accept(struct Client *source_p, int parc, char *parv[])
 
       split_nuh(&nuh);
 
-      if ((accept_p = find_accept(nick, user, host, source_p, irccmp)) == NULL)
+      if ((accept_p = find_accept(nick, user, host, source_p)) == NULL)
       {
         sendto_one_numeric(source_p, &me, ERR_ACCEPTNOT, nick, user, host);
         continue;
@@ -173,13 +152,14 @@ m_accept(struct Client *source_p, int parc, char *parv[])
 
       split_nuh(&nuh);
 
-      if ((accept_p = find_accept(nick, user, host, source_p, irccmp)))
+      if ((accept_p = find_accept(nick, user, host, source_p)))
       {
         sendto_one_numeric(source_p, &me, ERR_ACCEPTEXIST, nick, user, host);
         continue;
       }
 
-      add_accept(&nuh, source_p);
+      add_accept(nick, user, host, source_p);
+      list_accepts(source_p);
     }
   }
 }
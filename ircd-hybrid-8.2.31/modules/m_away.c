@@ -36,6 +36,7 @@
 #include "server.h"
 #include "user.h"
 #include "isupport.h"
+#include "memory.h"
 
 
 /*!
@@ -51,9 +52,10 @@ do_away(struct Client *source_p, const char *message)
   if (EmptyString(message))
   {
     /* Marking as not away */
-    if (source_p->away[0])
+    if (source_p->cold->away)
     {
-      source_p->away[0] = '\0';
+      xfree_str_tag(MEMORY_AWAY, source_p->cold->away);
+      source_p->cold->away = NULL;
 
       /* We now send this only if they were away before --is */
       sendto_server(source_p, 0, 0, ":%s AWAY", source_p->id);
@@ -81,16 +83,17 @@ do_away(struct Client *source_p, const char *message)
     source_p->connection->away.count++;
     sendto_one_numeric(source_p, &me, RPL_NOWAWAY);
 
-    if (strncmp(source_p->away, message, sizeof(source_p->away) - 1) == 0)
+    if (source_p->cold->away && strncmp(source_p->cold->away, message, AWAYLEN) == 0)
       return;
   }
 
-  strlcpy(source_p->away, message, sizeof(source_p->away));
+  xfree_str_tag(MEMORY_AWAY, source_p->cold->away);
+  source_p->cold->away = xstrndup_tag(MEMORY_AWAY, message, AWAYLEN);
   sendto_common_channels_local(source_p, true, CAP_AWAY_NOTIFY, 0, ":%s!%s@%s AWAY :%s",
                                source_p->name, source_p->username,
-                               source_p->host, source_p->away);
+                               source_p->host, source_p->cold->away);
   sendto_server(source_p, 0, 0, ":%s AWAY :%s",
-                source_p->id, source_p->away);
+                source_p->id, source_p->cold->away);
 }
 
 /*! \brief AWAY command handler
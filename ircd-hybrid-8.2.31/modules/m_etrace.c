@@ -59,8 +59,8 @@ report_this_status(struct Client *source_p, const struct Client *target_p)
                      target_p->name,
                      target_p->username,
                      target_p->host,
-                     target_p->sockhost,
-                     target_p->info);
+                     target_p->cold->sockhost,
+                     target_p->cold->info);
 }
 
 /*
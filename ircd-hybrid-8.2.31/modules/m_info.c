@@ -355,6 +355,18 @@ static const struct InfoStruct info_table[] =
     &ConfigGeneral.default_floodtime,
     "Startup value of FLOODTIME"
   },
+  {
+    "perf_export_delay",
+    OUTPUT_DECIMAL,
+    &ConfigGeneral.perf_export_delay,
+    "Startup value of PERFEXPORT"
+  },
+  {
+    "perf_export_file",
+    OUTPUT_STRING,
+    &ConfigGeneral.perf_export_file,
+    "Path to the instrumentation export file or socket"
+  },
   {
     "failed_oper_notice",
     OUTPUT_BOOLEAN_YN,
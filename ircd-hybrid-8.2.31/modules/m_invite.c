@@ -127,8 +127,8 @@ m_invite(struct Client *source_p, int parc, char *parv[])
 
   sendto_one_numeric(source_p, &me, RPL_INVITING, target_p->name, channel->name);
 
-  if (target_p->away[0])
-    sendto_one_numeric(source_p, &me, RPL_AWAY, target_p->name, target_p->away);
+  if (target_p->cold->away)
+    sendto_one_numeric(source_p, &me, RPL_AWAY, target_p->name, target_p->cold->away);
 
   channel->last_invite_time = event_base->time.sec_monotonic;
 
@@ -78,7 +78,7 @@ do_links(struct Client *source_p, int parc, char *parv[])
        */
       sendto_one_numeric(source_p, &me, RPL_LINKS,
                          target_p->name, target_p->servptr->name,
-                         target_p->hopcount, target_p->info);
+                         target_p->hopcount, target_p->cold->info);
     }
 
     sendto_one_numeric(source_p, &me, RPL_ENDOFLINKS,
@@ -90,7 +90,7 @@ do_links(struct Client *source_p, int parc, char *parv[])
      * Print our own info so at least it looks like a normal links, then
      * print out the file (which may or may not be empty).
      */
-    sendto_one_numeric(source_p, &me, RPL_LINKS, me.name, me.name, 0, me.info);
+    sendto_one_numeric(source_p, &me, RPL_LINKS, me.name, me.name, 0, me.cold->info);
 
     DLINK_FOREACH(node, flatten_links.head)
       sendto_one_numeric(source_p, &me, RPL_LINKS | SND_EXPLICIT, "%s", node->data);
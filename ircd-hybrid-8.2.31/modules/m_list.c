@@ -51,7 +51,7 @@ do_list(struct Client *source_p, char *arg)
     return;
   }
 
-  struct ListTask *lt = xcalloc(sizeof(*lt));
+  struct ListTask *lt = xcalloc_tag(MEMORY_LIST_TASK, sizeof(*lt));
   lt->users_max = UINT_MAX;
   lt->created_max = UINT_MAX;
   lt->topicts_max = UINT_MAX;
@@ -148,7 +148,7 @@ do_list(struct Client *source_p, char *arg)
             error = true;
 
           if (error == false)
-            dlinkAdd(xstrdup(opt), make_dlink_node(), list);
+            dlinkAdd(xstrndup_tag(MEMORY_LIST_TASK, opt, IRCD_BUFSIZE), make_dlink_node(), list);
       }
     }
 
@@ -73,7 +73,7 @@ oper_up(struct Client *source_p, const struct MaskItem *conf)
 
   if (!EmptyString(conf->whois))
   {
-    svstag_attach(&source_p->svstags, RPL_WHOISOPERATOR, "+", conf->whois);
+    svstag_attach(&source_p->cold->svstags, RPL_WHOISOPERATOR, "+", conf->whois);
     sendto_server(NULL, 0, 0, ":%s SVSTAG %s %ju %u + :%s",
                   me.id, source_p->id, source_p->tsinfo,
                   RPL_WHOISOPERATOR, conf->whois);
@@ -154,7 +154,7 @@ m_oper(struct Client *source_p, int parc, char *parv[])
 
   if (!EmptyString(conf->certfp))
   {
-    if (EmptyString(source_p->certfp) || strcasecmp(source_p->certfp, conf->certfp))
+    if (EmptyString(source_p->cold->certfp) || strcasecmp(source_p->cold->certfp, conf->certfp))
     {
       sendto_one_numeric(source_p, &me, ERR_NOOPERHOST);
       failed_oper_notice(source_p, opername, "client certificate fingerprint mismatch");
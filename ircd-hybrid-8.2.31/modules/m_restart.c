@@ -45,6 +45,7 @@
  * \note Valid arguments for this command are:
  *      - parv[0] = command
  *      - parv[1] = server name
+ *      - parv[2] = "UPGRADE" to keep the clients connected (optional)
  */
 static void
 mo_restart(struct Client *source_p, int parc, char *parv[])
@@ -72,7 +73,11 @@ mo_restart(struct Client *source_p, int parc, char *parv[])
 
   snprintf(buf, sizeof(buf), "received RESTART command from %s",
            client_get_name(source_p, HIDE_IP));
-  server_die(buf, true);
+
+  if (parc > 2 && irccmp(parv[2], "UPGRADE") == 0)
+    server_upgrade(buf);
+  else
+    server_die(buf, true);
 }
 
 static struct Message restart_msgtab =
@@ -79,7 +79,7 @@ resv_handle(struct Client *source_p, const struct aline_ctx *aline)
 
   if (aline->duration)
   {
-    resv->expire = event_base->time.sec_real + aline->duration;
+    resv_set_expire(resv, event_base->time.sec_real + aline->duration);
 
     if (IsClient(source_p))
       sendto_one_notice(source_p, &me, ":Added temporary %ju min. RESV [%s]",
@@ -214,6 +214,74 @@ quote_jfloodcount(struct Client *source_p, const char *arg, int newval)
                       GlobalSetOptions.joinfloodcount);
 }
 
+/* SET TLSSESSIONCACHE */
+static void
+quote_tlssessioncache(struct Client *source_p, const char *arg, int newval)
+{
+  if (newval >= 0)
+  {
+    GlobalSetOptions.tls_session_cache = newval;
+    tls_set_session_cache(GlobalSetOptions.tls_session_cache);
+
+    sendto_realops_flags(UMODE_SERVNOTICE, L_ALL, SEND_NOTICE,
+                         "%s has changed TLSSESSIONCACHE to %u",
+                         get_oper_name(source_p), GlobalSetOptions.tls_session_cache);
+  }
+  else
+    sendto_one_notice(source_p, &me, ":TLSSESSIONCACHE is currently %u",
+                      GlobalSetOptions.tls_session_cache);
+}
+
+/* SET PERFEXPORT */
+static void
+quote_perfexport(struct Client *source_p, const char *arg, int newval)
+{
+  if (newval >= 0)
+  {
+    GlobalSetOptions.perf_export = newval;
+    perf_set_export(GlobalSetOptions.perf_export);
+
+    sendto_realops_flags(UMODE_SERVNOTICE, L_ALL, SEND_NOTICE,
+                         "%s has changed PERFEXPORT to %u",
+                         get_oper_name(source_p), GlobalSetOptions.perf_export);
+  }
+  else
+    sendto_one_notice(source_p, &me, ":PERFEXPORT is currently %u",
+                      GlobalSetOptions.perf_export);
+}
+
+/* SET PREFIXRATE */
+static void
+quote_prefixrate(struct Client *source_p, const char *arg, int newval)
+{
+  if (newval >= 0)
+  {
+    GlobalSetOptions.prefix_rate = newval;
+    sendto_realops_flags(UMODE_SERVNOTICE, L_ALL, SEND_NOTICE,
+                         "%s has changed PREFIXRATE to %u",
+                         get_oper_name(source_p), GlobalSetOptions.prefix_rate);
+  }
+  else
+    sendto_one_notice(source_p, &me, ":PREFIXRATE is currently %u",
+                      GlobalSetOptions.prefix_rate);
+}
+
+/* SET PREFIXBURST */
+static void
+quote_prefixburst(struct Client *source_p, const char *arg, int newval)
+{
+  if (newval > 0)
+  {
+    GlobalSetOptions.prefix_burst = newval;
+    sendto_realops_flags(UMODE_SERVNOTICE, L_ALL, SEND_NOTICE,
+                         "%s has changed PREFIXBURST to %u",
+                         get_oper_name(source_p), GlobalSetOptions.prefix_burst);
+  }
+  else
+    sendto_one_notice(source_p, &me, ":PREFIXBURST is currently %u",
+                      GlobalSetOptions.prefix_burst);
+}
+
 /* Structure used for the SET table itself */
 struct SetStruct
 {
@@ -245,6 +313,10 @@ static const struct SetStruct set_cmd_table[] =
   { "SPAMTIME",         quote_spamtime,     false,  true  },
   { "JFLOODTIME",       quote_jfloodtime,   false,  true  },
   { "JFLOODCOUNT",      quote_jfloodcount,  false,  true  },
+  { "TLSSESSIONCACHE",  quote_tlssessioncache, false, true },
+  { "PERFEXPORT",       quote_perfexport,   false,  true  },
+  { "PREFIXBURST",      quote_prefixburst,  false,  true  },
+  { "PREFIXRATE",       quote_prefixrate,   false,  true  },
   /* ------------------------------------------------------ */
   { NULL,               NULL,               false,  false }
 };
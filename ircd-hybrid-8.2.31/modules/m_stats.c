@@ -53,6 +53,11 @@
 #include "reslib.h"
 #include "motd.h"
 #include "ipcache.h"
+#include "intern.h"
+#include "ratelimit.h"
+#include "conf_expire.h"
+#include "memory.h"
+#include "dbuf.h"
 #include "channel.h"
 #include "channel_invite.h"
 
@@ -320,119 +325,27 @@ stats_resv(struct Client *source_p, int parc, char *parv[])
 static void
 stats_memory(struct Client *source_p, int parc, char *parv[])
 {
-  dlink_node *node, *node2;
-
-  unsigned int local_client_conf_count = 0;      /* local client conf links */
-
-  unsigned int channel_members = 0;
-  unsigned int channel_invites = 0;
-  unsigned int channel_bans = 0;
-  unsigned int channel_except = 0;
-  unsigned int channel_invex = 0;
-
-  unsigned int wwu = 0;                  /* whowas users */
-  unsigned int number_ips_stored = 0;        /* number of ip addresses hashed */
-
-  size_t channel_ban_memory = 0;
-  size_t channel_except_memory = 0;
-  size_t channel_invex_memory = 0;
-
-  unsigned int safelist_count = 0;
-  size_t safelist_memory = 0;
-
-  size_t wwm = 0;               /* whowas array memory used       */
-  size_t mem_ips_stored = 0;        /* memory used by ip address hash */
-
-  unsigned int local_client_count  = 0;
-  unsigned int remote_client_count = 0;
-
-  size_t local_client_memory_used  = 0;
-  size_t remote_client_memory_used = 0;
+  unsigned int number = 0;
+  size_t memory = 0, total = 0;
 
-  unsigned int watch_list_headers = 0;   /* watchlist headers     */
-  unsigned int watch_list_entries = 0;   /* watchlist entries     */
-  size_t watch_list_memory = 0; /* watchlist memory used */
-
-  unsigned int listener_count = 0;
-  size_t listener_memory = 0;
-
-
-  DLINK_FOREACH(node, local_server_list.head)
+  /* Counted as things are allocated, so this never walks a list */
+  for (enum MemoryTag tag = 0; tag < MEMORY_TAG_LAST; ++tag)
   {
-    const struct Client *target_p = node->data;
-
-    local_client_conf_count += dlink_list_length(&target_p->connection->confs);
-  }
-
-  DLINK_FOREACH(node, local_client_list.head)
-  {
-    const struct Client *target_p = node->data;
-
-    local_client_conf_count += dlink_list_length(&target_p->connection->confs);
-    watch_list_entries += dlink_list_length(&target_p->connection->watches);
-  }
-
-  local_client_count = dlink_list_length(&local_server_list) + dlink_list_length(&local_client_list);
-  remote_client_count = dlink_list_length(&global_server_list) + dlink_list_length(&global_client_list) - local_client_count;
-
-  /* Count up all members, invites, ban lists, except lists, Invex lists */
-  DLINK_FOREACH(node, channel_get_list()->head)
-  {
-    const struct Channel *channel = node->data;
-
-    channel_members += dlink_list_length(&channel->members);
-    channel_invites += dlink_list_length(&channel->invites);
-
-    channel_bans += dlink_list_length(&channel->banlist);
-    channel_ban_memory += dlink_list_length(&channel->banlist) * sizeof(struct Ban);
-
-    channel_except += dlink_list_length(&channel->exceptlist);
-    channel_except_memory += dlink_list_length(&channel->exceptlist) * sizeof(struct Ban);
-
-    channel_invex += dlink_list_length(&channel->invexlist);
-    channel_invex_memory += dlink_list_length(&channel->invexlist) * sizeof(struct Ban);
-  }
-
-  safelist_count = dlink_list_length(&listing_client_list);
-  if (safelist_count)
-  {
-    safelist_memory = safelist_count * sizeof(struct ListTask);
-
-    DLINK_FOREACH(node, listing_client_list.head)
-    {
-      const struct Client *acptr = node->data;
-
-      DLINK_FOREACH(node2, acptr->connection->list_task->show_mask.head)
-        safelist_memory += strlen(node2->data);
+    const struct MemoryStats *stats = memory_get_stats(tag);
 
-      DLINK_FOREACH(node2, acptr->connection->list_task->hide_mask.head)
-        safelist_memory += strlen(node2->data);
-    }
+    total += stats->bytes;
+    sendto_one_numeric(source_p, &me, RPL_STATSDEBUG | SND_EXPLICIT,
+                       "z :%s %zu(%zu) peak %zu",
+                       stats->name, stats->count, stats->bytes, stats->peak);
   }
 
-  watch_count_memory(&watch_list_headers, &watch_list_memory);
   sendto_one_numeric(source_p, &me, RPL_STATSDEBUG | SND_EXPLICIT,
-                     "z :WATCH headers %u(%zu) entries %u(%zu)",
-                     watch_list_headers,
-                     watch_list_memory,
-                     watch_list_entries,
-                     watch_list_entries * sizeof(dlink_node) * 2);
+                     "z :Total accounted for %zu", total);
 
   sendto_one_numeric(source_p, &me, RPL_STATSDEBUG | SND_EXPLICIT,
-                     "z :Clients %u(%zu)",
-                     dlink_list_length(&global_client_list),
-                     dlink_list_length(&global_client_list) * sizeof(struct Client));
-
-  sendto_one_numeric(source_p, &me, RPL_STATSDEBUG | SND_EXPLICIT,
-                     "z :Servers %u(%zu, %zu)",
-                     dlink_list_length(&global_server_list),
-                     dlink_list_length(&global_server_list) * sizeof(struct Client),
-                     dlink_list_length(&global_server_list) * sizeof(struct Server));
-
-  sendto_one_numeric(source_p, &me, RPL_STATSDEBUG | SND_EXPLICIT,
-                     "z :Attached confs %u(%zu)",
-                     local_client_conf_count,
-                     local_client_conf_count * sizeof(dlink_node));
+                     "z :Send queues %zu peak %zu, receive queues %zu peak %zu",
+                     dbuf_sendq_total.size, dbuf_sendq_total.peak,
+                     dbuf_recvq_total.size, dbuf_recvq_total.peak);
 
   sendto_one_numeric(source_p, &me, RPL_STATSDEBUG | SND_EXPLICIT,
                      "z :Resv channels %u(%zu) nicks %u(%zu)",
@@ -441,64 +354,37 @@ stats_memory(struct Client *source_p, int parc, char *parv[])
                      dlink_list_length(resv_nick_get_list()),
                      dlink_list_length(resv_nick_get_list()) * sizeof(struct ResvItem));
 
-  listener_count_memory(&listener_count, &listener_memory);
+  listener_count_memory(&number, &memory);
   sendto_one_numeric(source_p, &me, RPL_STATSDEBUG | SND_EXPLICIT,
                      "z :Listeners %u(%zu)",
-                     listener_count, listener_memory);
+                     number, memory);
 
   sendto_one_numeric(source_p, &me, RPL_STATSDEBUG | SND_EXPLICIT,
                      "z :Classes %u(%zu)",
                      dlink_list_length(class_get_list()),
                      dlink_list_length(class_get_list()) * sizeof(struct ClassItem));
 
-  sendto_one_numeric(source_p, &me, RPL_STATSDEBUG | SND_EXPLICIT,
-                     "z :Channels %u(%zu)",
-                     dlink_list_length(channel_get_list()),
-                     dlink_list_length(channel_get_list()) * sizeof(struct Channel));
-
-  sendto_one_numeric(source_p, &me, RPL_STATSDEBUG | SND_EXPLICIT,
-                     "z :Bans %u(%zu)",
-                     channel_bans, channel_ban_memory);
-
-  sendto_one_numeric(source_p, &me, RPL_STATSDEBUG | SND_EXPLICIT,
-                     "z :Exceptions %u(%zu)",
-                     channel_except, channel_except_memory);
-
-  sendto_one_numeric(source_p, &me, RPL_STATSDEBUG | SND_EXPLICIT,
-                     "z :Invex %u(%zu)",
-                     channel_invex, channel_invex_memory);
-
-  sendto_one_numeric(source_p, &me, RPL_STATSDEBUG | SND_EXPLICIT,
-                     "z :Channel members %u(%zu) invites %u(%zu)",
-                     channel_members,
-                     channel_members * sizeof(struct ChannelMember),
-                     channel_invites,
-                     channel_invites * sizeof(struct Invite));
-
-  sendto_one_numeric(source_p, &me, RPL_STATSDEBUG | SND_EXPLICIT,
-                     "z :Safelist %u(%zu)",
-                     safelist_count, safelist_memory);
-
-  whowas_count_memory(&wwu, &wwm);
-  sendto_one_numeric(source_p, &me, RPL_STATSDEBUG | SND_EXPLICIT,
-                     "z :Whowas users %u(%zu)", wwu, wwm);
-
   motd_memory_count(source_p);
 
-  ipcache_get_stats(&number_ips_stored, &mem_ips_stored);
+  ipcache_get_stats(&number, &memory);
   sendto_one_numeric(source_p, &me, RPL_STATSDEBUG | SND_EXPLICIT,
                      "z :iphash %u(%zu)",
-                     number_ips_stored, mem_ips_stored);
+                     number, memory);
+
+  intern_get_stats(&number, &memory);
+  sendto_one_numeric(source_p, &me, RPL_STATSDEBUG | SND_EXPLICIT,
+                     "z :Interned strings %u(%zu)",
+                     number, memory);
 
-  local_client_memory_used = local_client_count * (sizeof(struct Client) + sizeof(struct Connection));
+  ratelimit_get_stats(&number, &memory);
   sendto_one_numeric(source_p, &me, RPL_STATSDEBUG | SND_EXPLICIT,
-                     "z :Local client Memory in use: %u(%zu)",
-                     local_client_count, local_client_memory_used);
+                     "z :Rate sketches %u(%zu)",
+                     number, memory);
 
-  remote_client_memory_used = remote_client_count * sizeof(struct Client);
+  conf_expire_get_stats(&number, &memory);
   sendto_one_numeric(source_p, &me, RPL_STATSDEBUG | SND_EXPLICIT,
-                     "z :Remote client Memory in use: %u(%zu)",
-                     remote_client_count, remote_client_memory_used);
+                     "z :Expiry queue %u(%zu)",
+                     number, memory);
 }
 
 static void
@@ -967,6 +853,9 @@ stats_tstats(struct Client *source_p, int parc, char *parv[])
   sendto_one_numeric(source_p, &me, RPL_STATSDEBUG | SND_EXPLICIT,
                      "t :auth successes %u fails %u",
                      sp.is_asuc, sp.is_abad);
+  sendto_one_numeric(source_p, &me, RPL_STATSDEBUG | SND_EXPLICIT,
+                     "t :tls handshakes %u resumed %u (%u%%)",
+                     sp.is_tls, sp.is_tlsr, sp.is_tls ? (unsigned int)((uintmax_t)sp.is_tlsr * 100 / sp.is_tls) : 0);
   sendto_one_numeric(source_p, &me, RPL_STATSDEBUG | SND_EXPLICIT,
                      "t :Client Server");
   sendto_one_numeric(source_p, &me, RPL_STATSDEBUG | SND_EXPLICIT,
@@ -983,6 +872,18 @@ stats_tstats(struct Client *source_p, int parc, char *parv[])
                      sp.is_cti, sp.is_sti);
 }
 
+static void
+stats_perf(struct Client *source_p, int parc, char *parv[])
+{
+  perf_report(source_p);
+}
+
+static void
+stats_ratelimit(struct Client *source_p, int parc, char *parv[])
+{
+  ratelimit_report(source_p);
+}
+
 static void
 stats_uptime(struct Client *source_p, int parc, char *parv[])
 {
@@ -1246,6 +1147,8 @@ static const struct StatsStruct  stats_tab[] =
   { .letter = 'H', .handler = stats_hubleaf, .required_modes = UMODE_OPER },
   { .letter = 'i', .handler = stats_auth },
   { .letter = 'I', .handler = stats_auth },
+  { .letter = 'j', .handler = stats_perf, .required_modes = UMODE_OPER },
+  { .letter = 'J', .handler = stats_perf, .required_modes = UMODE_OPER },
   { .letter = 'k', .handler = stats_tkill },
   { .letter = 'K', .handler = stats_kill },
   { .letter = 'l', .handler = stats_ltrace, .required_modes = UMODE_OPER },
@@ -1265,6 +1168,8 @@ static const struct StatsStruct  stats_tab[] =
   { .letter = 'u', .handler = stats_uptime },
   { .letter = 'U', .handler = stats_shared, .required_modes = UMODE_OPER },
   { .letter = 'v', .handler = stats_servers, .required_modes = UMODE_OPER },
+  { .letter = 'w', .handler = stats_ratelimit, .required_modes = UMODE_OPER },
+  { .letter = 'W', .handler = stats_ratelimit, .required_modes = UMODE_OPER },
   { .letter = 'x', .handler = stats_gecos, .required_modes = UMODE_OPER },
   { .letter = 'X', .handler = stats_gecos, .required_modes = UMODE_OPER },
   { .letter = 'y', .handler = stats_class, .required_modes = UMODE_OPER },
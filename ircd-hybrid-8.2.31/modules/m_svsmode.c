@@ -91,10 +91,10 @@ ms_svsmode(struct Client *source_p, int parc, char *parv[])
       case 'd':
         if (!EmptyString(extarg))
         {
-          strlcpy(target_p->account, extarg, sizeof(target_p->account));
+          strlcpy(target_p->cold->account, extarg, sizeof(target_p->cold->account));
           sendto_common_channels_local(target_p, true, CAP_ACCOUNT_NOTIFY, 0, ":%s!%s@%s ACCOUNT %s",
                                        target_p->name, target_p->username,
-                                       target_p->host, target_p->account);
+                                       target_p->host, target_p->cold->account);
         }
 
         break;
@@ -112,7 +112,7 @@ ms_svsmode(struct Client *source_p, int parc, char *parv[])
 
           if (MyConnect(target_p))
           {
-            svstag_detach(&target_p->svstags, RPL_WHOISOPERATOR);
+            svstag_detach(&target_p->cold->svstags, RPL_WHOISOPERATOR);
             conf_detach(target_p, CONF_OPER);
 
             ClrOFlag(target_p);
@@ -83,18 +83,18 @@ report_this_status(struct Client *source_p, const struct Client *target_p)
       break;
     case STAT_UNKNOWN:
       sendto_one_numeric(source_p, &me, RPL_TRACEUNKNOWN, class_name,
-                         name, target_p->sockhost,
+                         name, target_p->cold->sockhost,
                          event_base->time.sec_monotonic - target_p->connection->created_monotonic);
       break;
     case STAT_CLIENT:
       if (HasUMode(target_p, UMODE_OPER))
         sendto_one_numeric(source_p, &me, RPL_TRACEOPERATOR, class_name, name,
-                           target_p->sockhost,
+                           target_p->cold->sockhost,
                            event_base->time.sec_monotonic - target_p->connection->last_data,
                            client_get_idle_time(source_p, target_p));
       else
         sendto_one_numeric(source_p, &me, RPL_TRACEUSER, class_name, name,
-                           target_p->sockhost,
+                           target_p->cold->sockhost,
                            event_base->time.sec_monotonic - target_p->connection->last_data,
                            client_get_idle_time(source_p, target_p));
       break;
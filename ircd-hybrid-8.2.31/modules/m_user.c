@@ -51,7 +51,7 @@ do_user(struct Client *source_p,
 
   source_p->connection->registration &= ~REG_NEED_USER;
 
-  strlcpy(source_p->info, realname, sizeof(source_p->info));
+  strlcpy(source_p->cold->info, realname, sizeof(source_p->cold->info));
 
   if (!HasFlag(source_p, FLAGS_GOTID))
     strlcpy(source_p->username, username, sizeof(source_p->username));
@@ -78,15 +78,15 @@ m_userhost(struct Client *source_p, int parc, char *parv[])
       masklen = snprintf(response, sizeof(response), "%s%s=%c%s@%s ",
                          target_p->name,
                          HasUMode(target_p, UMODE_OPER) ? "*" : "",
-                         (target_p->away[0]) ? '-' : '+',
+                         (target_p->cold->away) ? '-' : '+',
                          target_p->username,
-                         target_p->sockhost);
+                         target_p->cold->sockhost);
     else
       masklen = snprintf(response, sizeof(response), "%s%s=%c%s@%s ",
                          target_p->name, (HasUMode(target_p, UMODE_OPER) &&
                                           (!HasUMode(target_p, UMODE_HIDDEN) ||
                                             HasUMode(source_p, UMODE_OPER))) ? "*" : "",
-                         (target_p->away[0]) ? '-' : '+',
+                         (target_p->cold->away) ? '-' : '+',
                          target_p->username,
                          target_p->host);
 
@@ -30,6 +30,7 @@
 #include "ircd.h"
 #include "send.h"
 #include "irc_string.h"
+#include "intern.h"
 #include "parse.h"
 #include "modules.h"
 #include "conf.h"
@@ -110,16 +111,18 @@ mr_webirc(struct Client *source_p, int parc, char *parv[])
   source_p->ip.ss_len = res->ai_addrlen;
   freeaddrinfo(res);
 
-  strlcpy(source_p->sockhost, addr, sizeof(source_p->sockhost));
-
-  if (source_p->sockhost[0] == ':')
+  if (*addr == ':')
   {
-    memmove(source_p->sockhost + 1, source_p->sockhost, sizeof(source_p->sockhost) - 1);
-    source_p->sockhost[0] = '0';
+    char sockhost[HOSTIPLEN + 1];
+
+    snprintf(sockhost, sizeof(sockhost), "0%s", addr);
+    intern_set(&source_p->cold->sockhost, sockhost, HOSTIPLEN);
   }
+  else
+    intern_set(&source_p->cold->sockhost, addr, HOSTIPLEN);
 
-  strlcpy(source_p->host, host, sizeof(source_p->host));
-  strlcpy(source_p->realhost, host, sizeof(source_p->realhost));
+  intern_set(&source_p->host, host, HOSTLEN);
+  intern_set(&source_p->cold->realhost, host, HOSTLEN);
 
   /* Check dlines now, k-lines will be checked on registration */
   if ((conf = find_dline_conf(&source_p->ip)))
@@ -38,50 +38,12 @@
 #include "conf.h"
 #include "parse.h"
 #include "modules.h"
+#include "user.h"
 
 
 enum { WHO_MAX_REPLIES = 500 };
 
 
-/* do_who()
- *
- * inputs       - pointer to client requesting who
- *              - pointer to client to do who on
- *              - The reported name
- *              - channel flags
- * output       - NONE
- * side effects - do a who on given person
- */
-static void
-do_who(struct Client *source_p, const struct Client *target_p,
-       const char *name, const char *op_flags)
-{
-  char status[8] = "";  /* sizeof("Gr*@%+") + 2 */
-
-  if (HasUMode(source_p, UMODE_OPER))
-    snprintf(status, sizeof(status), "%c%s%s%s", target_p->away[0] ? 'G' : 'H',
-             HasUMode(target_p, UMODE_REGISTERED) ? "r" : "",
-             HasUMode(target_p, UMODE_OPER) ? "*" : "", op_flags);
-  else
-    snprintf(status, sizeof(status), "%c%s%s%s", target_p->away[0] ? 'G' : 'H',
-             HasUMode(target_p, UMODE_REGISTERED) ? "r" : "",
-             HasUMode(target_p, UMODE_OPER) &&
-             !HasUMode(target_p, UMODE_HIDDEN) ? "*" : "", op_flags);
-
-  if (ConfigServerHide.hide_servers || IsHidden(target_p->servptr))
-    sendto_one_numeric(source_p, &me, RPL_WHOREPLY,
-               (name) ? (name) : "*",
-               target_p->username, target_p->host,
-               HasUMode(source_p, UMODE_OPER) ? target_p->servptr->name : "*",
-               target_p->name, status,
-               HasUMode(source_p, UMODE_OPER) ? target_p->hopcount : 0, target_p->info);
-  else
-    sendto_one_numeric(source_p, &me, RPL_WHOREPLY,
-               (name) ? (name) : "*", target_p->username,
-               target_p->host, target_p->servptr->name, target_p->name,
-               status, target_p->hopcount, target_p->info);
-}
-
 /*!
  * \param source_p Pointer to client requesting who
  * \param target_p Pointer to client to do who on
@@ -103,14 +65,14 @@ who_matches(struct Client *source_p, struct Client *target_p, const char *mask)
   if (match(mask, target_p->host) == 0)
     return true;
 
-  if (match(mask, target_p->info) == 0)
+  if (match(mask, target_p->cold->info) == 0)
     return true;
 
   if (HasUMode(source_p, UMODE_OPER))
   {
-    if (match(mask, target_p->sockhost) == 0)
+    if (match(mask, target_p->cold->sockhost) == 0)
       return true;
-    if (match(mask, target_p->realhost) == 0)
+    if (match(mask, target_p->cold->realhost) == 0)
       return true;
   }
 
@@ -137,11 +99,9 @@ static void
 who_common_channel(struct Client *source_p, struct Channel *channel, const char *mask,
                    bool server_oper, unsigned int *maxmatches)
 {
-  dlink_node *node;
-
-  DLINK_FOREACH(node, channel->members.head)
+  for (unsigned int i = 0; i < channel->members.count; ++i)
   {
-    struct Client *target_p = ((struct ChannelMember *)node->data)->client;
+    struct Client *target_p = channel->members.entry[i].client;
 
     if (!HasUMode(target_p, UMODE_INVISIBLE) || HasFlag(target_p, FLAGS_MARK))
       continue;
@@ -155,7 +115,7 @@ who_common_channel(struct Client *source_p, struct Channel *channel, const char
 
     if (who_matches(source_p, target_p, mask) == true)
     {
-      do_who(source_p, target_p, NULL, "");
+      show_who(source_p, target_p, NULL, "");
 
       if (*maxmatches)
       {
@@ -223,7 +183,7 @@ who_global(struct Client *source_p, const char *mask, bool server_oper)
 
     if (who_matches(source_p, target_p, mask) == true)
     {
-      do_who(source_p, target_p, NULL, "");
+      show_who(source_p, target_p, NULL, "");
 
       if (maxmatches)
       {
@@ -237,39 +197,6 @@ who_global(struct Client *source_p, const char *mask, bool server_oper)
   }
 }
 
-/* do_who_on_channel()
- *
- * inputs	- pointer to client requesting who
- *		- pointer to channel to do who on
- *		- The "real name" of this channel
- *		- int if source_p is a server oper or not
- *		- int if client is member or not
- *		- int server_op flag
- * output	- NONE
- * side effects - do a who on given channel
- */
-static void
-do_who_on_channel(struct Client *source_p, struct Channel *channel,
-                  bool is_member, bool server_oper)
-{
-  dlink_node *node;
-
-  DLINK_FOREACH(node, channel->members.head)
-  {
-    struct ChannelMember *member = node->data;
-    struct Client *target_p = member->client;
-
-    if (is_member == true || !HasUMode(target_p, UMODE_INVISIBLE))
-    {
-      if (server_oper == true)
-        if (!HasUMode(target_p, UMODE_OPER) ||
-            (HasUMode(target_p, UMODE_HIDDEN) && !HasUMode(source_p, UMODE_OPER)))
-          continue;
-      do_who(source_p, target_p, channel->name, get_member_status(member, !!HasCap(source_p, CAP_MULTI_PREFIX)));
-    }
-  }
-}
-
 /*! \brief WHO command handler
  *
  * \param source_p Pointer to allocated Client struct from which the message
@@ -308,10 +235,19 @@ m_who(struct Client *source_p, int parc, char *parv[])
     /* List all users on a given channel */
     if ((channel = hash_find_channel(mask)))
     {
+      const unsigned int flags = server_oper == true ? WHO_OPERS_ONLY : 0;
+
       if (HasUMode(source_p, UMODE_ADMIN) || IsMember(source_p, channel))
-        do_who_on_channel(source_p, channel, true, server_oper);
-      else if (!SecretChannel(channel))
-        do_who_on_channel(source_p, channel, false, server_oper);
+      {
+        channel_member_who(source_p, channel, mask, flags | WHO_SHOW_INVISIBLE);
+        return;
+      }
+
+      if (!SecretChannel(channel))
+      {
+        channel_member_who(source_p, channel, mask, flags);
+        return;
+      }
     }
 
     sendto_one_numeric(source_p, &me, RPL_ENDOFWHO, mask);
@@ -330,10 +266,10 @@ m_who(struct Client *source_p, int parc, char *parv[])
     }
 
     if (node)
-      do_who(source_p, target_p, channel->name,
-             get_member_status(node->data, !!HasCap(source_p, CAP_MULTI_PREFIX)));
+      show_who(source_p, target_p, channel->name,
+               get_member_status(node->data, !!HasCap(source_p, CAP_MULTI_PREFIX)));
     else
-      do_who(source_p, target_p, NULL, "");
+      show_who(source_p, target_p, NULL, "");
 
     sendto_one_numeric(source_p, &me, RPL_ENDOFWHO, mask);
     return;
@@ -345,7 +281,9 @@ m_who(struct Client *source_p, int parc, char *parv[])
     if ((node = source_p->channel.head))
     {
       channel = ((struct ChannelMember *)node->data)->channel;
-      do_who_on_channel(source_p, channel, true, server_oper);
+      channel_member_who(source_p, channel, "*",
+                         WHO_SHOW_INVISIBLE | (server_oper == true ? WHO_OPERS_ONLY : 0));
+      return;
     }
 
     sendto_one_numeric(source_p, &me, RPL_ENDOFWHO, "*");
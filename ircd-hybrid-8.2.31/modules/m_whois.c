@@ -80,7 +80,7 @@ whois_person(struct Client *source_p, struct Client *target_p)
 
   sendto_one_numeric(source_p, &me, RPL_WHOISUSER, target_p->name,
                      target_p->username, target_p->host,
-                     target_p->info);
+                     target_p->cold->info);
 
   cur_len = mlen = snprintf(buf, sizeof(buf), numeric_form(RPL_WHOISCHANNELS),
                             me.name, source_p->name, target_p->name, "");
@@ -122,18 +122,18 @@ whois_person(struct Client *source_p, struct Client *target_p)
                        ConfigServerInfo.network_desc);
   else
     sendto_one_numeric(source_p, &me, RPL_WHOISSERVER, target_p->name,
-                       target_p->servptr->name, target_p->servptr->info);
+                       target_p->servptr->name, target_p->servptr->cold->info);
 
   if (HasUMode(target_p, UMODE_REGISTERED))
     sendto_one_numeric(source_p, &me, RPL_WHOISREGNICK, target_p->name);
 
-  if (strcmp(target_p->account, "*"))
+  if (strcmp(target_p->cold->account, "*"))
     sendto_one_numeric(source_p, &me, RPL_WHOISACCOUNT, target_p->name,
-                       target_p->account, "is");
+                       target_p->cold->account, "is");
 
-  if (target_p->away[0])
+  if (target_p->cold->away)
     sendto_one_numeric(source_p, &me, RPL_AWAY, target_p->name,
-                       target_p->away);
+                       target_p->cold->away);
 
   if (HasUMode(target_p, UMODE_CALLERID | UMODE_SOFTCALLERID))
   {
@@ -149,8 +149,8 @@ whois_person(struct Client *source_p, struct Client *target_p)
   {
     if (!HasUMode(target_p, UMODE_HIDDEN) || HasUMode(source_p, UMODE_OPER))
     {
-      if (target_p->svstags.head)
-        svstag = target_p->svstags.head->data;
+      if (target_p->cold->svstags.head)
+        svstag = target_p->cold->svstags.head->data;
 
       if (svstag == NULL || svstag->numeric != RPL_WHOISOPERATOR)
       {
@@ -166,7 +166,7 @@ whois_person(struct Client *source_p, struct Client *target_p)
     }
   }
 
-  DLINK_FOREACH(node, target_p->svstags.head)
+  DLINK_FOREACH(node, target_p->cold->svstags.head)
   {
     svstag = node->data;
 
@@ -198,15 +198,15 @@ whois_person(struct Client *source_p, struct Client *target_p)
 
   if (HasUMode(source_p, UMODE_OPER) || source_p == target_p)
     sendto_one_numeric(source_p, &me, RPL_WHOISACTUALLY, target_p->name,
-                       target_p->username, target_p->realhost,
-                       target_p->sockhost);
+                       target_p->username, target_p->cold->realhost,
+                       target_p->cold->sockhost);
 
   if (HasUMode(target_p, UMODE_SECURE))
     sendto_one_numeric(source_p, &me, RPL_WHOISSECURE, target_p->name);
 
-  if (!EmptyString(target_p->certfp))
+  if (!EmptyString(target_p->cold->certfp))
     if (HasUMode(source_p, UMODE_OPER) || source_p == target_p)
-      sendto_one_numeric(source_p, &me, RPL_WHOISCERTFP, target_p->name, target_p->certfp);
+      sendto_one_numeric(source_p, &me, RPL_WHOISCERTFP, target_p->name, target_p->cold->certfp);
 
   if (MyConnect(target_p))
     if (!HasUMode(target_p, UMODE_HIDEIDLE) || HasUMode(source_p, UMODE_OPER) ||
@@ -55,7 +55,7 @@ xline_check(const struct GecosItem *gecos)
     if (IsDead(client_p))
       continue;
 
-    if (match(gecos->mask, client_p->info) == 0)
+    if (match(gecos->mask, client_p->cold->info) == 0)
       conf_try_ban(client_p, CLIENT_BAN_XLINE, gecos->reason);
   }
 }
@@ -105,7 +105,7 @@ xline_handle(struct Client *source_p, const struct aline_ctx *aline)
 
   if (aline->duration)
   {
-    gecos->expire = event_base->time.sec_real + aline->duration;
+    gecos_set_expire(gecos, event_base->time.sec_real + aline->duration);
 
     if (IsClient(source_p))
       sendto_one_notice(source_p, &me, ":Added temporary %ju min. X-Line [%s]",
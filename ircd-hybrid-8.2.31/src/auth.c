@@ -44,6 +44,7 @@
 #include "client.h"
 #include "event.h"
 #include "irc_string.h"
+#include "intern.h"
 #include "ircd.h"
 #include "packet.h"
 #include "res.h"
@@ -141,7 +142,7 @@ auth_release_client(struct AuthRequest *auth)
 
   AddFlag(client, FLAGS_FINISHED_AUTH);
 
-  strlcpy(client->realhost, client->host, sizeof(client->realhost));
+  intern_set(&client->cold->realhost, client->host, HOSTLEN);
 
   read_packet(client->connection->fd, client);
 }
@@ -194,7 +195,7 @@ auth_dns_callback(void *vptr, const struct irc_ssaddr *addr, const char *name, s
     auth_sendheader(auth->client, REPORT_HOST_INVALID);
   else
   {
-    strlcpy(auth->client->host, name, sizeof(auth->client->host));
+    intern_set(&auth->client->host, name, HOSTLEN);
     //auth_sendheader(auth->client, REPORT_FIN_DNS);
   }
 
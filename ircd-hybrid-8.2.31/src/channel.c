@@ -29,6 +29,7 @@
 #include "channel.h"
 #include "channel_invite.h"
 #include "channel_mode.h"
+#include "channel_stream.h"
 #include "client.h"
 #include "hash.h"
 #include "conf.h"
@@ -43,11 +44,19 @@
 #include "memory.h"
 #include "misc.h"
 #include "extban.h"
+#include "user.h"
 
 
 /** Doubly linked list containing a list of all channels. */
 static dlink_list channel_list;
 
+/*
+ * Every ban, exception and invite exception of every channel is also kept
+ * in ban_hash, keyed on both the list it is on and its case-folded mask,
+ * so finding a duplicate or the entry to remove does not scan the list.
+ */
+static dlink_list ban_hash[HASHSIZE];
+
 
 /*! \brief Returns the channel_list as constant
  * \return channel_list
@@ -58,6 +67,176 @@ channel_get_list(void)
   return &channel_list;
 }
 
+/*! \brief Appends a member to one of the member arrays of a channel
+ * \param array  Pointer to Channel::members or Channel::members_local
+ * \param member Pointer to membership to add
+ * \return Position of the new entry
+ */
+static unsigned int
+member_array_add(struct MemberArray *array, struct ChannelMember *member)
+{
+  if (array->count == array->size)
+  {
+    const unsigned int size = array->size ? array->size * 2 : 4;
+
+    array->entry = xrealloc_tag(MEMORY_MEMBER_ARRAY, array->entry, array->size * sizeof(*array->entry),
+                                size * sizeof(*array->entry));
+    array->size = size;
+  }
+
+  array->entry[array->count].client = member->client;
+  array->entry[array->count].member = member;
+  return array->count++;
+}
+
+/*! \brief Removes an entry from one of the member arrays of a channel by
+ *         moving the last entry into its place
+ * \param array Pointer to Channel::members or Channel::members_local
+ * \param index Position of the entry to remove
+ * \param local Whether array is Channel::members_local
+ */
+static void
+member_array_delete(struct MemberArray *array, unsigned int index, bool local)
+{
+  assert(index < array->count);
+
+  if (index != --array->count)
+  {
+    struct MemberEntry *const entry = &array->entry[index];
+
+    *entry = array->entry[array->count];
+
+    if (local == true)
+      entry->member->local_index = index;
+    else
+      entry->member->index = index;
+  }
+
+  if (array->count == 0)
+  {
+    xfree_tag(MEMORY_MEMBER_ARRAY, array->entry, array->size * sizeof(*array->entry));
+    array->entry = NULL;
+    array->size = 0;
+  }
+  else if (array->size > 16 && array->count < array->size / 4)
+  {
+    array->entry = xrealloc_tag(MEMORY_MEMBER_ARRAY, array->entry, array->size * sizeof(*array->entry),
+                                array->size / 2 * sizeof(*array->entry));
+    array->size /= 2;
+  }
+}
+
+/*! \brief Swaps two entries of Channel::members
+ * \param channel Pointer to channel
+ * \param a       Position of one entry
+ * \param b       Position of the other entry
+ */
+static void
+member_array_swap(struct Channel *channel, unsigned int a, unsigned int b)
+{
+  struct MemberEntry *const entry = channel->members.entry;
+  const struct MemberEntry tmp = entry[a];
+
+  entry[a] = entry[b];
+  entry[b] = tmp;
+  entry[a].member->index = a;
+  entry[b].member->index = b;
+}
+
+/*! \brief Moves a member that is about to leave a channel behind the
+ *         position of every ChannelStream walking the channel
+ * \param channel Pointer to channel
+ * \param index   Position of the leaving member in Channel::members
+ *
+ * member_array_delete() fills the gap with the last entry.  A stream that is
+ * already past the gap would never get to that entry, so the gap is first
+ * moved up to the position of every such stream in turn, each time in
+ * exchange for an entry the stream has already listed.
+ */
+static void
+member_array_keep_streams(struct Channel *channel, unsigned int index)
+{
+  while (true)
+  {
+    struct ChannelStream *next = NULL;
+    dlink_node *node;
+
+    DLINK_FOREACH(node, channel->streams.head)
+    {
+      struct ChannelStream *stream = node->data;
+
+      if (stream->index > index && (next == NULL || stream->index < next->index))
+        next = stream;
+    }
+
+    if (next == NULL)
+      break;
+
+    member_array_swap(channel, index, --next->index);
+    index = next->index;
+  }
+}
+
+/*! \brief Counts a new remote member of a channel against the server
+ *         link it is behind
+ * \param channel Pointer to channel
+ * \param link    Pointer to directly connected server
+ */
+static void
+channel_route_add(struct Channel *channel, struct Client *link)
+{
+  for (unsigned int i = 0; i < channel->routes_count; ++i)
+  {
+    if (channel->routes[i].link == link)
+    {
+      ++channel->routes[i].count;
+      return;
+    }
+  }
+
+  channel->routes = xrealloc_tag(MEMORY_CHANNEL_ROUTE, channel->routes,
+                                 channel->routes_count * sizeof(*channel->routes),
+                                 (channel->routes_count + 1) * sizeof(*channel->routes));
+  channel->routes[channel->routes_count].link = link;
+  channel->routes[channel->routes_count].count = 1;
+  ++channel->routes_count;
+}
+
+/*! \brief Takes a departing remote member of a channel off the count of
+ *         the server link it is behind
+ * \param channel Pointer to channel
+ * \param link    Pointer to directly connected server
+ */
+static void
+channel_route_del(struct Channel *channel, const struct Client *link)
+{
+  for (unsigned int i = 0; i < channel->routes_count; ++i)
+  {
+    if (channel->routes[i].link != link)
+      continue;
+
+    if (--channel->routes[i].count == 0)
+    {
+      channel->routes[i] = channel->routes[--channel->routes_count];
+
+      /* Keep the array exactly routes_count long so its size is known */
+      if (channel->routes_count == 0)
+      {
+        xfree_tag(MEMORY_CHANNEL_ROUTE, channel->routes, sizeof(*channel->routes));
+        channel->routes = NULL;
+      }
+      else
+        channel->routes = xrealloc_tag(MEMORY_CHANNEL_ROUTE, channel->routes,
+                                       (channel->routes_count + 1) * sizeof(*channel->routes),
+                                       channel->routes_count * sizeof(*channel->routes));
+    }
+
+    return;
+  }
+
+  assert(0);
+}
+
 /*! \brief Adds a user to a channel by adding another link to the
  *         channels member chain.
  * \param channel    Pointer to channel to add client to
@@ -102,15 +281,17 @@ add_user_to_channel(struct Channel *channel, struct Client *client,
     channel->last_join_time = event_base->time.sec_monotonic;
   }
 
-  struct ChannelMember *member = xcalloc(sizeof(*member));
+  struct ChannelMember *member = xcalloc_tag(MEMORY_MEMBER, sizeof(*member));
   member->client = client;
   member->channel = channel;
   member->flags = flags;
 
-  dlinkAdd(member, &member->channode, &channel->members);
+  member->index = member_array_add(&channel->members, member);
 
   if (MyConnect(client))
-    dlinkAdd(member, &member->locchannode, &channel->members_local);
+    member->local_index = member_array_add(&channel->members_local, member);
+  else
+    channel_route_add(channel, client->from);
 
   dlinkAdd(member, &member->usernode, &client->channel);
 }
@@ -125,16 +306,21 @@ remove_user_from_channel(struct ChannelMember *member)
   struct Client *const client = member->client;
   struct Channel *const channel = member->channel;
 
-  dlinkDelete(&member->channode, &channel->members);
+  if (channel->streams.head)
+    member_array_keep_streams(channel, member->index);
+
+  member_array_delete(&channel->members, member->index, false);
 
   if (MyConnect(client))
-    dlinkDelete(&member->locchannode, &channel->members_local);
+    member_array_delete(&channel->members_local, member->local_index, true);
+  else
+    channel_route_del(channel, client->from);
 
   dlinkDelete(&member->usernode, &client->channel);
 
-  xfree(member);
+  xfree_tag(MEMORY_MEMBER, member, sizeof(*member));
 
-  if (channel->members.head == NULL)
+  if (channel->members.count == 0)
     channel_free(channel);
 }
 
@@ -148,7 +334,6 @@ static void
 channel_send_members(struct Client *client, const struct Channel *channel,
                      const char *modebuf, const char *parabuf)
 {
-  dlink_node *node;
   char buf[IRCD_BUFSIZE];
   int tlen;              /* length of text to append */
   char *t, *start;       /* temp char pointer */
@@ -157,9 +342,9 @@ channel_send_members(struct Client *client, const struct Channel *channel,
                              me.id, channel->creation_time,
                              channel->name, modebuf, parabuf);
 
-  DLINK_FOREACH(node, channel->members.head)
+  for (unsigned int i = 0; i < channel->members.count; ++i)
   {
-    const struct ChannelMember *member = node->data;
+    const struct ChannelMember *member = channel->members.entry[i].member;
 
     tlen = strlen(member->client->id) + 1;  /* +1 for space */
 
@@ -195,7 +380,7 @@ channel_send_members(struct Client *client, const struct Channel *channel,
   }
 
   /* Should always be non-NULL unless we have a kind of persistent channels */
-  if (channel->members.head)
+  if (channel->members.count)
     --t;  /* Take the space out */
   *t = '\0';
   sendto_one(client, "%s", buf);
@@ -299,11 +484,55 @@ channel_check_name(const char *name, bool local)
   return p - name <= CHANNELLEN;
 }
 
+static unsigned int
+ban_hash_value(const dlink_list *list, const char *banstr)
+{
+  return (strhash(banstr) ^ (unsigned int)((uintptr_t)list / sizeof(*list))) % HASHSIZE;
+}
+
+/*! \brief Looks up a mask on a channel's ban, exception or invex list
+ * \param list   Pointer to Channel::banlist, ::exceptlist or ::invexlist
+ * \param banstr Mask to look for; compared case-insensitively
+ * \return Pointer to the Ban, or NULL if the mask is not on the list
+ */
+struct Ban *
+find_ban(const dlink_list *list, const char *banstr)
+{
+  dlink_node *node;
+
+  DLINK_FOREACH(node, ban_hash[ban_hash_value(list, banstr)].head)
+  {
+    struct Ban *ban = node->data;
+
+    if (ban->list == list && irccmp(ban->banstr, banstr) == 0)
+      return ban;
+  }
+
+  return NULL;
+}
+
+/*! \brief Puts a ban on a channel's ban, exception or invex list
+ * \param ban  Pointer to the Ban; Ban::banstr must already be set
+ * \param list Pointer to the list to add it to
+ */
+void
+add_ban(struct Ban *ban, dlink_list *list)
+{
+  ban->list = list;
+  ban->hashv = ban_hash_value(list, ban->banstr);
+
+  dlinkAdd(ban, &ban->node, list);
+  dlinkAdd(ban, &ban->hnode, &ban_hash[ban->hashv]);
+}
+
 void
 remove_ban(struct Ban *ban, dlink_list *list)
 {
+  assert(ban->list == list);
+
+  dlinkDelete(&ban->hnode, &ban_hash[ban->hashv]);
   dlinkDelete(&ban->node, list);
-  xfree(ban);
+  xfree_tag(MEMORY_BAN, ban, sizeof(*ban));
 }
 
 /* channel_free_mask_list()
@@ -332,7 +561,7 @@ channel_make(const char *name)
 {
   assert(!EmptyString(name));
 
-  struct Channel *channel = xcalloc(sizeof(*channel));
+  struct Channel *channel = xcalloc_tag(MEMORY_CHANNEL, sizeof(*channel));
   channel->hnextch = channel;
   /* Doesn't hurt to set it here */
   channel->creation_time = event_base->time.sec_real;
@@ -355,6 +584,7 @@ channel_make(const char *name)
 void
 channel_free(struct Channel *channel)
 {
+  channel_stream_channel_free(channel);
   invite_clear_list(&channel->invites);
 
   /* Free ban/exception/invex lists */
@@ -370,13 +600,14 @@ channel_free(struct Channel *channel)
   assert(channel->node.prev == NULL);
   assert(channel->node.next == NULL);
 
-  assert(dlink_list_length(&channel->members_local) == 0);
-  assert(channel->members_local.head == NULL);
-  assert(channel->members_local.tail == NULL);
+  assert(channel->members_local.count == 0);
+  assert(channel->members_local.entry == NULL);
 
-  assert(dlink_list_length(&channel->members) == 0);
-  assert(channel->members.head == NULL);
-  assert(channel->members.tail == NULL);
+  assert(channel->members.count == 0);
+  assert(channel->members.entry == NULL);
+
+  assert(channel->routes_count == 0);
+  assert(channel->routes == NULL);
 
   assert(dlink_list_length(&channel->invites) == 0);
   assert(channel->invites.head == NULL);
@@ -394,7 +625,7 @@ channel_free(struct Channel *channel)
   assert(channel->invexlist.head == NULL);
   assert(channel->invexlist.tail == NULL);
 
-  xfree(channel);
+  xfree_tag(MEMORY_CHANNEL, channel, sizeof(*channel));
 }
 
 /*!
@@ -411,83 +642,173 @@ channel_pub_or_secret(const struct Channel *channel)
   return "=";
 }
 
-/*! \brief lists all names on given channel
- * \param client   Pointer to client struct requesting names
- * \param channel  Pointer to channel block
- * \param show_eon Show RPL_ENDOFNAMES numeric or not
- *                 (don't want it with /names with no params)
+enum { NAMES_SHOW_EON = 1 << 0 };
+
+/*! \brief Replies with the next members of a channel to NAMES; see
+ *         ChannelStream::handler
+ * \param stream Pointer to the ChannelStream of the reply
+ * \return true if all members have been listed
  */
-void
-channel_member_names(struct Client *client, struct Channel *channel, bool show_eon)
+static bool
+channel_member_names_next(struct ChannelStream *stream)
 {
-  dlink_node *node;
-  char buf[IRCD_BUFSIZE + 1];
-  int tlen = 0;
+  struct Client *const client = stream->client;
+  struct Channel *const channel = stream->channel;
+  struct Reply reply = { .body_numeric = 0 };
+  char buf[IRCD_BUFSIZE];
+  char *t = buf;
+  size_t tlen = 0;
   bool is_member = IsMember(client, channel);
   bool multi_prefix = HasCap(client, CAP_MULTI_PREFIX) != 0;
   bool uhnames = HasCap(client, CAP_UHNAMES) != 0;
+  bool done = true;
 
   assert(IsClient(client));
 
-  if (PubChannel(channel) || is_member == true)
-  {
-    char *t = buf + snprintf(buf, sizeof(buf), numeric_form(RPL_NAMREPLY), me.name, client->name,
-                             channel_pub_or_secret(channel), channel->name);
-    char *start = t;
+  if (!PubChannel(channel) && is_member == false)
+    return true;
 
-    DLINK_FOREACH(node, channel->members.head)
-    {
-      const struct ChannelMember *member = node->data;
+  /* Room for the names next to the rest of RPL_NAMREPLY */
+  reply_body(&reply, RPL_NAMREPLY, channel_pub_or_secret(channel), channel->name, "");
+  const size_t room = reply_body_room(client, &reply);
 
-      if (HasUMode(member->client, UMODE_INVISIBLE) && is_member == false)
-        continue;
+  for (; stream->index < channel->members.count; ++stream->index)
+  {
+    const struct ChannelMember *member = channel->members.entry[stream->index].member;
 
-      if (uhnames == true)
-        tlen = strlen(member->client->name) + strlen(member->client->username) +
-               strlen(member->client->host) + 3;  /* +3 for ! + @ + space */
-      else
-        tlen = strlen(member->client->name) + 1;  /* +1 for space */
+    if (exceeding_sendq(client) == true)
+    {
+      done = false;  /* Continued by channel_stream_run() */
+      break;
+    }
 
-      if (multi_prefix == true)
-      {
-        if (member->flags & CHFL_CHANOP)
-          ++tlen;
-        if (member->flags & CHFL_HALFOP)
-          ++tlen;
-        if (member->flags & CHFL_VOICE)
-          ++tlen;
-      }
-      else
-      {
-        if (member->flags & (CHFL_CHANOP | CHFL_HALFOP | CHFL_VOICE))
-          ++tlen;
-      }
+    if (HasUMode(member->client, UMODE_INVISIBLE) && is_member == false)
+      continue;
 
-      if (t + tlen - buf > IRCD_BUFSIZE - 2)
-      {
-        *(t - 1) = '\0';
-        sendto_one(client, "%s", buf);
-        t = start;
-      }
+    if (uhnames == true)
+      tlen = strlen(member->client->name) + strlen(member->client->username) +
+             strlen(member->client->host) + 3;  /* +3 for ! + @ + space */
+    else
+      tlen = strlen(member->client->name) + 1;  /* +1 for space */
 
-      if (uhnames == true)
-        t += sprintf(t, "%s%s!%s@%s ", get_member_status(member, multi_prefix),
-                     member->client->name, member->client->username,
-                     member->client->host);
-      else
-        t += sprintf(t, "%s%s ", get_member_status(member, multi_prefix),
-                     member->client->name);
+    if (multi_prefix == true)
+    {
+      if (member->flags & CHFL_CHANOP)
+        ++tlen;
+      if (member->flags & CHFL_HALFOP)
+        ++tlen;
+      if (member->flags & CHFL_VOICE)
+        ++tlen;
+    }
+    else
+    {
+      if (member->flags & (CHFL_CHANOP | CHFL_HALFOP | CHFL_VOICE))
+        ++tlen;
     }
 
-    if (tlen)
+    if (t != buf && (size_t)(t - buf) + tlen > room)
     {
-      *(t - 1) = '\0';
-      sendto_one(client, "%s", buf);
+      *(t - 1) = '\0';  /* Drop the trailing space */
+      reply_body(&reply, RPL_NAMREPLY, channel_pub_or_secret(channel), channel->name, buf);
+      sendto_one_reply(client, &reply);
+      t = buf;
     }
+
+    if (uhnames == true)
+      t += sprintf(t, "%s%s!%s@%s ", get_member_status(member, multi_prefix),
+                   member->client->name, member->client->username,
+                   member->client->host);
+    else
+      t += sprintf(t, "%s%s ", get_member_status(member, multi_prefix),
+                   member->client->name);
+  }
+
+  if (t != buf)
+  {
+    *(t - 1) = '\0';
+    reply_body(&reply, RPL_NAMREPLY, channel_pub_or_secret(channel), channel->name, buf);
+    sendto_one_reply(client, &reply);
   }
 
-  if (show_eon == true)
-    sendto_one_numeric(client, &me, RPL_ENDOFNAMES, channel->name);
+  return done;
+}
+
+static void
+channel_member_names_end(struct ChannelStream *stream)
+{
+  if (stream->flags & NAMES_SHOW_EON)
+    sendto_one_numeric(stream->client, &me, RPL_ENDOFNAMES, stream->name);
+}
+
+/*! \brief lists all names on given channel
+ * \param client   Pointer to client struct requesting names
+ * \param channel  Pointer to channel block
+ * \param show_eon Show RPL_ENDOFNAMES numeric or not
+ *                 (don't want it with /names with no params)
+ *
+ * Members that don't fit into the sendq right away are listed by
+ * channel_stream_run() as it drains.
+ */
+void
+channel_member_names(struct Client *client, struct Channel *channel, bool show_eon)
+{
+  channel_stream_start(client, channel, channel->name, show_eon ? NAMES_SHOW_EON : 0,
+                       channel_member_names_next, channel_member_names_end);
+}
+
+/*! \brief Replies with the next members of a channel to WHO; see
+ *         ChannelStream::handler
+ * \param stream Pointer to the ChannelStream of the reply
+ * \return true if all members have been listed
+ */
+static bool
+channel_member_who_next(struct ChannelStream *stream)
+{
+  struct Client *const client = stream->client;
+  struct Channel *const channel = stream->channel;
+
+  for (; stream->index < channel->members.count; ++stream->index)
+  {
+    const struct ChannelMember *member = channel->members.entry[stream->index].member;
+    const struct Client *target = member->client;
+
+    if (exceeding_sendq(client) == true)
+      return false;  /* Continued by channel_stream_run() */
+
+    if (!(stream->flags & WHO_SHOW_INVISIBLE) && HasUMode(target, UMODE_INVISIBLE))
+      continue;
+
+    if (stream->flags & WHO_OPERS_ONLY)
+      if (!HasUMode(target, UMODE_OPER) ||
+          (HasUMode(target, UMODE_HIDDEN) && !HasUMode(client, UMODE_OPER)))
+        continue;
+
+    show_who(client, target, channel->name, get_member_status(member, !!HasCap(client, CAP_MULTI_PREFIX)));
+  }
+
+  return true;
+}
+
+static void
+channel_member_who_end(struct ChannelStream *stream)
+{
+  sendto_one_numeric(stream->client, &me, RPL_ENDOFWHO, stream->name);
+}
+
+/*! \brief Replies to WHO with the members of a channel, followed by
+ *         RPL_ENDOFWHO
+ * \param client  Pointer to client struct requesting who
+ * \param channel Pointer to channel block
+ * \param name    Name to report in RPL_ENDOFWHO
+ * \param flags   WHO_SHOW_INVISIBLE and/or WHO_OPERS_ONLY
+ *
+ * Like channel_member_names(), the reply is spread out as the sendq drains.
+ */
+void
+channel_member_who(struct Client *client, struct Channel *channel, const char *name, unsigned int flags)
+{
+  channel_stream_start(client, channel, name, flags,
+                       channel_member_who_next, channel_member_who_end);
 }
 
 /* get_member_status()
@@ -554,8 +875,8 @@ ban_matches(struct Client *client, struct Channel *channel, struct Ban *ban)
     switch (ban->type)
     {
       case HM_HOST:
-        if (match(ban->host, client->realhost) == 0 ||
-            match(ban->host, client->sockhost) == 0 || match(ban->host, client->host) == 0)
+        if (match(ban->host, client->cold->realhost) == 0 ||
+            match(ban->host, client->cold->sockhost) == 0 || match(ban->host, client->host) == 0)
           return true;
         break;
       case HM_IPV4:
@@ -651,7 +972,7 @@ can_join(struct Client *client, struct Channel *channel, const char *key)
   if (channel->mode.key[0] && (key == NULL || strcmp(channel->mode.key, key)))
     return ERR_BADCHANNELKEY;
 
-  if (channel->mode.limit && dlink_list_length(&channel->members) >=
+  if (channel->mode.limit && channel->members.count >=
       channel->mode.limit)
     return ERR_CHANNELISFULL;
 
@@ -676,11 +997,11 @@ find_channel_link(const struct Client *client, const struct Channel *channel)
     return NULL;
 
   /* Take the shortest of the two lists */
-  if (dlink_list_length(&channel->members) < dlink_list_length(&client->channel))
+  if (channel->members.count < dlink_list_length(&client->channel))
   {
-    DLINK_FOREACH(node, channel->members.head)
-      if (((struct ChannelMember *)node->data)->client == client)
-        return node->data;
+    for (unsigned int i = 0; i < channel->members.count; ++i)
+      if (channel->members.entry[i].client == client)
+        return channel->members.entry[i].member;
   }
   else
   {
@@ -692,6 +1013,43 @@ find_channel_link(const struct Client *client, const struct Channel *channel)
   return NULL;
 }
 
+/*! \brief Checks whether two clients are on at least one channel together
+ * \param client1 Pointer to client
+ * \param client2 Pointer to client
+ * \return true if they share a channel, false otherwise
+ *
+ * The channels of the client on fewer channels are marked first, and the
+ * other client's channels are then checked for the mark; this takes
+ * time linear in the number of channels both clients are on.
+ */
+bool
+channel_common(const struct Client *client1, const struct Client *client2)
+{
+  static uintmax_t current_serial;
+  dlink_node *node;
+
+  if (dlink_list_length(&client1->channel) > dlink_list_length(&client2->channel))
+  {
+    const struct Client *tmp = client1;
+    client1 = client2;
+    client2 = tmp;
+  }
+
+  if (dlink_list_length(&client1->channel) == 0)
+    return false;
+
+  ++current_serial;
+
+  DLINK_FOREACH(node, client1->channel.head)
+    ((struct ChannelMember *)node->data)->channel->serial = current_serial;
+
+  DLINK_FOREACH(node, client2->channel.head)
+    if (((struct ChannelMember *)node->data)->channel->serial == current_serial)
+      return true;
+
+  return false;
+}
+
 /*! Checks if a message contains control codes
  * \param message The actual message string the client wants to send
  * \return 1 if the message does contain any control codes, 0 otherwise
@@ -935,7 +1293,7 @@ channel_do_join(struct Client *client, char *chan_list, char *key_list)
        * This should never be the case unless there is some sort of
        * persistent channels.
        */
-      if (dlink_list_length(&channel->members) == 0)
+      if (channel->members.count == 0)
         flags = CHFL_CHANOP;
       else
         flags = 0;
@@ -969,7 +1327,7 @@ channel_do_join(struct Client *client, char *chan_list, char *key_list)
        */
       sendto_channel_local(NULL, channel, 0, CAP_EXTENDED_JOIN, 0, ":%s!%s@%s JOIN %s %s :%s",
                            client->name, client->username,
-                           client->host, channel->name, client->account, client->info);
+                           client->host, channel->name, client->cold->account, client->cold->info);
       sendto_channel_local(NULL, channel, 0, 0, CAP_EXTENDED_JOIN, ":%s!%s@%s JOIN :%s",
                            client->name, client->username,
                            client->host, channel->name);
@@ -984,17 +1342,17 @@ channel_do_join(struct Client *client, char *chan_list, char *key_list)
 
       sendto_channel_local(NULL, channel, 0, CAP_EXTENDED_JOIN, 0, ":%s!%s@%s JOIN %s %s :%s",
                            client->name, client->username,
-                           client->host, channel->name, client->account, client->info);
+                           client->host, channel->name, client->cold->account, client->cold->info);
       sendto_channel_local(NULL, channel, 0, 0, CAP_EXTENDED_JOIN, ":%s!%s@%s JOIN :%s",
                            client->name, client->username,
                            client->host, channel->name);
     }
 
-    if (client->away[0])
+    if (client->cold->away)
       sendto_channel_local(client, channel, 0, CAP_AWAY_NOTIFY, 0,
                            ":%s!%s@%s AWAY :%s",
                            client->name, client->username,
-                           client->host, client->away);
+                           client->host, client->cold->away);
 
     struct Invite *invite = invite_find(channel, client);
     if (invite)
@@ -76,7 +76,7 @@ invite_add(struct Channel *channel, struct Client *client)
   if (invite)
     invite_del(invite);
 
-  invite = xcalloc(sizeof(*invite));
+  invite = xcalloc_tag(MEMORY_INVITE, sizeof(*invite));
   invite->client = client;
   invite->channel = channel;
   invite->when = event_base->time.sec_monotonic;
@@ -104,7 +104,7 @@ invite_del(struct Invite *invite)
   dlinkDelete(&invite->chan_node, &invite->channel->invites);
 
   /* Release memory pointed to by 'invite' */
-  xfree(invite);
+  xfree_tag(MEMORY_INVITE, invite, sizeof(*invite));
 }
 
 /*! \brief Removes and frees all Invite blocks from a list
@@ -103,7 +103,6 @@ get_mask(const struct Ban *ban)
 const char *
 add_id(struct Client *client, struct Channel *channel, const char *banid, dlink_list *list, unsigned int type)
 {
-  dlink_node *node;
   char mask[MODEBUFLEN];
   char *maskptr = mask;
   unsigned int extbans, offset;
@@ -173,7 +172,7 @@ add_id(struct Client *client, struct Channel *channel, const char *banid, dlink_
   if (EmptyString(maskptr))
     return NULL;
 
-  struct Ban *ban = xcalloc(sizeof(*ban));
+  struct Ban *ban = xcalloc_tag(MEMORY_BAN, sizeof(*ban));
   ban->extban = extbans;
   ban->when = event_base->time.sec_real;
 
@@ -205,18 +204,13 @@ add_id(struct Client *client, struct Channel *channel, const char *banid, dlink_
   else
     ban->banstr_len = strlcpy(ban->banstr, banid, sizeof(ban->banstr));
 
-  DLINK_FOREACH(node, list->head)
+  if (find_ban(list, ban->banstr))
   {
-    const struct Ban *tmp = node->data;
-
-    if (irccmp(tmp->banstr, ban->banstr) == 0)
-    {
-      xfree(ban);
-      return NULL;
-    }
+    xfree_tag(MEMORY_BAN, ban, sizeof(*ban));
+    return NULL;
   }
 
-  clear_ban_cache_list(&channel->members_local);
+  clear_ban_cache_channel(channel);
 
   if (IsClient(client))
     snprintf(ban->who, sizeof(ban->who), "%s!%s@%s", client->name,
@@ -226,7 +220,7 @@ add_id(struct Client *client, struct Channel *channel, const char *banid, dlink_
   else
     strlcpy(ban->who, client->name, sizeof(ban->who));
 
-  dlinkAdd(ban, &ban->node, list);
+  add_ban(ban, list);
 
   return ban->banstr;
 }
@@ -242,26 +236,19 @@ static const char *
 del_id(struct Client *client, struct Channel *channel, const char *banid, dlink_list *list, unsigned int type)
 {
   static char mask[MODEBUFLEN];
-  dlink_node *node;
   assert(banid);
 
   /* TBD: n!u@h formatting fo local clients */
 
-  DLINK_FOREACH(node, list->head)
-  {
-    struct Ban *ban = node->data;
-
-    if (irccmp(banid, ban->banstr) == 0)
-    {
-      strlcpy(mask, ban->banstr, sizeof(mask));  /* caSe might be different in 'banid' */
-      clear_ban_cache_list(&channel->members_local);
-      remove_ban(ban, list);
+  struct Ban *ban = find_ban(list, banid);
+  if (ban == NULL)
+    return NULL;
 
-      return mask;
-    }
-  }
+  strlcpy(mask, ban->banstr, sizeof(mask));  /* caSe might be different in 'banid' */
+  clear_ban_cache_channel(channel);
+  remove_ban(ban, list);
 
-  return NULL;
+  return mask;
 }
 
 /* channel_modes()
@@ -345,6 +332,21 @@ clear_ban_cache_list(dlink_list *list)
   }
 }
 
+/*
+ * inputs       - pointer to channel
+ * output       - none
+ * side effects - clear ban cache of the local members of a channel
+ */
+void
+clear_ban_cache_channel(struct Channel *channel)
+{
+  for (unsigned int i = 0; i < channel->members_local.count; ++i)
+  {
+    struct ChannelMember *member = channel->members_local.entry[i].member;
+    member->flags &= ~(CHFL_BAN_SILENCED | CHFL_BAN_CHECKED | CHFL_MUTE_CHECKED);
+  }
+}
+
 /*
  * Bitmasks for various error returns that channel_mode_set should only return
  * once per call  -orabidoo
@@ -0,0 +1,193 @@
+/*
+ *  ircd-hybrid: an advanced, lightweight Internet Relay Chat Daemon (ircd)
+ *
+ *  Copyright (c) 2020 ircd-hybrid development team
+ *
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301
+ *  USA
+ */
+
+/*! \file channel_stream.c
+ * \brief Replies walking the member list of a channel, sent as the sendq drains.
+ * \version $Id$
+ *
+ * NAMES and WHO on a large channel used to put their whole reply into the
+ * sendq at once.  They now register a ChannelStream instead, which replies
+ * with members until the sendq is half full and is then resumed from the
+ * main loop, just like LIST does with its ListTask.  A client's streams are
+ * queued and run one after another so their replies don't interleave, and
+ * the client's input is left unparsed until they are done so that replies
+ * to later commands, including the end of list numeric of a NAMES or WHO
+ * that has nothing to stream, don't overtake them either.
+ *
+ * Channel::members is unordered and removing a member moves another one
+ * into its place; remove_user_from_channel() keeps the position of every
+ * stream on the channel right, so members that stay on the channel are
+ * listed exactly once.  Members joining while a stream runs are appended
+ * and listed as well.
+ */
+
+#include "stdinc.h"
+#include "list.h"
+#include "channel.h"
+#include "channel_stream.h"
+#include "client.h"
+#include "event.h"
+#include "irc_string.h"
+#include "memory.h"
+#include "packet.h"
+#include "send.h"
+
+
+/** Clients with streams queued; resumed by channel_stream_run() from the main loop */
+dlink_list streaming_client_list;
+
+
+static void
+channel_stream_free(struct ChannelStream *stream)
+{
+  struct Connection *const connection = stream->client->connection;
+
+  if (stream->channel)
+    dlinkDelete(&stream->channel_node, &stream->channel->streams);
+
+  dlinkDelete(&stream->node, &connection->channel_streams);
+  xfree_tag(MEMORY_CHANNEL_STREAM, stream, sizeof(*stream));
+
+  if (connection->channel_streams.head == NULL)
+    dlinkDelete(&connection->stream_node, &streaming_client_list);
+}
+
+/*! \brief Queues a reply walking the members of a channel
+ * \param client  Pointer to local client to reply to
+ * \param channel Pointer to channel to list
+ * \param name    Name to report in the end of list numeric
+ * \param flags   Passed on to the handler
+ * \param handler Function replying with members, see ChannelStream::handler
+ * \param finish  Function sending the end of list numeric
+ *
+ * The reply is sent right away as far as the sendq allows, unless the client
+ * is still waiting for an earlier one.
+ */
+void
+channel_stream_start(struct Client *client, struct Channel *channel, const char *name, unsigned int flags,
+                     bool (*handler)(struct ChannelStream *), void (*finish)(struct ChannelStream *))
+{
+  struct Connection *const connection = client->connection;
+
+  assert(MyConnect(client));
+
+  struct ChannelStream *stream = xcalloc_tag(MEMORY_CHANNEL_STREAM, sizeof(*stream));
+  stream->client = client;
+  stream->channel = channel;
+  stream->flags = flags;
+  stream->handler = handler;
+  stream->finish = finish;
+  strlcpy(stream->name, name, sizeof(stream->name));
+
+  dlinkAdd(stream, &stream->channel_node, &channel->streams);
+
+  if (connection->channel_streams.head)
+  {
+    dlinkAddTail(stream, &stream->node, &connection->channel_streams);
+    return;  /* Runs once the earlier ones are done */
+  }
+
+  dlinkAdd(stream, &stream->node, &connection->channel_streams);
+  dlinkAdd(client, &connection->stream_node, &streaming_client_list);
+  channel_stream_run(client);
+}
+
+/*! \brief Continues the replies queued for a client until they are all
+ *         sent or its sendq is half full
+ * \param client Pointer to local client
+ */
+void
+channel_stream_run(struct Client *client)
+{
+  dlink_node *node;
+
+  while ((node = client->connection->channel_streams.head))
+  {
+    struct ChannelStream *stream = node->data;
+
+    if (IsDead(client) || exceeding_sendq(client) == true)
+      return;  /* Still more to do */
+
+    /* Its socket isn't read meanwhile; the replies getting through show it's alive */
+    client->connection->last_ping = event_base->time.sec_monotonic;
+
+    if (stream->channel && stream->handler(stream) == false)
+      return;
+
+    stream->finish(stream);
+    channel_stream_free(stream);
+  }
+}
+
+/*! \brief Continues the replies of every client that has some queued; called
+ *         from the main loop
+ *
+ * A client's input isn't parsed, and its socket isn't read, while it has
+ * replies queued; see parse_client_queued() and read_packet().  Whatever it
+ * had sent is parsed as soon as the last of them is done, and reading
+ * resumes.
+ */
+void
+channel_stream_run_all(void)
+{
+  dlink_node *node, *node_next;
+
+  DLINK_FOREACH_SAFE(node, node_next, streaming_client_list.head)
+  {
+    struct Client *client = node->data;
+
+    channel_stream_run(client);
+
+    if (client->connection->channel_streams.head)
+      continue;
+
+    parse_client_queued(client);
+
+    if (!IsDefunct(client) && client->connection->channel_streams.head == NULL)
+      read_packet(client->connection->fd, client);
+  }
+}
+
+/*! \brief Drops the replies queued for a client without sending the rest
+ * \param client Pointer to local client
+ */
+void
+channel_stream_clear(struct Client *client)
+{
+  while (client->connection->channel_streams.head)
+    channel_stream_free(client->connection->channel_streams.head->data);
+}
+
+/*! \brief Detaches the streams of a channel that is being destroyed; they
+ *         send their end of list numeric the next time they run
+ * \param channel Pointer to channel
+ */
+void
+channel_stream_channel_free(struct Channel *channel)
+{
+  while (channel->streams.head)
+  {
+    struct ChannelStream *stream = channel->streams.head->data;
+
+    dlinkDelete(&stream->channel_node, &channel->streams);
+    stream->channel = NULL;
+  }
+}
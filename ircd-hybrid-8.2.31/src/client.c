@@ -27,6 +27,7 @@
 #include "stdinc.h"
 #include "list.h"
 #include "client.h"
+#include "channel_stream.h"
 #include "client_svstag.h"
 #include "event.h"
 #include "hash.h"
@@ -52,6 +53,7 @@
 #include "ipcache.h"
 #include "channel.h"
 #include "channel_invite.h"
+#include "intern.h"
 
 
 dlink_list listing_client_list;
@@ -84,19 +86,26 @@ static dlink_node *eac_next;  /* next aborted client to exit */
 struct Client *
 client_make(struct Client *from)
 {
-  struct Client *client = xcalloc(sizeof(*client));
+  struct Client *client = xcalloc_tag(MEMORY_CLIENT, sizeof(*client));
+
+  client->cold = xcalloc_tag(MEMORY_CLIENT_COLD, sizeof(*client->cold));
+  client->host = intern_get("", 0);
+  client->cold->realhost = intern_get("", 0);
+  client->cold->sockhost = intern_get("", 0);
 
   if (from)
     client->from = from;
   else
   {
     client->from = client;  /* 'from' of local client is self! */
-    client->connection = xcalloc(sizeof(*client->connection));
+    client->connection = xcalloc_tag(MEMORY_CONNECTION, sizeof(*client->connection));
     client->connection->last_data = event_base->time.sec_monotonic;
     client->connection->last_ping = event_base->time.sec_monotonic;
     client->connection->created_real = event_base->time.sec_real;
     client->connection->created_monotonic = event_base->time.sec_monotonic;
     client->connection->registration = REG_INIT;
+    client->connection->buf_sendq.total = &dbuf_sendq_total;
+    client->connection->buf_recvq.total = &dbuf_recvq_total;
 
     /* as good a place as any... */
     dlinkAdd(client, &client->connection->lclient_node, &unknown_list);
@@ -106,7 +115,7 @@ client_make(struct Client *from)
   client->hnext = client;
   SetUnknown(client);
   strcpy(client->username, "unknown");
-  strcpy(client->account, "*");
+  strcpy(client->cold->account, "*");
 
   return client;
 }
@@ -132,21 +141,25 @@ client_free(struct Client *client)
   assert(client->lnode.prev == NULL);
   assert(client->lnode.next == NULL);
 
-  assert(dlink_list_length(&client->whowas_list) == 0);
-  assert(client->whowas_list.head == NULL);
-  assert(client->whowas_list.tail == NULL);
+  assert(dlink_list_length(&client->cold->whowas_list) == 0);
+  assert(client->cold->whowas_list.head == NULL);
+  assert(client->cold->whowas_list.tail == NULL);
 
   assert(dlink_list_length(&client->channel) == 0);
   assert(client->channel.head == NULL);
   assert(client->channel.tail == NULL);
 
-  assert(dlink_list_length(&client->svstags) == 0);
-  assert(client->svstags.head == NULL);
-  assert(client->svstags.tail == NULL);
+  assert(dlink_list_length(&client->cold->svstags) == 0);
+  assert(client->cold->svstags.head == NULL);
+  assert(client->cold->svstags.tail == NULL);
 
 
-  xfree(client->serv);
-  xfree(client->certfp);
+  xfree_tag(MEMORY_SERVER, client->serv, sizeof(*client->serv));
+  xfree(client->cold->certfp);
+  xfree_str_tag(MEMORY_AWAY, client->cold->away);
+  intern_put(client->host);
+  intern_put(client->cold->realhost);
+  intern_put(client->cold->sockhost);
 
   if (MyConnect(client))
   {
@@ -154,6 +167,7 @@ client_free(struct Client *client)
     assert(client->connection->lclient_node.next == NULL);
 
     assert(client->connection->list_task == NULL);
+    assert(client->connection->channel_streams.head == NULL);
     assert(client->connection->auth == NULL);
 
     assert(dlink_list_length(&client->connection->acceptlist) == 0);
@@ -189,11 +203,12 @@ client_free(struct Client *client)
     dbuf_clear(&client->connection->buf_recvq);
     dbuf_clear(&client->connection->buf_sendq);
 
-    xfree(client->connection);
+    xfree_tag(MEMORY_CONNECTION, client->connection, sizeof(*client->connection));
     client->connection = NULL;
   }
 
-  xfree(client);
+  xfree_tag(MEMORY_CLIENT_COLD, client->cold, sizeof(*client->cold));
+  xfree_tag(MEMORY_CLIENT, client, sizeof(*client));
 }
 
 /* check_pings_list()
@@ -371,7 +386,7 @@ check_conf_klines(void)
       continue;  /* and go examine next Client */
     }
 
-    if ((ptr = gecos_find(client->info, match)))
+    if ((ptr = gecos_find(client->cold->info, match)))
     {
       const struct GecosItem *conf = ptr;
       conf_try_ban(client, CLIENT_BAN_XLINE, conf->reason);
@@ -531,7 +546,7 @@ client_get_name(const struct Client *client, enum addr_mask_type type)
     case SHOW_IP:
       snprintf(buf, sizeof(buf), "%s[%s@%s]",
                client->name,
-               client->username, client->sockhost);
+               client->username, client->cold->sockhost);
       break;
     case MASK_IP:
       if (client->ip.ss.ss_family == AF_INET)
@@ -585,6 +600,8 @@ client_close_connection(struct Client *client)
     send_queued_write(client);
   }
 
+  send_queued_cancel(client);
+
   if (IsClient(client))
   {
     ++ServerStats.is_cl;
@@ -638,10 +655,11 @@ client_close_connection(struct Client *client)
  * Exit one client, local or remote. Assuming all dependents have
  * been already removed, and socket closed for local client.
  *
- * The only messages generated are QUITs on channels.
+ * The only messages generated are QUITs on channels, unless
+ * they have already been sent by sendto_split_quits().
  */
 static void
-exit_one_client(struct Client *client, const char *comment)
+exit_one_client(struct Client *client, const char *comment, bool quit)
 {
   dlink_node *node, *node_next;
 
@@ -664,14 +682,15 @@ exit_one_client(struct Client *client, const char *comment)
      * that the client can show the "**signoff" message).
      * (Note: The notice is to the local clients *only*)
      */
-    sendto_common_channels_local(client, false, 0, 0, ":%s!%s@%s QUIT :%s",
-                                 client->name, client->username,
-                                 client->host, comment);
+    if (quit == true)
+      sendto_common_channels_local(client, false, 0, 0, ":%s!%s@%s QUIT :%s",
+                                   client->name, client->username,
+                                   client->host, comment);
 
     DLINK_FOREACH_SAFE(node, node_next, client->channel.head)
       remove_user_from_channel(node->data);
 
-    svstag_clear_list(&client->svstags);
+    svstag_clear_list(&client->cold->svstags);
 
     whowas_add_history(client, false);
     whowas_off_history(client);
@@ -708,6 +727,38 @@ exit_one_client(struct Client *client, const char *comment)
   dlinkAdd(client, make_dlink_node(), &dead_list);
 }
 
+/*
+ * Count the clients that depend on 'client', that is the clients on
+ * it and on all servers behind it.
+ */
+static unsigned int
+recurse_count_clients(const struct Client *client)
+{
+  unsigned int count = dlink_list_length(&client->serv->client_list);
+  dlink_node *node;
+
+  DLINK_FOREACH(node, client->serv->server_list.head)
+    count += recurse_count_clients(node->data);
+
+  return count;
+}
+
+/*
+ * Store all clients that depend on 'client' in 'users', which must have
+ * room for recurse_count_clients() entries.
+ */
+static void
+recurse_collect_clients(const struct Client *client, struct Client **users, unsigned int *count)
+{
+  dlink_node *node;
+
+  DLINK_FOREACH(node, client->serv->client_list.head)
+    users[(*count)++] = node->data;
+
+  DLINK_FOREACH(node, client->serv->server_list.head)
+    recurse_collect_clients(node->data, users, count);
+}
+
 /*
  * Remove all clients that depend on 'client'; assumes all (S)QUITs have
  * already been sent.  we make sure to exit a server's dependent clients
@@ -720,15 +771,47 @@ recurse_remove_clients(struct Client *client, const char *comment)
   dlink_node *node, *node_next;
 
   DLINK_FOREACH_SAFE(node, node_next, client->serv->client_list.head)
-    exit_one_client(node->data, comment);
+    exit_one_client(node->data, comment, false);
 
   DLINK_FOREACH_SAFE(node, node_next, client->serv->server_list.head)
   {
     recurse_remove_clients(node->data, comment);
-    exit_one_client(node->data, comment);
+    exit_one_client(node->data, comment, false);
   }
 }
 
+/*
+ * Process a netsplit in one batch: the QUITs of all departing clients
+ * are sent to local clients by sendto_split_quits() first, then the
+ * clients and servers are removed without sending any further QUITs.
+ */
+static void
+split_remove_clients(struct Client *client, const char *comment)
+{
+  const uintmax_t start = event_time_ns();
+  unsigned int count = recurse_count_clients(client);
+
+  if (count)
+  {
+    struct Client **users = xcalloc(count * sizeof(*users));
+
+    count = 0;
+    recurse_collect_clients(client, users, &count);
+    sendto_split_quits(users, count, comment);
+    xfree(users);
+  }
+
+  recurse_remove_clients(client, comment);
+
+  const uintmax_t duration = event_time_ns() - start;
+  perf_add(&PerfStats.split, duration);
+
+  if (count)
+    sendto_realops_flags(UMODE_EXTERNAL, L_ALL, SEND_NOTICE,
+                         "Netsplit of %s removed %u clients in %ju.%03ju ms",
+                         client->name, count, duration / 1000000, (duration / 1000) % 1000);
+}
+
 /*
  * exit_client - exit a client of any type. Generally, you can use
  * this on any struct Client, regardless of its state.
@@ -784,27 +867,30 @@ exit_client(struct Client *client, const char *comment)
       if (client->connection->list_task)
         free_list_task(client);
 
+      channel_stream_clear(client);
+
       invite_clear_list(&client->connection->invited);
       del_all_accepts(client);
       watch_del_watch_list(client);
 
       sendto_realops_flags(UMODE_CCONN, L_ALL, SEND_NOTICE,
                            "Client exiting: %s (%s@%s) [%s] [%s]",
-                           client->name, client->username, client->realhost,
-                           client->sockhost, comment);
+                           client->name, client->username, client->cold->realhost,
+                           client->cold->sockhost, comment);
 
       ilog(LOG_TYPE_USER, "%s (%ju): %s!%s@%s %s %s %ju/%ju :%s",
            date_ctime(client->connection->created_real),
            event_base->time.sec_monotonic - client->connection->created_monotonic,
            client->name, client->username, client->host,
-           client->sockhost, client->account,
+           client->cold->sockhost, client->cold->account,
            client->connection->send.bytes >> 10,
-           client->connection->recv.bytes >> 10, client->info);
+           client->connection->recv.bytes >> 10, client->cold->info);
     }
     else if (IsServer(client))
     {
       assert(dlinkFind(&local_server_list, client));
       dlinkDelete(&client->connection->lclient_node, &local_server_list);
+      send_links_changed();
 
       if (!HasFlag(client, FLAGS_SQUIT))
         /* For them, we are exiting the network */
@@ -824,7 +910,7 @@ exit_client(struct Client *client, const char *comment)
     sendto_realops_flags(UMODE_FARCONNECT, L_ALL, SEND_NOTICE,
                          "Client exiting at %s: %s (%s@%s) [%s] [%s]",
                          client->servptr->name, client->name,
-                         client->username, client->realhost, client->sockhost, comment);
+                         client->username, client->cold->realhost, client->cold->sockhost, comment);
 
   if (IsServer(client))
   {
@@ -848,7 +934,7 @@ exit_client(struct Client *client, const char *comment)
       sendto_server(NULL, 0, 0, "SQUIT %s :%s", client->id, comment);
 
     /* Now exit the clients internally */
-    recurse_remove_clients(client, splitstr);
+    split_remove_clients(client, splitstr);
 
     if (MyConnect(client))
     {
@@ -874,7 +960,7 @@ exit_client(struct Client *client, const char *comment)
   assert(dlinkFind(&listing_client_list, client) == NULL);
   assert(dlinkFind(&abort_list, client) == NULL);
 
-  exit_one_client(client, comment);
+  exit_one_client(client, comment, true);
 }
 
 /*
@@ -1001,37 +1087,137 @@ exit_aborted_clients(void)
  * Diane Bruce, "Dianora" db@db.net
  */
 
+static dlink_list accept_hash[HASHSIZE];
+
+/*
+ * Entries without wildcards are kept in accept_hash, keyed on both the
+ * owner and the mask, so checking a sender against them costs the same
+ * however long the list is.  Only wildcard entries are matched one by one.
+ */
+static unsigned int
+accept_hash_value(const struct Client *owner, const char *nick, const char *user, const char *host)
+{
+  return (strhash(nick) ^ strhash(user) ^ strhash(host) ^
+          (unsigned int)((uintptr_t)owner / sizeof(*owner))) % HASHSIZE;
+}
+
+static bool
+accept_is_wild(const char *mask)
+{
+  return strpbrk(mask, "*?\\") != NULL;
+}
+
+static bool
+accept_compare(const struct AcceptItem *accept_p, const char *nick, const char *user, const char *host)
+{
+  return irccmp(accept_p->nickptr, nick) == 0 &&
+         irccmp(accept_p->userptr, user) == 0 &&
+         irccmp(accept_p->hostptr, host) == 0;
+}
+
 void
-del_accept(struct split_nuh_item *accept_p, struct Client *client)
+add_accept(const char *nick, const char *user, const char *host, struct Client *client)
+{
+  struct AcceptItem *accept_p = xcalloc(sizeof(*accept_p));
+
+  accept_p->owner = client;
+  accept_p->nickptr = xstrdup(nick);
+  accept_p->userptr = xstrdup(user);
+  accept_p->hostptr = xstrdup(host);
+  accept_p->wild = accept_is_wild(nick) || accept_is_wild(user) || accept_is_wild(host);
+
+  dlinkAdd(accept_p, &accept_p->node, &client->connection->acceptlist);
+
+  if (accept_p->wild)
+    dlinkAdd(accept_p, &accept_p->lnode, &client->connection->acceptlist_wild);
+  else
+  {
+    accept_p->hashv = accept_hash_value(client, nick, user, host);
+    dlinkAdd(accept_p, &accept_p->lnode, &accept_hash[accept_p->hashv]);
+  }
+}
+
+void
+del_accept(struct AcceptItem *accept_p, struct Client *client)
 {
   dlinkDelete(&accept_p->node, &client->connection->acceptlist);
 
+  if (accept_p->wild)
+    dlinkDelete(&accept_p->lnode, &client->connection->acceptlist_wild);
+  else
+    dlinkDelete(&accept_p->lnode, &accept_hash[accept_p->hashv]);
+
   xfree(accept_p->nickptr);
   xfree(accept_p->userptr);
   xfree(accept_p->hostptr);
   xfree(accept_p);
 }
 
-struct split_nuh_item *
+/* find_accept()
+ *
+ * inputs       - nick, user and host of the entry
+ *              - pointer to client owning the accept list
+ * output       - the entry that is literally the same mask, or NULL
+ * side effects - NONE
+ */
+struct AcceptItem *
 find_accept(const char *nick, const char *user,
-            const char *host, struct Client *client,
-            int (*compare)(const char *, const char *))
+            const char *host, struct Client *client)
 {
   dlink_node *node;
+  const dlink_list *list;
+
+  if (accept_is_wild(nick) || accept_is_wild(user) || accept_is_wild(host))
+    list = &client->connection->acceptlist_wild;
+  else
+    list = &accept_hash[accept_hash_value(client, nick, user, host)];
 
-  DLINK_FOREACH(node, client->connection->acceptlist.head)
+  DLINK_FOREACH(node, list->head)
   {
-    struct split_nuh_item *accept_p = node->data;
+    struct AcceptItem *accept_p = node->data;
 
-    if (compare(accept_p->nickptr, nick) == 0 &&
-        compare(accept_p->userptr, user) == 0 &&
-        compare(accept_p->hostptr, host) == 0)
+    if (accept_p->owner == client && accept_compare(accept_p, nick, user, host))
       return accept_p;
   }
 
   return NULL;
 }
 
+/* accept_match()
+ *
+ * inputs       - pointer to source client
+ *              - pointer to target client
+ * output       - true if any entry on the target's accept list covers source
+ * side effects - NONE
+ */
+static bool
+accept_match(const struct Client *source, struct Client *target)
+{
+  dlink_node *node;
+  const unsigned int hashv = accept_hash_value(target, source->name, source->username, source->host);
+
+  DLINK_FOREACH(node, accept_hash[hashv].head)
+  {
+    const struct AcceptItem *accept_p = node->data;
+
+    if (accept_p->owner == target &&
+        accept_compare(accept_p, source->name, source->username, source->host))
+      return true;
+  }
+
+  DLINK_FOREACH(node, target->connection->acceptlist_wild.head)
+  {
+    const struct AcceptItem *accept_p = node->data;
+
+    if (match(accept_p->nickptr, source->name) == 0 &&
+        match(accept_p->userptr, source->username) == 0 &&
+        match(accept_p->hostptr, source->host) == 0)
+      return true;
+  }
+
+  return false;
+}
+
 /* accept_message()
  *
  * inputs       - pointer to source client
@@ -1043,20 +1229,15 @@ bool
 accept_message(struct Client *source,
                struct Client *target)
 {
-  dlink_node *node;
-
   if (HasFlag(source, FLAGS_SERVICE) ||
       (HasUMode(source, UMODE_OPER) && ConfigGeneral.opers_bypass_callerid))
     return true;
 
-  if (source == target || find_accept(source->name, source->username,
-                                      source->host, target, match))
+  if (source == target || accept_match(source, target))
     return true;
 
   if (!HasUMode(target, UMODE_CALLERID) && HasUMode(target, UMODE_SOFTCALLERID))
-    DLINK_FOREACH(node, target->channel.head)
-      if (IsMember(source, ((struct ChannelMember *)node->data)->channel))
-        return true;
+    return channel_common(source, target);
 
   return false;
 }
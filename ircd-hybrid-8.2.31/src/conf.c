@@ -30,6 +30,7 @@
 #include "parse.h"
 #include "conf.h"
 #include "conf_cluster.h"
+#include "conf_expire.h"
 #include "conf_gecos.h"
 #include "conf_pseudo.h"
 #include "conf_resv.h"
@@ -40,6 +41,7 @@
 #include "client.h"
 #include "event.h"
 #include "irc_string.h"
+#include "intern.h"
 #include "s_bsd.h"
 #include "ircd.h"
 #include "listener.h"
@@ -58,6 +60,7 @@
 #include "conf_class.h"
 #include "motd.h"
 #include "ipcache.h"
+#include "throttle.h"
 #include "isupport.h"
 #include "whowas.h"
 
@@ -74,6 +77,22 @@ struct conf_parser_context conf_parser_ctx;
 dlink_list connect_items;
 dlink_list operator_items;
 
+/* operator {} and connect {} items from before a rehash; see conf_keep_unchanged() */
+static dlink_list connect_items_old;
+static dlink_list operator_items_old;
+
+/* What the last rehash did to the address records and to the operator {}
+ * and connect {} items; see address_conf_sweep_stale() and conf_keep_unchanged() */
+static struct
+{
+  unsigned int kept;
+  unsigned int added;
+  unsigned int removed;
+  unsigned int items_kept;
+  unsigned int items_added;
+  unsigned int items_removed;
+} rehash_stats;
+
 extern unsigned int lineno;
 extern char linebuf[];
 extern char conffilebuf[IRCD_BUFSIZE];
@@ -316,7 +335,7 @@ verify_access(struct Client *client)
   }
 
   if (IsConfDoSpoofIp(conf))
-    strlcpy(client->host, conf->name, sizeof(client->host));
+    intern_set(&client->host, conf->name, HOSTLEN);
 
   return attach_iline(client, conf);
 }
@@ -341,7 +360,7 @@ conf_check_client(struct Client *client)
 
   if ((i = verify_access(client)))
     ilog(LOG_TYPE_IRCD, "Access denied: %s[%s]",
-         client->name, client->sockhost);
+         client->name, client->cold->sockhost);
 
   switch (i)
   {
@@ -349,7 +368,7 @@ conf_check_client(struct Client *client)
       sendto_realops_flags(UMODE_FULL, L_ALL, SEND_NOTICE,
                            "Too many on IP for %s (%s).",
                            client_get_name(client, SHOW_IP),
-                           client->sockhost);
+                           client->cold->sockhost);
       ilog(LOG_TYPE_IRCD, "Too many connections on IP from %s.",
            client_get_name(client, SHOW_IP));
       ++ServerStats.is_ref;
@@ -360,7 +379,7 @@ conf_check_client(struct Client *client)
       sendto_realops_flags(UMODE_FULL, L_ALL, SEND_NOTICE,
                            "auth {} block is full for %s (%s).",
                            client_get_name(client, SHOW_IP),
-                           client->sockhost);
+                           client->cold->sockhost);
       ilog(LOG_TYPE_IRCD, "Too many connections from %s.",
            client_get_name(client, SHOW_IP));
       ++ServerStats.is_ref;
@@ -537,7 +556,7 @@ operator_find(const struct Client *who, const char *name)
         switch (conf->htype)
         {
           case HM_HOST:
-            if (match(conf->host, who->host) == 0 || match(conf->host, who->sockhost) == 0)
+            if (match(conf->host, who->host) == 0 || match(conf->host, who->cold->sockhost) == 0)
               if (conf->class->max_total == 0 || conf->class->ref_count < conf->class->max_total)
                 return conf;
             break;
@@ -631,6 +650,8 @@ conf_set_defaults(void)
   ConfigGeneral.kill_chase_time_limit = 90;
   ConfigGeneral.default_floodcount = 8;
   ConfigGeneral.default_floodtime = 1;
+  ConfigGeneral.perf_export_file = xstrdup(PERFPATH);
+  ConfigGeneral.perf_export_delay = 0;
   ConfigGeneral.failed_oper_notice = 1;
   ConfigGeneral.dots_in_ident = 0;
   ConfigGeneral.min_nonwildcard = 4;
@@ -699,6 +720,7 @@ conf_read(FILE *file)
                     /* Some global values are also loaded here. */
   whowas_trim();  /* Attempt to trim whowas list if necessary */
   class_delete_marked();  /* Delete unused classes that are marked for deletion */
+  class_ip_limit_rebuild_marked();
 }
 
 /* conf_rehash()
@@ -717,6 +739,9 @@ conf_rehash(bool sig)
     ilog(LOG_TYPE_IRCD, "Got signal SIGHUP, reloading configuration file(s)");
   }
 
+  const uintmax_t start = event_time_ns();
+
+  memset(&rehash_stats, 0, sizeof(rehash_stats));
   restart_resolver();
 
   /* don't close listeners until we know we can go ahead with the rehash */
@@ -725,6 +750,19 @@ conf_rehash(bool sig)
 
   load_conf_modules();
   check_conf_klines();
+
+  const uintmax_t elapsed = (event_time_ns() - start) / 1000;
+  sendto_realops_flags(UMODE_SERVNOTICE, L_ALL, SEND_NOTICE,
+                       "Configuration reloaded in %ju.%03ju ms; address entries: %u kept, %u added, %u removed; "
+                       "operator/connect blocks: %u kept, %u added, %u removed",
+                       elapsed / 1000, elapsed % 1000,
+                       rehash_stats.kept, rehash_stats.added, rehash_stats.removed,
+                       rehash_stats.items_kept, rehash_stats.items_added, rehash_stats.items_removed);
+  ilog(LOG_TYPE_IRCD, "Configuration reloaded in %ju.%03ju ms; address entries: %u kept, %u added, %u removed; "
+       "operator/connect blocks: %u kept, %u added, %u removed",
+       elapsed / 1000, elapsed % 1000,
+       rehash_stats.kept, rehash_stats.added, rehash_stats.removed,
+       rehash_stats.items_kept, rehash_stats.items_added, rehash_stats.items_removed);
 }
 
 /* conf_connect_allowed()
@@ -747,6 +785,9 @@ conf_connect_allowed(struct irc_ssaddr *addr)
     return BANNED_CLIENT;
   }
 
+  if (throttle_check(addr) == false)
+    return TOO_FAST;
+
   struct ip_entry *ip_found = ipcache_record_find_or_add(addr);
   if ((event_base->time.sec_monotonic - ip_found->last_attempt) < ConfigGeneral.throttle_time)
   {
@@ -766,15 +807,13 @@ conf_connect_allowed(struct irc_ssaddr *addr)
  *
  * inputs       - NONE
  * output       - NONE
- * side effects - call function to expire temporary k/d lines
+ * side effects - expire temporary K/D/X-lines and RESVs that are due
  *                This is an event started off in ircd.c
  */
 void
 cleanup_tklines(void *unused)
 {
-  hostmask_expire_temporary();
-  gecos_expire();
-  resv_expire();
+  conf_expire_run();
 }
 
 /*
@@ -828,30 +867,17 @@ get_oper_name(const struct Client *client)
 static void
 conf_clear(void)
 {
-  dlink_node *node = NULL, *node_next = NULL;
-  dlink_list *free_items [] = {
-    &connect_items, &operator_items, NULL
-  };
-
-  dlink_list ** iterator = free_items; /* C is dumb */
-
   /* We only need to free anything allocated by yyparse() here.
    * Resetting structs, etc, is taken care of by conf_set_defaults().
    */
 
-  for (; *iterator; iterator++)
-  {
-    DLINK_FOREACH_SAFE(node, node_next, (*iterator)->head)
-    {
-      struct MaskItem *conf = node->data;
-
-      conf->active = false;
-      dlinkDelete(&conf->node, *iterator);
-
-      if (!conf->ref_count)
-        conf_free(conf);
-    }
-  }
+  /*
+   * The parser builds new operator {} and connect {} lists; the old items
+   * are set aside so that conf_keep_unchanged() can keep those that did
+   * not change.
+   */
+  dlinkMoveList(&connect_items, &connect_items_old);
+  dlinkMoveList(&operator_items, &operator_items_old);
 
   /*
    * Don't delete the class table, rather mark all entries for deletion.
@@ -859,7 +885,7 @@ conf_clear(void)
    */
   class_mark_for_deletion();
 
-  clear_out_address_conf();
+  address_conf_mark_stale();  /* Unchanged auth/exempt/kill/deny items are kept */
 
   modules_conf_clear();  /* Clear modules {} items */
 
@@ -907,14 +933,141 @@ conf_clear(void)
   xfree(ConfigAdminInfo.description);
   ConfigAdminInfo.description = NULL;
 
+  /* Clean out ConfigGeneral */
+  xfree(ConfigGeneral.perf_export_file);
+  ConfigGeneral.perf_export_file = NULL;
+
   /* Clean out ConfigServerHide */
   xfree(ConfigServerHide.flatten_links_file);
   ConfigServerHide.flatten_links_file = NULL;
   xfree(ConfigServerHide.hidden_name);
   ConfigServerHide.hidden_name = NULL;
 
-  /* Clean out listeners */
-  listener_close_marked();
+  /* Listeners still configured are unmarked by listener_add() */
+  listener_mark_for_deletion();
+}
+
+static bool
+conf_string_equal(const char *a, const char *b)
+{
+  if (a == NULL || b == NULL)
+    return a == b;
+  return strcmp(a, b) == 0;
+}
+
+static bool
+conf_string_list_equal(const dlink_list *a, const dlink_list *b)
+{
+  const dlink_node *node_a = a->head, *node_b = b->head;
+
+  for (; node_a && node_b; node_a = node_a->next, node_b = node_b->next)
+    if (strcmp(node_a->data, node_b->data))
+      return false;
+
+  return node_a == node_b;
+}
+
+/* conf_item_equal()
+ *
+ * inputs       - an operator {} or connect {} item from before the rehash
+ *              - the item the new configuration has in its place
+ * output       - true if both were configured the same
+ * side effects - none
+ */
+static bool
+conf_item_equal(const struct MaskItem *old, const struct MaskItem *conf)
+{
+  if (old->type != conf->type ||
+      old->class != conf->class ||
+      old->flags != conf->flags ||
+      old->modes != conf->modes ||
+      old->port != conf->port ||
+      old->aftype != conf->aftype ||
+      old->timeout != conf->timeout)
+    return false;
+
+  if (!conf_string_equal(old->name, conf->name) ||
+      !conf_string_equal(old->user, conf->user) ||
+      !conf_string_equal(old->host, conf->host) ||
+      !conf_string_equal(old->passwd, conf->passwd) ||
+      !conf_string_equal(old->spasswd, conf->spasswd) ||
+      !conf_string_equal(old->certfp, conf->certfp) ||
+      !conf_string_equal(old->whois, conf->whois) ||
+      !conf_string_equal(old->cipher_list, conf->cipher_list))
+    return false;
+
+  if (old->bind == NULL || conf->bind == NULL)
+  {
+    if (old->bind != conf->bind)
+      return false;
+  }
+  else if (memcmp(old->bind, conf->bind, sizeof(*conf->bind)))
+    return false;
+
+  return conf_string_list_equal(&old->hub_list, &conf->hub_list) &&
+         conf_string_list_equal(&old->leaf_list, &conf->leaf_list);
+}
+
+/* conf_keep_unchanged()
+ *
+ * inputs       - list the new configuration was parsed into
+ *              - the items it had before the rehash
+ * output       - none
+ * side effects - each new item that is configured exactly like an old
+ *                one is replaced by the old item, so that clients keep
+ *                the conf they are attached to; the remaining old items
+ *                are deactivated, and freed unless a client uses them
+ */
+static void
+conf_keep_unchanged(dlink_list *list, dlink_list *old_list)
+{
+  dlink_node *node, *node_next;
+
+  DLINK_FOREACH_SAFE(node, node_next, list->head)
+  {
+    struct MaskItem *conf = node->data;
+    struct MaskItem *old = NULL;
+    dlink_node *old_node;
+
+    DLINK_FOREACH(old_node, old_list->head)
+    {
+      if (conf_item_equal(old_node->data, conf))
+      {
+        old = old_node->data;
+        break;
+      }
+    }
+
+    if (old == NULL)
+    {
+      ++rehash_stats.items_added;
+      continue;
+    }
+
+    dlinkDelete(&old->node, old_list);
+    dlinkAddBefore(node, old, &old->node, list);
+    dlinkDelete(node, list);
+    conf_free(conf);
+
+    /* The new item's host name lookup was cancelled along with it */
+    if (old->type == CONF_SERVER)
+      conf_dns_lookup(old);
+
+    ++rehash_stats.items_kept;
+  }
+
+  DLINK_FOREACH_SAFE(node, node_next, old_list->head)
+  {
+    struct MaskItem *conf = node->data;
+
+    conf->active = false;
+    dlinkDelete(&conf->node, old_list);
+
+    if (!conf->ref_count)
+      conf_free(conf);
+
+    ++rehash_stats.items_removed;
+  }
 }
 
 static void
@@ -983,6 +1136,14 @@ conf_read_files(bool cold)
   conf_read(conf_parser_ctx.conf_file);
   fclose(conf_parser_ctx.conf_file);
 
+  if (cold == false)
+  {
+    address_conf_sweep_stale(&rehash_stats.kept, &rehash_stats.added, &rehash_stats.removed);
+    conf_keep_unchanged(&connect_items, &connect_items_old);
+    conf_keep_unchanged(&operator_items, &operator_items_old);
+    listener_close_marked();
+  }
+
   log_iterate(log_reopen);
   conf_handle_tls(cold);
 
@@ -236,13 +236,37 @@ class_ip_limit_remove(struct ClassItem *class, void *addr)
   return false;
 }
 
+/*
+ * The CIDR limits of a class changed. Its tries are rebuilt only once the
+ * whole configuration has been read, so that a rehash changing many classes
+ * walks the client list just once.
+ */
 void
 class_ip_limit_rebuild(struct ClassItem *class)
+{
+  class->ip_limit_rebuild = true;
+}
+
+void
+class_ip_limit_rebuild_marked(void)
 {
   dlink_node *node;
+  bool marked = false;
 
-  patricia_clear(class->ip_tree_v6, NULL);
-  patricia_clear(class->ip_tree_v4, NULL);
+  DLINK_FOREACH(node, class_list.head)
+  {
+    struct ClassItem *class = node->data;
+
+    if (class->ip_limit_rebuild == false)
+      continue;
+
+    patricia_clear(class->ip_tree_v6, NULL);
+    patricia_clear(class->ip_tree_v4, NULL);
+    marked = true;
+  }
+
+  if (marked == false)
+    return;
 
   DLINK_FOREACH(node, local_client_list.head)
   {
@@ -250,7 +274,10 @@ class_ip_limit_rebuild(struct ClassItem *class)
     struct MaskItem *conf = client->connection->confs.tail->data;
 
     if (conf->type == CONF_CLIENT)
-      if (conf->class == class)
-        class_ip_limit_add(class, &client->ip, true);
+      if (conf->class->ip_limit_rebuild)
+        class_ip_limit_add(conf->class, &client->ip, true);
   }
+
+  DLINK_FOREACH(node, class_list.head)
+    ((struct ClassItem *)node->data)->ip_limit_rebuild = false;
 }
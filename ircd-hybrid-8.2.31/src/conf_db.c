@@ -750,7 +750,7 @@ load_resv_database(const char *filename)
 
     resv = resv_make(name, reason, NULL);
     resv->setat = tmp64_setat;
-    resv->expire = tmp64_hold;
+    resv_set_expire(resv, tmp64_hold);
     resv->in_database = true;
 
     xfree(name);
@@ -831,7 +831,7 @@ load_xline_database(const char *filename)
     gecos->mask = name;
     gecos->reason = reason;
     gecos->setat = tmp64_setat;
-    gecos->expire = tmp64_hold;
+    gecos_set_expire(gecos, tmp64_hold);
   }
 
   close_db(f);
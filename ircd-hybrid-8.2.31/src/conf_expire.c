@@ -0,0 +1,190 @@
+/*
+ *  ircd-hybrid: an advanced, lightweight Internet Relay Chat Daemon (ircd)
+ *
+ *  Copyright (c) 2020 ircd-hybrid development team
+ *
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301
+ *  USA
+ */
+
+/*! \file conf_expire.c
+ * \brief Deadline ordered queue of temporary K/D/X-lines and RESVs.
+ * \version $Id$
+ *
+ * Every temporary ban is kept in a single binary min-heap ordered by
+ * its expiration time, so expiring bans only ever looks at the entries
+ * that are actually due instead of walking every ban table.  Each item
+ * remembers its position in the heap so a ban removed early (UNKLINE,
+ * rehash) is taken out in logarithmic time.
+ */
+
+#include "stdinc.h"
+#include "conf_expire.h"
+#include "event.h"
+#include "memory.h"
+
+
+static struct ExpireItem **expire_heap;
+static unsigned int expire_heap_length;
+static unsigned int expire_heap_size;
+
+
+static void
+expire_heap_set(struct ExpireItem *item, unsigned int pos)
+{
+  expire_heap[pos] = item;
+  item->index = pos + 1;
+}
+
+static void
+expire_heap_up(unsigned int pos)
+{
+  struct ExpireItem *item = expire_heap[pos];
+
+  while (pos)
+  {
+    unsigned int parent = (pos - 1) / 2;
+
+    if (expire_heap[parent]->until <= item->until)
+      break;
+
+    expire_heap_set(expire_heap[parent], pos);
+    pos = parent;
+  }
+
+  expire_heap_set(item, pos);
+}
+
+static void
+expire_heap_down(unsigned int pos)
+{
+  struct ExpireItem *item = expire_heap[pos];
+
+  while (true)
+  {
+    unsigned int child = pos * 2 + 1;
+
+    if (child >= expire_heap_length)
+      break;
+
+    if (child + 1 < expire_heap_length &&
+        expire_heap[child + 1]->until < expire_heap[child]->until)
+      ++child;
+
+    if (item->until <= expire_heap[child]->until)
+      break;
+
+    expire_heap_set(expire_heap[child], pos);
+    pos = child;
+  }
+
+  expire_heap_set(item, pos);
+}
+
+/* conf_expire_add()
+ *
+ * inputs       - pointer to the struct ExpireItem embedded in the ban
+ *              - expiration time; calendar time
+ *              - function removing the ban once it is due
+ *              - the ban itself
+ * output       - NONE
+ * side effects - the ban is queued, or moved to its new place if it
+ *                already was
+ */
+void
+conf_expire_add(struct ExpireItem *item, uintmax_t until, void (*handler)(void *), void *data)
+{
+  item->handler = handler;
+  item->data = data;
+
+  if (item->index)
+  {
+    unsigned int pos = item->index - 1;
+    uintmax_t old = item->until;
+
+    item->until = until;
+
+    if (until < old)
+      expire_heap_up(pos);
+    else
+      expire_heap_down(pos);
+    return;
+  }
+
+  if (expire_heap_length == expire_heap_size)
+  {
+    expire_heap_size = expire_heap_size ? expire_heap_size * 2 : 64;
+    expire_heap = xrealloc(expire_heap, expire_heap_size * sizeof(*expire_heap));
+  }
+
+  item->until = until;
+  expire_heap[expire_heap_length] = item;
+  expire_heap_up(expire_heap_length++);
+}
+
+/* conf_expire_delete()
+ *
+ * inputs       - pointer to struct ExpireItem
+ * output       - NONE
+ * side effects - the item is taken out of the queue; nothing happens
+ *                if it is not queued
+ */
+void
+conf_expire_delete(struct ExpireItem *item)
+{
+  if (item->index == 0)
+    return;
+
+  unsigned int pos = item->index - 1;
+  struct ExpireItem *last = expire_heap[--expire_heap_length];
+
+  item->index = 0;
+
+  if (last == item)
+    return;
+
+  expire_heap_set(last, pos);
+
+  if (pos && expire_heap[(pos - 1) / 2]->until > last->until)
+    expire_heap_up(pos);
+  else
+    expire_heap_down(pos);
+}
+
+/* conf_expire_run()
+ *
+ * inputs       - NONE
+ * output       - NONE
+ * side effects - every ban whose expiration time has passed is handed
+ *                to its handler
+ */
+void
+conf_expire_run(void)
+{
+  while (expire_heap_length && expire_heap[0]->until <= event_base->time.sec_real)
+  {
+    struct ExpireItem *item = expire_heap[0];
+
+    conf_expire_delete(item);
+    item->handler(item->data);
+  }
+}
+
+void
+conf_expire_get_stats(unsigned int *const number, size_t *const mem)
+{
+  (*number) = expire_heap_length;
+  (*mem) = expire_heap_size * sizeof(*expire_heap);
+}
@@ -64,6 +64,7 @@ gecos_delete(struct GecosItem *gecos, bool expired)
     sendto_realops_flags(UMODE_EXPIRATION, L_ALL, SEND_NOTICE, "Temporary X-line for [%s] expired",
                          gecos->mask);
 
+  conf_expire_delete(&gecos->expire_item);
   dlinkDelete(&gecos->node, &gecos_list);
   xfree(gecos->mask);
   xfree(gecos->reason);
@@ -79,36 +80,43 @@ gecos_make(void)
   return gecos;
 }
 
-struct GecosItem *
-gecos_find(const char *name, int (*compare)(const char *, const char *))
+static void
+gecos_expire(void *data)
 {
-  dlink_node *node, *node_next;
-
-  DLINK_FOREACH_SAFE(node, node_next, gecos_list.head)
-  {
-    struct GecosItem *gecos = node->data;
+  gecos_delete(data, true);
+}
 
-    if (gecos->expire &&
-        (gecos->expire <= event_base->time.sec_real))
-      gecos_delete(gecos, true);
-    else if (compare(gecos->mask, name) == 0)
-      return gecos;
-  }
+/* gecos_set_expire()
+ *
+ * inputs       - pointer to struct GecosItem
+ *              - expiration time; calendar time, 0 for a permanent X-line
+ * output       - NONE
+ * side effects - the X-line is queued for expiration, or taken out of
+ *                the queue if it is made permanent
+ */
+void
+gecos_set_expire(struct GecosItem *gecos, uintmax_t expire)
+{
+  gecos->expire = expire;
 
-  return NULL;
+  if (expire)
+    conf_expire_add(&gecos->expire_item, expire, gecos_expire, gecos);
+  else
+    conf_expire_delete(&gecos->expire_item);
 }
 
-void
-gecos_expire(void)
+struct GecosItem *
+gecos_find(const char *name, int (*compare)(const char *, const char *))
 {
-  dlink_node *node, *node_next;
+  dlink_node *node;
 
-  DLINK_FOREACH_SAFE(node, node_next, gecos_list.head)
+  DLINK_FOREACH(node, gecos_list.head)
   {
     struct GecosItem *gecos = node->data;
 
-    if (gecos->expire &&
-        (gecos->expire <= event_base->time.sec_real))
-      gecos_delete(gecos, true);
+    if (compare(gecos->mask, name) == 0)
+      return gecos;
   }
+
+  return NULL;
 }
@@ -355,8 +355,8 @@ static void yynoreturn yy_fatal_error ( const char* msg  );
 	(yy_hold_char) = *yy_cp; \
 	*yy_cp = '\0'; \
 	(yy_c_buf_p) = yy_cp;
-#define YY_NUM_RULES 254
-#define YY_END_OF_BUFFER 255
+#define YY_NUM_RULES 256
+#define YY_END_OF_BUFFER 257
 /* This struct is not used in this scanner,
    but its presence is necessary. */
 struct yy_trans_info
@@ -364,25 +364,25 @@ struct yy_trans_info
 	flex_int32_t yy_verify;
 	flex_int32_t yy_nxt;
 	};
-static const flex_int16_t yy_accept[1613] =
+static const flex_int16_t yy_accept[1633] =
     {   0,
-        4,    4,  255,  253,    4,    3,  253,    5,  253,  253,
-        6,  253,  253,  253,  253,  253,  253,  253,  253,  253,
-      253,  253,  253,  253,  253,  253,  253,  253,  253,  253,
-      253,  253,  253,  253,    4,    3,    0,    7,    5,  252,
+        4,    4,  257,  255,    4,    3,  255,    5,  255,  255,
+        6,  255,  255,  255,  255,  255,  255,  255,  255,  255,
+      255,  255,  255,  255,  255,  255,  255,  255,  255,  255,
+      255,  255,  255,  255,    4,    3,    0,    7,    5,  254,
         0,    2,    5,    6,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-       90,    0,  246,    0,    0,    0,    0,    0,    0,    0,
-      251,    0,    0,    0,    0,    0,    0,    0,  225,    0,
+       90,    0,  248,    0,    0,    0,    0,    0,    0,    0,
+      253,    0,    0,    0,    0,    0,    0,    0,  227,    0,
 
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,   12,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,  233,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,  235,    0,    0,    0,    0,    0,
        44,    0,    0,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,   82,    0,    0,    0,    0,    0,    0,
@@ -390,54 +390,54 @@ static const flex_int16_t yy_accept[1613] =
 
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,  159,    0,    0,    0,    0,
-        0,    0,  173,    0,    0,  176,    0,    0,    0,    0,
-      181,    0,  183,    0,    0,    0,    0,  195,    0,    0,
+        0,    0,    0,    0,    0,  161,    0,    0,    0,    0,
+        0,    0,  175,    0,    0,  178,    0,    0,    0,    0,
+      183,    0,  185,    0,    0,    0,    0,  197,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,  224,    0,    0,    0,    0,
-        0,   15,    0,    0,   19,   20,  241,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,  232,   35,
+        0,    0,    0,    0,    0,  226,    0,    0,    0,    0,
+        0,   15,    0,    0,   19,   20,  243,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,  234,   35,
         0,    0,   42,    0,    0,    0,    0,    0,    0,    0,
 
         0,    0,    0,    0,    0,    0,   61,    0,    0,   66,
-        0,    0,    0,    0,    0,    0,   81,  235,    0,    0,
+        0,    0,    0,    0,    0,    0,   81,  237,    0,    0,
        91,   92,   93,    0,   94,    0,    0,    0,    0,    0,
         0,  105,    0,    0,    0,    0,    0,    0,    0,  124,
       125,    0,    0,    0,  131,    0,    0,    0,    0,  138,
-      143,    0,    0,  147,    0,  150,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,  163,    0,    0,    0,    0,
-        0,    0,  177,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,  206,    0,    0,    0,    0,    0,
-        0,    0,  215,    0,    0,    0,    0,  231,    0,    0,
+      143,    0,    0,  147,    0,  152,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,  165,    0,    0,    0,    0,
+        0,    0,  179,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,  208,    0,    0,    0,    0,    0,
+        0,    0,  217,    0,    0,    0,    0,  233,    0,    0,
 
-        0,  227,    0,    0,    9,    0,    0,    0,    0,  240,
+        0,  229,    0,    0,    9,    0,    0,    0,    0,  242,
         0,    0,   24,    0,    0,   28,   29,    0,    0,    0,
         0,   36,    0,    0,    0,   48,    0,   52,    0,    0,
         0,    0,    0,    0,    0,    0,   62,    0,   67,    0,
-        0,    0,    0,    0,    0,    0,  234,    0,    0,    0,
-      245,    0,    0,   96,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,  250,    0,    0,    0,    0,
-        0,  229,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,  155,
-        0,    0,    0,    0,    0,    0,    0,  167,    0,    0,
-
-        0,    0,    0,    0,  178,    0,  180,  182,    0,    0,
+        0,    0,    0,    0,    0,    0,  236,    0,    0,    0,
+      247,    0,    0,   96,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,  252,    0,    0,    0,    0,
+        0,  231,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,  157,
+        0,    0,    0,    0,    0,    0,    0,  169,    0,    0,
+
+        0,    0,    0,    0,  180,    0,  182,  184,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,  230,
-      220,    0,  222,  226,    0,    0,    0,   11,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,  232,
+      222,    0,  224,  228,    0,    0,    0,   11,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,   56,
         0,    0,    0,    0,    0,    0,    0,    0,   73,    0,
-        0,    0,    0,    0,    0,    0,  244,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,  246,    0,    0,    0,
         0,    0,  102,  103,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,  249,    0,  237,    0,    0,  122,
-
-      228,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,  152,    0,
-      154,    0,    0,  158,  160,    0,    0,    0,  239,    0,
-      168,    0,    0,  174,    0,    0,    0,  191,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,  207,  208,
-        0,    0,    0,  212,    0,    0,  216,    0,  219,    0,
+        0,    0,    0,    0,  251,    0,  239,    0,    0,  122,
+
+      230,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,  154,    0,
+      156,    0,    0,  160,  162,    0,    0,    0,  241,    0,
+      170,    0,    0,  176,    0,    0,    0,  193,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,  209,  210,
+        0,    0,    0,  214,    0,    0,  218,    0,  221,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
         0,    0,   25,    0,   30,   31,   32,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
@@ -445,19 +445,19 @@ static const flex_int16_t yy_accept[1613] =
 
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-      236,    0,    0,  123,  126,    0,    0,    0,    0,    0,
+      238,    0,    0,  123,  126,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-      151,    0,    0,    0,    0,  162,    0,    0,  238,    0,
-        0,    0,  171,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,  194,    0,    0,    0,    0,    0,
-        0,    0,    0,  209,  210,    0,  213,    0,  217,    0,
+      153,    0,    0,    0,    0,  164,    0,    0,  240,    0,
+        0,    0,  173,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,  196,    0,    0,    0,    0,    0,
+        0,    0,    0,  211,  212,    0,  215,    0,  219,    0,
         0,    0,    0,    0,    0,    0,    0,   16,    0,    0,
        22,    0,    0,    0,    0,    0,    0,    0,    0,    0,
 
         0,    0,    0,    0,    0,   58,    0,    0,    0,    0,
         0,    0,   76,    0,    0,   83,    0,    0,    0,    0,
-        0,  243,    0,    0,    0,    0,    0,    0,  107,    0,
-      110,    0,    0,    0,    0,    0,    0,  248,  119,    0,
+        0,  245,    0,    0,    0,    0,    0,    0,  107,    0,
+      110,    0,    0,    0,    0,    0,    0,  250,  119,    0,
         0,    0,    0,  134,    0,  133,    0,  141,    0,    0,
         0,    0,  146,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
@@ -467,13 +467,13 @@ static const flex_int16_t yy_accept[1613] =
 
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
         0,    0,   54,    0,    0,    0,    0,    0,    0,    0,
-       75,    0,    0,   84,    0,    0,    0,    0,  242,    0,
+       75,    0,    0,   84,    0,    0,    0,    0,  244,    0,
         0,    0,    0,  101,    0,    0,    0,    0,    0,    0,
-        0,    0,  118,  247,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,  144,    0,  149,    0,  156,  157,
-      161,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,  118,  249,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,  144,    0,  151,    0,  158,  159,
+      163,    0,    0,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,  211,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,  213,    0,    0,    0,    0,
         0,    1,    0,    1,    0,    0,    0,    0,   17,    0,
 
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
@@ -481,8 +481,8 @@ static const flex_int16_t yy_accept[1613] =
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
         0,    0,  106,    0,    0,    0,    0,    0,    0,  115,
         0,    0,    0,  127,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,  169,  170,
-      172,  175,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,  171,  172,
+      174,  177,    0,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
        33,    0,    0,    0,    0,   43,    0,    0,    0,    0,
@@ -490,45 +490,45 @@ static const flex_int16_t yy_accept[1613] =
         0,    0,    0,    0,    0,   74,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
       111,    0,    0,    0,  116,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,  140,    0,  148,  153,  164,    0,
+        0,    0,    0,    0,  140,    0,  150,  155,  166,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,  214,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,  216,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,   45,    0,    0,    0,    0,    0,   55,
         0,    0,    0,   79,    0,    0,    0,    0,    0,    0,
         0,   97,    0,    0,    0,    0,  109,    0,    0,    0,
 
         0,    0,    0,  129,  130,    0,    0,    0,    0,    0,
-        0,    0,    0,  179,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,  181,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-      204,    0,    0,    0,  223,    0,   10,    0,    0,    0,
+      206,    0,    0,    0,  225,    0,   10,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,   51,    0,
         0,   63,    0,    0,   80,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,  114,    0,    0,  128,
-      132,    0,    0,    0,    0,    0,    0,  166,    0,    0,
-        0,    0,    0,    0,    0,    0,  193,    0,    0,    0,
-        0,    0,    0,    0,  205,    0,    0,    0,    0,    0,
+      132,    0,    0,    0,    0,    0,    0,  168,    0,    0,
+        0,    0,    0,    0,    0,    0,  195,    0,    0,    0,
+        0,    0,    0,    0,  207,    0,    0,    0,    0,    0,
 
        21,    0,    0,    0,    0,    0,    0,    0,    0,   49,
        53,    0,    0,    0,    0,    0,    0,    0,    0,    0,
        69,    0,    0,    0,  108,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,  192,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,  194,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    8,   13,    0,    0,    0,    0,    0,    0,
         0,    0,    0,   50,    0,    0,    0,    0,   78,    0,
         0,    0,    0,    0,    0,   70,    0,    0,    0,    0,
       113,    0,  120,  135,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,  198,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,  200,    0,
 
         0,    0,    0,    0,    0,    0,    0,   26,   27,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,  112,
-      117,    0,    0,    0,    0,  139,  145,    0,  184,    0,
+      117,    0,    0,    0,    0,  139,  145,    0,  186,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,   38,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,   99,    0,    0,    0,    0,    0,    0,  185,
-      186,  187,  188,  189,  190,    0,  199,    0,  201,    0,
+        0,    0,   99,    0,    0,    0,    0,    0,    0,  187,
+      188,  189,  190,  191,  192,    0,  201,    0,  203,    0,
         0,    0,    0,    0,    0,   37,    0,    0,    0,    0,
 
        59,    0,   65,    0,    0,    0,   87,    0,   89,    0,
@@ -537,13 +537,15 @@ static const flex_int16_t yy_accept[1613] =
         0,    0,   86,    0,    0,  100,    0,    0,  137,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,   34,
         0,    0,    0,    0,   77,   85,   88,    0,    0,  136,
-        0,  165,  196,    0,    0,    0,  203,    0,    0,    0,
+        0,  167,  198,    0,    0,    0,  205,    0,    0,    0,
         0,    0,   46,    0,   95,    0,  142,    0,    0,    0,
-      218,  221,    0,    0,    0,    0,  121,    0,    0,    0,
-        0,    0,   40,   47,    0,  200,    0,    0,   39,    0,
+      220,  223,    0,    0,    0,    0,  121,    0,    0,    0,
+        0,    0,   40,   47,    0,  202,    0,    0,   39,    0,
 
-        0,    0,    0,    0,    0,    0,    0,   14,  197,    0,
-      202,    0
+        0,    0,    0,    0,    0,    0,    0,   14,  199,    0,
+      204,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,  148,    0,    0,    0,
+      149,    0
     } ;
 
 static const YY_CHAR yy_ec[256] =
@@ -589,11 +591,11 @@ static const YY_CHAR yy_meta[67] =
         1,    1,    1,    1,    1,    1
     } ;
 
-static const flex_int16_t yy_base[1618] =
+static const flex_int16_t yy_base[1638] =
     {   0,
         0,    0, 3101, 3102, 3098,    0,   64,    0,   62,   64,
        64,   96,   49,  146,  198,   52,   68,   58,  124,   68,
-       52,  139,  127,  240,  282,   52,  330,  172,  372,  419,
+       52,  139,  127,  240,  282,   52, 3236,  172,  372,  419,
       143,  189,   66,   74, 3097,    0,   82, 3102,    0, 3102,
        72, 3102,    0,  124,   84,   75,  103,  126,  120,  123,
       178,  173,  172,  173,  197,  180,  195,  197,  231,  230,
@@ -768,192 +770,196 @@ static const flex_int16_t yy_base[1618] =
      2960, 2961, 3102, 3102, 2967, 3102, 2968, 2978, 3102, 2980,
 
      2981, 2978, 2978, 2974, 2991, 2977, 2990, 3102, 3102, 2986,
-     3102, 3102,  124, 3039,   95,   93,   87
+     3102, 3169, 3303, 3370, 3437, 3504, 3571, 3638, 3705, 3772,
+     3839, 3906, 3973, 4040, 4107, 4174, 4241, 4308, 4375, 4442,
+     4509, 3102,  124, 3039,   95,   93,   87
     } ;
 
-static const flex_int16_t yy_def[1618] =
+static const flex_int16_t yy_def[1638] =
     {   0,
-     1612,    1, 1612, 1612, 1612, 1613, 1614, 1615, 1612, 1612,
-     1612, 1612, 1612, 1612, 1612, 1612, 1612, 1612, 1612, 1612,
-     1612, 1612, 1612, 1612, 1612, 1612, 1612, 1612, 1612, 1612,
-     1612, 1612, 1612, 1612, 1612, 1613, 1614, 1612, 1615, 1612,
-     1612, 1612, 1615, 1612, 1612, 1612, 1612, 1612, 1612, 1612,
-     1612, 1612, 1612, 1612, 1612, 1612, 1612, 1612, 1612, 1612,
-     1612, 1612, 1612, 1612, 1612, 1612, 1612, 1612, 1612, 1612,
-     1612, 1612, 1612, 1612, 1612, 1612, 1612, 1612, 1612, 1612,
-     1612, 1612, 1612, 1612, 1612, 1612, 1612, 1612, 1612, 1612,
-     1612, 1612, 1612, 1612, 1612, 1612, 1612, 1612, 1612, 1612,
-
-     1612, 1612, 1612, 1612, 1612, 1612, 1612, 1612, 1612, 1612,
-     1612, 1612, 1612, 1612, 1612, 1612, 1612, 1612, 1612, 1612,
-     1612, 1612, 1612, 1612, 1612, 1612, 1612, 1612, 1612, 1612,
-     1612, 1612, 1612, 1612, 1612, 1612, 1612, 1612, 1612, 1612,
-     1612, 1612, 1612, 1612, 1612, 1612, 1612, 1612, 1612, 1612,
-     1612, 1612, 1612, 1612, 1612, 1612, 1612, 1612, 1612, 1612,
-     1612, 1612, 1612, 1612, 1612, 1612, 1612, 1612, 1612, 1612,
-     1612, 1612, 1612, 1612, 1612, 1612, 1612, 1612, 1612, 1612,
-     1612, 1612, 1612, 1612, 1612, 1612, 1612, 1612, 1612, 1612,
-     1612, 1612, 1612, 1612, 1612, 1612, 1612, 1612, 1612, 1612,
-
-     1612, 1612, 1612, 1612, 1612, 1612, 1612, 1612, 1612, 1612,
-     1612, 1612, 1612, 1612, 1612, 1612, 1612, 1612, 1612, 1612,
-     1612, 1612, 1612, 1612, 1612, 1612, 1612, 1612, 1612, 1612,
-     1612, 1612, 1612, 1612, 1612, 1612, 1612, 1612, 1612, 1612,
-     1612, 1612, 1612, 1612, 1612, 1612, 1612, 1612, 1612, 1612,
-     1612, 1612, 1612, 1612, 1612, 1612, 1612, 1612, 1612, 1612,
-     1612, 1612, 1612, 1612, 1612, 1612, 1612, 1612, 1612, 1612,
-     1612, 1612, 1612, 1612, 1612, 1612, 1612, 1612, 1612, 1612,
-     1612, 1612, 1612, 1612, 1612, 1612, 1612, 1612, 1612, 1612,
-     1612, 1612, 1612, 1612, 1612, 1612, 1612, 1612, 1612, 1612,
-
-     1612, 1612, 1612, 1612, 1612, 1612, 1612, 1612, 1612, 1612,
-     1612, 1612, 1612, 1612, 1612, 1612, 1612, 1612, 1612, 1612,
-     1612, 1612, 1612, 1612, 1612, 1612, 1612, 1612, 1612, 1612,
-     1612, 1612, 1612, 1612, 1612, 1612, 1612, 1612, 1612, 1612,
-     1612, 1612, 1612, 1612, 1612, 1612, 1612, 1612, 1612, 1612,
-     1612, 1612, 1612, 1612, 1612, 1612, 1612, 1612, 1612, 1612,
-     1612, 1612, 1612, 1612, 1612, 1612, 1612, 1612, 1612, 1612,
-     1612, 1612, 1612, 1612, 1612, 1612, 1612, 1612, 1612, 1612,
-     1612, 1612, 1612, 1612, 1612, 1612, 1612, 1612, 1612, 1612,
-     1612, 1612, 1612, 1612, 1612, 1612, 1612, 1612, 1612, 1612,
-
-     1612, 1612, 1612, 1612, 1612, 1612, 1612, 1612, 1612, 1612,
-     1612, 1612, 1612, 1612, 1612, 1612, 1612, 1612, 1612, 1612,
-     1612, 1612, 1612, 1612, 1612, 1612, 1612, 1612, 1612, 1612,
-     1612, 1612, 1612, 1612, 1612, 1612, 1612, 1612, 1612, 1612,
-     1612, 1612, 1612, 1612, 1612, 1612, 1612, 1612, 1612, 1612,
-     1612, 1612, 1612, 1612, 1612, 1612, 1612, 1612, 1612, 1612,
-     1612, 1612, 1612, 1612, 1612, 1612, 1612, 1612, 1612, 1612,
-     1612, 1612, 1612, 1612, 1612, 1612, 1612, 1612, 1612, 1612,
-     1612, 1612, 1612, 1612, 1612, 1612, 1612, 1612, 1612, 1612,
-     1612, 1612, 1612, 1612, 1612, 1612, 1612, 1612, 1612, 1612,
-
-     1612, 1612, 1612, 1612, 1612, 1612, 1612, 1612, 1612, 1612,
-     1612, 1612, 1612, 1612, 1612, 1612, 1612, 1612, 1612, 1612,
-     1612, 1612, 1612, 1612, 1612, 1612, 1612, 1612, 1612, 1612,
-     1612, 1612, 1612, 1612, 1612, 1612, 1612, 1612, 1612, 1612,
-     1612, 1612, 1612, 1612, 1612, 1612, 1612, 1612, 1612, 1612,
-     1612, 1612, 1612, 1612, 1612, 1612, 1612, 1612, 1612, 1612,
-     1612, 1612, 1612, 1612, 1612, 1612, 1612, 1612, 1612, 1612,
-     1612, 1612, 1612, 1612, 1612, 1612, 1612, 1612, 1612, 1612,
-     1612, 1612, 1612, 1612, 1612, 1612, 1612, 1612, 1612, 1612,
-     1612, 1612, 1612, 1612, 1612, 1612, 1612, 1612, 1612, 1612,
-
-     1612, 1612, 1612, 1612, 1612, 1612, 1612, 1612, 1612, 1612,
-     1612, 1612, 1612, 1612, 1612, 1612, 1612, 1612, 1612, 1612,
-     1612, 1612, 1612, 1612, 1612, 1612, 1612, 1612, 1612, 1612,
-     1612, 1612, 1612, 1612, 1612, 1612, 1612, 1612, 1612, 1612,
-     1612, 1612, 1612, 1612, 1612, 1612, 1612, 1612, 1612, 1612,
-     1612, 1612, 1612, 1612, 1612, 1612, 1612, 1612, 1612, 1612,
-     1612, 1612, 1612, 1612, 1612, 1612, 1612, 1612, 1612, 1612,
-     1612, 1612, 1612, 1612, 1612, 1612, 1612, 1612, 1612, 1612,
-     1612, 1612, 1612, 1612, 1612, 1612, 1612, 1612, 1612, 1612,
-     1612, 1612, 1612, 1612, 1612, 1612, 1612, 1612, 1612, 1612,
-
-     1612, 1612, 1612, 1612, 1612, 1612, 1612, 1612, 1612, 1612,
-     1612, 1612, 1612, 1612, 1612, 1612, 1612, 1612, 1612, 1612,
-     1612, 1612, 1612, 1612, 1612, 1612, 1612, 1612, 1612, 1612,
-     1612, 1612, 1612, 1612, 1612, 1612, 1612, 1612, 1612, 1612,
-     1612, 1612, 1612, 1612, 1612, 1612, 1612, 1612, 1612, 1612,
-     1612, 1612, 1612, 1612, 1612, 1612, 1612, 1612, 1612, 1612,
-     1612, 1612, 1612, 1612, 1612, 1612, 1612, 1612, 1612, 1612,
-     1612, 1612, 1612, 1612, 1612, 1612, 1612, 1612, 1612, 1612,
-     1612, 1612, 1612, 1612, 1612, 1612, 1612, 1612, 1612, 1612,
-     1612, 1612, 1612, 1612, 1612, 1612, 1612, 1612, 1612, 1612,
-
-     1612, 1612, 1612, 1612, 1612, 1612, 1612, 1612, 1612, 1612,
-     1612, 1612, 1612, 1612, 1612, 1612, 1612, 1612, 1612, 1612,
-     1612, 1612, 1612, 1612, 1612, 1612, 1612, 1612, 1612, 1612,
-     1612, 1612, 1612, 1612, 1612, 1612, 1612, 1612, 1612, 1612,
-     1612, 1612, 1612, 1612, 1612, 1612, 1612, 1612, 1612, 1612,
-     1612, 1612, 1612, 1612, 1612, 1612, 1612, 1612, 1612, 1612,
-     1612, 1612, 1612, 1612, 1612, 1612, 1612, 1612, 1612, 1612,
-     1612, 1612, 1612, 1612, 1612, 1612, 1612, 1612, 1612, 1612,
-     1612, 1612, 1612, 1612, 1612, 1612, 1612, 1612, 1612, 1616,
-     1617, 1612, 1612, 1612, 1612, 1612, 1612, 1612, 1612, 1612,
-
-     1612, 1612, 1612, 1612, 1612, 1612, 1612, 1612, 1612, 1612,
-     1612, 1612, 1612, 1612, 1612, 1612, 1612, 1612, 1612, 1612,
-     1612, 1612, 1612, 1612, 1612, 1612, 1612, 1612, 1612, 1612,
-     1612, 1612, 1612, 1612, 1612, 1612, 1612, 1612, 1612, 1612,
-     1612, 1612, 1612, 1612, 1612, 1612, 1612, 1612, 1612, 1612,
-     1612, 1612, 1612, 1612, 1612, 1612, 1612, 1612, 1612, 1612,
-     1612, 1612, 1612, 1612, 1612, 1612, 1612, 1612, 1612, 1612,
-     1612, 1612, 1612, 1612, 1612, 1612, 1612, 1612, 1612, 1612,
-     1612, 1612, 1612, 1612, 1612, 1612, 1612, 1612, 1612, 1612,
-     1616, 1616, 1617, 1617, 1612, 1612, 1612, 1612, 1612, 1612,
-
-     1612, 1612, 1612, 1612, 1612, 1612, 1612, 1612, 1612, 1612,
-     1612, 1612, 1612, 1612, 1612, 1612, 1612, 1612, 1612, 1612,
-     1612, 1612, 1612, 1612, 1612, 1612, 1612, 1612, 1612, 1612,
-     1612, 1612, 1612, 1612, 1612, 1612, 1612, 1612, 1612, 1612,
-     1612, 1612, 1612, 1612, 1612, 1612, 1612, 1612, 1612, 1612,
-     1612, 1612, 1612, 1612, 1612, 1612, 1612, 1612, 1612, 1612,
-     1612, 1612, 1612, 1612, 1612, 1612, 1612, 1612, 1612, 1612,
-     1612, 1612, 1612, 1612, 1612, 1612, 1612, 1612, 1612, 1612,
-     1612, 1612, 1612, 1612, 1612, 1612, 1612, 1612, 1612, 1612,
-     1612, 1612, 1612, 1612, 1612, 1612, 1612, 1612, 1612, 1612,
-
-     1612, 1612, 1612, 1612, 1612, 1612, 1612, 1612, 1612, 1612,
-     1612, 1612, 1612, 1612, 1612, 1612, 1612, 1612, 1612, 1612,
-     1612, 1612, 1612, 1612, 1612, 1612, 1612, 1612, 1612, 1612,
-     1612, 1612, 1612, 1612, 1612, 1612, 1612, 1612, 1612, 1612,
-     1612, 1612, 1612, 1612, 1612, 1612, 1612, 1612, 1612, 1612,
-     1612, 1612, 1612, 1612, 1612, 1612, 1612, 1612, 1612, 1612,
-     1612, 1612, 1612, 1612, 1612, 1612, 1612, 1612, 1612, 1612,
-     1612, 1612, 1612, 1612, 1612, 1612, 1612, 1612, 1612, 1612,
-     1612, 1612, 1612, 1612, 1612, 1612, 1612, 1612, 1612, 1612,
-     1612, 1612, 1612, 1612, 1612, 1612, 1612, 1612, 1612, 1612,
-
-     1612, 1612, 1612, 1612, 1612, 1612, 1612, 1612, 1612, 1612,
-     1612, 1612, 1612, 1612, 1612, 1612, 1612, 1612, 1612, 1612,
-     1612, 1612, 1612, 1612, 1612, 1612, 1612, 1612, 1612, 1612,
-     1612, 1612, 1612, 1612, 1612, 1612, 1612, 1612, 1612, 1612,
-     1612, 1612, 1612, 1612, 1612, 1612, 1612, 1612, 1612, 1612,
-     1612, 1612, 1612, 1612, 1612, 1612, 1612, 1612, 1612, 1612,
-     1612, 1612, 1612, 1612, 1612, 1612, 1612, 1612, 1612, 1612,
-     1612, 1612, 1612, 1612, 1612, 1612, 1612, 1612, 1612, 1612,
-     1612, 1612, 1612, 1612, 1612, 1612, 1612, 1612, 1612, 1612,
-     1612, 1612, 1612, 1612, 1612, 1612, 1612, 1612, 1612, 1612,
-
-     1612, 1612, 1612, 1612, 1612, 1612, 1612, 1612, 1612, 1612,
-     1612, 1612, 1612, 1612, 1612, 1612, 1612, 1612, 1612, 1612,
-     1612, 1612, 1612, 1612, 1612, 1612, 1612, 1612, 1612, 1612,
-     1612, 1612, 1612, 1612, 1612, 1612, 1612, 1612, 1612, 1612,
-     1612, 1612, 1612, 1612, 1612, 1612, 1612, 1612, 1612, 1612,
-     1612, 1612, 1612, 1612, 1612, 1612, 1612, 1612, 1612, 1612,
-     1612, 1612, 1612, 1612, 1612, 1612, 1612, 1612, 1612, 1612,
-     1612, 1612, 1612, 1612, 1612, 1612, 1612, 1612, 1612, 1612,
-     1612, 1612, 1612, 1612, 1612, 1612, 1612, 1612, 1612, 1612,
-     1612, 1612, 1612, 1612, 1612, 1612, 1612, 1612, 1612, 1612,
-
-     1612, 1612, 1612, 1612, 1612, 1612, 1612, 1612, 1612, 1612,
-     1612, 1612, 1612, 1612, 1612, 1612, 1612, 1612, 1612, 1612,
-     1612, 1612, 1612, 1612, 1612, 1612, 1612, 1612, 1612, 1612,
-     1612, 1612, 1612, 1612, 1612, 1612, 1612, 1612, 1612, 1612,
-     1612, 1612, 1612, 1612, 1612, 1612, 1612, 1612, 1612, 1612,
-     1612, 1612, 1612, 1612, 1612, 1612, 1612, 1612, 1612, 1612,
-     1612, 1612, 1612, 1612, 1612, 1612, 1612, 1612, 1612, 1612,
-     1612, 1612, 1612, 1612, 1612, 1612, 1612, 1612, 1612, 1612,
-     1612, 1612, 1612, 1612, 1612, 1612, 1612, 1612, 1612, 1612,
-     1612, 1612, 1612, 1612, 1612, 1612, 1612, 1612, 1612, 1612,
-
-     1612, 1612, 1612, 1612, 1612, 1612, 1612, 1612, 1612, 1612,
-     1612, 1612, 1612, 1612, 1612, 1612, 1612, 1612, 1612, 1612,
-     1612, 1612, 1612, 1612, 1612, 1612, 1612, 1612, 1612, 1612,
-     1612, 1612, 1612, 1612, 1612, 1612, 1612, 1612, 1612, 1612,
-     1612, 1612, 1612, 1612, 1612, 1612, 1612, 1612, 1612, 1612,
-     1612, 1612, 1612, 1612, 1612, 1612, 1612, 1612, 1612, 1612,
-     1612, 1612, 1612, 1612, 1612, 1612, 1612, 1612, 1612, 1612,
-     1612, 1612, 1612, 1612, 1612, 1612, 1612, 1612, 1612, 1612,
-     1612, 1612, 1612, 1612, 1612, 1612, 1612, 1612, 1612, 1612,
-     1612, 1612, 1612, 1612, 1612, 1612, 1612, 1612, 1612, 1612,
-
-     1612, 1612, 1612, 1612, 1612, 1612, 1612, 1612, 1612, 1612,
-     1612,    0, 1612, 1612, 1612, 1612, 1612
+     1632,    1, 1632, 1632, 1632, 1633, 1634, 1635, 1632, 1632,
+     1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632,
+     1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632,
+     1632, 1632, 1632, 1632, 1632, 1633, 1634, 1632, 1635, 1632,
+     1632, 1632, 1635, 1632, 1632, 1632, 1632, 1632, 1632, 1632,
+     1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632,
+     1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632,
+     1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632,
+     1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632,
+     1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632,
+
+     1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632,
+     1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632,
+     1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632,
+     1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632,
+     1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632,
+     1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632,
+     1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632,
+     1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632,
+     1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632,
+     1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632,
+
+     1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632,
+     1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632,
+     1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632,
+     1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632,
+     1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632,
+     1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632,
+     1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632,
+     1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632,
+     1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632,
+     1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632,
+
+     1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632,
+     1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632,
+     1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632,
+     1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632,
+     1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632,
+     1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632,
+     1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632,
+     1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632,
+     1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632,
+     1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632,
+
+     1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632,
+     1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632,
+     1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632,
+     1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632,
+     1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632,
+     1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632,
+     1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632,
+     1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632,
+     1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632,
+     1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632,
+
+     1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632,
+     1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632,
+     1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632,
+     1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632,
+     1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632,
+     1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632,
+     1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632,
+     1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632,
+     1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632,
+     1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632,
+
+     1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632,
+     1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632,
+     1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632,
+     1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632,
+     1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632,
+     1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632,
+     1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632,
+     1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632,
+     1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632,
+     1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632,
+
+     1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632,
+     1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632,
+     1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632,
+     1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632,
+     1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632,
+     1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632,
+     1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632,
+     1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632,
+     1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632,
+     1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632,
+
+     1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632,
+     1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632,
+     1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632,
+     1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632,
+     1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632,
+     1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632,
+     1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632,
+     1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632,
+     1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1636,
+     1637, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632,
+
+     1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632,
+     1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632,
+     1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632,
+     1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632,
+     1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632,
+     1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632,
+     1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632,
+     1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632,
+     1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632,
+     1636, 1636, 1637, 1637, 1632, 1632, 1632, 1632, 1632, 1632,
+
+     1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632,
+     1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632,
+     1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632,
+     1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632,
+     1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632,
+     1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632,
+     1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632,
+     1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632,
+     1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632,
+     1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632,
+
+     1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632,
+     1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632,
+     1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632,
+     1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632,
+     1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632,
+     1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632,
+     1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632,
+     1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632,
+     1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632,
+     1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632,
+
+     1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632,
+     1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632,
+     1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632,
+     1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632,
+     1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632,
+     1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632,
+     1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632,
+     1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632,
+     1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632,
+     1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632,
+
+     1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632,
+     1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632,
+     1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632,
+     1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632,
+     1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632,
+     1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632,
+     1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632,
+     1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632,
+     1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632,
+     1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632,
+
+     1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632,
+     1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632,
+     1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632,
+     1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632,
+     1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632,
+     1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632,
+     1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632,
+     1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632,
+     1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632,
+     1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632,
+
+     1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632,
+     1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632,
+     1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632,
+     1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632,
+     1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632,
+     1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632,
+     1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632,
+     1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632,
+     1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632,
+     1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632,
+
+     1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632,
+     1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632,
+     1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632,
+     1632,    0, 1632, 1632, 1632, 1632, 1632
     } ;
 
-static const flex_int16_t yy_nxt[3169] =
+static const flex_int16_t yy_nxt[4576] =
     {   0,
         4,    5,    6,    7,    8,    4,    9,   10,   11,   11,
        11,    4,    4,   12,   13,   14,   15,   16,   17,   18,
@@ -1296,16 +1302,171 @@ static const flex_int16_t yy_nxt[3169] =
       528,  495,  485,  483,  474,  456,  452,  442,  427,  415,
       409,  407,  382,  367,  333,  319,  279,  249,   35,   35,
 
-     1612,    3, 1612, 1612, 1612, 1612, 1612, 1612, 1612, 1612,
-     1612, 1612, 1612, 1612, 1612, 1612, 1612, 1612, 1612, 1612,
-     1612, 1612, 1612, 1612, 1612, 1612, 1612, 1612, 1612, 1612,
-     1612, 1612, 1612, 1612, 1612, 1612, 1612, 1612, 1612, 1612,
-     1612, 1612, 1612, 1612, 1612, 1612, 1612, 1612, 1612, 1612,
-     1612, 1612, 1612, 1612, 1612, 1612, 1612, 1612, 1612, 1612,
-     1612, 1612, 1612, 1612, 1612, 1612, 1612, 1612
+     1632,    3, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632,
+     1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632,
+     1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632,
+     1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632,
+     1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632,
+     1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632,
+     1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632,
+     1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632,
+     1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632,
+     1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1613,
+
+     1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632,
+     1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632,
+     1632, 1632, 1632, 1632, 1632, 1632, 1613, 1632, 1632, 1632,
+     1632, 1632, 1632, 1632, 1632,    3, 1632, 1632, 1632, 1632,
+     1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632,  102,
+     1632, 1632, 1632, 1612, 1632, 1632, 1632,  103, 1632, 1632,
+     1632, 1632, 1632,  104, 1632, 1632,  105,  106, 1632, 1632,
+     1632, 1632, 1632, 1632, 1632, 1632,  102, 1632, 1632, 1632,
+     1612, 1632, 1632, 1632,  103, 1632, 1632, 1632, 1632, 1632,
+      104, 1632, 1632,  105,  106, 1632, 1632, 1632, 1632, 1632,
+
+     1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632,
+     1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632,
+     1632, 1614, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632,
+     1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632,
+     1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1614, 1632,
+     1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632,
+     1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632,
+     1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632,
+     1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632,
+     1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632,
+
+     1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1615,
+     1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632,
+     1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632,
+     1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632,
+     1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632,
+     1632, 1632, 1632, 1632, 1616, 1632, 1632, 1632, 1632, 1632,
+     1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632,
+     1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632,
+     1632, 1616, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632,
+     1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632,
+
+     1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632,
+     1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632,
+     1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632,
+     1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632,
+     1617, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632,
+     1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632,
+     1632, 1632, 1632, 1632, 1632, 1632, 1632, 1617, 1632, 1632,
+     1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632,
+     1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632,
+     1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1618,
+
+     1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632,
+     1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632,
+     1632, 1632, 1632, 1632, 1632, 1632, 1618, 1632, 1632, 1632,
+     1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632,
+     1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632,
+     1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632,
+     1632, 1632, 1632, 1632, 1632, 1619, 1632, 1632, 1632, 1632,
+     1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632,
+     1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632,
+     1632, 1632, 1619, 1632, 1632, 1632, 1632, 1632, 1632, 1632,
+
+     1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632,
+     1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632,
+     1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632,
+     1632, 1632, 1632, 1632, 1632, 1620, 1632, 1632, 1632, 1632,
+     1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632,
+     1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632,
+     1632, 1632, 1620, 1632, 1632, 1632, 1632, 1632, 1632, 1632,
+     1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632,
+     1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632,
+     1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632,
+
+     1632, 1632, 1632, 1632, 1621, 1632, 1632, 1632, 1632, 1632,
+     1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632,
+     1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632,
+     1632, 1621, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632,
+     1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632,
+     1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632,
+     1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632,
+     1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1622, 1632,
+     1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632,
+     1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632,
+
+     1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632,
+     1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632,
+     1632, 1632, 1623, 1632, 1628, 1632, 1632, 1632, 1632, 1632,
+     1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632,
+     1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1623,
+     1632, 1628, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632,
+     1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632,
+     1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632,
+     1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632,
+     1624, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632,
+
+     1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632,
+     1632, 1632, 1632, 1632, 1632, 1632, 1632, 1624, 1632, 1632,
+     1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632,
+     1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632,
+     1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632,
+     1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632,
+     1632, 1632, 1632, 1632, 1625, 1632, 1632, 1632, 1632, 1632,
+     1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632,
+     1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632,
+     1632, 1625, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632,
+
+     1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632,
+     1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632,
+     1626, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632,
+     1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632,
+     1632, 1632, 1632, 1632, 1632, 1632, 1632, 1626, 1632, 1632,
+     1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632,
+     1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632,
+     1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632,
+     1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632,
+     1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632,
+
+     1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632,
+     1632, 1627, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632,
+     1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632,
+     1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1627, 1632,
+     1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632,
+     1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632,
+     1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632,
+     1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632,
+     1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632,
+     1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632,
+
+     1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632,
+     1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632,
+     1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1629,
+     1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632,
+     1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632,
+     1632, 1632, 1632, 1632, 1632, 1632, 1629, 1632, 1632, 1632,
+     1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632,
+     1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632,
+     1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632,
+     1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1630,
+
+     1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632,
+     1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632,
+     1632, 1632, 1632, 1632, 1632, 1632, 1630, 1632, 1632, 1632,
+     1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632,
+     1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632,
+     1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1631,
+     1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632,
+     1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632,
+     1632, 1632, 1632, 1632, 1632, 1632, 1631, 1632, 1632, 1632,
+     1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632,
+
+     1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632,
+     1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632,
+     1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632,
+     1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632,
+     1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632,
+     1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632,
+     1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632,
+     1632, 1632, 1632, 1632, 1632
     } ;
 
-static const flex_int16_t yy_chk[3169] =
+static const flex_int16_t yy_chk[4576] =
     {   0,
         1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
         1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
@@ -1315,12 +1476,12 @@ static const flex_int16_t yy_chk[3169] =
         1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
         1,    1,    1,    1,    1,    1,    7,    7,    9,   10,
        13,   10,   11,   11,   11,   18,   13,   16,   16,   21,
-       26,   17,   18,    9,   37,   37,   13, 1617,   16,   17,
-       33,   34,   17, 1616,   20, 1615,   20,   13,   41,   45,
+       26,   17,   18,    9,   37,   37,   13, 1637,   16,   17,
+       33,   34,   17, 1636,   20, 1635,   20,   13,   41,   45,
 
        46,   17,   18,   13,   16,   16,   21,   26,   17,   18,
         9,   12,   12,   13,   12,   16,   17,   33,   34,   17,
-       12,   20,   12,   20, 1613,   41,   45,   46,   17,   12,
+       12,   20,   12,   20, 1633,   41,   45,   46,   17,   12,
      1583,   12,   44,   44,   44,   47, 1520,   19,   12,   12,
      1497,   12,  186,  186,   23,   19, 1405,   12,   23,   12,
        48,   19,   49,   22,   23,   50,   12,   19,   12,   14,
@@ -1640,21 +1801,176 @@ static const flex_int16_t yy_chk[3169] =
      1586, 1600, 1601, 1602, 1603, 1588, 1604, 1589, 1605, 1606,
      1607, 1610,  991,  955,  953,  942,  931, 1590,  924, 1591,
      1592,  922,  910,  898, 1595, 1597, 1598,  895, 1600, 1601,
-     1602, 1603,  894, 1604,  891, 1605, 1606, 1607, 1610, 1614,
-     1614,  890,  875,  833,  829,  796,  780,  773,  763,  762,
+     1602, 1603,  894, 1604,  891, 1605, 1606, 1607, 1610, 1634,
+     1634,  890,  875,  833,  829,  796,  780,  773,  763,  762,
       761,  760,  759,  758,  757,  730,  728,  691,  683,  681,
       679,  660,  647,  644,  620,  609,  576,  569,  563,  559,
       557,  536,  533,  509,  504,  481,  455,  454,  426,  421,
       396,  366,  355,  352,  343,  329,  325,  314,  297,  282,
       274,  271,  248,  229,  197,  184,  145,  123,   35,    5,
 
-        3, 1612, 1612, 1612, 1612, 1612, 1612, 1612, 1612, 1612,
-     1612, 1612, 1612, 1612, 1612, 1612, 1612, 1612, 1612, 1612,
-     1612, 1612, 1612, 1612, 1612, 1612, 1612, 1612, 1612, 1612,
-     1612, 1612, 1612, 1612, 1612, 1612, 1612, 1612, 1612, 1612,
-     1612, 1612, 1612, 1612, 1612, 1612, 1612, 1612, 1612, 1612,
-     1612, 1612, 1612, 1612, 1612, 1612, 1612, 1612, 1612, 1612,
-     1612, 1612, 1612, 1612, 1612, 1612, 1612, 1612
+        3, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632,
+     1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632,
+     1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632,
+     1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632,
+     1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632,
+     1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632,
+     1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1612, 1612,
+     1612, 1612, 1612, 1612, 1612, 1612, 1612, 1612, 1612, 1612,
+     1612, 1612, 1612, 1612, 1612, 1612, 1612, 1612, 1612, 1612,
+     1612, 1612, 1612, 1612, 1612, 1612, 1612, 1612, 1612, 1612,
+
+     1612, 1612, 1612, 1612, 1612, 1612, 1612, 1612, 1612, 1612,
+     1612, 1612, 1612, 1612, 1612, 1612, 1612, 1612, 1612, 1612,
+     1612, 1612, 1612, 1612, 1612, 1612, 1612, 1612, 1612, 1612,
+     1612, 1612, 1612, 1612, 1612,   27,   27,   27,   27,   27,
+       27,   27,   27,   27,   27,   27,   27,   27,   27,   27,
+       27,   27,   27,   27,   27,   27,   27,   27,   27,   27,
+       27,   27,   27,   27,   27,   27,   27,   27,   27,   27,
+       27,   27,   27,   27,   27,   27,   27,   27,   27,   27,
+       27,   27,   27,   27,   27,   27,   27,   27,   27,   27,
+       27,   27,   27,   27,   27,   27,   27,   27,   27,   27,
+
+       27,   27, 1613, 1613, 1613, 1613, 1613, 1613, 1613, 1613,
+     1613, 1613, 1613, 1613, 1613, 1613, 1613, 1613, 1613, 1613,
+     1613, 1613, 1613, 1613, 1613, 1613, 1613, 1613, 1613, 1613,
+     1613, 1613, 1613, 1613, 1613, 1613, 1613, 1613, 1613, 1613,
+     1613, 1613, 1613, 1613, 1613, 1613, 1613, 1613, 1613, 1613,
+     1613, 1613, 1613, 1613, 1613, 1613, 1613, 1613, 1613, 1613,
+     1613, 1613, 1613, 1613, 1613, 1613, 1613, 1613, 1613, 1614,
+     1614, 1614, 1614, 1614, 1614, 1614, 1614, 1614, 1614, 1614,
+     1614, 1614, 1614, 1614, 1614, 1614, 1614, 1614, 1614, 1614,
+     1614, 1614, 1614, 1614, 1614, 1614, 1614, 1614, 1614, 1614,
+
+     1614, 1614, 1614, 1614, 1614, 1614, 1614, 1614, 1614, 1614,
+     1614, 1614, 1614, 1614, 1614, 1614, 1614, 1614, 1614, 1614,
+     1614, 1614, 1614, 1614, 1614, 1614, 1614, 1614, 1614, 1614,
+     1614, 1614, 1614, 1614, 1614, 1614, 1615, 1615, 1615, 1615,
+     1615, 1615, 1615, 1615, 1615, 1615, 1615, 1615, 1615, 1615,
+     1615, 1615, 1615, 1615, 1615, 1615, 1615, 1615, 1615, 1615,
+     1615, 1615, 1615, 1615, 1615, 1615, 1615, 1615, 1615, 1615,
+     1615, 1615, 1615, 1615, 1615, 1615, 1615, 1615, 1615, 1615,
+     1615, 1615, 1615, 1615, 1615, 1615, 1615, 1615, 1615, 1615,
+     1615, 1615, 1615, 1615, 1615, 1615, 1615, 1615, 1615, 1615,
+
+     1615, 1615, 1615, 1616, 1616, 1616, 1616, 1616, 1616, 1616,
+     1616, 1616, 1616, 1616, 1616, 1616, 1616, 1616, 1616, 1616,
+     1616, 1616, 1616, 1616, 1616, 1616, 1616, 1616, 1616, 1616,
+     1616, 1616, 1616, 1616, 1616, 1616, 1616, 1616, 1616, 1616,
+     1616, 1616, 1616, 1616, 1616, 1616, 1616, 1616, 1616, 1616,
+     1616, 1616, 1616, 1616, 1616, 1616, 1616, 1616, 1616, 1616,
+     1616, 1616, 1616, 1616, 1616, 1616, 1616, 1616, 1616, 1616,
+     1617, 1617, 1617, 1617, 1617, 1617, 1617, 1617, 1617, 1617,
+     1617, 1617, 1617, 1617, 1617, 1617, 1617, 1617, 1617, 1617,
+     1617, 1617, 1617, 1617, 1617, 1617, 1617, 1617, 1617, 1617,
+
+     1617, 1617, 1617, 1617, 1617, 1617, 1617, 1617, 1617, 1617,
+     1617, 1617, 1617, 1617, 1617, 1617, 1617, 1617, 1617, 1617,
+     1617, 1617, 1617, 1617, 1617, 1617, 1617, 1617, 1617, 1617,
+     1617, 1617, 1617, 1617, 1617, 1617, 1617, 1618, 1618, 1618,
+     1618, 1618, 1618, 1618, 1618, 1618, 1618, 1618, 1618, 1618,
+     1618, 1618, 1618, 1618, 1618, 1618, 1618, 1618, 1618, 1618,
+     1618, 1618, 1618, 1618, 1618, 1618, 1618, 1618, 1618, 1618,
+     1618, 1618, 1618, 1618, 1618, 1618, 1618, 1618, 1618, 1618,
+     1618, 1618, 1618, 1618, 1618, 1618, 1618, 1618, 1618, 1618,
+     1618, 1618, 1618, 1618, 1618, 1618, 1618, 1618, 1618, 1618,
+
+     1618, 1618, 1618, 1618, 1619, 1619, 1619, 1619, 1619, 1619,
+     1619, 1619, 1619, 1619, 1619, 1619, 1619, 1619, 1619, 1619,
+     1619, 1619, 1619, 1619, 1619, 1619, 1619, 1619, 1619, 1619,
+     1619, 1619, 1619, 1619, 1619, 1619, 1619, 1619, 1619, 1619,
+     1619, 1619, 1619, 1619, 1619, 1619, 1619, 1619, 1619, 1619,
+     1619, 1619, 1619, 1619, 1619, 1619, 1619, 1619, 1619, 1619,
+     1619, 1619, 1619, 1619, 1619, 1619, 1619, 1619, 1619, 1619,
+     1619, 1620, 1620, 1620, 1620, 1620, 1620, 1620, 1620, 1620,
+     1620, 1620, 1620, 1620, 1620, 1620, 1620, 1620, 1620, 1620,
+     1620, 1620, 1620, 1620, 1620, 1620, 1620, 1620, 1620, 1620,
+
+     1620, 1620, 1620, 1620, 1620, 1620, 1620, 1620, 1620, 1620,
+     1620, 1620, 1620, 1620, 1620, 1620, 1620, 1620, 1620, 1620,
+     1620, 1620, 1620, 1620, 1620, 1620, 1620, 1620, 1620, 1620,
+     1620, 1620, 1620, 1620, 1620, 1620, 1620, 1620, 1621, 1621,
+     1621, 1621, 1621, 1621, 1621, 1621, 1621, 1621, 1621, 1621,
+     1621, 1621, 1621, 1621, 1621, 1621, 1621, 1621, 1621, 1621,
+     1621, 1621, 1621, 1621, 1621, 1621, 1621, 1621, 1621, 1621,
+     1621, 1621, 1621, 1621, 1621, 1621, 1621, 1621, 1621, 1621,
+     1621, 1621, 1621, 1621, 1621, 1621, 1621, 1621, 1621, 1621,
+     1621, 1621, 1621, 1621, 1621, 1621, 1621, 1621, 1621, 1621,
+
+     1621, 1621, 1621, 1621, 1621, 1622, 1622, 1622, 1622, 1622,
+     1622, 1622, 1622, 1622, 1622, 1622, 1622, 1622, 1622, 1622,
+     1622, 1622, 1622, 1622, 1622, 1622, 1622, 1622, 1622, 1622,
+     1622, 1622, 1622, 1622, 1622, 1622, 1622, 1622, 1622, 1622,
+     1622, 1622, 1622, 1622, 1622, 1622, 1622, 1622, 1622, 1622,
+     1622, 1622, 1622, 1622, 1622, 1622, 1622, 1622, 1622, 1622,
+     1622, 1622, 1622, 1622, 1622, 1622, 1622, 1622, 1622, 1622,
+     1622, 1622, 1623, 1623, 1623, 1623, 1623, 1623, 1623, 1623,
+     1623, 1623, 1623, 1623, 1623, 1623, 1623, 1623, 1623, 1623,
+     1623, 1623, 1623, 1623, 1623, 1623, 1623, 1623, 1623, 1623,
+
+     1623, 1623, 1623, 1623, 1623, 1623, 1623, 1623, 1623, 1623,
+     1623, 1623, 1623, 1623, 1623, 1623, 1623, 1623, 1623, 1623,
+     1623, 1623, 1623, 1623, 1623, 1623, 1623, 1623, 1623, 1623,
+     1623, 1623, 1623, 1623, 1623, 1623, 1623, 1623, 1623, 1624,
+     1624, 1624, 1624, 1624, 1624, 1624, 1624, 1624, 1624, 1624,
+     1624, 1624, 1624, 1624, 1624, 1624, 1624, 1624, 1624, 1624,
+     1624, 1624, 1624, 1624, 1624, 1624, 1624, 1624, 1624, 1624,
+     1624, 1624, 1624, 1624, 1624, 1624, 1624, 1624, 1624, 1624,
+     1624, 1624, 1624, 1624, 1624, 1624, 1624, 1624, 1624, 1624,
+     1624, 1624, 1624, 1624, 1624, 1624, 1624, 1624, 1624, 1624,
+
+     1624, 1624, 1624, 1624, 1624, 1624, 1625, 1625, 1625, 1625,
+     1625, 1625, 1625, 1625, 1625, 1625, 1625, 1625, 1625, 1625,
+     1625, 1625, 1625, 1625, 1625, 1625, 1625, 1625, 1625, 1625,
+     1625, 1625, 1625, 1625, 1625, 1625, 1625, 1625, 1625, 1625,
+     1625, 1625, 1625, 1625, 1625, 1625, 1625, 1625, 1625, 1625,
+     1625, 1625, 1625, 1625, 1625, 1625, 1625, 1625, 1625, 1625,
+     1625, 1625, 1625, 1625, 1625, 1625, 1625, 1625, 1625, 1625,
+     1625, 1625, 1625, 1626, 1626, 1626, 1626, 1626, 1626, 1626,
+     1626, 1626, 1626, 1626, 1626, 1626, 1626, 1626, 1626, 1626,
+     1626, 1626, 1626, 1626, 1626, 1626, 1626, 1626, 1626, 1626,
+
+     1626, 1626, 1626, 1626, 1626, 1626, 1626, 1626, 1626, 1626,
+     1626, 1626, 1626, 1626, 1626, 1626, 1626, 1626, 1626, 1626,
+     1626, 1626, 1626, 1626, 1626, 1626, 1626, 1626, 1626, 1626,
+     1626, 1626, 1626, 1626, 1626, 1626, 1626, 1626, 1626, 1626,
+     1627, 1627, 1627, 1627, 1627, 1627, 1627, 1627, 1627, 1627,
+     1627, 1627, 1627, 1627, 1627, 1627, 1627, 1627, 1627, 1627,
+     1627, 1627, 1627, 1627, 1627, 1627, 1627, 1627, 1627, 1627,
+     1627, 1627, 1627, 1627, 1627, 1627, 1627, 1627, 1627, 1627,
+     1627, 1627, 1627, 1627, 1627, 1627, 1627, 1627, 1627, 1627,
+     1627, 1627, 1627, 1627, 1627, 1627, 1627, 1627, 1627, 1627,
+
+     1627, 1627, 1627, 1627, 1627, 1627, 1627, 1628, 1628, 1628,
+     1628, 1628, 1628, 1628, 1628, 1628, 1628, 1628, 1628, 1628,
+     1628, 1628, 1628, 1628, 1628, 1628, 1628, 1628, 1628, 1628,
+     1628, 1628, 1628, 1628, 1628, 1628, 1628, 1628, 1628, 1628,
+     1628, 1628, 1628, 1628, 1628, 1628, 1628, 1628, 1628, 1628,
+     1628, 1628, 1628, 1628, 1628, 1628, 1628, 1628, 1628, 1628,
+     1628, 1628, 1628, 1628, 1628, 1628, 1628, 1628, 1628, 1628,
+     1628, 1628, 1628, 1628, 1629, 1629, 1629, 1629, 1629, 1629,
+     1629, 1629, 1629, 1629, 1629, 1629, 1629, 1629, 1629, 1629,
+     1629, 1629, 1629, 1629, 1629, 1629, 1629, 1629, 1629, 1629,
+
+     1629, 1629, 1629, 1629, 1629, 1629, 1629, 1629, 1629, 1629,
+     1629, 1629, 1629, 1629, 1629, 1629, 1629, 1629, 1629, 1629,
+     1629, 1629, 1629, 1629, 1629, 1629, 1629, 1629, 1629, 1629,
+     1629, 1629, 1629, 1629, 1629, 1629, 1629, 1629, 1629, 1629,
+     1629, 1630, 1630, 1630, 1630, 1630, 1630, 1630, 1630, 1630,
+     1630, 1630, 1630, 1630, 1630, 1630, 1630, 1630, 1630, 1630,
+     1630, 1630, 1630, 1630, 1630, 1630, 1630, 1630, 1630, 1630,
+     1630, 1630, 1630, 1630, 1630, 1630, 1630, 1630, 1630, 1630,
+     1630, 1630, 1630, 1630, 1630, 1630, 1630, 1630, 1630, 1630,
+     1630, 1630, 1630, 1630, 1630, 1630, 1630, 1630, 1630, 1630,
+
+     1630, 1630, 1630, 1630, 1630, 1630, 1630, 1630, 1631, 1631,
+     1631, 1631, 1631, 1631, 1631, 1631, 1631, 1631, 1631, 1631,
+     1631, 1631, 1631, 1631, 1631, 1631, 1631, 1631, 1631, 1631,
+     1631, 1631, 1631, 1631, 1631, 1631, 1631, 1631, 1631, 1631,
+     1631, 1631, 1631, 1631, 1631, 1631, 1631, 1631, 1631, 1631,
+     1631, 1631, 1631, 1631, 1631, 1631, 1631, 1631, 1631, 1631,
+     1631, 1631, 1631, 1631, 1631, 1631, 1631, 1631, 1631, 1631,
+     1631, 1631, 1631, 1631, 1631
     } ;
 
 static yy_state_type yy_last_accepting_state;
@@ -1743,8 +2059,8 @@ conf_yy_fatal_error(const char *msg)
   return 0;
 }
 
-#line 1747 "conf_lexer.c"
-#line 1748 "conf_lexer.c"
+#line 2063 "conf_lexer.c"
+#line 2064 "conf_lexer.c"
 
 #define INITIAL 0
 
@@ -1961,7 +2277,7 @@ YY_DECL
 	{
 #line 85 "conf_lexer.l"
 
-#line 1965 "conf_lexer.c"
+#line 2281 "conf_lexer.c"
 
 	while ( /*CONSTCOND*/1 )		/* loops until end-of-file is reached */
 		{
@@ -1994,13 +2310,13 @@ yy_match:
 			while ( yy_chk[yy_base[yy_current_state] + yy_c] != yy_current_state )
 				{
 				yy_current_state = (int) yy_def[yy_current_state];
-				if ( yy_current_state >= 1613 )
+				if ( yy_current_state >= 1633 )
 					yy_c = yy_meta[yy_c];
 				}
 			yy_current_state = yy_nxt[yy_base[yy_current_state] + yy_c];
 			++yy_cp;
 			}
-		while ( yy_current_state != 1612 );
+		while ( yy_current_state != 1632 );
 		yy_cp = (yy_last_accepting_cpos);
 		yy_current_state = (yy_last_accepting_state);
 
@@ -2799,482 +3115,482 @@ YY_RULE_SETUP
 case 148:
 YY_RULE_SETUP
 #line 273 "conf_lexer.l"
-{ return PING_COOKIE; }
+{ return PERF_EXPORT_DELAY; }
 	YY_BREAK
 case 149:
 YY_RULE_SETUP
 #line 274 "conf_lexer.l"
-{ return PING_TIME; }
+{ return PERF_EXPORT_FILE; }
 	YY_BREAK
 case 150:
 YY_RULE_SETUP
 #line 275 "conf_lexer.l"
-{ return PORT; }
+{ return PING_COOKIE; }
 	YY_BREAK
 case 151:
 YY_RULE_SETUP
 #line 276 "conf_lexer.l"
-{ return T_PREPEND; }
+{ return PING_TIME; }
 	YY_BREAK
 case 152:
 YY_RULE_SETUP
 #line 277 "conf_lexer.l"
-{ return T_PSEUDO; }
+{ return PORT; }
 	YY_BREAK
 case 153:
 YY_RULE_SETUP
 #line 278 "conf_lexer.l"
-{ return RANDOM_IDLE; }
+{ return T_PREPEND; }
 	YY_BREAK
 case 154:
 YY_RULE_SETUP
 #line 279 "conf_lexer.l"
-{ return REASON; }
+{ return T_PSEUDO; }
 	YY_BREAK
 case 155:
 YY_RULE_SETUP
 #line 280 "conf_lexer.l"
-{ return T_RECVQ; }
+{ return RANDOM_IDLE; }
 	YY_BREAK
 case 156:
 YY_RULE_SETUP
 #line 281 "conf_lexer.l"
-{ return REDIRPORT; }
+{ return REASON; }
 	YY_BREAK
 case 157:
 YY_RULE_SETUP
 #line 282 "conf_lexer.l"
-{ return REDIRSERV; }
+{ return T_RECVQ; }
 	YY_BREAK
 case 158:
 YY_RULE_SETUP
 #line 283 "conf_lexer.l"
-{ return REHASH; }
+{ return REDIRPORT; }
 	YY_BREAK
 case 159:
 YY_RULE_SETUP
 #line 284 "conf_lexer.l"
-{ return T_REJ; }
+{ return REDIRSERV; }
 	YY_BREAK
 case 160:
 YY_RULE_SETUP
 #line 285 "conf_lexer.l"
-{ return REMOTE; }
+{ return REHASH; }
 	YY_BREAK
 case 161:
 YY_RULE_SETUP
 #line 286 "conf_lexer.l"
-{ return REMOTEBAN; }
+{ return T_REJ; }
 	YY_BREAK
 case 162:
 YY_RULE_SETUP
 #line 287 "conf_lexer.l"
-{ return T_RESTART; }
+{ return REMOTE; }
 	YY_BREAK
 case 163:
 YY_RULE_SETUP
 #line 288 "conf_lexer.l"
-{ return RESV; }
+{ return REMOTEBAN; }
 	YY_BREAK
 case 164:
 YY_RULE_SETUP
 #line 289 "conf_lexer.l"
-{ return RESV_EXEMPT; }
+{ return T_RESTART; }
 	YY_BREAK
 case 165:
 YY_RULE_SETUP
 #line 290 "conf_lexer.l"
-{ return RSA_PRIVATE_KEY_FILE; }
+{ return RESV; }
 	YY_BREAK
 case 166:
 YY_RULE_SETUP
 #line 291 "conf_lexer.l"
-{ return SEND_PASSWORD; }
+{ return RESV_EXEMPT; }
 	YY_BREAK
 case 167:
 YY_RULE_SETUP
 #line 292 "conf_lexer.l"
-{ return SENDQ; }
+{ return RSA_PRIVATE_KEY_FILE; }
 	YY_BREAK
 case 168:
 YY_RULE_SETUP
 #line 293 "conf_lexer.l"
-{ return T_SERVER; }
+{ return SEND_PASSWORD; }
 	YY_BREAK
 case 169:
 YY_RULE_SETUP
 #line 294 "conf_lexer.l"
-{ return SERVERHIDE; }
+{ return SENDQ; }
 	YY_BREAK
 case 170:
 YY_RULE_SETUP
 #line 295 "conf_lexer.l"
-{ return SERVERINFO; }
+{ return T_SERVER; }
 	YY_BREAK
 case 171:
 YY_RULE_SETUP
 #line 296 "conf_lexer.l"
-{ return T_SERVICE; }
+{ return SERVERHIDE; }
 	YY_BREAK
 case 172:
 YY_RULE_SETUP
 #line 297 "conf_lexer.l"
-{ return T_SERVNOTICE; }
+{ return SERVERINFO; }
 	YY_BREAK
 case 173:
 YY_RULE_SETUP
 #line 298 "conf_lexer.l"
-{ return T_SET; }
+{ return T_SERVICE; }
 	YY_BREAK
 case 174:
 YY_RULE_SETUP
 #line 299 "conf_lexer.l"
-{ return T_SHARED; }
+{ return T_SERVNOTICE; }
 	YY_BREAK
 case 175:
 YY_RULE_SETUP
 #line 300 "conf_lexer.l"
-{ return SHORT_MOTD; }
+{ return T_SET; }
 	YY_BREAK
 case 176:
 YY_RULE_SETUP
 #line 301 "conf_lexer.l"
-{ return IRCD_SID; }
+{ return T_SHARED; }
 	YY_BREAK
 case 177:
 YY_RULE_SETUP
 #line 302 "conf_lexer.l"
-{ return T_SIZE; }
+{ return SHORT_MOTD; }
 	YY_BREAK
 case 178:
 YY_RULE_SETUP
 #line 303 "conf_lexer.l"
-{ return T_SKILL; }
+{ return IRCD_SID; }
 	YY_BREAK
 case 179:
 YY_RULE_SETUP
 #line 304 "conf_lexer.l"
-{ return T_SOFTCALLERID; }
+{ return T_SIZE; }
 	YY_BREAK
 case 180:
 YY_RULE_SETUP
 #line 305 "conf_lexer.l"
-{ return SPOOF; }
+{ return T_SKILL; }
 	YY_BREAK
 case 181:
 YY_RULE_SETUP
 #line 306 "conf_lexer.l"
-{ return T_SPY; }
+{ return T_SOFTCALLERID; }
 	YY_BREAK
 case 182:
 YY_RULE_SETUP
 #line 307 "conf_lexer.l"
-{ return SQUIT; }
+{ return SPOOF; }
 	YY_BREAK
 case 183:
 YY_RULE_SETUP
 #line 308 "conf_lexer.l"
-{ return T_TLS; }
+{ return T_SPY; }
 	YY_BREAK
 case 184:
 YY_RULE_SETUP
 #line 309 "conf_lexer.l"
-{ return STATS_E_DISABLED; }
+{ return SQUIT; }
 	YY_BREAK
 case 185:
 YY_RULE_SETUP
 #line 310 "conf_lexer.l"
-{ return STATS_I_OPER_ONLY; }
+{ return T_TLS; }
 	YY_BREAK
 case 186:
 YY_RULE_SETUP
 #line 311 "conf_lexer.l"
-{ return STATS_K_OPER_ONLY; }
+{ return STATS_E_DISABLED; }
 	YY_BREAK
 case 187:
 YY_RULE_SETUP
 #line 312 "conf_lexer.l"
-{ return STATS_M_OPER_ONLY; }
+{ return STATS_I_OPER_ONLY; }
 	YY_BREAK
 case 188:
 YY_RULE_SETUP
 #line 313 "conf_lexer.l"
-{ return STATS_O_OPER_ONLY; }
+{ return STATS_K_OPER_ONLY; }
 	YY_BREAK
 case 189:
 YY_RULE_SETUP
 #line 314 "conf_lexer.l"
-{ return STATS_P_OPER_ONLY; }
+{ return STATS_M_OPER_ONLY; }
 	YY_BREAK
 case 190:
 YY_RULE_SETUP
 #line 315 "conf_lexer.l"
-{ return STATS_U_OPER_ONLY; }
+{ return STATS_O_OPER_ONLY; }
 	YY_BREAK
 case 191:
 YY_RULE_SETUP
 #line 316 "conf_lexer.l"
-{ return T_TARGET; }
+{ return STATS_P_OPER_ONLY; }
 	YY_BREAK
 case 192:
 YY_RULE_SETUP
 #line 317 "conf_lexer.l"
-{ return THROTTLE_COUNT; }
+{ return STATS_U_OPER_ONLY; }
 	YY_BREAK
 case 193:
 YY_RULE_SETUP
 #line 318 "conf_lexer.l"
-{ return THROTTLE_TIME; }
+{ return T_TARGET; }
 	YY_BREAK
 case 194:
 YY_RULE_SETUP
 #line 319 "conf_lexer.l"
-{ return TIMEOUT; }
+{ return THROTTLE_COUNT; }
 	YY_BREAK
 case 195:
 YY_RULE_SETUP
 #line 320 "conf_lexer.l"
-{ return T_TLS; }
+{ return THROTTLE_TIME; }
 	YY_BREAK
 case 196:
 YY_RULE_SETUP
 #line 321 "conf_lexer.l"
-{ return TLS_CERTIFICATE_FILE; }
+{ return TIMEOUT; }
 	YY_BREAK
 case 197:
 YY_RULE_SETUP
 #line 322 "conf_lexer.l"
-{ return TLS_CERTIFICATE_FINGERPRINT; }
+{ return T_TLS; }
 	YY_BREAK
 case 198:
 YY_RULE_SETUP
 #line 323 "conf_lexer.l"
-{ return TLS_CIPHER_LIST; }
+{ return TLS_CERTIFICATE_FILE; }
 	YY_BREAK
 case 199:
 YY_RULE_SETUP
 #line 324 "conf_lexer.l"
-{ return TLS_CIPHER_SUITES; }
+{ return TLS_CERTIFICATE_FINGERPRINT; }
 	YY_BREAK
 case 200:
 YY_RULE_SETUP
 #line 325 "conf_lexer.l"
-{ return TLS_CONNECTION_REQUIRED; }
+{ return TLS_CIPHER_LIST; }
 	YY_BREAK
 case 201:
 YY_RULE_SETUP
 #line 326 "conf_lexer.l"
-{ return TLS_DH_PARAM_FILE; }
+{ return TLS_CIPHER_SUITES; }
 	YY_BREAK
 case 202:
 YY_RULE_SETUP
 #line 327 "conf_lexer.l"
-{ return TLS_MESSAGE_DIGEST_ALGORITHM; }
+{ return TLS_CONNECTION_REQUIRED; }
 	YY_BREAK
 case 203:
 YY_RULE_SETUP
 #line 328 "conf_lexer.l"
-{ return TLS_SUPPORTED_GROUPS; }
+{ return TLS_DH_PARAM_FILE; }
 	YY_BREAK
 case 204:
 YY_RULE_SETUP
 #line 329 "conf_lexer.l"
-{ return TS_MAX_DELTA; }
+{ return TLS_MESSAGE_DIGEST_ALGORITHM; }
 	YY_BREAK
 case 205:
 YY_RULE_SETUP
 #line 330 "conf_lexer.l"
-{ return TS_WARN_DELTA; }
+{ return TLS_SUPPORTED_GROUPS; }
 	YY_BREAK
 case 206:
 YY_RULE_SETUP
 #line 331 "conf_lexer.l"
-{ return TYPE; }
+{ return TS_MAX_DELTA; }
 	YY_BREAK
 case 207:
 YY_RULE_SETUP
 #line 332 "conf_lexer.l"
-{ return T_UMODES; }
+{ return TS_WARN_DELTA; }
 	YY_BREAK
 case 208:
 YY_RULE_SETUP
 #line 333 "conf_lexer.l"
-{ return T_UNAUTH; }
+{ return TYPE; }
 	YY_BREAK
 case 209:
 YY_RULE_SETUP
 #line 334 "conf_lexer.l"
-{ return T_UNDLINE; }
+{ return T_UMODES; }
 	YY_BREAK
 case 210:
 YY_RULE_SETUP
 #line 335 "conf_lexer.l"
-{ return UNKLINE; }
+{ return T_UNAUTH; }
 	YY_BREAK
 case 211:
 YY_RULE_SETUP
 #line 336 "conf_lexer.l"
-{ return T_UNLIMITED; }
+{ return T_UNDLINE; }
 	YY_BREAK
 case 212:
 YY_RULE_SETUP
 #line 337 "conf_lexer.l"
-{ return T_UNRESV; }
+{ return UNKLINE; }
 	YY_BREAK
 case 213:
 YY_RULE_SETUP
 #line 338 "conf_lexer.l"
-{ return T_UNXLINE; }
+{ return T_UNLIMITED; }
 	YY_BREAK
 case 214:
 YY_RULE_SETUP
 #line 339 "conf_lexer.l"
-{ return USE_LOGGING; }
+{ return T_UNRESV; }
 	YY_BREAK
 case 215:
 YY_RULE_SETUP
 #line 340 "conf_lexer.l"
-{ return USER; }
+{ return T_UNXLINE; }
 	YY_BREAK
 case 216:
 YY_RULE_SETUP
 #line 341 "conf_lexer.l"
-{ return T_WALLOP; }
+{ return USE_LOGGING; }
 	YY_BREAK
 case 217:
 YY_RULE_SETUP
 #line 342 "conf_lexer.l"
-{ return T_WALLOPS; }
+{ return USER; }
 	YY_BREAK
 case 218:
 YY_RULE_SETUP
 #line 343 "conf_lexer.l"
-{ return WARN_NO_CONNECT_BLOCK; }
+{ return T_WALLOP; }
 	YY_BREAK
 case 219:
 YY_RULE_SETUP
 #line 344 "conf_lexer.l"
-{ return T_WEBIRC; }
+{ return T_WALLOPS; }
 	YY_BREAK
 case 220:
 YY_RULE_SETUP
 #line 345 "conf_lexer.l"
-{ return WHOIS; }
+{ return WARN_NO_CONNECT_BLOCK; }
 	YY_BREAK
 case 221:
 YY_RULE_SETUP
 #line 346 "conf_lexer.l"
-{ return WHOWAS_HISTORY_LENGTH; }
+{ return T_WEBIRC; }
 	YY_BREAK
 case 222:
 YY_RULE_SETUP
 #line 347 "conf_lexer.l"
-{ return XLINE; }
+{ return WHOIS; }
 	YY_BREAK
 case 223:
 YY_RULE_SETUP
 #line 348 "conf_lexer.l"
-{ return XLINE_EXEMPT; }
+{ return WHOWAS_HISTORY_LENGTH; }
 	YY_BREAK
 case 224:
 YY_RULE_SETUP
-#line 350 "conf_lexer.l"
-{ yylval.number = 1; return TBOOL; }
+#line 349 "conf_lexer.l"
+{ return XLINE; }
 	YY_BREAK
 case 225:
 YY_RULE_SETUP
-#line 351 "conf_lexer.l"
-{ yylval.number = 0; return TBOOL; }
+#line 350 "conf_lexer.l"
+{ return XLINE_EXEMPT; }
 	YY_BREAK
 case 226:
 YY_RULE_SETUP
-#line 353 "conf_lexer.l"
-{ return YEARS; }
+#line 352 "conf_lexer.l"
+{ yylval.number = 1; return TBOOL; }
 	YY_BREAK
 case 227:
 YY_RULE_SETUP
-#line 354 "conf_lexer.l"
-{ return YEARS; }
+#line 353 "conf_lexer.l"
+{ yylval.number = 0; return TBOOL; }
 	YY_BREAK
 case 228:
 YY_RULE_SETUP
 #line 355 "conf_lexer.l"
-{ return MONTHS; }
+{ return YEARS; }
 	YY_BREAK
 case 229:
 YY_RULE_SETUP
 #line 356 "conf_lexer.l"
-{ return MONTHS; }
+{ return YEARS; }
 	YY_BREAK
 case 230:
 YY_RULE_SETUP
 #line 357 "conf_lexer.l"
-{ return WEEKS; }
+{ return MONTHS; }
 	YY_BREAK
 case 231:
 YY_RULE_SETUP
 #line 358 "conf_lexer.l"
-{ return WEEKS; }
+{ return MONTHS; }
 	YY_BREAK
 case 232:
 YY_RULE_SETUP
 #line 359 "conf_lexer.l"
-{ return DAYS; }
+{ return WEEKS; }
 	YY_BREAK
 case 233:
 YY_RULE_SETUP
 #line 360 "conf_lexer.l"
-{ return DAYS; }
+{ return WEEKS; }
 	YY_BREAK
 case 234:
 YY_RULE_SETUP
 #line 361 "conf_lexer.l"
-{ return HOURS; }
+{ return DAYS; }
 	YY_BREAK
 case 235:
 YY_RULE_SETUP
 #line 362 "conf_lexer.l"
-{ return HOURS; }
+{ return DAYS; }
 	YY_BREAK
 case 236:
 YY_RULE_SETUP
 #line 363 "conf_lexer.l"
-{ return MINUTES; }
+{ return HOURS; }
 	YY_BREAK
 case 237:
 YY_RULE_SETUP
 #line 364 "conf_lexer.l"
-{ return MINUTES; }
+{ return HOURS; }
 	YY_BREAK
 case 238:
 YY_RULE_SETUP
 #line 365 "conf_lexer.l"
-{ return SECONDS; }
+{ return MINUTES; }
 	YY_BREAK
 case 239:
 YY_RULE_SETUP
 #line 366 "conf_lexer.l"
-{ return SECONDS; }
+{ return MINUTES; }
 	YY_BREAK
 case 240:
 YY_RULE_SETUP
-#line 368 "conf_lexer.l"
-{ return BYTES; }
+#line 367 "conf_lexer.l"
+{ return SECONDS; }
 	YY_BREAK
 case 241:
 YY_RULE_SETUP
-#line 369 "conf_lexer.l"
-{ return BYTES; }
+#line 368 "conf_lexer.l"
+{ return SECONDS; }
 	YY_BREAK
 case 242:
 YY_RULE_SETUP
 #line 370 "conf_lexer.l"
-{ return KBYTES; }
+{ return BYTES; }
 	YY_BREAK
 case 243:
 YY_RULE_SETUP
 #line 371 "conf_lexer.l"
-{ return KBYTES; }
+{ return BYTES; }
 	YY_BREAK
 case 244:
 YY_RULE_SETUP
@@ -3294,12 +3610,12 @@ YY_RULE_SETUP
 case 247:
 YY_RULE_SETUP
 #line 375 "conf_lexer.l"
-{ return MBYTES; }
+{ return KBYTES; }
 	YY_BREAK
 case 248:
 YY_RULE_SETUP
 #line 376 "conf_lexer.l"
-{ return MBYTES; }
+{ return KBYTES; }
 	YY_BREAK
 case 249:
 YY_RULE_SETUP
@@ -3319,23 +3635,33 @@ YY_RULE_SETUP
 case 252:
 YY_RULE_SETUP
 #line 380 "conf_lexer.l"
-{ return TWODOTS; }
+{ return MBYTES; }
 	YY_BREAK
 case 253:
 YY_RULE_SETUP
+#line 381 "conf_lexer.l"
+{ return MBYTES; }
+	YY_BREAK
+case 254:
+YY_RULE_SETUP
 #line 382 "conf_lexer.l"
+{ return TWODOTS; }
+	YY_BREAK
+case 255:
+YY_RULE_SETUP
+#line 384 "conf_lexer.l"
 { return yytext[0]; }
 	YY_BREAK
 case YY_STATE_EOF(INITIAL):
-#line 383 "conf_lexer.l"
+#line 385 "conf_lexer.l"
 { if (ieof() == true) yyterminate(); }
 	YY_BREAK
-case 254:
+case 256:
 YY_RULE_SETUP
-#line 385 "conf_lexer.l"
+#line 387 "conf_lexer.l"
 ECHO;
 	YY_BREAK
-#line 3339 "conf_lexer.c"
+#line 3665 "conf_lexer.c"
 
 	case YY_END_OF_BUFFER:
 		{
@@ -3631,7 +3957,7 @@ static int yy_get_next_buffer (void)
 		while ( yy_chk[yy_base[yy_current_state] + yy_c] != yy_current_state )
 			{
 			yy_current_state = (int) yy_def[yy_current_state];
-			if ( yy_current_state >= 1613 )
+			if ( yy_current_state >= 1633 )
 				yy_c = yy_meta[yy_c];
 			}
 		yy_current_state = yy_nxt[yy_base[yy_current_state] + yy_c];
@@ -3659,11 +3985,11 @@ static int yy_get_next_buffer (void)
 	while ( yy_chk[yy_base[yy_current_state] + yy_c] != yy_current_state )
 		{
 		yy_current_state = (int) yy_def[yy_current_state];
-		if ( yy_current_state >= 1613 )
+		if ( yy_current_state >= 1633 )
 			yy_c = yy_meta[yy_c];
 		}
 	yy_current_state = yy_nxt[yy_base[yy_current_state] + yy_c];
-	yy_is_jam = (yy_current_state == 1612);
+	yy_is_jam = (yy_current_state == 1632);
 
 		return yy_is_jam ? 0 : yy_current_state;
 }
@@ -4302,7 +4628,7 @@ void yyfree (void * ptr )
 
 #define YYTABLES_NAME "yytables"
 
-#line 385 "conf_lexer.l"
+#line 387 "conf_lexer.l"
 
 
 /* C-comment ignoring routine -kre*/
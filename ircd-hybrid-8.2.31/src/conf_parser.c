@@ -1,8 +1,8 @@
-/* A Bison parser, made by GNU Bison 3.3.2.  */
+/* A Bison parser, made by GNU Bison 3.8.2.  */
 
 /* Bison implementation for Yacc-like parsers in C
 
-   Copyright (C) 1984, 1989-1990, 2000-2015, 2018-2019 Free Software Foundation,
+   Copyright (C) 1984, 1989-1990, 2000-2015, 2018-2021 Free Software Foundation,
    Inc.
 
    This program is free software: you can redistribute it and/or modify
@@ -16,7 +16,7 @@
    GNU General Public License for more details.
 
    You should have received a copy of the GNU General Public License
-   along with this program.  If not, see <http://www.gnu.org/licenses/>.  */
+   along with this program.  If not, see <https://www.gnu.org/licenses/>.  */
 
 /* As a special exception, you may create a larger work that contains
    part or all of the Bison parser skeleton and distribute that work
@@ -34,6 +34,10 @@
 /* C LALR(1) parser skeleton written by Richard Stallman, by
    simplifying the original so-called "semantic" parser.  */
 
+/* DO NOT RELY ON FEATURES THAT ARE NOT DOCUMENTED in the manual,
+   especially those whose name start with YY_ or yy_.  They are
+   private implementation details that can be changed or removed.  */
+
 /* All symbols defined below should begin with yy or YY, to avoid
    infringing on user name space.  This should be done even for local
    variables, as they might otherwise be expanded by user macros.
@@ -41,14 +45,11 @@
    define necessary library symbols; they are noted "INFRINGES ON
    USER NAME SPACE" below.  */
 
-/* Undocumented macros, especially those whose name start with YY_,
-   are private implementation details.  Do not rely on them.  */
-
-/* Identify Bison output.  */
-#define YYBISON 1
+/* Identify Bison output, and Bison version.  */
+#define YYBISON 30802
 
-/* Bison version.  */
-#define YYBISON_VERSION "3.3.2"
+/* Bison version string.  */
+#define YYBISON_VERSION "3.8.2"
 
 /* Skeleton name.  */
 #define YYSKELETON_NAME "yacc.c"
@@ -66,7 +67,7 @@
 
 
 /* First part of user prologue.  */
-#line 28 "conf_parser.y" /* yacc.c:337  */
+#line 28 "conf_parser.y"
 
 
 #include "config.h"
@@ -171,7 +172,17 @@ reset_block_state(void)
 }
 
 
-#line 175 "conf_parser.c" /* yacc.c:337  */
+#line 176 "conf_parser.c"
+
+# ifndef YY_CAST
+#  ifdef __cplusplus
+#   define YY_CAST(Type, Val) static_cast<Type> (Val)
+#   define YY_REINTERPRET_CAST(Type, Val) reinterpret_cast<Type> (Val)
+#  else
+#   define YY_CAST(Type, Val) ((Type) (Val))
+#   define YY_REINTERPRET_CAST(Type, Val) ((Type) (Val))
+#  endif
+# endif
 # ifndef YY_NULLPTR
 #  if defined __cplusplus
 #   if 201103L <= __cplusplus
@@ -184,16 +195,8 @@ reset_block_state(void)
 #  endif
 # endif
 
-/* Enabling verbose error messages.  */
-#ifdef YYERROR_VERBOSE
-# undef YYERROR_VERBOSE
-# define YYERROR_VERBOSE 1
-#else
-# define YYERROR_VERBOSE 0
-#endif
-
-/* In a future release of Bison, this section will be replaced
-   by #include "y.tab.h".  */
+/* Use api.header.include to #include this header
+   instead of duplicating it here.  */
 #ifndef YY_YY_CONF_PARSER_H_INCLUDED
 # define YY_YY_CONF_PARSER_H_INCLUDED
 /* Debug traces.  */
@@ -204,242 +207,253 @@ reset_block_state(void)
 extern int yydebug;
 #endif
 
-/* Token type.  */
+/* Token kinds.  */
 #ifndef YYTOKENTYPE
 # define YYTOKENTYPE
   enum yytokentype
   {
-    ACCEPT_PASSWORD = 258,
-    ADMIN = 259,
-    AFTYPE = 260,
-    ANTI_NICK_FLOOD = 261,
-    ANTI_SPAM_EXIT_MESSAGE_TIME = 262,
-    AUTOCONN = 263,
-    AWAY_COUNT = 264,
-    AWAY_TIME = 265,
-    BYTES = 266,
-    KBYTES = 267,
-    MBYTES = 268,
-    CALLER_ID_WAIT = 269,
-    CAN_FLOOD = 270,
-    CHANNEL = 271,
-    CIDR_BITLEN_IPV4 = 272,
-    CIDR_BITLEN_IPV6 = 273,
-    CLASS = 274,
-    CLOSE = 275,
-    CONNECT = 276,
-    CONNECTFREQ = 277,
-    CYCLE_ON_HOST_CHANGE = 278,
-    DEFAULT_FLOODCOUNT = 279,
-    DEFAULT_FLOODTIME = 280,
-    DEFAULT_JOIN_FLOOD_COUNT = 281,
-    DEFAULT_JOIN_FLOOD_TIME = 282,
-    DEFAULT_MAX_CLIENTS = 283,
-    DENY = 284,
-    DESCRIPTION = 285,
-    DIE = 286,
-    DISABLE_AUTH = 287,
-    DISABLE_FAKE_CHANNELS = 288,
-    DISABLE_REMOTE_COMMANDS = 289,
-    DLINE_MIN_CIDR = 290,
-    DLINE_MIN_CIDR6 = 291,
-    DOTS_IN_IDENT = 292,
-    EMAIL = 293,
-    ENABLE_EXTBANS = 294,
-    ENCRYPTED = 295,
-    EXCEED_LIMIT = 296,
-    EXEMPT = 297,
-    EXPIRATION = 298,
-    FAILED_OPER_NOTICE = 299,
-    FLATTEN_LINKS = 300,
-    FLATTEN_LINKS_DELAY = 301,
-    FLATTEN_LINKS_FILE = 302,
-    GECOS = 303,
-    GENERAL = 304,
-    HIDDEN = 305,
-    HIDDEN_NAME = 306,
-    HIDE_CHANS = 307,
-    HIDE_IDLE = 308,
-    HIDE_IDLE_FROM_OPERS = 309,
-    HIDE_SERVER_IPS = 310,
-    HIDE_SERVERS = 311,
-    HIDE_SERVICES = 312,
-    HOST = 313,
-    HUB = 314,
-    HUB_MASK = 315,
-    INVISIBLE_ON_CONNECT = 316,
-    INVITE_CLIENT_COUNT = 317,
-    INVITE_CLIENT_TIME = 318,
-    INVITE_DELAY_CHANNEL = 319,
-    INVITE_EXPIRE_TIME = 320,
-    IP = 321,
-    IRCD_AUTH = 322,
-    IRCD_FLAGS = 323,
-    IRCD_SID = 324,
-    JOIN = 325,
-    KILL = 326,
-    KILL_CHASE_TIME_LIMIT = 327,
-    KLINE = 328,
-    KLINE_EXEMPT = 329,
-    KLINE_MIN_CIDR = 330,
-    KLINE_MIN_CIDR6 = 331,
-    KNOCK_CLIENT_COUNT = 332,
-    KNOCK_CLIENT_TIME = 333,
-    KNOCK_DELAY_CHANNEL = 334,
-    LEAF_MASK = 335,
-    LISTEN = 336,
-    MASK = 337,
-    MAX_ACCEPT = 338,
-    MAX_BANS = 339,
-    MAX_BANS_LARGE = 340,
-    MAX_CHANNELS = 341,
-    MAX_IDLE = 342,
-    MAX_INVITES = 343,
-    MAX_NICK_CHANGES = 344,
-    MAX_NICK_LENGTH = 345,
-    MAX_NICK_TIME = 346,
-    MAX_NUMBER = 347,
-    MAX_TARGETS = 348,
-    MAX_TOPIC_LENGTH = 349,
-    MAX_WATCH = 350,
-    MIN_IDLE = 351,
-    MIN_NONWILDCARD = 352,
-    MIN_NONWILDCARD_SIMPLE = 353,
-    MODULE = 354,
-    MODULES = 355,
-    MOTD = 356,
-    NAME = 357,
-    NEED_IDENT = 358,
-    NEED_PASSWORD = 359,
-    NETWORK_DESC = 360,
-    NETWORK_NAME = 361,
-    NICK = 362,
-    NO_OPER_FLOOD = 363,
-    NO_TILDE = 364,
-    NUMBER = 365,
-    NUMBER_PER_CIDR = 366,
-    NUMBER_PER_IP_GLOBAL = 367,
-    NUMBER_PER_IP_LOCAL = 368,
-    OPER_ONLY_UMODES = 369,
-    OPER_UMODES = 370,
-    OPERATOR = 371,
-    OPERS_BYPASS_CALLERID = 372,
-    PACE_WAIT = 373,
-    PACE_WAIT_SIMPLE = 374,
-    PASSWORD = 375,
-    PATH = 376,
-    PING_COOKIE = 377,
-    PING_TIME = 378,
-    PORT = 379,
-    QSTRING = 380,
-    RANDOM_IDLE = 381,
-    REASON = 382,
-    REDIRPORT = 383,
-    REDIRSERV = 384,
-    REHASH = 385,
-    REMOTE = 386,
-    REMOTEBAN = 387,
-    RESV = 388,
-    RESV_EXEMPT = 389,
-    RSA_PRIVATE_KEY_FILE = 390,
-    SECONDS = 391,
-    MINUTES = 392,
-    HOURS = 393,
-    DAYS = 394,
-    WEEKS = 395,
-    MONTHS = 396,
-    YEARS = 397,
-    SEND_PASSWORD = 398,
-    SENDQ = 399,
-    SERVERHIDE = 400,
-    SERVERINFO = 401,
-    SHORT_MOTD = 402,
-    SPOOF = 403,
-    SQUIT = 404,
-    STATS_E_DISABLED = 405,
-    STATS_I_OPER_ONLY = 406,
-    STATS_K_OPER_ONLY = 407,
-    STATS_M_OPER_ONLY = 408,
-    STATS_O_OPER_ONLY = 409,
-    STATS_P_OPER_ONLY = 410,
-    STATS_U_OPER_ONLY = 411,
-    T_ALL = 412,
-    T_BIND = 413,
-    T_BOTS = 414,
-    T_CALLERID = 415,
-    T_CCONN = 416,
-    T_COMMAND = 417,
-    T_CLUSTER = 418,
-    T_DEAF = 419,
-    T_DEBUG = 420,
-    T_DLINE = 421,
-    T_EXTERNAL = 422,
-    T_FARCONNECT = 423,
-    T_FILE = 424,
-    T_FULL = 425,
-    T_GLOBOPS = 426,
-    T_INVISIBLE = 427,
-    T_IPV4 = 428,
-    T_IPV6 = 429,
-    T_LOCOPS = 430,
-    T_LOG = 431,
-    T_NCHANGE = 432,
-    T_NONONREG = 433,
-    T_OPME = 434,
-    T_PREPEND = 435,
-    T_PSEUDO = 436,
-    T_RECVQ = 437,
-    T_REJ = 438,
-    T_RESTART = 439,
-    T_SERVER = 440,
-    T_SERVICE = 441,
-    T_SERVNOTICE = 442,
-    T_SET = 443,
-    T_SHARED = 444,
-    T_SIZE = 445,
-    T_SKILL = 446,
-    T_SOFTCALLERID = 447,
-    T_SPY = 448,
-    T_TARGET = 449,
-    T_TLS = 450,
-    T_UMODES = 451,
-    T_UNAUTH = 452,
-    T_UNDLINE = 453,
-    T_UNLIMITED = 454,
-    T_UNRESV = 455,
-    T_UNXLINE = 456,
-    T_WALLOP = 457,
-    T_WALLOPS = 458,
-    T_WEBIRC = 459,
-    TBOOL = 460,
-    THROTTLE_COUNT = 461,
-    THROTTLE_TIME = 462,
-    TIMEOUT = 463,
-    TLS_CERTIFICATE_FILE = 464,
-    TLS_CERTIFICATE_FINGERPRINT = 465,
-    TLS_CIPHER_LIST = 466,
-    TLS_CIPHER_SUITES = 467,
-    TLS_CONNECTION_REQUIRED = 468,
-    TLS_DH_PARAM_FILE = 469,
-    TLS_MESSAGE_DIGEST_ALGORITHM = 470,
-    TLS_SUPPORTED_GROUPS = 471,
-    TS_MAX_DELTA = 472,
-    TS_WARN_DELTA = 473,
-    TWODOTS = 474,
-    TYPE = 475,
-    UNKLINE = 476,
-    USE_LOGGING = 477,
-    USER = 478,
-    VHOST = 479,
-    VHOST6 = 480,
-    WARN_NO_CONNECT_BLOCK = 481,
-    WHOIS = 482,
-    WHOWAS_HISTORY_LENGTH = 483,
-    XLINE = 484,
-    XLINE_EXEMPT = 485
+    YYEMPTY = -2,
+    YYEOF = 0,                     /* "end of file"  */
+    YYerror = 256,                 /* error  */
+    YYUNDEF = 257,                 /* "invalid token"  */
+    ACCEPT_PASSWORD = 258,         /* ACCEPT_PASSWORD  */
+    ADMIN = 259,                   /* ADMIN  */
+    AFTYPE = 260,                  /* AFTYPE  */
+    ANTI_NICK_FLOOD = 261,         /* ANTI_NICK_FLOOD  */
+    ANTI_SPAM_EXIT_MESSAGE_TIME = 262, /* ANTI_SPAM_EXIT_MESSAGE_TIME  */
+    AUTOCONN = 263,                /* AUTOCONN  */
+    AWAY_COUNT = 264,              /* AWAY_COUNT  */
+    AWAY_TIME = 265,               /* AWAY_TIME  */
+    BYTES = 266,                   /* BYTES  */
+    KBYTES = 267,                  /* KBYTES  */
+    MBYTES = 268,                  /* MBYTES  */
+    CALLER_ID_WAIT = 269,          /* CALLER_ID_WAIT  */
+    CAN_FLOOD = 270,               /* CAN_FLOOD  */
+    CHANNEL = 271,                 /* CHANNEL  */
+    CIDR_BITLEN_IPV4 = 272,        /* CIDR_BITLEN_IPV4  */
+    CIDR_BITLEN_IPV6 = 273,        /* CIDR_BITLEN_IPV6  */
+    CLASS = 274,                   /* CLASS  */
+    CLOSE = 275,                   /* CLOSE  */
+    CONNECT = 276,                 /* CONNECT  */
+    CONNECTFREQ = 277,             /* CONNECTFREQ  */
+    CYCLE_ON_HOST_CHANGE = 278,    /* CYCLE_ON_HOST_CHANGE  */
+    DEFAULT_FLOODCOUNT = 279,      /* DEFAULT_FLOODCOUNT  */
+    DEFAULT_FLOODTIME = 280,       /* DEFAULT_FLOODTIME  */
+    DEFAULT_JOIN_FLOOD_COUNT = 281, /* DEFAULT_JOIN_FLOOD_COUNT  */
+    DEFAULT_JOIN_FLOOD_TIME = 282, /* DEFAULT_JOIN_FLOOD_TIME  */
+    DEFAULT_MAX_CLIENTS = 283,     /* DEFAULT_MAX_CLIENTS  */
+    DENY = 284,                    /* DENY  */
+    DESCRIPTION = 285,             /* DESCRIPTION  */
+    DIE = 286,                     /* DIE  */
+    DISABLE_AUTH = 287,            /* DISABLE_AUTH  */
+    DISABLE_FAKE_CHANNELS = 288,   /* DISABLE_FAKE_CHANNELS  */
+    DISABLE_REMOTE_COMMANDS = 289, /* DISABLE_REMOTE_COMMANDS  */
+    DLINE_MIN_CIDR = 290,          /* DLINE_MIN_CIDR  */
+    DLINE_MIN_CIDR6 = 291,         /* DLINE_MIN_CIDR6  */
+    DOTS_IN_IDENT = 292,           /* DOTS_IN_IDENT  */
+    EMAIL = 293,                   /* EMAIL  */
+    ENABLE_EXTBANS = 294,          /* ENABLE_EXTBANS  */
+    ENCRYPTED = 295,               /* ENCRYPTED  */
+    EXCEED_LIMIT = 296,            /* EXCEED_LIMIT  */
+    EXEMPT = 297,                  /* EXEMPT  */
+    EXPIRATION = 298,              /* EXPIRATION  */
+    FAILED_OPER_NOTICE = 299,      /* FAILED_OPER_NOTICE  */
+    FLATTEN_LINKS = 300,           /* FLATTEN_LINKS  */
+    FLATTEN_LINKS_DELAY = 301,     /* FLATTEN_LINKS_DELAY  */
+    FLATTEN_LINKS_FILE = 302,      /* FLATTEN_LINKS_FILE  */
+    GECOS = 303,                   /* GECOS  */
+    GENERAL = 304,                 /* GENERAL  */
+    HIDDEN = 305,                  /* HIDDEN  */
+    HIDDEN_NAME = 306,             /* HIDDEN_NAME  */
+    HIDE_CHANS = 307,              /* HIDE_CHANS  */
+    HIDE_IDLE = 308,               /* HIDE_IDLE  */
+    HIDE_IDLE_FROM_OPERS = 309,    /* HIDE_IDLE_FROM_OPERS  */
+    HIDE_SERVER_IPS = 310,         /* HIDE_SERVER_IPS  */
+    HIDE_SERVERS = 311,            /* HIDE_SERVERS  */
+    HIDE_SERVICES = 312,           /* HIDE_SERVICES  */
+    HOST = 313,                    /* HOST  */
+    HUB = 314,                     /* HUB  */
+    HUB_MASK = 315,                /* HUB_MASK  */
+    INVISIBLE_ON_CONNECT = 316,    /* INVISIBLE_ON_CONNECT  */
+    INVITE_CLIENT_COUNT = 317,     /* INVITE_CLIENT_COUNT  */
+    INVITE_CLIENT_TIME = 318,      /* INVITE_CLIENT_TIME  */
+    INVITE_DELAY_CHANNEL = 319,    /* INVITE_DELAY_CHANNEL  */
+    INVITE_EXPIRE_TIME = 320,      /* INVITE_EXPIRE_TIME  */
+    IP = 321,                      /* IP  */
+    IRCD_AUTH = 322,               /* IRCD_AUTH  */
+    IRCD_FLAGS = 323,              /* IRCD_FLAGS  */
+    IRCD_SID = 324,                /* IRCD_SID  */
+    JOIN = 325,                    /* JOIN  */
+    KILL = 326,                    /* KILL  */
+    KILL_CHASE_TIME_LIMIT = 327,   /* KILL_CHASE_TIME_LIMIT  */
+    KLINE = 328,                   /* KLINE  */
+    KLINE_EXEMPT = 329,            /* KLINE_EXEMPT  */
+    KLINE_MIN_CIDR = 330,          /* KLINE_MIN_CIDR  */
+    KLINE_MIN_CIDR6 = 331,         /* KLINE_MIN_CIDR6  */
+    KNOCK_CLIENT_COUNT = 332,      /* KNOCK_CLIENT_COUNT  */
+    KNOCK_CLIENT_TIME = 333,       /* KNOCK_CLIENT_TIME  */
+    KNOCK_DELAY_CHANNEL = 334,     /* KNOCK_DELAY_CHANNEL  */
+    LEAF_MASK = 335,               /* LEAF_MASK  */
+    LISTEN = 336,                  /* LISTEN  */
+    MASK = 337,                    /* MASK  */
+    MAX_ACCEPT = 338,              /* MAX_ACCEPT  */
+    MAX_BANS = 339,                /* MAX_BANS  */
+    MAX_BANS_LARGE = 340,          /* MAX_BANS_LARGE  */
+    MAX_CHANNELS = 341,            /* MAX_CHANNELS  */
+    MAX_IDLE = 342,                /* MAX_IDLE  */
+    MAX_INVITES = 343,             /* MAX_INVITES  */
+    MAX_NICK_CHANGES = 344,        /* MAX_NICK_CHANGES  */
+    MAX_NICK_LENGTH = 345,         /* MAX_NICK_LENGTH  */
+    MAX_NICK_TIME = 346,           /* MAX_NICK_TIME  */
+    MAX_NUMBER = 347,              /* MAX_NUMBER  */
+    MAX_TARGETS = 348,             /* MAX_TARGETS  */
+    MAX_TOPIC_LENGTH = 349,        /* MAX_TOPIC_LENGTH  */
+    MAX_WATCH = 350,               /* MAX_WATCH  */
+    MIN_IDLE = 351,                /* MIN_IDLE  */
+    MIN_NONWILDCARD = 352,         /* MIN_NONWILDCARD  */
+    MIN_NONWILDCARD_SIMPLE = 353,  /* MIN_NONWILDCARD_SIMPLE  */
+    MODULE = 354,                  /* MODULE  */
+    MODULES = 355,                 /* MODULES  */
+    MOTD = 356,                    /* MOTD  */
+    NAME = 357,                    /* NAME  */
+    NEED_IDENT = 358,              /* NEED_IDENT  */
+    NEED_PASSWORD = 359,           /* NEED_PASSWORD  */
+    NETWORK_DESC = 360,            /* NETWORK_DESC  */
+    NETWORK_NAME = 361,            /* NETWORK_NAME  */
+    NICK = 362,                    /* NICK  */
+    NO_OPER_FLOOD = 363,           /* NO_OPER_FLOOD  */
+    NO_TILDE = 364,                /* NO_TILDE  */
+    NUMBER = 365,                  /* NUMBER  */
+    NUMBER_PER_CIDR = 366,         /* NUMBER_PER_CIDR  */
+    NUMBER_PER_IP_GLOBAL = 367,    /* NUMBER_PER_IP_GLOBAL  */
+    NUMBER_PER_IP_LOCAL = 368,     /* NUMBER_PER_IP_LOCAL  */
+    OPER_ONLY_UMODES = 369,        /* OPER_ONLY_UMODES  */
+    OPER_UMODES = 370,             /* OPER_UMODES  */
+    OPERATOR = 371,                /* OPERATOR  */
+    OPERS_BYPASS_CALLERID = 372,   /* OPERS_BYPASS_CALLERID  */
+    PACE_WAIT = 373,               /* PACE_WAIT  */
+    PACE_WAIT_SIMPLE = 374,        /* PACE_WAIT_SIMPLE  */
+    PASSWORD = 375,                /* PASSWORD  */
+    PATH = 376,                    /* PATH  */
+    PERF_EXPORT_DELAY = 377,       /* PERF_EXPORT_DELAY  */
+    PERF_EXPORT_FILE = 378,        /* PERF_EXPORT_FILE  */
+    PING_COOKIE = 379,             /* PING_COOKIE  */
+    PING_TIME = 380,               /* PING_TIME  */
+    PORT = 381,                    /* PORT  */
+    QSTRING = 382,                 /* QSTRING  */
+    RANDOM_IDLE = 383,             /* RANDOM_IDLE  */
+    REASON = 384,                  /* REASON  */
+    REDIRPORT = 385,               /* REDIRPORT  */
+    REDIRSERV = 386,               /* REDIRSERV  */
+    REHASH = 387,                  /* REHASH  */
+    REMOTE = 388,                  /* REMOTE  */
+    REMOTEBAN = 389,               /* REMOTEBAN  */
+    RESV = 390,                    /* RESV  */
+    RESV_EXEMPT = 391,             /* RESV_EXEMPT  */
+    RSA_PRIVATE_KEY_FILE = 392,    /* RSA_PRIVATE_KEY_FILE  */
+    SECONDS = 393,                 /* SECONDS  */
+    MINUTES = 394,                 /* MINUTES  */
+    HOURS = 395,                   /* HOURS  */
+    DAYS = 396,                    /* DAYS  */
+    WEEKS = 397,                   /* WEEKS  */
+    MONTHS = 398,                  /* MONTHS  */
+    YEARS = 399,                   /* YEARS  */
+    SEND_PASSWORD = 400,           /* SEND_PASSWORD  */
+    SENDQ = 401,                   /* SENDQ  */
+    SERVERHIDE = 402,              /* SERVERHIDE  */
+    SERVERINFO = 403,              /* SERVERINFO  */
+    SHORT_MOTD = 404,              /* SHORT_MOTD  */
+    SPOOF = 405,                   /* SPOOF  */
+    SQUIT = 406,                   /* SQUIT  */
+    STATS_E_DISABLED = 407,        /* STATS_E_DISABLED  */
+    STATS_I_OPER_ONLY = 408,       /* STATS_I_OPER_ONLY  */
+    STATS_K_OPER_ONLY = 409,       /* STATS_K_OPER_ONLY  */
+    STATS_M_OPER_ONLY = 410,       /* STATS_M_OPER_ONLY  */
+    STATS_O_OPER_ONLY = 411,       /* STATS_O_OPER_ONLY  */
+    STATS_P_OPER_ONLY = 412,       /* STATS_P_OPER_ONLY  */
+    STATS_U_OPER_ONLY = 413,       /* STATS_U_OPER_ONLY  */
+    T_ALL = 414,                   /* T_ALL  */
+    T_BIND = 415,                  /* T_BIND  */
+    T_BOTS = 416,                  /* T_BOTS  */
+    T_CALLERID = 417,              /* T_CALLERID  */
+    T_CCONN = 418,                 /* T_CCONN  */
+    T_COMMAND = 419,               /* T_COMMAND  */
+    T_CLUSTER = 420,               /* T_CLUSTER  */
+    T_DEAF = 421,                  /* T_DEAF  */
+    T_DEBUG = 422,                 /* T_DEBUG  */
+    T_DLINE = 423,                 /* T_DLINE  */
+    T_EXTERNAL = 424,              /* T_EXTERNAL  */
+    T_FARCONNECT = 425,            /* T_FARCONNECT  */
+    T_FILE = 426,                  /* T_FILE  */
+    T_FULL = 427,                  /* T_FULL  */
+    T_GLOBOPS = 428,               /* T_GLOBOPS  */
+    T_INVISIBLE = 429,             /* T_INVISIBLE  */
+    T_IPV4 = 430,                  /* T_IPV4  */
+    T_IPV6 = 431,                  /* T_IPV6  */
+    T_LOCOPS = 432,                /* T_LOCOPS  */
+    T_LOG = 433,                   /* T_LOG  */
+    T_NCHANGE = 434,               /* T_NCHANGE  */
+    T_NONONREG = 435,              /* T_NONONREG  */
+    T_OPME = 436,                  /* T_OPME  */
+    T_PREPEND = 437,               /* T_PREPEND  */
+    T_PSEUDO = 438,                /* T_PSEUDO  */
+    T_RECVQ = 439,                 /* T_RECVQ  */
+    T_REJ = 440,                   /* T_REJ  */
+    T_RESTART = 441,               /* T_RESTART  */
+    T_SERVER = 442,                /* T_SERVER  */
+    T_SERVICE = 443,               /* T_SERVICE  */
+    T_SERVNOTICE = 444,            /* T_SERVNOTICE  */
+    T_SET = 445,                   /* T_SET  */
+    T_SHARED = 446,                /* T_SHARED  */
+    T_SIZE = 447,                  /* T_SIZE  */
+    T_SKILL = 448,                 /* T_SKILL  */
+    T_SOFTCALLERID = 449,          /* T_SOFTCALLERID  */
+    T_SPY = 450,                   /* T_SPY  */
+    T_TARGET = 451,                /* T_TARGET  */
+    T_TLS = 452,                   /* T_TLS  */
+    T_UMODES = 453,                /* T_UMODES  */
+    T_UNAUTH = 454,                /* T_UNAUTH  */
+    T_UNDLINE = 455,               /* T_UNDLINE  */
+    T_UNLIMITED = 456,             /* T_UNLIMITED  */
+    T_UNRESV = 457,                /* T_UNRESV  */
+    T_UNXLINE = 458,               /* T_UNXLINE  */
+    T_WALLOP = 459,                /* T_WALLOP  */
+    T_WALLOPS = 460,               /* T_WALLOPS  */
+    T_WEBIRC = 461,                /* T_WEBIRC  */
+    TBOOL = 462,                   /* TBOOL  */
+    THROTTLE_COUNT = 463,          /* THROTTLE_COUNT  */
+    THROTTLE_TIME = 464,           /* THROTTLE_TIME  */
+    TIMEOUT = 465,                 /* TIMEOUT  */
+    TLS_CERTIFICATE_FILE = 466,    /* TLS_CERTIFICATE_FILE  */
+    TLS_CERTIFICATE_FINGERPRINT = 467, /* TLS_CERTIFICATE_FINGERPRINT  */
+    TLS_CIPHER_LIST = 468,         /* TLS_CIPHER_LIST  */
+    TLS_CIPHER_SUITES = 469,       /* TLS_CIPHER_SUITES  */
+    TLS_CONNECTION_REQUIRED = 470, /* TLS_CONNECTION_REQUIRED  */
+    TLS_DH_PARAM_FILE = 471,       /* TLS_DH_PARAM_FILE  */
+    TLS_MESSAGE_DIGEST_ALGORITHM = 472, /* TLS_MESSAGE_DIGEST_ALGORITHM  */
+    TLS_SUPPORTED_GROUPS = 473,    /* TLS_SUPPORTED_GROUPS  */
+    TS_MAX_DELTA = 474,            /* TS_MAX_DELTA  */
+    TS_WARN_DELTA = 475,           /* TS_WARN_DELTA  */
+    TWODOTS = 476,                 /* TWODOTS  */
+    TYPE = 477,                    /* TYPE  */
+    UNKLINE = 478,                 /* UNKLINE  */
+    USE_LOGGING = 479,             /* USE_LOGGING  */
+    USER = 480,                    /* USER  */
+    VHOST = 481,                   /* VHOST  */
+    VHOST6 = 482,                  /* VHOST6  */
+    WARN_NO_CONNECT_BLOCK = 483,   /* WARN_NO_CONNECT_BLOCK  */
+    WHOIS = 484,                   /* WHOIS  */
+    WHOWAS_HISTORY_LENGTH = 485,   /* WHOWAS_HISTORY_LENGTH  */
+    XLINE = 486,                   /* XLINE  */
+    XLINE_EXEMPT = 487             /* XLINE_EXEMPT  */
   };
+  typedef enum yytokentype yytoken_kind_t;
 #endif
-/* Tokens.  */
+/* Token kinds.  */
+#define YYEMPTY -2
+#define YYEOF 0
+#define YYerror 256
+#define YYUNDEF 257
 #define ACCEPT_PASSWORD 258
 #define ADMIN 259
 #define AFTYPE 260
@@ -559,129 +573,130 @@ extern int yydebug;
 #define PACE_WAIT_SIMPLE 374
 #define PASSWORD 375
 #define PATH 376
-#define PING_COOKIE 377
-#define PING_TIME 378
-#define PORT 379
-#define QSTRING 380
-#define RANDOM_IDLE 381
-#define REASON 382
-#define REDIRPORT 383
-#define REDIRSERV 384
-#define REHASH 385
-#define REMOTE 386
-#define REMOTEBAN 387
-#define RESV 388
-#define RESV_EXEMPT 389
-#define RSA_PRIVATE_KEY_FILE 390
-#define SECONDS 391
-#define MINUTES 392
-#define HOURS 393
-#define DAYS 394
-#define WEEKS 395
-#define MONTHS 396
-#define YEARS 397
-#define SEND_PASSWORD 398
-#define SENDQ 399
-#define SERVERHIDE 400
-#define SERVERINFO 401
-#define SHORT_MOTD 402
-#define SPOOF 403
-#define SQUIT 404
-#define STATS_E_DISABLED 405
-#define STATS_I_OPER_ONLY 406
-#define STATS_K_OPER_ONLY 407
-#define STATS_M_OPER_ONLY 408
-#define STATS_O_OPER_ONLY 409
-#define STATS_P_OPER_ONLY 410
-#define STATS_U_OPER_ONLY 411
-#define T_ALL 412
-#define T_BIND 413
-#define T_BOTS 414
-#define T_CALLERID 415
-#define T_CCONN 416
-#define T_COMMAND 417
-#define T_CLUSTER 418
-#define T_DEAF 419
-#define T_DEBUG 420
-#define T_DLINE 421
-#define T_EXTERNAL 422
-#define T_FARCONNECT 423
-#define T_FILE 424
-#define T_FULL 425
-#define T_GLOBOPS 426
-#define T_INVISIBLE 427
-#define T_IPV4 428
-#define T_IPV6 429
-#define T_LOCOPS 430
-#define T_LOG 431
-#define T_NCHANGE 432
-#define T_NONONREG 433
-#define T_OPME 434
-#define T_PREPEND 435
-#define T_PSEUDO 436
-#define T_RECVQ 437
-#define T_REJ 438
-#define T_RESTART 439
-#define T_SERVER 440
-#define T_SERVICE 441
-#define T_SERVNOTICE 442
-#define T_SET 443
-#define T_SHARED 444
-#define T_SIZE 445
-#define T_SKILL 446
-#define T_SOFTCALLERID 447
-#define T_SPY 448
-#define T_TARGET 449
-#define T_TLS 450
-#define T_UMODES 451
-#define T_UNAUTH 452
-#define T_UNDLINE 453
-#define T_UNLIMITED 454
-#define T_UNRESV 455
-#define T_UNXLINE 456
-#define T_WALLOP 457
-#define T_WALLOPS 458
-#define T_WEBIRC 459
-#define TBOOL 460
-#define THROTTLE_COUNT 461
-#define THROTTLE_TIME 462
-#define TIMEOUT 463
-#define TLS_CERTIFICATE_FILE 464
-#define TLS_CERTIFICATE_FINGERPRINT 465
-#define TLS_CIPHER_LIST 466
-#define TLS_CIPHER_SUITES 467
-#define TLS_CONNECTION_REQUIRED 468
-#define TLS_DH_PARAM_FILE 469
-#define TLS_MESSAGE_DIGEST_ALGORITHM 470
-#define TLS_SUPPORTED_GROUPS 471
-#define TS_MAX_DELTA 472
-#define TS_WARN_DELTA 473
-#define TWODOTS 474
-#define TYPE 475
-#define UNKLINE 476
-#define USE_LOGGING 477
-#define USER 478
-#define VHOST 479
-#define VHOST6 480
-#define WARN_NO_CONNECT_BLOCK 481
-#define WHOIS 482
-#define WHOWAS_HISTORY_LENGTH 483
-#define XLINE 484
-#define XLINE_EXEMPT 485
+#define PERF_EXPORT_DELAY 377
+#define PERF_EXPORT_FILE 378
+#define PING_COOKIE 379
+#define PING_TIME 380
+#define PORT 381
+#define QSTRING 382
+#define RANDOM_IDLE 383
+#define REASON 384
+#define REDIRPORT 385
+#define REDIRSERV 386
+#define REHASH 387
+#define REMOTE 388
+#define REMOTEBAN 389
+#define RESV 390
+#define RESV_EXEMPT 391
+#define RSA_PRIVATE_KEY_FILE 392
+#define SECONDS 393
+#define MINUTES 394
+#define HOURS 395
+#define DAYS 396
+#define WEEKS 397
+#define MONTHS 398
+#define YEARS 399
+#define SEND_PASSWORD 400
+#define SENDQ 401
+#define SERVERHIDE 402
+#define SERVERINFO 403
+#define SHORT_MOTD 404
+#define SPOOF 405
+#define SQUIT 406
+#define STATS_E_DISABLED 407
+#define STATS_I_OPER_ONLY 408
+#define STATS_K_OPER_ONLY 409
+#define STATS_M_OPER_ONLY 410
+#define STATS_O_OPER_ONLY 411
+#define STATS_P_OPER_ONLY 412
+#define STATS_U_OPER_ONLY 413
+#define T_ALL 414
+#define T_BIND 415
+#define T_BOTS 416
+#define T_CALLERID 417
+#define T_CCONN 418
+#define T_COMMAND 419
+#define T_CLUSTER 420
+#define T_DEAF 421
+#define T_DEBUG 422
+#define T_DLINE 423
+#define T_EXTERNAL 424
+#define T_FARCONNECT 425
+#define T_FILE 426
+#define T_FULL 427
+#define T_GLOBOPS 428
+#define T_INVISIBLE 429
+#define T_IPV4 430
+#define T_IPV6 431
+#define T_LOCOPS 432
+#define T_LOG 433
+#define T_NCHANGE 434
+#define T_NONONREG 435
+#define T_OPME 436
+#define T_PREPEND 437
+#define T_PSEUDO 438
+#define T_RECVQ 439
+#define T_REJ 440
+#define T_RESTART 441
+#define T_SERVER 442
+#define T_SERVICE 443
+#define T_SERVNOTICE 444
+#define T_SET 445
+#define T_SHARED 446
+#define T_SIZE 447
+#define T_SKILL 448
+#define T_SOFTCALLERID 449
+#define T_SPY 450
+#define T_TARGET 451
+#define T_TLS 452
+#define T_UMODES 453
+#define T_UNAUTH 454
+#define T_UNDLINE 455
+#define T_UNLIMITED 456
+#define T_UNRESV 457
+#define T_UNXLINE 458
+#define T_WALLOP 459
+#define T_WALLOPS 460
+#define T_WEBIRC 461
+#define TBOOL 462
+#define THROTTLE_COUNT 463
+#define THROTTLE_TIME 464
+#define TIMEOUT 465
+#define TLS_CERTIFICATE_FILE 466
+#define TLS_CERTIFICATE_FINGERPRINT 467
+#define TLS_CIPHER_LIST 468
+#define TLS_CIPHER_SUITES 469
+#define TLS_CONNECTION_REQUIRED 470
+#define TLS_DH_PARAM_FILE 471
+#define TLS_MESSAGE_DIGEST_ALGORITHM 472
+#define TLS_SUPPORTED_GROUPS 473
+#define TS_MAX_DELTA 474
+#define TS_WARN_DELTA 475
+#define TWODOTS 476
+#define TYPE 477
+#define UNKLINE 478
+#define USE_LOGGING 479
+#define USER 480
+#define VHOST 481
+#define VHOST6 482
+#define WARN_NO_CONNECT_BLOCK 483
+#define WHOIS 484
+#define WHOWAS_HISTORY_LENGTH 485
+#define XLINE 486
+#define XLINE_EXEMPT 487
 
 /* Value type.  */
 #if ! defined YYSTYPE && ! defined YYSTYPE_IS_DECLARED
-
 union YYSTYPE
 {
-#line 133 "conf_parser.y" /* yacc.c:352  */
+#line 133 "conf_parser.y"
 
   int number;
   char *string;
 
-#line 683 "conf_parser.c" /* yacc.c:352  */
-};
+#line 698 "conf_parser.c"
 
+};
 typedef union YYSTYPE YYSTYPE;
 # define YYSTYPE_IS_TRIVIAL 1
 # define YYSTYPE_IS_DECLARED 1
@@ -690,9 +705,553 @@ typedef union YYSTYPE YYSTYPE;
 
 extern YYSTYPE yylval;
 
+
 int yyparse (void);
 
+
 #endif /* !YY_YY_CONF_PARSER_H_INCLUDED  */
+/* Symbol kind.  */
+enum yysymbol_kind_t
+{
+  YYSYMBOL_YYEMPTY = -2,
+  YYSYMBOL_YYEOF = 0,                      /* "end of file"  */
+  YYSYMBOL_YYerror = 1,                    /* error  */
+  YYSYMBOL_YYUNDEF = 2,                    /* "invalid token"  */
+  YYSYMBOL_ACCEPT_PASSWORD = 3,            /* ACCEPT_PASSWORD  */
+  YYSYMBOL_ADMIN = 4,                      /* ADMIN  */
+  YYSYMBOL_AFTYPE = 5,                     /* AFTYPE  */
+  YYSYMBOL_ANTI_NICK_FLOOD = 6,            /* ANTI_NICK_FLOOD  */
+  YYSYMBOL_ANTI_SPAM_EXIT_MESSAGE_TIME = 7, /* ANTI_SPAM_EXIT_MESSAGE_TIME  */
+  YYSYMBOL_AUTOCONN = 8,                   /* AUTOCONN  */
+  YYSYMBOL_AWAY_COUNT = 9,                 /* AWAY_COUNT  */
+  YYSYMBOL_AWAY_TIME = 10,                 /* AWAY_TIME  */
+  YYSYMBOL_BYTES = 11,                     /* BYTES  */
+  YYSYMBOL_KBYTES = 12,                    /* KBYTES  */
+  YYSYMBOL_MBYTES = 13,                    /* MBYTES  */
+  YYSYMBOL_CALLER_ID_WAIT = 14,            /* CALLER_ID_WAIT  */
+  YYSYMBOL_CAN_FLOOD = 15,                 /* CAN_FLOOD  */
+  YYSYMBOL_CHANNEL = 16,                   /* CHANNEL  */
+  YYSYMBOL_CIDR_BITLEN_IPV4 = 17,          /* CIDR_BITLEN_IPV4  */
+  YYSYMBOL_CIDR_BITLEN_IPV6 = 18,          /* CIDR_BITLEN_IPV6  */
+  YYSYMBOL_CLASS = 19,                     /* CLASS  */
+  YYSYMBOL_CLOSE = 20,                     /* CLOSE  */
+  YYSYMBOL_CONNECT = 21,                   /* CONNECT  */
+  YYSYMBOL_CONNECTFREQ = 22,               /* CONNECTFREQ  */
+  YYSYMBOL_CYCLE_ON_HOST_CHANGE = 23,      /* CYCLE_ON_HOST_CHANGE  */
+  YYSYMBOL_DEFAULT_FLOODCOUNT = 24,        /* DEFAULT_FLOODCOUNT  */
+  YYSYMBOL_DEFAULT_FLOODTIME = 25,         /* DEFAULT_FLOODTIME  */
+  YYSYMBOL_DEFAULT_JOIN_FLOOD_COUNT = 26,  /* DEFAULT_JOIN_FLOOD_COUNT  */
+  YYSYMBOL_DEFAULT_JOIN_FLOOD_TIME = 27,   /* DEFAULT_JOIN_FLOOD_TIME  */
+  YYSYMBOL_DEFAULT_MAX_CLIENTS = 28,       /* DEFAULT_MAX_CLIENTS  */
+  YYSYMBOL_DENY = 29,                      /* DENY  */
+  YYSYMBOL_DESCRIPTION = 30,               /* DESCRIPTION  */
+  YYSYMBOL_DIE = 31,                       /* DIE  */
+  YYSYMBOL_DISABLE_AUTH = 32,              /* DISABLE_AUTH  */
+  YYSYMBOL_DISABLE_FAKE_CHANNELS = 33,     /* DISABLE_FAKE_CHANNELS  */
+  YYSYMBOL_DISABLE_REMOTE_COMMANDS = 34,   /* DISABLE_REMOTE_COMMANDS  */
+  YYSYMBOL_DLINE_MIN_CIDR = 35,            /* DLINE_MIN_CIDR  */
+  YYSYMBOL_DLINE_MIN_CIDR6 = 36,           /* DLINE_MIN_CIDR6  */
+  YYSYMBOL_DOTS_IN_IDENT = 37,             /* DOTS_IN_IDENT  */
+  YYSYMBOL_EMAIL = 38,                     /* EMAIL  */
+  YYSYMBOL_ENABLE_EXTBANS = 39,            /* ENABLE_EXTBANS  */
+  YYSYMBOL_ENCRYPTED = 40,                 /* ENCRYPTED  */
+  YYSYMBOL_EXCEED_LIMIT = 41,              /* EXCEED_LIMIT  */
+  YYSYMBOL_EXEMPT = 42,                    /* EXEMPT  */
+  YYSYMBOL_EXPIRATION = 43,                /* EXPIRATION  */
+  YYSYMBOL_FAILED_OPER_NOTICE = 44,        /* FAILED_OPER_NOTICE  */
+  YYSYMBOL_FLATTEN_LINKS = 45,             /* FLATTEN_LINKS  */
+  YYSYMBOL_FLATTEN_LINKS_DELAY = 46,       /* FLATTEN_LINKS_DELAY  */
+  YYSYMBOL_FLATTEN_LINKS_FILE = 47,        /* FLATTEN_LINKS_FILE  */
+  YYSYMBOL_GECOS = 48,                     /* GECOS  */
+  YYSYMBOL_GENERAL = 49,                   /* GENERAL  */
+  YYSYMBOL_HIDDEN = 50,                    /* HIDDEN  */
+  YYSYMBOL_HIDDEN_NAME = 51,               /* HIDDEN_NAME  */
+  YYSYMBOL_HIDE_CHANS = 52,                /* HIDE_CHANS  */
+  YYSYMBOL_HIDE_IDLE = 53,                 /* HIDE_IDLE  */
+  YYSYMBOL_HIDE_IDLE_FROM_OPERS = 54,      /* HIDE_IDLE_FROM_OPERS  */
+  YYSYMBOL_HIDE_SERVER_IPS = 55,           /* HIDE_SERVER_IPS  */
+  YYSYMBOL_HIDE_SERVERS = 56,              /* HIDE_SERVERS  */
+  YYSYMBOL_HIDE_SERVICES = 57,             /* HIDE_SERVICES  */
+  YYSYMBOL_HOST = 58,                      /* HOST  */
+  YYSYMBOL_HUB = 59,                       /* HUB  */
+  YYSYMBOL_HUB_MASK = 60,                  /* HUB_MASK  */
+  YYSYMBOL_INVISIBLE_ON_CONNECT = 61,      /* INVISIBLE_ON_CONNECT  */
+  YYSYMBOL_INVITE_CLIENT_COUNT = 62,       /* INVITE_CLIENT_COUNT  */
+  YYSYMBOL_INVITE_CLIENT_TIME = 63,        /* INVITE_CLIENT_TIME  */
+  YYSYMBOL_INVITE_DELAY_CHANNEL = 64,      /* INVITE_DELAY_CHANNEL  */
+  YYSYMBOL_INVITE_EXPIRE_TIME = 65,        /* INVITE_EXPIRE_TIME  */
+  YYSYMBOL_IP = 66,                        /* IP  */
+  YYSYMBOL_IRCD_AUTH = 67,                 /* IRCD_AUTH  */
+  YYSYMBOL_IRCD_FLAGS = 68,                /* IRCD_FLAGS  */
+  YYSYMBOL_IRCD_SID = 69,                  /* IRCD_SID  */
+  YYSYMBOL_JOIN = 70,                      /* JOIN  */
+  YYSYMBOL_KILL = 71,                      /* KILL  */
+  YYSYMBOL_KILL_CHASE_TIME_LIMIT = 72,     /* KILL_CHASE_TIME_LIMIT  */
+  YYSYMBOL_KLINE = 73,                     /* KLINE  */
+  YYSYMBOL_KLINE_EXEMPT = 74,              /* KLINE_EXEMPT  */
+  YYSYMBOL_KLINE_MIN_CIDR = 75,            /* KLINE_MIN_CIDR  */
+  YYSYMBOL_KLINE_MIN_CIDR6 = 76,           /* KLINE_MIN_CIDR6  */
+  YYSYMBOL_KNOCK_CLIENT_COUNT = 77,        /* KNOCK_CLIENT_COUNT  */
+  YYSYMBOL_KNOCK_CLIENT_TIME = 78,         /* KNOCK_CLIENT_TIME  */
+  YYSYMBOL_KNOCK_DELAY_CHANNEL = 79,       /* KNOCK_DELAY_CHANNEL  */
+  YYSYMBOL_LEAF_MASK = 80,                 /* LEAF_MASK  */
+  YYSYMBOL_LISTEN = 81,                    /* LISTEN  */
+  YYSYMBOL_MASK = 82,                      /* MASK  */
+  YYSYMBOL_MAX_ACCEPT = 83,                /* MAX_ACCEPT  */
+  YYSYMBOL_MAX_BANS = 84,                  /* MAX_BANS  */
+  YYSYMBOL_MAX_BANS_LARGE = 85,            /* MAX_BANS_LARGE  */
+  YYSYMBOL_MAX_CHANNELS = 86,              /* MAX_CHANNELS  */
+  YYSYMBOL_MAX_IDLE = 87,                  /* MAX_IDLE  */
+  YYSYMBOL_MAX_INVITES = 88,               /* MAX_INVITES  */
+  YYSYMBOL_MAX_NICK_CHANGES = 89,          /* MAX_NICK_CHANGES  */
+  YYSYMBOL_MAX_NICK_LENGTH = 90,           /* MAX_NICK_LENGTH  */
+  YYSYMBOL_MAX_NICK_TIME = 91,             /* MAX_NICK_TIME  */
+  YYSYMBOL_MAX_NUMBER = 92,                /* MAX_NUMBER  */
+  YYSYMBOL_MAX_TARGETS = 93,               /* MAX_TARGETS  */
+  YYSYMBOL_MAX_TOPIC_LENGTH = 94,          /* MAX_TOPIC_LENGTH  */
+  YYSYMBOL_MAX_WATCH = 95,                 /* MAX_WATCH  */
+  YYSYMBOL_MIN_IDLE = 96,                  /* MIN_IDLE  */
+  YYSYMBOL_MIN_NONWILDCARD = 97,           /* MIN_NONWILDCARD  */
+  YYSYMBOL_MIN_NONWILDCARD_SIMPLE = 98,    /* MIN_NONWILDCARD_SIMPLE  */
+  YYSYMBOL_MODULE = 99,                    /* MODULE  */
+  YYSYMBOL_MODULES = 100,                  /* MODULES  */
+  YYSYMBOL_MOTD = 101,                     /* MOTD  */
+  YYSYMBOL_NAME = 102,                     /* NAME  */
+  YYSYMBOL_NEED_IDENT = 103,               /* NEED_IDENT  */
+  YYSYMBOL_NEED_PASSWORD = 104,            /* NEED_PASSWORD  */
+  YYSYMBOL_NETWORK_DESC = 105,             /* NETWORK_DESC  */
+  YYSYMBOL_NETWORK_NAME = 106,             /* NETWORK_NAME  */
+  YYSYMBOL_NICK = 107,                     /* NICK  */
+  YYSYMBOL_NO_OPER_FLOOD = 108,            /* NO_OPER_FLOOD  */
+  YYSYMBOL_NO_TILDE = 109,                 /* NO_TILDE  */
+  YYSYMBOL_NUMBER = 110,                   /* NUMBER  */
+  YYSYMBOL_NUMBER_PER_CIDR = 111,          /* NUMBER_PER_CIDR  */
+  YYSYMBOL_NUMBER_PER_IP_GLOBAL = 112,     /* NUMBER_PER_IP_GLOBAL  */
+  YYSYMBOL_NUMBER_PER_IP_LOCAL = 113,      /* NUMBER_PER_IP_LOCAL  */
+  YYSYMBOL_OPER_ONLY_UMODES = 114,         /* OPER_ONLY_UMODES  */
+  YYSYMBOL_OPER_UMODES = 115,              /* OPER_UMODES  */
+  YYSYMBOL_OPERATOR = 116,                 /* OPERATOR  */
+  YYSYMBOL_OPERS_BYPASS_CALLERID = 117,    /* OPERS_BYPASS_CALLERID  */
+  YYSYMBOL_PACE_WAIT = 118,                /* PACE_WAIT  */
+  YYSYMBOL_PACE_WAIT_SIMPLE = 119,         /* PACE_WAIT_SIMPLE  */
+  YYSYMBOL_PASSWORD = 120,                 /* PASSWORD  */
+  YYSYMBOL_PATH = 121,                     /* PATH  */
+  YYSYMBOL_PERF_EXPORT_DELAY = 122,        /* PERF_EXPORT_DELAY  */
+  YYSYMBOL_PERF_EXPORT_FILE = 123,         /* PERF_EXPORT_FILE  */
+  YYSYMBOL_PING_COOKIE = 124,              /* PING_COOKIE  */
+  YYSYMBOL_PING_TIME = 125,                /* PING_TIME  */
+  YYSYMBOL_PORT = 126,                     /* PORT  */
+  YYSYMBOL_QSTRING = 127,                  /* QSTRING  */
+  YYSYMBOL_RANDOM_IDLE = 128,              /* RANDOM_IDLE  */
+  YYSYMBOL_REASON = 129,                   /* REASON  */
+  YYSYMBOL_REDIRPORT = 130,                /* REDIRPORT  */
+  YYSYMBOL_REDIRSERV = 131,                /* REDIRSERV  */
+  YYSYMBOL_REHASH = 132,                   /* REHASH  */
+  YYSYMBOL_REMOTE = 133,                   /* REMOTE  */
+  YYSYMBOL_REMOTEBAN = 134,                /* REMOTEBAN  */
+  YYSYMBOL_RESV = 135,                     /* RESV  */
+  YYSYMBOL_RESV_EXEMPT = 136,              /* RESV_EXEMPT  */
+  YYSYMBOL_RSA_PRIVATE_KEY_FILE = 137,     /* RSA_PRIVATE_KEY_FILE  */
+  YYSYMBOL_SECONDS = 138,                  /* SECONDS  */
+  YYSYMBOL_MINUTES = 139,                  /* MINUTES  */
+  YYSYMBOL_HOURS = 140,                    /* HOURS  */
+  YYSYMBOL_DAYS = 141,                     /* DAYS  */
+  YYSYMBOL_WEEKS = 142,                    /* WEEKS  */
+  YYSYMBOL_MONTHS = 143,                   /* MONTHS  */
+  YYSYMBOL_YEARS = 144,                    /* YEARS  */
+  YYSYMBOL_SEND_PASSWORD = 145,            /* SEND_PASSWORD  */
+  YYSYMBOL_SENDQ = 146,                    /* SENDQ  */
+  YYSYMBOL_SERVERHIDE = 147,               /* SERVERHIDE  */
+  YYSYMBOL_SERVERINFO = 148,               /* SERVERINFO  */
+  YYSYMBOL_SHORT_MOTD = 149,               /* SHORT_MOTD  */
+  YYSYMBOL_SPOOF = 150,                    /* SPOOF  */
+  YYSYMBOL_SQUIT = 151,                    /* SQUIT  */
+  YYSYMBOL_STATS_E_DISABLED = 152,         /* STATS_E_DISABLED  */
+  YYSYMBOL_STATS_I_OPER_ONLY = 153,        /* STATS_I_OPER_ONLY  */
+  YYSYMBOL_STATS_K_OPER_ONLY = 154,        /* STATS_K_OPER_ONLY  */
+  YYSYMBOL_STATS_M_OPER_ONLY = 155,        /* STATS_M_OPER_ONLY  */
+  YYSYMBOL_STATS_O_OPER_ONLY = 156,        /* STATS_O_OPER_ONLY  */
+  YYSYMBOL_STATS_P_OPER_ONLY = 157,        /* STATS_P_OPER_ONLY  */
+  YYSYMBOL_STATS_U_OPER_ONLY = 158,        /* STATS_U_OPER_ONLY  */
+  YYSYMBOL_T_ALL = 159,                    /* T_ALL  */
+  YYSYMBOL_T_BIND = 160,                   /* T_BIND  */
+  YYSYMBOL_T_BOTS = 161,                   /* T_BOTS  */
+  YYSYMBOL_T_CALLERID = 162,               /* T_CALLERID  */
+  YYSYMBOL_T_CCONN = 163,                  /* T_CCONN  */
+  YYSYMBOL_T_COMMAND = 164,                /* T_COMMAND  */
+  YYSYMBOL_T_CLUSTER = 165,                /* T_CLUSTER  */
+  YYSYMBOL_T_DEAF = 166,                   /* T_DEAF  */
+  YYSYMBOL_T_DEBUG = 167,                  /* T_DEBUG  */
+  YYSYMBOL_T_DLINE = 168,                  /* T_DLINE  */
+  YYSYMBOL_T_EXTERNAL = 169,               /* T_EXTERNAL  */
+  YYSYMBOL_T_FARCONNECT = 170,             /* T_FARCONNECT  */
+  YYSYMBOL_T_FILE = 171,                   /* T_FILE  */
+  YYSYMBOL_T_FULL = 172,                   /* T_FULL  */
+  YYSYMBOL_T_GLOBOPS = 173,                /* T_GLOBOPS  */
+  YYSYMBOL_T_INVISIBLE = 174,              /* T_INVISIBLE  */
+  YYSYMBOL_T_IPV4 = 175,                   /* T_IPV4  */
+  YYSYMBOL_T_IPV6 = 176,                   /* T_IPV6  */
+  YYSYMBOL_T_LOCOPS = 177,                 /* T_LOCOPS  */
+  YYSYMBOL_T_LOG = 178,                    /* T_LOG  */
+  YYSYMBOL_T_NCHANGE = 179,                /* T_NCHANGE  */
+  YYSYMBOL_T_NONONREG = 180,               /* T_NONONREG  */
+  YYSYMBOL_T_OPME = 181,                   /* T_OPME  */
+  YYSYMBOL_T_PREPEND = 182,                /* T_PREPEND  */
+  YYSYMBOL_T_PSEUDO = 183,                 /* T_PSEUDO  */
+  YYSYMBOL_T_RECVQ = 184,                  /* T_RECVQ  */
+  YYSYMBOL_T_REJ = 185,                    /* T_REJ  */
+  YYSYMBOL_T_RESTART = 186,                /* T_RESTART  */
+  YYSYMBOL_T_SERVER = 187,                 /* T_SERVER  */
+  YYSYMBOL_T_SERVICE = 188,                /* T_SERVICE  */
+  YYSYMBOL_T_SERVNOTICE = 189,             /* T_SERVNOTICE  */
+  YYSYMBOL_T_SET = 190,                    /* T_SET  */
+  YYSYMBOL_T_SHARED = 191,                 /* T_SHARED  */
+  YYSYMBOL_T_SIZE = 192,                   /* T_SIZE  */
+  YYSYMBOL_T_SKILL = 193,                  /* T_SKILL  */
+  YYSYMBOL_T_SOFTCALLERID = 194,           /* T_SOFTCALLERID  */
+  YYSYMBOL_T_SPY = 195,                    /* T_SPY  */
+  YYSYMBOL_T_TARGET = 196,                 /* T_TARGET  */
+  YYSYMBOL_T_TLS = 197,                    /* T_TLS  */
+  YYSYMBOL_T_UMODES = 198,                 /* T_UMODES  */
+  YYSYMBOL_T_UNAUTH = 199,                 /* T_UNAUTH  */
+  YYSYMBOL_T_UNDLINE = 200,                /* T_UNDLINE  */
+  YYSYMBOL_T_UNLIMITED = 201,              /* T_UNLIMITED  */
+  YYSYMBOL_T_UNRESV = 202,                 /* T_UNRESV  */
+  YYSYMBOL_T_UNXLINE = 203,                /* T_UNXLINE  */
+  YYSYMBOL_T_WALLOP = 204,                 /* T_WALLOP  */
+  YYSYMBOL_T_WALLOPS = 205,                /* T_WALLOPS  */
+  YYSYMBOL_T_WEBIRC = 206,                 /* T_WEBIRC  */
+  YYSYMBOL_TBOOL = 207,                    /* TBOOL  */
+  YYSYMBOL_THROTTLE_COUNT = 208,           /* THROTTLE_COUNT  */
+  YYSYMBOL_THROTTLE_TIME = 209,            /* THROTTLE_TIME  */
+  YYSYMBOL_TIMEOUT = 210,                  /* TIMEOUT  */
+  YYSYMBOL_TLS_CERTIFICATE_FILE = 211,     /* TLS_CERTIFICATE_FILE  */
+  YYSYMBOL_TLS_CERTIFICATE_FINGERPRINT = 212, /* TLS_CERTIFICATE_FINGERPRINT  */
+  YYSYMBOL_TLS_CIPHER_LIST = 213,          /* TLS_CIPHER_LIST  */
+  YYSYMBOL_TLS_CIPHER_SUITES = 214,        /* TLS_CIPHER_SUITES  */
+  YYSYMBOL_TLS_CONNECTION_REQUIRED = 215,  /* TLS_CONNECTION_REQUIRED  */
+  YYSYMBOL_TLS_DH_PARAM_FILE = 216,        /* TLS_DH_PARAM_FILE  */
+  YYSYMBOL_TLS_MESSAGE_DIGEST_ALGORITHM = 217, /* TLS_MESSAGE_DIGEST_ALGORITHM  */
+  YYSYMBOL_TLS_SUPPORTED_GROUPS = 218,     /* TLS_SUPPORTED_GROUPS  */
+  YYSYMBOL_TS_MAX_DELTA = 219,             /* TS_MAX_DELTA  */
+  YYSYMBOL_TS_WARN_DELTA = 220,            /* TS_WARN_DELTA  */
+  YYSYMBOL_TWODOTS = 221,                  /* TWODOTS  */
+  YYSYMBOL_TYPE = 222,                     /* TYPE  */
+  YYSYMBOL_UNKLINE = 223,                  /* UNKLINE  */
+  YYSYMBOL_USE_LOGGING = 224,              /* USE_LOGGING  */
+  YYSYMBOL_USER = 225,                     /* USER  */
+  YYSYMBOL_VHOST = 226,                    /* VHOST  */
+  YYSYMBOL_VHOST6 = 227,                   /* VHOST6  */
+  YYSYMBOL_WARN_NO_CONNECT_BLOCK = 228,    /* WARN_NO_CONNECT_BLOCK  */
+  YYSYMBOL_WHOIS = 229,                    /* WHOIS  */
+  YYSYMBOL_WHOWAS_HISTORY_LENGTH = 230,    /* WHOWAS_HISTORY_LENGTH  */
+  YYSYMBOL_XLINE = 231,                    /* XLINE  */
+  YYSYMBOL_XLINE_EXEMPT = 232,             /* XLINE_EXEMPT  */
+  YYSYMBOL_233_ = 233,                     /* ';'  */
+  YYSYMBOL_234_ = 234,                     /* '}'  */
+  YYSYMBOL_235_ = 235,                     /* '{'  */
+  YYSYMBOL_236_ = 236,                     /* '='  */
+  YYSYMBOL_237_ = 237,                     /* ','  */
+  YYSYMBOL_238_ = 238,                     /* ':'  */
+  YYSYMBOL_YYACCEPT = 239,                 /* $accept  */
+  YYSYMBOL_conf = 240,                     /* conf  */
+  YYSYMBOL_conf_item = 241,                /* conf_item  */
+  YYSYMBOL_timespec_ = 242,                /* timespec_  */
+  YYSYMBOL_timespec = 243,                 /* timespec  */
+  YYSYMBOL_sizespec_ = 244,                /* sizespec_  */
+  YYSYMBOL_sizespec = 245,                 /* sizespec  */
+  YYSYMBOL_modules_entry = 246,            /* modules_entry  */
+  YYSYMBOL_modules_items = 247,            /* modules_items  */
+  YYSYMBOL_modules_item = 248,             /* modules_item  */
+  YYSYMBOL_modules_module = 249,           /* modules_module  */
+  YYSYMBOL_modules_path = 250,             /* modules_path  */
+  YYSYMBOL_serverinfo_entry = 251,         /* serverinfo_entry  */
+  YYSYMBOL_serverinfo_items = 252,         /* serverinfo_items  */
+  YYSYMBOL_serverinfo_item = 253,          /* serverinfo_item  */
+  YYSYMBOL_serverinfo_tls_certificate_file = 254, /* serverinfo_tls_certificate_file  */
+  YYSYMBOL_serverinfo_rsa_private_key_file = 255, /* serverinfo_rsa_private_key_file  */
+  YYSYMBOL_serverinfo_tls_dh_param_file = 256, /* serverinfo_tls_dh_param_file  */
+  YYSYMBOL_serverinfo_tls_cipher_list = 257, /* serverinfo_tls_cipher_list  */
+  YYSYMBOL_serverinfo_tls_cipher_suites = 258, /* serverinfo_tls_cipher_suites  */
+  YYSYMBOL_serverinfo_tls_message_digest_algorithm = 259, /* serverinfo_tls_message_digest_algorithm  */
+  YYSYMBOL_serverinfo_tls_supported_groups = 260, /* serverinfo_tls_supported_groups  */
+  YYSYMBOL_serverinfo_name = 261,          /* serverinfo_name  */
+  YYSYMBOL_serverinfo_sid = 262,           /* serverinfo_sid  */
+  YYSYMBOL_serverinfo_description = 263,   /* serverinfo_description  */
+  YYSYMBOL_serverinfo_network_name = 264,  /* serverinfo_network_name  */
+  YYSYMBOL_serverinfo_network_desc = 265,  /* serverinfo_network_desc  */
+  YYSYMBOL_serverinfo_default_max_clients = 266, /* serverinfo_default_max_clients  */
+  YYSYMBOL_serverinfo_max_nick_length = 267, /* serverinfo_max_nick_length  */
+  YYSYMBOL_serverinfo_max_topic_length = 268, /* serverinfo_max_topic_length  */
+  YYSYMBOL_serverinfo_hub = 269,           /* serverinfo_hub  */
+  YYSYMBOL_admin_entry = 270,              /* admin_entry  */
+  YYSYMBOL_admin_items = 271,              /* admin_items  */
+  YYSYMBOL_admin_item = 272,               /* admin_item  */
+  YYSYMBOL_admin_name = 273,               /* admin_name  */
+  YYSYMBOL_admin_email = 274,              /* admin_email  */
+  YYSYMBOL_admin_description = 275,        /* admin_description  */
+  YYSYMBOL_motd_entry = 276,               /* motd_entry  */
+  YYSYMBOL_277_1 = 277,                    /* $@1  */
+  YYSYMBOL_motd_items = 278,               /* motd_items  */
+  YYSYMBOL_motd_item = 279,                /* motd_item  */
+  YYSYMBOL_motd_mask = 280,                /* motd_mask  */
+  YYSYMBOL_motd_file = 281,                /* motd_file  */
+  YYSYMBOL_pseudo_entry = 282,             /* pseudo_entry  */
+  YYSYMBOL_283_2 = 283,                    /* $@2  */
+  YYSYMBOL_pseudo_items = 284,             /* pseudo_items  */
+  YYSYMBOL_pseudo_item = 285,              /* pseudo_item  */
+  YYSYMBOL_pseudo_command = 286,           /* pseudo_command  */
+  YYSYMBOL_pseudo_name = 287,              /* pseudo_name  */
+  YYSYMBOL_pseudo_prepend = 288,           /* pseudo_prepend  */
+  YYSYMBOL_pseudo_target = 289,            /* pseudo_target  */
+  YYSYMBOL_logging_entry = 290,            /* logging_entry  */
+  YYSYMBOL_logging_items = 291,            /* logging_items  */
+  YYSYMBOL_logging_item = 292,             /* logging_item  */
+  YYSYMBOL_logging_use_logging = 293,      /* logging_use_logging  */
+  YYSYMBOL_logging_file_entry = 294,       /* logging_file_entry  */
+  YYSYMBOL_295_3 = 295,                    /* $@3  */
+  YYSYMBOL_logging_file_items = 296,       /* logging_file_items  */
+  YYSYMBOL_logging_file_item = 297,        /* logging_file_item  */
+  YYSYMBOL_logging_file_name = 298,        /* logging_file_name  */
+  YYSYMBOL_logging_file_size = 299,        /* logging_file_size  */
+  YYSYMBOL_logging_file_type = 300,        /* logging_file_type  */
+  YYSYMBOL_301_4 = 301,                    /* $@4  */
+  YYSYMBOL_logging_file_type_items = 302,  /* logging_file_type_items  */
+  YYSYMBOL_logging_file_type_item = 303,   /* logging_file_type_item  */
+  YYSYMBOL_oper_entry = 304,               /* oper_entry  */
+  YYSYMBOL_305_5 = 305,                    /* $@5  */
+  YYSYMBOL_oper_items = 306,               /* oper_items  */
+  YYSYMBOL_oper_item = 307,                /* oper_item  */
+  YYSYMBOL_oper_name = 308,                /* oper_name  */
+  YYSYMBOL_oper_user = 309,                /* oper_user  */
+  YYSYMBOL_oper_password = 310,            /* oper_password  */
+  YYSYMBOL_oper_whois = 311,               /* oper_whois  */
+  YYSYMBOL_oper_encrypted = 312,           /* oper_encrypted  */
+  YYSYMBOL_oper_tls_certificate_fingerprint = 313, /* oper_tls_certificate_fingerprint  */
+  YYSYMBOL_oper_tls_connection_required = 314, /* oper_tls_connection_required  */
+  YYSYMBOL_oper_class = 315,               /* oper_class  */
+  YYSYMBOL_oper_umodes = 316,              /* oper_umodes  */
+  YYSYMBOL_317_6 = 317,                    /* $@6  */
+  YYSYMBOL_oper_umodes_items = 318,        /* oper_umodes_items  */
+  YYSYMBOL_oper_umodes_item = 319,         /* oper_umodes_item  */
+  YYSYMBOL_oper_flags = 320,               /* oper_flags  */
+  YYSYMBOL_321_7 = 321,                    /* $@7  */
+  YYSYMBOL_oper_flags_items = 322,         /* oper_flags_items  */
+  YYSYMBOL_oper_flags_item = 323,          /* oper_flags_item  */
+  YYSYMBOL_class_entry = 324,              /* class_entry  */
+  YYSYMBOL_325_8 = 325,                    /* $@8  */
+  YYSYMBOL_class_items = 326,              /* class_items  */
+  YYSYMBOL_class_item = 327,               /* class_item  */
+  YYSYMBOL_class_name = 328,               /* class_name  */
+  YYSYMBOL_class_ping_time = 329,          /* class_ping_time  */
+  YYSYMBOL_class_number_per_ip_local = 330, /* class_number_per_ip_local  */
+  YYSYMBOL_class_number_per_ip_global = 331, /* class_number_per_ip_global  */
+  YYSYMBOL_class_connectfreq = 332,        /* class_connectfreq  */
+  YYSYMBOL_class_max_channels = 333,       /* class_max_channels  */
+  YYSYMBOL_class_max_number = 334,         /* class_max_number  */
+  YYSYMBOL_class_sendq = 335,              /* class_sendq  */
+  YYSYMBOL_class_recvq = 336,              /* class_recvq  */
+  YYSYMBOL_class_cidr_bitlen_ipv4 = 337,   /* class_cidr_bitlen_ipv4  */
+  YYSYMBOL_class_cidr_bitlen_ipv6 = 338,   /* class_cidr_bitlen_ipv6  */
+  YYSYMBOL_class_number_per_cidr = 339,    /* class_number_per_cidr  */
+  YYSYMBOL_class_min_idle = 340,           /* class_min_idle  */
+  YYSYMBOL_class_max_idle = 341,           /* class_max_idle  */
+  YYSYMBOL_class_flags = 342,              /* class_flags  */
+  YYSYMBOL_343_9 = 343,                    /* $@9  */
+  YYSYMBOL_class_flags_items = 344,        /* class_flags_items  */
+  YYSYMBOL_class_flags_item = 345,         /* class_flags_item  */
+  YYSYMBOL_listen_entry = 346,             /* listen_entry  */
+  YYSYMBOL_347_10 = 347,                   /* $@10  */
+  YYSYMBOL_listen_flags = 348,             /* listen_flags  */
+  YYSYMBOL_349_11 = 349,                   /* $@11  */
+  YYSYMBOL_listen_flags_items = 350,       /* listen_flags_items  */
+  YYSYMBOL_listen_flags_item = 351,        /* listen_flags_item  */
+  YYSYMBOL_listen_items = 352,             /* listen_items  */
+  YYSYMBOL_listen_item = 353,              /* listen_item  */
+  YYSYMBOL_listen_port = 354,              /* listen_port  */
+  YYSYMBOL_355_12 = 355,                   /* $@12  */
+  YYSYMBOL_port_items = 356,               /* port_items  */
+  YYSYMBOL_port_item = 357,                /* port_item  */
+  YYSYMBOL_listen_address = 358,           /* listen_address  */
+  YYSYMBOL_listen_host = 359,              /* listen_host  */
+  YYSYMBOL_auth_entry = 360,               /* auth_entry  */
+  YYSYMBOL_361_13 = 361,                   /* $@13  */
+  YYSYMBOL_auth_items = 362,               /* auth_items  */
+  YYSYMBOL_auth_item = 363,                /* auth_item  */
+  YYSYMBOL_auth_user = 364,                /* auth_user  */
+  YYSYMBOL_auth_passwd = 365,              /* auth_passwd  */
+  YYSYMBOL_auth_class = 366,               /* auth_class  */
+  YYSYMBOL_auth_encrypted = 367,           /* auth_encrypted  */
+  YYSYMBOL_auth_flags = 368,               /* auth_flags  */
+  YYSYMBOL_369_14 = 369,                   /* $@14  */
+  YYSYMBOL_auth_flags_items = 370,         /* auth_flags_items  */
+  YYSYMBOL_auth_flags_item = 371,          /* auth_flags_item  */
+  YYSYMBOL_auth_spoof = 372,               /* auth_spoof  */
+  YYSYMBOL_auth_redir_serv = 373,          /* auth_redir_serv  */
+  YYSYMBOL_auth_redir_port = 374,          /* auth_redir_port  */
+  YYSYMBOL_resv_entry = 375,               /* resv_entry  */
+  YYSYMBOL_376_15 = 376,                   /* $@15  */
+  YYSYMBOL_resv_items = 377,               /* resv_items  */
+  YYSYMBOL_resv_item = 378,                /* resv_item  */
+  YYSYMBOL_resv_mask = 379,                /* resv_mask  */
+  YYSYMBOL_resv_reason = 380,              /* resv_reason  */
+  YYSYMBOL_resv_exempt = 381,              /* resv_exempt  */
+  YYSYMBOL_service_entry = 382,            /* service_entry  */
+  YYSYMBOL_service_items = 383,            /* service_items  */
+  YYSYMBOL_service_item = 384,             /* service_item  */
+  YYSYMBOL_service_name = 385,             /* service_name  */
+  YYSYMBOL_shared_entry = 386,             /* shared_entry  */
+  YYSYMBOL_387_16 = 387,                   /* $@16  */
+  YYSYMBOL_shared_items = 388,             /* shared_items  */
+  YYSYMBOL_shared_item = 389,              /* shared_item  */
+  YYSYMBOL_shared_name = 390,              /* shared_name  */
+  YYSYMBOL_shared_user = 391,              /* shared_user  */
+  YYSYMBOL_shared_type = 392,              /* shared_type  */
+  YYSYMBOL_393_17 = 393,                   /* $@17  */
+  YYSYMBOL_shared_types = 394,             /* shared_types  */
+  YYSYMBOL_shared_type_item = 395,         /* shared_type_item  */
+  YYSYMBOL_cluster_entry = 396,            /* cluster_entry  */
+  YYSYMBOL_397_18 = 397,                   /* $@18  */
+  YYSYMBOL_cluster_items = 398,            /* cluster_items  */
+  YYSYMBOL_cluster_item = 399,             /* cluster_item  */
+  YYSYMBOL_cluster_name = 400,             /* cluster_name  */
+  YYSYMBOL_cluster_type = 401,             /* cluster_type  */
+  YYSYMBOL_402_19 = 402,                   /* $@19  */
+  YYSYMBOL_cluster_types = 403,            /* cluster_types  */
+  YYSYMBOL_cluster_type_item = 404,        /* cluster_type_item  */
+  YYSYMBOL_connect_entry = 405,            /* connect_entry  */
+  YYSYMBOL_406_20 = 406,                   /* $@20  */
+  YYSYMBOL_connect_items = 407,            /* connect_items  */
+  YYSYMBOL_connect_item = 408,             /* connect_item  */
+  YYSYMBOL_connect_name = 409,             /* connect_name  */
+  YYSYMBOL_connect_host = 410,             /* connect_host  */
+  YYSYMBOL_connect_timeout = 411,          /* connect_timeout  */
+  YYSYMBOL_connect_bind = 412,             /* connect_bind  */
+  YYSYMBOL_connect_send_password = 413,    /* connect_send_password  */
+  YYSYMBOL_connect_accept_password = 414,  /* connect_accept_password  */
+  YYSYMBOL_connect_tls_certificate_fingerprint = 415, /* connect_tls_certificate_fingerprint  */
+  YYSYMBOL_connect_port = 416,             /* connect_port  */
+  YYSYMBOL_connect_aftype = 417,           /* connect_aftype  */
+  YYSYMBOL_connect_flags = 418,            /* connect_flags  */
+  YYSYMBOL_419_21 = 419,                   /* $@21  */
+  YYSYMBOL_connect_flags_items = 420,      /* connect_flags_items  */
+  YYSYMBOL_connect_flags_item = 421,       /* connect_flags_item  */
+  YYSYMBOL_connect_encrypted = 422,        /* connect_encrypted  */
+  YYSYMBOL_connect_hub_mask = 423,         /* connect_hub_mask  */
+  YYSYMBOL_connect_leaf_mask = 424,        /* connect_leaf_mask  */
+  YYSYMBOL_connect_class = 425,            /* connect_class  */
+  YYSYMBOL_connect_tls_cipher_list = 426,  /* connect_tls_cipher_list  */
+  YYSYMBOL_kill_entry = 427,               /* kill_entry  */
+  YYSYMBOL_428_22 = 428,                   /* $@22  */
+  YYSYMBOL_kill_items = 429,               /* kill_items  */
+  YYSYMBOL_kill_item = 430,                /* kill_item  */
+  YYSYMBOL_kill_user = 431,                /* kill_user  */
+  YYSYMBOL_kill_reason = 432,              /* kill_reason  */
+  YYSYMBOL_deny_entry = 433,               /* deny_entry  */
+  YYSYMBOL_434_23 = 434,                   /* $@23  */
+  YYSYMBOL_deny_items = 435,               /* deny_items  */
+  YYSYMBOL_deny_item = 436,                /* deny_item  */
+  YYSYMBOL_deny_ip = 437,                  /* deny_ip  */
+  YYSYMBOL_deny_reason = 438,              /* deny_reason  */
+  YYSYMBOL_exempt_entry = 439,             /* exempt_entry  */
+  YYSYMBOL_exempt_items = 440,             /* exempt_items  */
+  YYSYMBOL_exempt_item = 441,              /* exempt_item  */
+  YYSYMBOL_exempt_ip = 442,                /* exempt_ip  */
+  YYSYMBOL_gecos_entry = 443,              /* gecos_entry  */
+  YYSYMBOL_444_24 = 444,                   /* $@24  */
+  YYSYMBOL_gecos_items = 445,              /* gecos_items  */
+  YYSYMBOL_gecos_item = 446,               /* gecos_item  */
+  YYSYMBOL_gecos_name = 447,               /* gecos_name  */
+  YYSYMBOL_gecos_reason = 448,             /* gecos_reason  */
+  YYSYMBOL_general_entry = 449,            /* general_entry  */
+  YYSYMBOL_general_items = 450,            /* general_items  */
+  YYSYMBOL_general_item = 451,             /* general_item  */
+  YYSYMBOL_general_away_count = 452,       /* general_away_count  */
+  YYSYMBOL_general_away_time = 453,        /* general_away_time  */
+  YYSYMBOL_general_max_watch = 454,        /* general_max_watch  */
+  YYSYMBOL_general_whowas_history_length = 455, /* general_whowas_history_length  */
+  YYSYMBOL_general_cycle_on_host_change = 456, /* general_cycle_on_host_change  */
+  YYSYMBOL_general_dline_min_cidr = 457,   /* general_dline_min_cidr  */
+  YYSYMBOL_general_dline_min_cidr6 = 458,  /* general_dline_min_cidr6  */
+  YYSYMBOL_general_kline_min_cidr = 459,   /* general_kline_min_cidr  */
+  YYSYMBOL_general_kline_min_cidr6 = 460,  /* general_kline_min_cidr6  */
+  YYSYMBOL_general_kill_chase_time_limit = 461, /* general_kill_chase_time_limit  */
+  YYSYMBOL_general_failed_oper_notice = 462, /* general_failed_oper_notice  */
+  YYSYMBOL_general_anti_nick_flood = 463,  /* general_anti_nick_flood  */
+  YYSYMBOL_general_max_nick_time = 464,    /* general_max_nick_time  */
+  YYSYMBOL_general_max_nick_changes = 465, /* general_max_nick_changes  */
+  YYSYMBOL_general_max_accept = 466,       /* general_max_accept  */
+  YYSYMBOL_general_anti_spam_exit_message_time = 467, /* general_anti_spam_exit_message_time  */
+  YYSYMBOL_general_ts_warn_delta = 468,    /* general_ts_warn_delta  */
+  YYSYMBOL_general_ts_max_delta = 469,     /* general_ts_max_delta  */
+  YYSYMBOL_general_invisible_on_connect = 470, /* general_invisible_on_connect  */
+  YYSYMBOL_general_warn_no_connect_block = 471, /* general_warn_no_connect_block  */
+  YYSYMBOL_general_stats_e_disabled = 472, /* general_stats_e_disabled  */
+  YYSYMBOL_general_stats_m_oper_only = 473, /* general_stats_m_oper_only  */
+  YYSYMBOL_general_stats_o_oper_only = 474, /* general_stats_o_oper_only  */
+  YYSYMBOL_general_stats_P_oper_only = 475, /* general_stats_P_oper_only  */
+  YYSYMBOL_general_stats_u_oper_only = 476, /* general_stats_u_oper_only  */
+  YYSYMBOL_general_stats_k_oper_only = 477, /* general_stats_k_oper_only  */
+  YYSYMBOL_general_stats_i_oper_only = 478, /* general_stats_i_oper_only  */
+  YYSYMBOL_general_pace_wait = 479,        /* general_pace_wait  */
+  YYSYMBOL_general_caller_id_wait = 480,   /* general_caller_id_wait  */
+  YYSYMBOL_general_opers_bypass_callerid = 481, /* general_opers_bypass_callerid  */
+  YYSYMBOL_general_pace_wait_simple = 482, /* general_pace_wait_simple  */
+  YYSYMBOL_general_short_motd = 483,       /* general_short_motd  */
+  YYSYMBOL_general_no_oper_flood = 484,    /* general_no_oper_flood  */
+  YYSYMBOL_general_dots_in_ident = 485,    /* general_dots_in_ident  */
+  YYSYMBOL_general_max_targets = 486,      /* general_max_targets  */
+  YYSYMBOL_general_ping_cookie = 487,      /* general_ping_cookie  */
+  YYSYMBOL_general_disable_auth = 488,     /* general_disable_auth  */
+  YYSYMBOL_general_throttle_count = 489,   /* general_throttle_count  */
+  YYSYMBOL_general_throttle_time = 490,    /* general_throttle_time  */
+  YYSYMBOL_general_oper_umodes = 491,      /* general_oper_umodes  */
+  YYSYMBOL_492_25 = 492,                   /* $@25  */
+  YYSYMBOL_umode_oitems = 493,             /* umode_oitems  */
+  YYSYMBOL_umode_oitem = 494,              /* umode_oitem  */
+  YYSYMBOL_general_oper_only_umodes = 495, /* general_oper_only_umodes  */
+  YYSYMBOL_496_26 = 496,                   /* $@26  */
+  YYSYMBOL_umode_items = 497,              /* umode_items  */
+  YYSYMBOL_umode_item = 498,               /* umode_item  */
+  YYSYMBOL_general_min_nonwildcard = 499,  /* general_min_nonwildcard  */
+  YYSYMBOL_general_min_nonwildcard_simple = 500, /* general_min_nonwildcard_simple  */
+  YYSYMBOL_general_default_floodcount = 501, /* general_default_floodcount  */
+  YYSYMBOL_general_default_floodtime = 502, /* general_default_floodtime  */
+  YYSYMBOL_general_perf_export_delay = 503, /* general_perf_export_delay  */
+  YYSYMBOL_general_perf_export_file = 504, /* general_perf_export_file  */
+  YYSYMBOL_channel_entry = 505,            /* channel_entry  */
+  YYSYMBOL_channel_items = 506,            /* channel_items  */
+  YYSYMBOL_channel_item = 507,             /* channel_item  */
+  YYSYMBOL_channel_enable_extbans = 508,   /* channel_enable_extbans  */
+  YYSYMBOL_channel_disable_fake_channels = 509, /* channel_disable_fake_channels  */
+  YYSYMBOL_channel_invite_client_count = 510, /* channel_invite_client_count  */
+  YYSYMBOL_channel_invite_client_time = 511, /* channel_invite_client_time  */
+  YYSYMBOL_channel_invite_delay_channel = 512, /* channel_invite_delay_channel  */
+  YYSYMBOL_channel_invite_expire_time = 513, /* channel_invite_expire_time  */
+  YYSYMBOL_channel_knock_client_count = 514, /* channel_knock_client_count  */
+  YYSYMBOL_channel_knock_client_time = 515, /* channel_knock_client_time  */
+  YYSYMBOL_channel_knock_delay_channel = 516, /* channel_knock_delay_channel  */
+  YYSYMBOL_channel_max_channels = 517,     /* channel_max_channels  */
+  YYSYMBOL_channel_max_invites = 518,      /* channel_max_invites  */
+  YYSYMBOL_channel_max_bans = 519,         /* channel_max_bans  */
+  YYSYMBOL_channel_max_bans_large = 520,   /* channel_max_bans_large  */
+  YYSYMBOL_channel_default_join_flood_count = 521, /* channel_default_join_flood_count  */
+  YYSYMBOL_channel_default_join_flood_time = 522, /* channel_default_join_flood_time  */
+  YYSYMBOL_serverhide_entry = 523,         /* serverhide_entry  */
+  YYSYMBOL_serverhide_items = 524,         /* serverhide_items  */
+  YYSYMBOL_serverhide_item = 525,          /* serverhide_item  */
+  YYSYMBOL_serverhide_flatten_links = 526, /* serverhide_flatten_links  */
+  YYSYMBOL_serverhide_flatten_links_delay = 527, /* serverhide_flatten_links_delay  */
+  YYSYMBOL_serverhide_flatten_links_file = 528, /* serverhide_flatten_links_file  */
+  YYSYMBOL_serverhide_disable_remote_commands = 529, /* serverhide_disable_remote_commands  */
+  YYSYMBOL_serverhide_hide_servers = 530,  /* serverhide_hide_servers  */
+  YYSYMBOL_serverhide_hide_services = 531, /* serverhide_hide_services  */
+  YYSYMBOL_serverhide_hidden_name = 532,   /* serverhide_hidden_name  */
+  YYSYMBOL_serverhide_hidden = 533,        /* serverhide_hidden  */
+  YYSYMBOL_serverhide_hide_server_ips = 534 /* serverhide_hide_server_ips  */
+};
+typedef enum yysymbol_kind_t yysymbol_kind_t;
+
 
 
 
@@ -700,28 +1259,87 @@ int yyparse (void);
 # undef short
 #endif
 
-#ifdef YYTYPE_UINT8
-typedef YYTYPE_UINT8 yytype_uint8;
-#else
-typedef unsigned char yytype_uint8;
+/* On compilers that do not define __PTRDIFF_MAX__ etc., make sure
+   <limits.h> and (if available) <stdint.h> are included
+   so that the code can choose integer types of a good width.  */
+
+#ifndef __PTRDIFF_MAX__
+# include <limits.h> /* INFRINGES ON USER NAME SPACE */
+# if defined __STDC_VERSION__ && 199901 <= __STDC_VERSION__
+#  include <stdint.h> /* INFRINGES ON USER NAME SPACE */
+#  define YY_STDINT_H
+# endif
 #endif
 
-#ifdef YYTYPE_INT8
-typedef YYTYPE_INT8 yytype_int8;
+/* Narrow types that promote to a signed type and that can represent a
+   signed or unsigned integer of at least N bits.  In tables they can
+   save space and decrease cache pressure.  Promoting to a signed type
+   helps avoid bugs in integer arithmetic.  */
+
+#ifdef __INT_LEAST8_MAX__
+typedef __INT_LEAST8_TYPE__ yytype_int8;
+#elif defined YY_STDINT_H
+typedef int_least8_t yytype_int8;
 #else
 typedef signed char yytype_int8;
 #endif
 
-#ifdef YYTYPE_UINT16
-typedef YYTYPE_UINT16 yytype_uint16;
+#ifdef __INT_LEAST16_MAX__
+typedef __INT_LEAST16_TYPE__ yytype_int16;
+#elif defined YY_STDINT_H
+typedef int_least16_t yytype_int16;
 #else
-typedef unsigned short yytype_uint16;
+typedef short yytype_int16;
 #endif
 
-#ifdef YYTYPE_INT16
-typedef YYTYPE_INT16 yytype_int16;
+/* Work around bug in HP-UX 11.23, which defines these macros
+   incorrectly for preprocessor constants.  This workaround can likely
+   be removed in 2023, as HPE has promised support for HP-UX 11.23
+   (aka HP-UX 11i v2) only through the end of 2022; see Table 2 of
+   <https://h20195.www2.hpe.com/V2/getpdf.aspx/4AA4-7673ENW.pdf>.  */
+#ifdef __hpux
+# undef UINT_LEAST8_MAX
+# undef UINT_LEAST16_MAX
+# define UINT_LEAST8_MAX 255
+# define UINT_LEAST16_MAX 65535
+#endif
+
+#if defined __UINT_LEAST8_MAX__ && __UINT_LEAST8_MAX__ <= __INT_MAX__
+typedef __UINT_LEAST8_TYPE__ yytype_uint8;
+#elif (!defined __UINT_LEAST8_MAX__ && defined YY_STDINT_H \
+       && UINT_LEAST8_MAX <= INT_MAX)
+typedef uint_least8_t yytype_uint8;
+#elif !defined __UINT_LEAST8_MAX__ && UCHAR_MAX <= INT_MAX
+typedef unsigned char yytype_uint8;
 #else
-typedef short yytype_int16;
+typedef short yytype_uint8;
+#endif
+
+#if defined __UINT_LEAST16_MAX__ && __UINT_LEAST16_MAX__ <= __INT_MAX__
+typedef __UINT_LEAST16_TYPE__ yytype_uint16;
+#elif (!defined __UINT_LEAST16_MAX__ && defined YY_STDINT_H \
+       && UINT_LEAST16_MAX <= INT_MAX)
+typedef uint_least16_t yytype_uint16;
+#elif !defined __UINT_LEAST16_MAX__ && USHRT_MAX <= INT_MAX
+typedef unsigned short yytype_uint16;
+#else
+typedef int yytype_uint16;
+#endif
+
+#ifndef YYPTRDIFF_T
+# if defined __PTRDIFF_TYPE__ && defined __PTRDIFF_MAX__
+#  define YYPTRDIFF_T __PTRDIFF_TYPE__
+#  define YYPTRDIFF_MAXIMUM __PTRDIFF_MAX__
+# elif defined PTRDIFF_MAX
+#  ifndef ptrdiff_t
+#   include <stddef.h> /* INFRINGES ON USER NAME SPACE */
+#  endif
+#  define YYPTRDIFF_T ptrdiff_t
+#  define YYPTRDIFF_MAXIMUM PTRDIFF_MAX
+# else
+#  define YYPTRDIFF_T long
+#  define YYPTRDIFF_MAXIMUM LONG_MAX
+# endif
 #endif
 
 #ifndef YYSIZE_T
@@ -729,7 +1347,7 @@ typedef short yytype_int16;
 #  define YYSIZE_T __SIZE_TYPE__
 # elif defined size_t
 #  define YYSIZE_T size_t
-# elif ! defined YYSIZE_T
+# elif defined __STDC_VERSION__ && 199901 <= __STDC_VERSION__
 #  include <stddef.h> /* INFRINGES ON USER NAME SPACE */
 #  define YYSIZE_T size_t
 # else
@@ -737,7 +1355,20 @@ typedef short yytype_int16;
 # endif
 #endif
 
-#define YYSIZE_MAXIMUM ((YYSIZE_T) -1)
+#define YYSIZE_MAXIMUM                                  \
+  YY_CAST (YYPTRDIFF_T,                                 \
+           (YYPTRDIFF_MAXIMUM < YY_CAST (YYSIZE_T, -1)  \
+            ? YYPTRDIFF_MAXIMUM                         \
+            : YY_CAST (YYSIZE_T, -1)))
+
+#define YYSIZEOF(X) YY_CAST (YYPTRDIFF_T, sizeof (X))
+
+
+/* Stored state numbers (used for stacks). */
+typedef yytype_int16 yy_state_t;
+
+/* State numbers in computations.  */
+typedef int yy_state_fast_t;
 
 #ifndef YY_
 # if defined YYENABLE_NLS && YYENABLE_NLS
@@ -751,38 +1382,43 @@ typedef short yytype_int16;
 # endif
 #endif
 
-#ifndef YY_ATTRIBUTE
-# if (defined __GNUC__                                               \
-      && (2 < __GNUC__ || (__GNUC__ == 2 && 96 <= __GNUC_MINOR__)))  \
-     || defined __SUNPRO_C && 0x5110 <= __SUNPRO_C
-#  define YY_ATTRIBUTE(Spec) __attribute__(Spec)
-# else
-#  define YY_ATTRIBUTE(Spec) /* empty */
-# endif
-#endif
 
 #ifndef YY_ATTRIBUTE_PURE
-# define YY_ATTRIBUTE_PURE   YY_ATTRIBUTE ((__pure__))
+# if defined __GNUC__ && 2 < __GNUC__ + (96 <= __GNUC_MINOR__)
+#  define YY_ATTRIBUTE_PURE __attribute__ ((__pure__))
+# else
+#  define YY_ATTRIBUTE_PURE
+# endif
 #endif
 
 #ifndef YY_ATTRIBUTE_UNUSED
-# define YY_ATTRIBUTE_UNUSED YY_ATTRIBUTE ((__unused__))
+# if defined __GNUC__ && 2 < __GNUC__ + (7 <= __GNUC_MINOR__)
+#  define YY_ATTRIBUTE_UNUSED __attribute__ ((__unused__))
+# else
+#  define YY_ATTRIBUTE_UNUSED
+# endif
 #endif
 
 /* Suppress unused-variable warnings by "using" E.  */
 #if ! defined lint || defined __GNUC__
-# define YYUSE(E) ((void) (E))
+# define YY_USE(E) ((void) (E))
 #else
-# define YYUSE(E) /* empty */
+# define YY_USE(E) /* empty */
 #endif
 
-#if defined __GNUC__ && ! defined __ICC && 407 <= __GNUC__ * 100 + __GNUC_MINOR__
 /* Suppress an incorrect diagnostic about yylval being uninitialized.  */
-# define YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN \
-    _Pragma ("GCC diagnostic push") \
-    _Pragma ("GCC diagnostic ignored \"-Wuninitialized\"")\
+#if defined __GNUC__ && ! defined __ICC && 406 <= __GNUC__ * 100 + __GNUC_MINOR__
+# if __GNUC__ * 100 + __GNUC_MINOR__ < 407
+#  define YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN                           \
+    _Pragma ("GCC diagnostic push")                                     \
+    _Pragma ("GCC diagnostic ignored \"-Wuninitialized\"")
+# else
+#  define YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN                           \
+    _Pragma ("GCC diagnostic push")                                     \
+    _Pragma ("GCC diagnostic ignored \"-Wuninitialized\"")              \
     _Pragma ("GCC diagnostic ignored \"-Wmaybe-uninitialized\"")
-# define YY_IGNORE_MAYBE_UNINITIALIZED_END \
+# endif
+# define YY_IGNORE_MAYBE_UNINITIALIZED_END      \
     _Pragma ("GCC diagnostic pop")
 #else
 # define YY_INITIAL_VALUE(Value) Value
@@ -795,8 +1431,22 @@ typedef short yytype_int16;
 # define YY_INITIAL_VALUE(Value) /* Nothing. */
 #endif
 
+#if defined __cplusplus && defined __GNUC__ && ! defined __ICC && 6 <= __GNUC__
+# define YY_IGNORE_USELESS_CAST_BEGIN                          \
+    _Pragma ("GCC diagnostic push")                            \
+    _Pragma ("GCC diagnostic ignored \"-Wuseless-cast\"")
+# define YY_IGNORE_USELESS_CAST_END            \
+    _Pragma ("GCC diagnostic pop")
+#endif
+#ifndef YY_IGNORE_USELESS_CAST_BEGIN
+# define YY_IGNORE_USELESS_CAST_BEGIN
+# define YY_IGNORE_USELESS_CAST_END
+#endif
+
 
-#if ! defined yyoverflow || YYERROR_VERBOSE
+#define YY_ASSERT(E) ((void) (0 && (E)))
+
+#if !defined yyoverflow
 
 /* The parser invokes alloca or malloc; define the necessary symbols.  */
 
@@ -861,8 +1511,7 @@ void free (void *); /* INFRINGES ON USER NAME SPACE */
 #   endif
 #  endif
 # endif
-#endif /* ! defined yyoverflow || YYERROR_VERBOSE */
-
+#endif /* !defined yyoverflow */
 
 #if (! defined yyoverflow \
      && (! defined __cplusplus \
@@ -871,17 +1520,17 @@ void free (void *); /* INFRINGES ON USER NAME SPACE */
 /* A type that is properly aligned for any stack member.  */
 union yyalloc
 {
-  yytype_int16 yyss_alloc;
+  yy_state_t yyss_alloc;
   YYSTYPE yyvs_alloc;
 };
 
 /* The size of the maximum gap between one aligned stack and the next.  */
-# define YYSTACK_GAP_MAXIMUM (sizeof (union yyalloc) - 1)
+# define YYSTACK_GAP_MAXIMUM (YYSIZEOF (union yyalloc) - 1)
 
 /* The size of an array large to enough to hold all stacks, each with
    N elements.  */
 # define YYSTACK_BYTES(N) \
-     ((N) * (sizeof (yytype_int16) + sizeof (YYSTYPE)) \
+     ((N) * (YYSIZEOF (yy_state_t) + YYSIZEOF (YYSTYPE)) \
       + YYSTACK_GAP_MAXIMUM)
 
 # define YYCOPY_NEEDED 1
@@ -894,11 +1543,11 @@ union yyalloc
 # define YYSTACK_RELOCATE(Stack_alloc, Stack)                           \
     do                                                                  \
       {                                                                 \
-        YYSIZE_T yynewbytes;                                            \
+        YYPTRDIFF_T yynewbytes;                                         \
         YYCOPY (&yyptr->Stack_alloc, Stack, yysize);                    \
         Stack = &yyptr->Stack_alloc;                                    \
-        yynewbytes = yystacksize * sizeof (*Stack) + YYSTACK_GAP_MAXIMUM; \
-        yyptr += yynewbytes / sizeof (*yyptr);                          \
+        yynewbytes = yystacksize * YYSIZEOF (*Stack) + YYSTACK_GAP_MAXIMUM; \
+        yyptr += yynewbytes / YYSIZEOF (*yyptr);                        \
       }                                                                 \
     while (0)
 
@@ -910,12 +1559,12 @@ union yyalloc
 # ifndef YYCOPY
 #  if defined __GNUC__ && 1 < __GNUC__
 #   define YYCOPY(Dst, Src, Count) \
-      __builtin_memcpy (Dst, Src, (Count) * sizeof (*(Src)))
+      __builtin_memcpy (Dst, Src, YY_CAST (YYSIZE_T, (Count)) * sizeof (*(Src)))
 #  else
 #   define YYCOPY(Dst, Src, Count)              \
       do                                        \
         {                                       \
-          YYSIZE_T yyi;                         \
+          YYPTRDIFF_T yyi;                      \
           for (yyi = 0; yyi < (Count); yyi++)   \
             (Dst)[yyi] = (Src)[yyi];            \
         }                                       \
@@ -927,24 +1576,27 @@ union yyalloc
 /* YYFINAL -- State number of the termination state.  */
 #define YYFINAL  2
 /* YYLAST -- Last index in YYTABLE.  */
-#define YYLAST   1284
+#define YYLAST   1279
 
 /* YYNTOKENS -- Number of terminals.  */
-#define YYNTOKENS  237
+#define YYNTOKENS  239
 /* YYNNTS -- Number of nonterminals.  */
-#define YYNNTS  294
+#define YYNNTS  296
 /* YYNRULES -- Number of rules.  */
-#define YYNRULES  666
+#define YYNRULES  670
 /* YYNSTATES -- Number of states.  */
-#define YYNSTATES  1312
+#define YYNSTATES  1322
+
+/* YYMAXUTOK -- Last valid token kind.  */
+#define YYMAXUTOK   487
 
-#define YYUNDEFTOK  2
-#define YYMAXUTOK   485
 
 /* YYTRANSLATE(TOKEN-NUM) -- Symbol number corresponding to TOKEN-NUM
    as returned by yylex, with out-of-bounds checking.  */
-#define YYTRANSLATE(YYX)                                                \
-  ((unsigned) (YYX) <= YYMAXUTOK ? yytranslate[YYX] : YYUNDEFTOK)
+#define YYTRANSLATE(YYX)                                \
+  (0 <= (YYX) && (YYX) <= YYMAXUTOK                     \
+   ? YY_CAST (yysymbol_kind_t, yytranslate[YYX])        \
+   : YYSYMBOL_YYUNDEF)
 
 /* YYTRANSLATE[TOKEN-NUM] -- Symbol number corresponding to TOKEN-NUM
    as returned by yylex.  */
@@ -954,15 +1606,15 @@ static const yytype_uint8 yytranslate[] =
        2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
        2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
        2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
-       2,     2,     2,     2,   235,     2,     2,     2,     2,     2,
-       2,     2,     2,     2,     2,     2,     2,     2,   236,   231,
-       2,   234,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,   237,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,   238,   233,
+       2,   236,     2,     2,     2,     2,     2,     2,     2,     2,
        2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
        2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
        2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
        2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
        2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
-       2,     2,     2,   233,     2,   232,     2,     2,     2,     2,
+       2,     2,     2,   235,     2,   234,     2,     2,     2,     2,
        2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
        2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
        2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
@@ -998,122 +1650,131 @@ static const yytype_uint8 yytranslate[] =
      195,   196,   197,   198,   199,   200,   201,   202,   203,   204,
      205,   206,   207,   208,   209,   210,   211,   212,   213,   214,
      215,   216,   217,   218,   219,   220,   221,   222,   223,   224,
-     225,   226,   227,   228,   229,   230
+     225,   226,   227,   228,   229,   230,   231,   232
 };
 
 #if YYDEBUG
-  /* YYRLINE[YYN] -- Source line where rule number YYN was defined.  */
-static const yytype_uint16 yyrline[] =
-{
-       0,   367,   367,   368,   371,   372,   373,   374,   375,   376,
-     377,   378,   379,   380,   381,   382,   383,   384,   385,   386,
-     387,   388,   389,   390,   391,   392,   393,   394,   398,   398,
-     399,   400,   401,   402,   403,   404,   405,   406,   409,   409,
-     410,   411,   412,   413,   420,   422,   422,   423,   423,   423,
-     425,   431,   441,   443,   443,   444,   445,   446,   447,   448,
-     449,   450,   451,   452,   453,   454,   455,   456,   457,   458,
-     459,   460,   463,   472,   481,   490,   499,   508,   517,   526,
-     541,   556,   566,   580,   589,   612,   635,   658,   668,   670,
-     670,   671,   672,   673,   674,   676,   685,   694,   708,   707,
-     725,   725,   726,   726,   726,   728,   734,   745,   744,   763,
-     763,   764,   764,   764,   764,   764,   766,   772,   778,   784,
-     806,   807,   807,   809,   809,   810,   812,   819,   819,   832,
-     833,   835,   835,   836,   836,   838,   846,   849,   855,   854,
-     860,   860,   861,   865,   869,   873,   877,   881,   885,   889,
-     900,   899,   962,   962,   963,   964,   965,   966,   967,   968,
-     969,   970,   971,   972,   973,   975,   981,   987,   993,   999,
-    1010,  1016,  1027,  1034,  1033,  1039,  1039,  1040,  1044,  1048,
-    1052,  1056,  1060,  1064,  1068,  1072,  1076,  1080,  1084,  1088,
-    1092,  1096,  1100,  1104,  1108,  1112,  1116,  1120,  1124,  1128,
-    1135,  1134,  1140,  1140,  1141,  1145,  1149,  1153,  1157,  1161,
-    1165,  1169,  1173,  1177,  1181,  1185,  1189,  1193,  1197,  1201,
-    1205,  1209,  1213,  1217,  1221,  1225,  1229,  1233,  1237,  1241,
-    1245,  1249,  1253,  1264,  1263,  1320,  1320,  1321,  1322,  1323,
-    1324,  1325,  1326,  1327,  1328,  1329,  1330,  1331,  1332,  1333,
-    1334,  1335,  1336,  1338,  1344,  1350,  1356,  1362,  1368,  1374,
-    1380,  1386,  1393,  1399,  1405,  1411,  1420,  1430,  1429,  1435,
-    1435,  1436,  1440,  1451,  1450,  1457,  1456,  1461,  1461,  1462,
-    1466,  1470,  1476,  1476,  1477,  1477,  1477,  1477,  1477,  1479,
-    1479,  1481,  1481,  1483,  1496,  1513,  1519,  1530,  1529,  1576,
-    1576,  1577,  1578,  1579,  1580,  1581,  1582,  1583,  1584,  1585,
-    1587,  1593,  1599,  1605,  1617,  1616,  1622,  1622,  1623,  1627,
-    1631,  1635,  1639,  1643,  1647,  1651,  1655,  1661,  1675,  1684,
-    1698,  1697,  1712,  1712,  1713,  1713,  1713,  1713,  1715,  1721,
-    1727,  1737,  1739,  1739,  1740,  1740,  1742,  1759,  1758,  1781,
-    1781,  1782,  1782,  1782,  1782,  1784,  1790,  1810,  1809,  1815,
-    1815,  1816,  1820,  1824,  1828,  1832,  1836,  1840,  1844,  1848,
-    1852,  1863,  1862,  1881,  1881,  1882,  1882,  1882,  1884,  1891,
-    1890,  1896,  1896,  1897,  1901,  1905,  1909,  1913,  1917,  1921,
-    1925,  1929,  1933,  1944,  1943,  2021,  2021,  2022,  2023,  2024,
-    2025,  2026,  2027,  2028,  2029,  2030,  2031,  2032,  2033,  2034,
-    2035,  2036,  2037,  2039,  2045,  2051,  2057,  2063,  2076,  2089,
-    2095,  2101,  2105,  2112,  2111,  2116,  2116,  2117,  2121,  2127,
-    2138,  2144,  2150,  2156,  2172,  2171,  2195,  2195,  2196,  2196,
-    2196,  2198,  2218,  2229,  2228,  2253,  2253,  2254,  2254,  2254,
-    2256,  2262,  2272,  2274,  2274,  2275,  2275,  2277,  2295,  2294,
-    2315,  2315,  2316,  2316,  2316,  2318,  2324,  2334,  2336,  2336,
-    2337,  2338,  2339,  2340,  2341,  2342,  2343,  2344,  2345,  2346,
-    2347,  2348,  2349,  2350,  2351,  2352,  2353,  2354,  2355,  2356,
-    2357,  2358,  2359,  2360,  2361,  2362,  2363,  2364,  2365,  2366,
-    2367,  2368,  2369,  2370,  2371,  2372,  2373,  2374,  2375,  2376,
-    2377,  2378,  2379,  2380,  2381,  2382,  2385,  2390,  2395,  2400,
-    2405,  2410,  2415,  2420,  2425,  2430,  2435,  2440,  2445,  2450,
-    2455,  2460,  2465,  2470,  2475,  2480,  2485,  2490,  2495,  2500,
-    2505,  2510,  2515,  2520,  2525,  2530,  2535,  2540,  2545,  2550,
-    2555,  2560,  2565,  2570,  2575,  2581,  2580,  2585,  2585,  2586,
-    2589,  2592,  2595,  2598,  2601,  2604,  2607,  2610,  2613,  2616,
-    2619,  2622,  2625,  2628,  2631,  2634,  2637,  2640,  2643,  2646,
-    2649,  2652,  2658,  2657,  2662,  2662,  2663,  2666,  2669,  2672,
-    2675,  2678,  2681,  2684,  2687,  2690,  2693,  2696,  2699,  2702,
-    2705,  2708,  2711,  2714,  2717,  2720,  2723,  2728,  2733,  2738,
-    2743,  2752,  2754,  2754,  2755,  2756,  2757,  2758,  2759,  2760,
-    2761,  2762,  2763,  2764,  2765,  2766,  2767,  2768,  2769,  2770,
-    2772,  2777,  2782,  2787,  2792,  2797,  2802,  2807,  2812,  2817,
-    2822,  2827,  2832,  2837,  2842,  2851,  2853,  2853,  2854,  2855,
-    2856,  2857,  2858,  2859,  2860,  2861,  2862,  2863,  2865,  2871,
-    2887,  2896,  2902,  2908,  2914,  2923,  2929
+/* YYRLINE[YYN] -- Source line where rule number YYN was defined.  */
+static const yytype_int16 yyrline[] =
+{
+       0,   369,   369,   370,   373,   374,   375,   376,   377,   378,
+     379,   380,   381,   382,   383,   384,   385,   386,   387,   388,
+     389,   390,   391,   392,   393,   394,   395,   396,   400,   400,
+     401,   402,   403,   404,   405,   406,   407,   408,   411,   411,
+     412,   413,   414,   415,   422,   424,   424,   425,   425,   425,
+     427,   433,   443,   445,   445,   446,   447,   448,   449,   450,
+     451,   452,   453,   454,   455,   456,   457,   458,   459,   460,
+     461,   462,   465,   474,   483,   492,   501,   510,   519,   528,
+     543,   558,   568,   582,   591,   614,   637,   660,   670,   672,
+     672,   673,   674,   675,   676,   678,   687,   696,   710,   709,
+     727,   727,   728,   728,   728,   730,   736,   747,   746,   765,
+     765,   766,   766,   766,   766,   766,   768,   774,   780,   786,
+     808,   809,   809,   811,   811,   812,   814,   821,   821,   834,
+     835,   837,   837,   838,   838,   840,   848,   851,   857,   856,
+     862,   862,   863,   867,   871,   875,   879,   883,   887,   891,
+     902,   901,   964,   964,   965,   966,   967,   968,   969,   970,
+     971,   972,   973,   974,   975,   977,   983,   989,   995,  1001,
+    1012,  1018,  1029,  1036,  1035,  1041,  1041,  1042,  1046,  1050,
+    1054,  1058,  1062,  1066,  1070,  1074,  1078,  1082,  1086,  1090,
+    1094,  1098,  1102,  1106,  1110,  1114,  1118,  1122,  1126,  1130,
+    1137,  1136,  1142,  1142,  1143,  1147,  1151,  1155,  1159,  1163,
+    1167,  1171,  1175,  1179,  1183,  1187,  1191,  1195,  1199,  1203,
+    1207,  1211,  1215,  1219,  1223,  1227,  1231,  1235,  1239,  1243,
+    1247,  1251,  1255,  1266,  1265,  1322,  1322,  1323,  1324,  1325,
+    1326,  1327,  1328,  1329,  1330,  1331,  1332,  1333,  1334,  1335,
+    1336,  1337,  1338,  1340,  1346,  1352,  1358,  1364,  1370,  1376,
+    1382,  1388,  1395,  1401,  1407,  1413,  1422,  1432,  1431,  1437,
+    1437,  1438,  1442,  1453,  1452,  1459,  1458,  1463,  1463,  1464,
+    1468,  1472,  1478,  1478,  1479,  1479,  1479,  1479,  1479,  1481,
+    1481,  1483,  1483,  1485,  1498,  1515,  1521,  1532,  1531,  1578,
+    1578,  1579,  1580,  1581,  1582,  1583,  1584,  1585,  1586,  1587,
+    1589,  1595,  1601,  1607,  1619,  1618,  1624,  1624,  1625,  1629,
+    1633,  1637,  1641,  1645,  1649,  1653,  1657,  1663,  1677,  1686,
+    1700,  1699,  1714,  1714,  1715,  1715,  1715,  1715,  1717,  1723,
+    1729,  1739,  1741,  1741,  1742,  1742,  1744,  1761,  1760,  1783,
+    1783,  1784,  1784,  1784,  1784,  1786,  1792,  1812,  1811,  1817,
+    1817,  1818,  1822,  1826,  1830,  1834,  1838,  1842,  1846,  1850,
+    1854,  1865,  1864,  1883,  1883,  1884,  1884,  1884,  1886,  1893,
+    1892,  1898,  1898,  1899,  1903,  1907,  1911,  1915,  1919,  1923,
+    1927,  1931,  1935,  1946,  1945,  2023,  2023,  2024,  2025,  2026,
+    2027,  2028,  2029,  2030,  2031,  2032,  2033,  2034,  2035,  2036,
+    2037,  2038,  2039,  2041,  2047,  2053,  2059,  2065,  2078,  2091,
+    2097,  2103,  2107,  2114,  2113,  2118,  2118,  2119,  2123,  2129,
+    2140,  2146,  2152,  2158,  2174,  2173,  2197,  2197,  2198,  2198,
+    2198,  2200,  2220,  2231,  2230,  2255,  2255,  2256,  2256,  2256,
+    2258,  2264,  2274,  2276,  2276,  2277,  2277,  2279,  2297,  2296,
+    2317,  2317,  2318,  2318,  2318,  2320,  2326,  2336,  2338,  2338,
+    2339,  2340,  2341,  2342,  2343,  2344,  2345,  2346,  2347,  2348,
+    2349,  2350,  2351,  2352,  2353,  2354,  2355,  2356,  2357,  2358,
+    2359,  2360,  2361,  2362,  2363,  2364,  2365,  2366,  2367,  2368,
+    2369,  2370,  2371,  2372,  2373,  2374,  2375,  2376,  2377,  2378,
+    2379,  2380,  2381,  2382,  2383,  2384,  2385,  2386,  2389,  2394,
+    2399,  2404,  2409,  2414,  2419,  2424,  2429,  2434,  2439,  2444,
+    2449,  2454,  2459,  2464,  2469,  2474,  2479,  2484,  2489,  2494,
+    2499,  2504,  2509,  2514,  2519,  2524,  2529,  2534,  2539,  2544,
+    2549,  2554,  2559,  2564,  2569,  2574,  2579,  2585,  2584,  2589,
+    2589,  2590,  2593,  2596,  2599,  2602,  2605,  2608,  2611,  2614,
+    2617,  2620,  2623,  2626,  2629,  2632,  2635,  2638,  2641,  2644,
+    2647,  2650,  2653,  2656,  2662,  2661,  2666,  2666,  2667,  2670,
+    2673,  2676,  2679,  2682,  2685,  2688,  2691,  2694,  2697,  2700,
+    2703,  2706,  2709,  2712,  2715,  2718,  2721,  2724,  2727,  2732,
+    2737,  2742,  2747,  2752,  2757,  2770,  2772,  2772,  2773,  2774,
+    2775,  2776,  2777,  2778,  2779,  2780,  2781,  2782,  2783,  2784,
+    2785,  2786,  2787,  2788,  2790,  2795,  2800,  2805,  2810,  2815,
+    2820,  2825,  2830,  2835,  2840,  2845,  2850,  2855,  2860,  2869,
+    2871,  2871,  2872,  2873,  2874,  2875,  2876,  2877,  2878,  2879,
+    2880,  2881,  2883,  2889,  2905,  2914,  2920,  2926,  2932,  2941,
+    2947
 };
 #endif
 
-#if YYDEBUG || YYERROR_VERBOSE || 0
+/** Accessing symbol of state STATE.  */
+#define YY_ACCESSING_SYMBOL(State) YY_CAST (yysymbol_kind_t, yystos[State])
+
+#if YYDEBUG || 0
+/* The user-facing name of the symbol whose (internal) number is
+   YYSYMBOL.  No bounds checking.  */
+static const char *yysymbol_name (yysymbol_kind_t yysymbol) YY_ATTRIBUTE_UNUSED;
+
 /* YYTNAME[SYMBOL-NUM] -- String name of the symbol SYMBOL-NUM.
    First, the terminals, then, starting at YYNTOKENS, nonterminals.  */
 static const char *const yytname[] =
 {
-  "$end", "error", "$undefined", "ACCEPT_PASSWORD", "ADMIN", "AFTYPE",
-  "ANTI_NICK_FLOOD", "ANTI_SPAM_EXIT_MESSAGE_TIME", "AUTOCONN",
-  "AWAY_COUNT", "AWAY_TIME", "BYTES", "KBYTES", "MBYTES", "CALLER_ID_WAIT",
-  "CAN_FLOOD", "CHANNEL", "CIDR_BITLEN_IPV4", "CIDR_BITLEN_IPV6", "CLASS",
-  "CLOSE", "CONNECT", "CONNECTFREQ", "CYCLE_ON_HOST_CHANGE",
-  "DEFAULT_FLOODCOUNT", "DEFAULT_FLOODTIME", "DEFAULT_JOIN_FLOOD_COUNT",
-  "DEFAULT_JOIN_FLOOD_TIME", "DEFAULT_MAX_CLIENTS", "DENY", "DESCRIPTION",
-  "DIE", "DISABLE_AUTH", "DISABLE_FAKE_CHANNELS",
-  "DISABLE_REMOTE_COMMANDS", "DLINE_MIN_CIDR", "DLINE_MIN_CIDR6",
-  "DOTS_IN_IDENT", "EMAIL", "ENABLE_EXTBANS", "ENCRYPTED", "EXCEED_LIMIT",
-  "EXEMPT", "EXPIRATION", "FAILED_OPER_NOTICE", "FLATTEN_LINKS",
-  "FLATTEN_LINKS_DELAY", "FLATTEN_LINKS_FILE", "GECOS", "GENERAL",
-  "HIDDEN", "HIDDEN_NAME", "HIDE_CHANS", "HIDE_IDLE",
-  "HIDE_IDLE_FROM_OPERS", "HIDE_SERVER_IPS", "HIDE_SERVERS",
-  "HIDE_SERVICES", "HOST", "HUB", "HUB_MASK", "INVISIBLE_ON_CONNECT",
-  "INVITE_CLIENT_COUNT", "INVITE_CLIENT_TIME", "INVITE_DELAY_CHANNEL",
-  "INVITE_EXPIRE_TIME", "IP", "IRCD_AUTH", "IRCD_FLAGS", "IRCD_SID",
-  "JOIN", "KILL", "KILL_CHASE_TIME_LIMIT", "KLINE", "KLINE_EXEMPT",
-  "KLINE_MIN_CIDR", "KLINE_MIN_CIDR6", "KNOCK_CLIENT_COUNT",
-  "KNOCK_CLIENT_TIME", "KNOCK_DELAY_CHANNEL", "LEAF_MASK", "LISTEN",
-  "MASK", "MAX_ACCEPT", "MAX_BANS", "MAX_BANS_LARGE", "MAX_CHANNELS",
-  "MAX_IDLE", "MAX_INVITES", "MAX_NICK_CHANGES", "MAX_NICK_LENGTH",
-  "MAX_NICK_TIME", "MAX_NUMBER", "MAX_TARGETS", "MAX_TOPIC_LENGTH",
-  "MAX_WATCH", "MIN_IDLE", "MIN_NONWILDCARD", "MIN_NONWILDCARD_SIMPLE",
-  "MODULE", "MODULES", "MOTD", "NAME", "NEED_IDENT", "NEED_PASSWORD",
-  "NETWORK_DESC", "NETWORK_NAME", "NICK", "NO_OPER_FLOOD", "NO_TILDE",
-  "NUMBER", "NUMBER_PER_CIDR", "NUMBER_PER_IP_GLOBAL",
-  "NUMBER_PER_IP_LOCAL", "OPER_ONLY_UMODES", "OPER_UMODES", "OPERATOR",
-  "OPERS_BYPASS_CALLERID", "PACE_WAIT", "PACE_WAIT_SIMPLE", "PASSWORD",
-  "PATH", "PING_COOKIE", "PING_TIME", "PORT", "QSTRING", "RANDOM_IDLE",
-  "REASON", "REDIRPORT", "REDIRSERV", "REHASH", "REMOTE", "REMOTEBAN",
-  "RESV", "RESV_EXEMPT", "RSA_PRIVATE_KEY_FILE", "SECONDS", "MINUTES",
-  "HOURS", "DAYS", "WEEKS", "MONTHS", "YEARS", "SEND_PASSWORD", "SENDQ",
-  "SERVERHIDE", "SERVERINFO", "SHORT_MOTD", "SPOOF", "SQUIT",
+  "\"end of file\"", "error", "\"invalid token\"", "ACCEPT_PASSWORD",
+  "ADMIN", "AFTYPE", "ANTI_NICK_FLOOD", "ANTI_SPAM_EXIT_MESSAGE_TIME",
+  "AUTOCONN", "AWAY_COUNT", "AWAY_TIME", "BYTES", "KBYTES", "MBYTES",
+  "CALLER_ID_WAIT", "CAN_FLOOD", "CHANNEL", "CIDR_BITLEN_IPV4",
+  "CIDR_BITLEN_IPV6", "CLASS", "CLOSE", "CONNECT", "CONNECTFREQ",
+  "CYCLE_ON_HOST_CHANGE", "DEFAULT_FLOODCOUNT", "DEFAULT_FLOODTIME",
+  "DEFAULT_JOIN_FLOOD_COUNT", "DEFAULT_JOIN_FLOOD_TIME",
+  "DEFAULT_MAX_CLIENTS", "DENY", "DESCRIPTION", "DIE", "DISABLE_AUTH",
+  "DISABLE_FAKE_CHANNELS", "DISABLE_REMOTE_COMMANDS", "DLINE_MIN_CIDR",
+  "DLINE_MIN_CIDR6", "DOTS_IN_IDENT", "EMAIL", "ENABLE_EXTBANS",
+  "ENCRYPTED", "EXCEED_LIMIT", "EXEMPT", "EXPIRATION",
+  "FAILED_OPER_NOTICE", "FLATTEN_LINKS", "FLATTEN_LINKS_DELAY",
+  "FLATTEN_LINKS_FILE", "GECOS", "GENERAL", "HIDDEN", "HIDDEN_NAME",
+  "HIDE_CHANS", "HIDE_IDLE", "HIDE_IDLE_FROM_OPERS", "HIDE_SERVER_IPS",
+  "HIDE_SERVERS", "HIDE_SERVICES", "HOST", "HUB", "HUB_MASK",
+  "INVISIBLE_ON_CONNECT", "INVITE_CLIENT_COUNT", "INVITE_CLIENT_TIME",
+  "INVITE_DELAY_CHANNEL", "INVITE_EXPIRE_TIME", "IP", "IRCD_AUTH",
+  "IRCD_FLAGS", "IRCD_SID", "JOIN", "KILL", "KILL_CHASE_TIME_LIMIT",
+  "KLINE", "KLINE_EXEMPT", "KLINE_MIN_CIDR", "KLINE_MIN_CIDR6",
+  "KNOCK_CLIENT_COUNT", "KNOCK_CLIENT_TIME", "KNOCK_DELAY_CHANNEL",
+  "LEAF_MASK", "LISTEN", "MASK", "MAX_ACCEPT", "MAX_BANS",
+  "MAX_BANS_LARGE", "MAX_CHANNELS", "MAX_IDLE", "MAX_INVITES",
+  "MAX_NICK_CHANGES", "MAX_NICK_LENGTH", "MAX_NICK_TIME", "MAX_NUMBER",
+  "MAX_TARGETS", "MAX_TOPIC_LENGTH", "MAX_WATCH", "MIN_IDLE",
+  "MIN_NONWILDCARD", "MIN_NONWILDCARD_SIMPLE", "MODULE", "MODULES", "MOTD",
+  "NAME", "NEED_IDENT", "NEED_PASSWORD", "NETWORK_DESC", "NETWORK_NAME",
+  "NICK", "NO_OPER_FLOOD", "NO_TILDE", "NUMBER", "NUMBER_PER_CIDR",
+  "NUMBER_PER_IP_GLOBAL", "NUMBER_PER_IP_LOCAL", "OPER_ONLY_UMODES",
+  "OPER_UMODES", "OPERATOR", "OPERS_BYPASS_CALLERID", "PACE_WAIT",
+  "PACE_WAIT_SIMPLE", "PASSWORD", "PATH", "PERF_EXPORT_DELAY",
+  "PERF_EXPORT_FILE", "PING_COOKIE", "PING_TIME", "PORT", "QSTRING",
+  "RANDOM_IDLE", "REASON", "REDIRPORT", "REDIRSERV", "REHASH", "REMOTE",
+  "REMOTEBAN", "RESV", "RESV_EXEMPT", "RSA_PRIVATE_KEY_FILE", "SECONDS",
+  "MINUTES", "HOURS", "DAYS", "WEEKS", "MONTHS", "YEARS", "SEND_PASSWORD",
+  "SENDQ", "SERVERHIDE", "SERVERINFO", "SHORT_MOTD", "SPOOF", "SQUIT",
   "STATS_E_DISABLED", "STATS_I_OPER_ONLY", "STATS_K_OPER_ONLY",
   "STATS_M_OPER_ONLY", "STATS_O_OPER_ONLY", "STATS_P_OPER_ONLY",
   "STATS_U_OPER_ONLY", "T_ALL", "T_BIND", "T_BOTS", "T_CALLERID",
@@ -1209,7 +1870,8 @@ static const char *const yytname[] =
   "$@25", "umode_oitems", "umode_oitem", "general_oper_only_umodes",
   "$@26", "umode_items", "umode_item", "general_min_nonwildcard",
   "general_min_nonwildcard_simple", "general_default_floodcount",
-  "general_default_floodtime", "channel_entry", "channel_items",
+  "general_default_floodtime", "general_perf_export_delay",
+  "general_perf_export_file", "channel_entry", "channel_items",
   "channel_item", "channel_enable_extbans",
   "channel_disable_fake_channels", "channel_invite_client_count",
   "channel_invite_client_time", "channel_invite_delay_channel",
@@ -1224,192 +1886,167 @@ static const char *const yytname[] =
   "serverhide_hide_services", "serverhide_hidden_name",
   "serverhide_hidden", "serverhide_hide_server_ips", YY_NULLPTR
 };
-#endif
 
-# ifdef YYPRINT
-/* YYTOKNUM[NUM] -- (External) token number corresponding to the
-   (internal) symbol number NUM (which must be that of a token).  */
-static const yytype_uint16 yytoknum[] =
-{
-       0,   256,   257,   258,   259,   260,   261,   262,   263,   264,
-     265,   266,   267,   268,   269,   270,   271,   272,   273,   274,
-     275,   276,   277,   278,   279,   280,   281,   282,   283,   284,
-     285,   286,   287,   288,   289,   290,   291,   292,   293,   294,
-     295,   296,   297,   298,   299,   300,   301,   302,   303,   304,
-     305,   306,   307,   308,   309,   310,   311,   312,   313,   314,
-     315,   316,   317,   318,   319,   320,   321,   322,   323,   324,
-     325,   326,   327,   328,   329,   330,   331,   332,   333,   334,
-     335,   336,   337,   338,   339,   340,   341,   342,   343,   344,
-     345,   346,   347,   348,   349,   350,   351,   352,   353,   354,
-     355,   356,   357,   358,   359,   360,   361,   362,   363,   364,
-     365,   366,   367,   368,   369,   370,   371,   372,   373,   374,
-     375,   376,   377,   378,   379,   380,   381,   382,   383,   384,
-     385,   386,   387,   388,   389,   390,   391,   392,   393,   394,
-     395,   396,   397,   398,   399,   400,   401,   402,   403,   404,
-     405,   406,   407,   408,   409,   410,   411,   412,   413,   414,
-     415,   416,   417,   418,   419,   420,   421,   422,   423,   424,
-     425,   426,   427,   428,   429,   430,   431,   432,   433,   434,
-     435,   436,   437,   438,   439,   440,   441,   442,   443,   444,
-     445,   446,   447,   448,   449,   450,   451,   452,   453,   454,
-     455,   456,   457,   458,   459,   460,   461,   462,   463,   464,
-     465,   466,   467,   468,   469,   470,   471,   472,   473,   474,
-     475,   476,   477,   478,   479,   480,   481,   482,   483,   484,
-     485,    59,   125,   123,    61,    44,    58
-};
-# endif
+static const char *
+yysymbol_name (yysymbol_kind_t yysymbol)
+{
+  return yytname[yysymbol];
+}
+#endif
 
-#define YYPACT_NINF -1038
+#define YYPACT_NINF (-966)
 
-#define yypact_value_is_default(Yystate) \
-  (!!((Yystate) == (-1038)))
+#define yypact_value_is_default(Yyn) \
+  ((Yyn) == YYPACT_NINF)
 
-#define YYTABLE_NINF -128
+#define YYTABLE_NINF (-128)
 
-#define yytable_value_is_error(Yytable_value) \
+#define yytable_value_is_error(Yyn) \
   0
 
-  /* YYPACT[STATE-NUM] -- Index in YYTABLE of the portion describing
-     STATE-NUM.  */
+/* YYPACT[STATE-NUM] -- Index in YYTABLE of the portion describing
+   STATE-NUM.  */
 static const yytype_int16 yypact[] =
 {
-   -1038,   648, -1038,  -104,  -216,  -203, -1038, -1038, -1038,  -198,
-   -1038,  -195, -1038, -1038, -1038,  -180, -1038, -1038, -1038,  -178,
-    -171, -1038,  -158, -1038,  -144, -1038, -1038, -1038, -1038, -1038,
-   -1038, -1038, -1038, -1038, -1038, -1038, -1038, -1038, -1038, -1038,
-   -1038, -1038, -1038, -1038, -1038, -1038, -1038, -1038, -1038, -1038,
-   -1038,     4,   940,  -137,  -120,   -89,    18,   -82,   381,   -51,
-     -43,   -31,   178,   -28,   -17,   -16,   686,   556,    33,     3,
-      36,     8,    40,     7,    10,    50,    51,    60, -1038, -1038,
-   -1038, -1038, -1038,    53,    64,    69,    81,    82,    88,    93,
-     100,   102,   105,   110,   119,   120,   121,   127,   144, -1038,
-   -1038, -1038, -1038, -1038, -1038, -1038, -1038, -1038, -1038, -1038,
-   -1038, -1038, -1038, -1038, -1038,   615,   542,    28, -1038,   130,
-      26, -1038, -1038,    72, -1038,   132,   141,   143,   146,   149,
-     150,   151,   155,   159,   162,   163,   165,   169,   173,   175,
-     176,   181,   185,   190,   194,   195,   197,   198,   199,   200,
-   -1038, -1038,   202,   203,   204,   205,   207,   211,   213,   215,
-     217,   220,   221,   224,   226,   227,   231,   233,   234,   235,
-      42, -1038, -1038, -1038, -1038, -1038, -1038, -1038, -1038, -1038,
-   -1038, -1038, -1038, -1038, -1038, -1038, -1038, -1038, -1038, -1038,
-   -1038, -1038, -1038, -1038, -1038, -1038, -1038, -1038, -1038, -1038,
-   -1038, -1038, -1038, -1038, -1038, -1038, -1038, -1038, -1038, -1038,
-   -1038, -1038, -1038, -1038, -1038, -1038, -1038,   362,    38,   274,
-     147,   237,   241,     2, -1038, -1038, -1038,    96,   346,   225,
-   -1038,   243,   247,   249,   250,   252,   258,   259,   260,   263,
-      13, -1038, -1038, -1038, -1038, -1038, -1038, -1038, -1038, -1038,
-   -1038,   228,   268,   270,   271,   272,   280,   282,   283,   284,
-     285,   286,   287,   289,   290,   291,   292,   293,    79, -1038,
-   -1038, -1038, -1038, -1038, -1038, -1038, -1038, -1038, -1038, -1038,
-   -1038, -1038, -1038, -1038, -1038, -1038,    86,   298,   296,    11,
-   -1038, -1038, -1038,   131,   246, -1038,   304,   111, -1038, -1038,
-      56, -1038,   355,   383,   386,   308, -1038,   302,   430,   339,
-     341,   440,   430,   430,   430,   441,   430,   430,   443,   444,
-     445,   448,   321, -1038,   329,   328,   330,   331, -1038,   332,
-     333,   334,   336,   337,   342,   343,   344,   345,   347,   349,
-     218, -1038, -1038, -1038, -1038, -1038, -1038, -1038, -1038, -1038,
-   -1038, -1038, -1038, -1038, -1038, -1038, -1038,   358,   359,   360,
-     361,   363,   367,   369, -1038,   370,   371,   372,   377,   378,
-     380,   384,   385,   277, -1038, -1038, -1038, -1038, -1038, -1038,
-   -1038, -1038, -1038, -1038, -1038, -1038, -1038, -1038, -1038, -1038,
-   -1038,   389,   390,    19, -1038, -1038, -1038,   438,   365, -1038,
-   -1038,   393,   394,    20, -1038, -1038, -1038,   375,   430,   482,
-     430,   430,   415,   519,   430,   426,   524,   525,   526,   433,
-     434,   430,   531,   537,   541,   543,   430,   544,   545,   546,
-     547,   454,   431,   436,   455,   430,   430,   463,   467,   468,
-     469,   470,   471,   473,   474,   475,   571,   430,   430,   430,
-     477,   574,   457, -1038,   458,   452,   459, -1038,   461,   464,
-     465,   472,   476,   135, -1038, -1038, -1038, -1038, -1038, -1038,
-   -1038, -1038, -1038, -1038,   478,   479,    49, -1038, -1038, -1038,
-     485,   484,   488, -1038,   491, -1038,    25, -1038, -1038, -1038,
-   -1038, -1038,   567,   578,   499, -1038,   503,   501,   505,    70,
-   -1038, -1038, -1038,   509,   510,   511, -1038,   512,   513, -1038,
-     517,   521,   522,   523,    14, -1038, -1038, -1038, -1038, -1038,
-   -1038, -1038, -1038, -1038, -1038, -1038,   527,   528,   529,   535,
-      39, -1038, -1038, -1038, -1038,   500,   504,   430,   579,   555,
-     583,   569,   572,   575,   530, -1038, -1038,   669,   657,   580,
-     658,   674,   676,   663,   664,   665,   666,   667,   670,   673,
-     675,   677,   678,   568, -1038,   570,   573, -1038,   118, -1038,
-   -1038, -1038, -1038,   599,   577, -1038,   576,   582,   581,   584,
-     586,   589,    24, -1038, -1038, -1038, -1038, -1038,   681,   585,
-   -1038,   594,   592, -1038,   593,    30, -1038, -1038, -1038, -1038,
-     597,   602,   609, -1038,   613,   852,   614,   616,   620,   622,
-     624,   625,   626,   629,   630,   634,   635,   636,   638,   639,
-   -1038, -1038,   700,   704,   430,   618,   707,   430,   761,   430,
-     747,   764,   765,   766,   430,   767,   767,   647, -1038, -1038,
-     754,    -6,   755,   680,   756,   769,   652,   771,   772,   779,
-     774,   777,   430,   778,   780,   661, -1038,   782,   783,   682,
-   -1038,   687, -1038,   784,   787,   693, -1038,   697,   702,   705,
-     711,   713,   715,   716,   717,   719,   720,   725,   726,   727,
-     729,   732,   734,   737,   738,   739,   740,   741,   743,   744,
-     745,   746,   762,   671,   749,   750,   751,   752,   768,   770,
-     775,   781,   785,   789,   790,   791,   792,   796,   798,   799,
-     800,   801, -1038, -1038,   806,   699,   683,   810,   828,   853,
-     860,   870,   802, -1038,   871,   872,   803, -1038, -1038,   873,
-     875,   776,   898,   804, -1038,   805,   807, -1038, -1038,   884,
-     886,   808, -1038, -1038,   888,   706,   809,   889,   912,   811,
-     915,   836,   917,   919,   815, -1038, -1038,   922,   923,   924,
-     819, -1038,   820,   821,   822,   823,   824,   825,   826,   827,
-     829, -1038,   830,   831,   832,   833,   834,   835,   837,   838,
-     839,   840,   841,   842,   843,   844,   845,   846, -1038, -1038,
-     934,   847,   848, -1038,   849, -1038,    99, -1038,   942,   953,
-     957,   958,   854, -1038,   855, -1038, -1038,   959,   856,   962,
-     857, -1038, -1038, -1038, -1038, -1038,   430,   430,   430,   430,
-     430,   430,   430, -1038, -1038, -1038, -1038, -1038, -1038, -1038,
-   -1038, -1038, -1038, -1038, -1038, -1038, -1038, -1038, -1038,   858,
-     861,   862,   -38,   863,   864,   865,   866,   867,   868,   869,
-     874,   876,   313,   877,   878, -1038,   879,   880,   881,   882,
-     883,   885,   887,     5,   890,   891,   892,   893,   894,   895,
-     896,   897, -1038,   899,   900, -1038, -1038,   901,   902, -1038,
-   -1038, -1038, -1038, -1038, -1038, -1038, -1038, -1038, -1038, -1038,
-   -1038, -1038, -1038, -1038, -1038, -1038, -1038, -1038, -1038, -1038,
-   -1038, -1038, -1038, -1038, -1038, -1038, -1038, -1038, -1038, -1038,
-   -1038, -1038, -1038, -1038, -1038, -1038, -1038, -1038, -1038, -1038,
-   -1038, -1038, -1038, -1038, -1038, -1038,  -207, -1038, -1038, -1038,
-   -1038, -1038, -1038, -1038, -1038, -1038, -1038, -1038, -1038, -1038,
-   -1038, -1038, -1038, -1038, -1038, -1038, -1038, -1038, -1038, -1038,
-   -1038,  -199, -1038, -1038, -1038, -1038, -1038, -1038, -1038, -1038,
-   -1038, -1038, -1038, -1038, -1038, -1038, -1038, -1038, -1038, -1038,
-   -1038,   903,   904,   318,   905,   906,   907,   908,   909, -1038,
-     910,   911, -1038,   913,   914,   -32,   927,   916, -1038, -1038,
-   -1038, -1038,   918,   921, -1038,   925,   926,   442,   928,   929,
-     723,   930,   931,   932,   933, -1038,   935,   936,   937, -1038,
-   -1038, -1038, -1038, -1038, -1038, -1038, -1038, -1038, -1038, -1038,
-   -1038, -1038, -1038, -1038, -1038, -1038, -1038, -1038, -1038, -1038,
-   -1038, -1038, -1038, -1038, -1038,   938,   621, -1038, -1038,   939,
-     920,   941, -1038,    22, -1038, -1038, -1038, -1038,   943,   945,
-     946,   947, -1038, -1038,   948,   786,   949, -1038, -1038, -1038,
-   -1038, -1038, -1038, -1038, -1038, -1038, -1038, -1038, -1038, -1038,
-    -194, -1038, -1038, -1038, -1038, -1038, -1038, -1038, -1038, -1038,
-   -1038,   767,   767,   767, -1038, -1038, -1038, -1038, -1038, -1038,
-   -1038, -1038, -1038, -1038, -1038, -1038, -1038,  -159, -1038, -1038,
-   -1038, -1038, -1038, -1038, -1038, -1038, -1038, -1038, -1038, -1038,
-   -1038, -1038,   762, -1038,   671, -1038, -1038, -1038, -1038, -1038,
-   -1038, -1038, -1038, -1038, -1038, -1038,  -136, -1038, -1038, -1038,
-   -1038, -1038, -1038, -1038, -1038, -1038, -1038, -1038, -1038, -1038,
-     -44, -1038,   981,   898,   950, -1038, -1038, -1038, -1038, -1038,
-   -1038,   951, -1038,   952,   954, -1038, -1038,   955,   956, -1038,
-   -1038,   960, -1038, -1038, -1038, -1038, -1038, -1038, -1038, -1038,
-   -1038, -1038, -1038, -1038,   -20, -1038, -1038, -1038, -1038, -1038,
-   -1038, -1038, -1038, -1038, -1038, -1038, -1038, -1038, -1038, -1038,
-   -1038, -1038, -1038, -1038, -1038, -1038, -1038, -1038, -1038, -1038,
-   -1038,    66, -1038, -1038, -1038, -1038, -1038, -1038, -1038, -1038,
-   -1038, -1038, -1038, -1038, -1038, -1038, -1038, -1038, -1038, -1038,
-   -1038,    77, -1038, -1038,   976,   -88,   961,   963, -1038, -1038,
-   -1038, -1038, -1038, -1038, -1038, -1038, -1038, -1038, -1038, -1038,
-   -1038, -1038, -1038, -1038,    78, -1038, -1038, -1038,   -38, -1038,
-   -1038, -1038, -1038,     5, -1038, -1038, -1038,   318, -1038,   -32,
-   -1038, -1038, -1038,   971,   970,   973,   982,   975,   986, -1038,
-     442, -1038,   723, -1038,   621,   966,   967,   968,   278, -1038,
-   -1038,   786, -1038, -1038, -1038, -1038, -1038, -1038, -1038, -1038,
-   -1038, -1038, -1038, -1038, -1038, -1038, -1038, -1038, -1038, -1038,
-   -1038, -1038, -1038, -1038, -1038, -1038,   125, -1038, -1038, -1038,
-     278, -1038
+    -966,   646,  -966,  -211,  -226,  -218,  -966,  -966,  -966,  -205,
+    -966,  -197,  -966,  -966,  -966,  -184,  -966,  -966,  -966,  -169,
+    -156,  -966,  -153,  -966,  -151,  -966,  -966,  -966,  -966,  -966,
+    -966,  -966,  -966,  -966,  -966,  -966,  -966,  -966,  -966,  -966,
+    -966,  -966,  -966,  -966,  -966,  -966,  -966,  -966,  -966,  -966,
+    -966,   275,   923,  -126,  -123,   -98,    15,   -84,   361,   -73,
+     -65,   -63,   102,   -51,   -33,   -29,   970,   438,   -26,    17,
+     -24,    14,    -3,  -139,    -1,    27,    31,     4,  -966,  -966,
+    -966,  -966,  -966,    33,    45,    65,    66,    68,    70,    75,
+      76,    82,    83,    85,    91,    92,    99,   103,   165,  -966,
+    -966,  -966,  -966,  -966,  -966,  -966,  -966,  -966,  -966,  -966,
+    -966,  -966,  -966,  -966,  -966,   662,   618,    67,  -966,   108,
+      25,  -966,  -966,    20,  -966,   109,   110,   115,   117,   122,
+     123,   124,   125,   127,   129,   130,   138,   142,   143,   145,
+     151,   152,   153,   158,   159,   164,   166,   167,   168,   171,
+    -966,  -966,   174,   175,   176,   177,   180,   181,   182,   184,
+     185,   188,   189,   191,   195,   196,   199,   202,   205,   209,
+     210,   212,    63,  -966,  -966,  -966,  -966,  -966,  -966,  -966,
+    -966,  -966,  -966,  -966,  -966,  -966,  -966,  -966,  -966,  -966,
+    -966,  -966,  -966,  -966,  -966,  -966,  -966,  -966,  -966,  -966,
+    -966,  -966,  -966,  -966,  -966,  -966,  -966,  -966,  -966,  -966,
+    -966,  -966,  -966,  -966,  -966,  -966,  -966,  -966,  -966,  -966,
+    -966,   485,    30,   314,    37,   215,   219,    26,  -966,  -966,
+    -966,    28,   389,    36,  -966,   224,   225,   226,   227,   231,
+     234,   235,   236,   238,     2,  -966,  -966,  -966,  -966,  -966,
+    -966,  -966,  -966,  -966,  -966,   197,   241,   245,   246,   251,
+     253,   258,   260,   262,   264,   267,   269,   272,   276,   284,
+     286,   288,   120,  -966,  -966,  -966,  -966,  -966,  -966,  -966,
+    -966,  -966,  -966,  -966,  -966,  -966,  -966,  -966,  -966,  -966,
+      34,   278,   290,   116,  -966,  -966,  -966,   128,   363,  -966,
+     294,    11,  -966,  -966,    53,  -966,   173,   229,   274,   298,
+    -966,   193,   214,   327,   330,   428,   214,   214,   214,   429,
+     214,   214,   436,   437,   439,   440,   309,  -966,   315,   319,
+     322,   331,  -966,   335,   336,   338,   340,   341,   342,   343,
+     346,   347,   350,   352,   230,  -966,  -966,  -966,  -966,  -966,
+    -966,  -966,  -966,  -966,  -966,  -966,  -966,  -966,  -966,  -966,
+    -966,   318,   356,   357,   360,   362,   366,   370,  -966,   371,
+     373,   375,   377,   381,   384,   390,   400,   289,  -966,  -966,
+    -966,  -966,  -966,  -966,  -966,  -966,  -966,  -966,  -966,  -966,
+    -966,  -966,  -966,  -966,  -966,   403,   404,    24,  -966,  -966,
+    -966,   470,   408,  -966,  -966,   407,   421,    40,  -966,  -966,
+    -966,   452,   214,   534,   214,   214,   453,   551,   214,   459,
+     558,   559,   560,   464,   466,   214,   564,   567,   571,   572,
+     214,   573,   575,   577,   579,   483,   455,   456,   486,   214,
+     214,   214,   570,   492,   493,   494,   495,   496,   497,   499,
+     500,   501,   601,   214,   214,   214,   505,   605,   488,  -966,
+     489,   480,   482,  -966,   487,   502,   506,   507,   509,    43,
+    -966,  -966,  -966,  -966,  -966,  -966,  -966,  -966,  -966,  -966,
+     514,   515,    54,  -966,  -966,  -966,   503,   516,   517,  -966,
+     519,  -966,   139,  -966,  -966,  -966,  -966,  -966,   592,   598,
+     508,  -966,   523,   521,   525,   118,  -966,  -966,  -966,   526,
+     529,   530,  -966,   531,   533,  -966,   536,   540,   546,   547,
+     194,  -966,  -966,  -966,  -966,  -966,  -966,  -966,  -966,  -966,
+    -966,  -966,   552,   548,   550,   553,     3,  -966,  -966,  -966,
+    -966,   522,   528,   214,   599,   581,   663,   584,   585,   589,
+     565,  -966,  -966,   622,   670,   593,   672,   691,   692,   676,
+     678,   679,   680,   683,   685,   687,   688,   690,   693,   586,
+    -966,   588,   582,  -966,    73,  -966,  -966,  -966,  -966,   615,
+     590,  -966,    74,   594,   596,   597,   604,   609,    12,  -966,
+    -966,  -966,  -966,  -966,   698,   602,  -966,   608,   613,  -966,
+     616,    39,  -966,  -966,  -966,  -966,   621,   623,   624,  -966,
+     629,   490,   630,   631,   632,   635,   638,   639,   640,   644,
+     645,   648,   649,   650,   651,   653,  -966,  -966,   716,   759,
+     214,   643,   777,   214,   781,   214,   765,   785,   788,   790,
+     214,   792,   792,   675,  -966,  -966,   776,    64,   778,   702,
+     783,   784,   677,   787,   791,   805,   796,   798,   214,   803,
+     807,   684,  -966,   810,   812,   686,  -966,   708,  -966,   815,
+     817,   714,  -966,   715,   719,   720,   721,   724,   725,   730,
+     731,   733,   734,   735,   736,   739,   740,   741,   742,   743,
+     744,   745,   746,   747,   748,   749,   750,   751,   766,   681,
+     756,   757,   758,   760,   761,   762,   763,   764,   770,   772,
+     773,   779,   780,   786,   789,   795,   797,   799,   800,   801,
+    -966,  -966,   865,   811,   774,   871,   889,   887,   896,   897,
+     802,  -966,   902,   904,   804,  -966,  -966,   909,   911,   806,
+     929,   808,  -966,   813,   814,  -966,  -966,   913,   916,   816,
+    -966,  -966,   917,   838,   818,   921,   924,   819,   925,   843,
+     926,   930,   823,  -966,  -966,   931,   932,   933,   828,  -966,
+     829,   830,   831,   832,   833,   834,   835,   836,   837,  -966,
+     839,   840,   841,   842,   844,   845,   846,   847,   848,   849,
+     850,   851,   852,   853,   854,   855,  -966,  -966,   944,   856,
+     857,  -966,   858,  -966,    88,  -966,   949,   962,   966,   967,
+     862,  -966,   863,  -966,  -966,   971,   861,   972,   867,  -966,
+    -966,  -966,  -966,  -966,   214,   214,   214,   214,   214,   214,
+     214,  -966,  -966,  -966,  -966,  -966,  -966,  -966,  -966,  -966,
+    -966,  -966,  -966,  -966,  -966,  -966,  -966,   868,   869,   870,
+     -35,   872,   873,   874,   875,   876,   877,   878,   879,   880,
+     273,   881,   882,  -966,   883,   884,   885,   886,   888,   890,
+     891,     6,   892,   893,   894,   895,   898,   899,   900,   901,
+    -966,   903,   905,  -966,  -966,   906,   907,  -966,  -966,  -966,
+    -966,  -966,  -966,  -966,  -966,  -966,  -966,  -966,  -966,  -966,
+    -966,  -966,  -966,  -966,  -966,  -966,  -966,  -966,  -966,  -966,
+    -966,  -966,  -966,  -966,  -966,  -966,  -966,  -966,  -966,  -966,
+    -966,  -966,  -966,  -966,  -966,  -966,  -966,  -966,  -966,  -966,
+    -966,  -966,  -966,  -966,  -209,  -966,  -966,  -966,  -966,  -966,
+    -966,  -966,  -966,  -966,  -966,  -966,  -966,  -966,  -966,  -966,
+    -966,  -966,  -966,  -966,  -966,  -966,  -966,  -966,  -966,  -194,
+    -966,  -966,  -966,  -966,  -966,  -966,  -966,  -966,  -966,  -966,
+    -966,  -966,  -966,  -966,  -966,  -966,  -966,  -966,  -966,  -966,
+    -966,   908,   910,   432,   912,   914,   915,   918,   919,  -966,
+     920,   922,  -966,   927,   928,   -30,   935,   491,  -966,  -966,
+    -966,  -966,   934,   936,  -966,   937,   938,   422,   939,   940,
+     727,   941,   942,   943,   945,  -966,   946,   947,   948,  -966,
+    -966,  -966,  -966,  -966,  -966,  -966,  -966,  -966,  -966,  -966,
+    -966,  -966,  -966,  -966,  -966,  -966,  -966,  -966,  -966,  -966,
+    -966,  -966,  -966,  -966,  -966,   950,   537,  -966,  -966,   951,
+     952,   953,  -966,    32,  -966,  -966,  -966,  -966,   954,   957,
+     958,   959,  -966,  -966,   960,   636,   961,  -966,  -966,  -966,
+    -966,  -966,  -966,  -966,  -966,  -966,  -966,  -966,  -966,  -966,
+    -187,  -966,  -966,  -966,  -966,  -966,  -966,  -966,  -966,  -966,
+    -966,   792,   792,   792,  -966,  -966,  -966,  -966,  -966,  -966,
+    -966,  -966,  -966,  -966,  -966,  -966,  -966,  -177,  -966,  -966,
+    -966,  -966,  -966,  -966,  -966,  -966,  -966,  -966,  -966,  -966,
+    -966,  -966,   766,  -966,   681,  -966,  -966,  -966,  -966,  -966,
+    -966,  -966,  -966,  -966,  -966,  -966,  -172,  -966,  -966,  -966,
+    -966,  -966,  -966,  -966,  -966,  -966,  -966,  -966,  -966,  -966,
+    -170,  -966,   994,   929,   963,  -966,  -966,  -966,  -966,  -966,
+    -966,   964,  -966,   965,   968,  -966,  -966,   969,   973,  -966,
+    -966,   974,  -966,  -966,  -966,  -966,  -966,  -966,  -966,  -966,
+    -966,  -966,  -966,  -966,  -162,  -966,  -966,  -966,  -966,  -966,
+    -966,  -966,  -966,  -966,  -966,  -966,  -966,  -966,  -966,  -966,
+    -966,  -966,  -966,  -966,  -966,  -966,  -966,  -966,  -966,  -966,
+    -966,  -157,  -966,  -966,  -966,  -966,  -966,  -966,  -966,  -966,
+    -966,  -966,  -966,  -966,  -966,  -966,  -966,  -966,  -966,  -966,
+    -966,  -141,  -966,  -966,   993,   -78,   977,   975,  -966,  -966,
+    -966,  -966,  -966,  -966,  -966,  -966,  -966,  -966,  -966,  -966,
+    -966,  -966,  -966,  -966,  -136,  -966,  -966,  -966,   -35,  -966,
+    -966,  -966,  -966,     6,  -966,  -966,  -966,   432,  -966,   -30,
+    -966,  -966,  -966,   989,   995,   996,  1000,  1004,  1009,  -966,
+     422,  -966,   727,  -966,   537,   976,   981,   982,   417,  -966,
+    -966,   636,  -966,  -966,  -966,  -966,  -966,  -966,  -966,  -966,
+    -966,  -966,  -966,  -966,  -966,  -966,  -966,  -966,  -966,  -966,
+    -966,  -966,  -966,  -966,  -966,  -966,   -69,  -966,  -966,  -966,
+     417,  -966
 };
 
-  /* YYDEFACT[STATE-NUM] -- Default reduction number in state STATE-NUM.
-     Performed when YYTABLE does not specify something else to do.  Zero
-     means the default is an error.  */
-static const yytype_uint16 yydefact[] =
+/* YYDEFACT[STATE-NUM] -- Default reduction number in state STATE-NUM.
+   Performed when YYTABLE does not specify something else to do.  Zero
+   means the default is an error.  */
+static const yytype_int16 yydefact[] =
 {
        2,     0,     1,     0,     0,     0,   233,   393,   443,     0,
      458,     0,   297,   434,   273,     0,    98,   150,   330,     0,
@@ -1419,100 +2056,101 @@ static const yytype_uint16 yydefact[] =
       27,     0,     0,     0,     0,     0,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,    90,    91,
-      93,    92,   629,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,     0,     0,     0,   613,
-     628,   627,   616,   617,   618,   619,   620,   621,   622,   623,
-     624,   614,   615,   625,   626,     0,     0,     0,   456,     0,
-       0,   454,   455,     0,   515,     0,     0,     0,     0,     0,
+      93,    92,   633,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,   617,
+     632,   631,   620,   621,   622,   623,   624,   625,   626,   627,
+     628,   618,   619,   629,   630,     0,     0,     0,   456,     0,
+       0,   454,   455,     0,   517,     0,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-     582,   555,     0,     0,     0,     0,     0,     0,     0,     0,
+     584,   557,     0,     0,     0,     0,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,   469,   470,   471,   513,   477,   514,   508,   509,   510,
-     511,   481,   472,   473,   474,   475,   476,   478,   479,   480,
-     482,   483,   512,   487,   488,   489,   490,   486,   485,   491,
-     498,   499,   492,   493,   494,   484,   496,   506,   507,   504,
-     505,   497,   495,   502,   503,   500,   501,     0,     0,     0,
-       0,     0,     0,     0,    46,    47,    48,     0,     0,     0,
-     657,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,   647,   648,   649,   650,   651,   652,   653,   655,   654,
-     656,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,     0,     0,     0,    54,
-      67,    65,    63,    68,    69,    70,    64,    55,    66,    57,
-      58,    59,    60,    61,    62,    56,     0,     0,     0,     0,
-     122,   123,   124,     0,     0,   345,     0,     0,   343,   344,
-       0,    94,     0,     0,     0,     0,    89,     0,     0,     0,
+       0,     0,     0,   469,   470,   471,   515,   477,   516,   510,
+     511,   512,   513,   481,   472,   473,   474,   475,   476,   478,
+     479,   480,   482,   483,   514,   487,   488,   489,   490,   486,
+     485,   491,   498,   499,   492,   493,   494,   484,   496,   508,
+     509,   506,   507,   497,   495,   504,   505,   500,   501,   502,
+     503,     0,     0,     0,     0,     0,     0,     0,    46,    47,
+      48,     0,     0,     0,   661,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,   651,   652,   653,   654,   655,
+     656,   657,   659,   658,   660,     0,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,   612,     0,     0,     0,     0,   267,     0,
+       0,     0,     0,    54,    67,    65,    63,    68,    69,    70,
+      64,    55,    66,    57,    58,    59,    60,    61,    62,    56,
+       0,     0,     0,     0,   122,   123,   124,     0,     0,   345,
+       0,     0,   343,   344,     0,    94,     0,     0,     0,     0,
+      89,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,   616,     0,     0,
+       0,     0,   267,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,   236,   237,   240,   242,   243,
+     244,   245,   246,   247,   248,   238,   239,   241,   249,   250,
+     251,     0,     0,     0,     0,     0,     0,     0,   423,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,   396,   397,
+     398,   399,   400,   401,   402,   403,   405,   404,   407,   411,
+     408,   409,   410,   406,   449,     0,     0,     0,   446,   447,
+     448,     0,     0,   453,   464,     0,     0,     0,   461,   462,
+     463,     0,     0,     0,     0,     0,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,   236,   237,   240,   242,   243,   244,   245,   246,   247,
-     248,   238,   239,   241,   249,   250,   251,     0,     0,     0,
-       0,     0,     0,     0,   423,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,   396,   397,   398,   399,   400,   401,
-     402,   403,   405,   404,   407,   411,   408,   409,   410,   406,
-     449,     0,     0,     0,   446,   447,   448,     0,     0,   453,
-     464,     0,     0,     0,   461,   462,   463,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,   468,
+       0,     0,     0,   314,     0,     0,     0,     0,     0,     0,
+     300,   301,   302,   303,   308,   304,   305,   306,   307,   440,
+       0,     0,     0,   437,   438,   439,     0,     0,     0,   275,
+       0,   285,     0,   283,   284,   286,   287,    49,     0,     0,
+       0,    45,     0,     0,     0,     0,   101,   102,   103,     0,
+       0,     0,   200,     0,     0,   173,     0,     0,     0,     0,
+       0,   153,   154,   155,   156,   157,   160,   161,   162,   159,
+     158,   163,     0,     0,     0,     0,     0,   333,   334,   335,
+     336,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,   650,    71,     0,     0,     0,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+      53,     0,     0,   379,     0,   374,   375,   376,   125,     0,
+       0,   121,     0,     0,     0,     0,     0,     0,     0,   110,
+     111,   113,   112,   114,     0,     0,   342,     0,     0,   357,
+       0,     0,   350,   351,   352,   353,     0,     0,     0,    88,
+       0,    28,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,   615,   252,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,   468,     0,     0,     0,   314,     0,     0,
-       0,     0,     0,     0,   300,   301,   302,   303,   308,   304,
-     305,   306,   307,   440,     0,     0,     0,   437,   438,   439,
-       0,     0,     0,   275,     0,   285,     0,   283,   284,   286,
-     287,    49,     0,     0,     0,    45,     0,     0,     0,     0,
-     101,   102,   103,     0,     0,     0,   200,     0,     0,   173,
-       0,     0,     0,     0,     0,   153,   154,   155,   156,   157,
-     160,   161,   162,   159,   158,   163,     0,     0,     0,     0,
-       0,   333,   334,   335,   336,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,   646,    71,     0,     0,     0,
+       0,     0,     0,     0,   235,   412,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,    53,     0,     0,   379,     0,   374,
-     375,   376,   125,     0,     0,   121,     0,     0,     0,     0,
-       0,     0,     0,   110,   111,   113,   112,   114,     0,     0,
-     342,     0,     0,   357,     0,     0,   350,   351,   352,   353,
-       0,     0,     0,    88,     0,    28,     0,     0,     0,     0,
+       0,     0,   395,     0,     0,     0,   445,     0,   452,     0,
+       0,     0,   460,     0,     0,     0,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-     611,   252,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,     0,     0,   235,   412,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,   395,     0,     0,     0,
-     445,     0,   452,     0,     0,     0,   460,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+     467,   309,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,   299,     0,     0,     0,   436,   288,     0,     0,     0,
+       0,     0,   282,     0,     0,    44,   104,     0,     0,     0,
+     100,   164,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,   152,   337,     0,     0,     0,     0,   332,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,   649,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,    52,   377,     0,     0,
+       0,   373,     0,   120,     0,   115,     0,     0,     0,     0,
+       0,   109,     0,   341,   354,     0,     0,     0,     0,   349,
+      97,    96,    95,   647,    28,    28,    28,    28,    28,    28,
+      28,    30,    29,   648,   635,   634,   636,   637,   638,   639,
+     640,   641,   642,   645,   646,   643,   644,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,   467,   309,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,   299,     0,     0,     0,   436,   288,     0,
-       0,     0,     0,     0,   282,     0,     0,    44,   104,     0,
-       0,     0,   100,   164,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,   152,   337,     0,     0,     0,
-       0,   332,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,   645,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,     0,     0,    52,   377,
-       0,     0,     0,   373,     0,   120,     0,   115,     0,     0,
-       0,     0,     0,   109,     0,   341,   354,     0,     0,     0,
-       0,   349,    97,    96,    95,   643,    28,    28,    28,    28,
-      28,    28,    28,    30,    29,   644,   631,   630,   632,   633,
-     634,   635,   636,   637,   638,   641,   642,   639,   640,     0,
+      38,     0,     0,   234,     0,     0,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,    38,     0,     0,   234,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,   394,     0,     0,   444,   457,     0,     0,   459,
-     527,   531,   516,   517,   544,   520,   609,   610,   552,   521,
-     522,   549,   526,   534,   525,   523,   524,   530,   529,   528,
-     550,   518,   607,   608,   548,   606,   592,   586,   602,   587,
-     588,   589,   597,   605,   590,   599,   603,   593,   604,   594,
-     598,   591,   601,   596,   595,   600,     0,   585,   581,   564,
-     565,   566,   559,   577,   560,   561,   562,   572,   580,   563,
-     574,   578,   568,   579,   569,   573,   567,   576,   571,   570,
-     575,     0,   558,   545,   543,   546,   551,   547,   536,   542,
-     541,   537,   538,   539,   540,   553,   554,   533,   532,   535,
-     519,     0,     0,     0,     0,     0,     0,     0,     0,   298,
+     394,     0,     0,   444,   457,     0,     0,   459,   529,   533,
+     518,   519,   546,   522,   611,   612,   554,   523,   524,   551,
+     528,   536,   527,   525,   526,   532,   531,   530,   552,   520,
+     609,   610,   550,   608,   594,   588,   604,   589,   590,   591,
+     599,   607,   592,   601,   605,   595,   606,   596,   600,   593,
+     603,   598,   597,   602,     0,   587,   583,   566,   567,   568,
+     561,   579,   562,   563,   564,   574,   582,   565,   576,   580,
+     570,   581,   571,   575,   569,   578,   573,   572,   577,     0,
+     560,   547,   545,   548,   613,   614,   553,   549,   538,   544,
+     543,   539,   540,   541,   542,   555,   556,   535,   534,   537,
+     521,     0,     0,     0,     0,     0,     0,     0,     0,   298,
        0,     0,   435,     0,     0,     0,   293,   289,   292,   274,
       50,    51,     0,     0,    99,     0,     0,     0,     0,     0,
        0,     0,     0,     0,     0,   151,     0,     0,     0,   331,
-     661,   658,   659,   660,   665,   664,   666,   662,   663,    84,
+     665,   662,   663,   664,   669,   668,   670,   666,   667,    84,
       81,    87,    80,    85,    86,    79,    83,    82,    73,    72,
       75,    76,    74,    77,    78,     0,     0,   372,   126,     0,
        0,     0,   138,     0,   130,   131,   133,   132,     0,     0,
@@ -1522,7 +2160,7 @@ static const yytype_uint16 yydefact[] =
      254,    38,    38,    38,    40,    39,   260,   261,   418,   421,
      422,   432,   429,   414,   430,   427,   428,     0,   426,   431,
      413,   420,   417,   416,   415,   419,   433,   450,   451,   465,
-     466,   583,     0,   556,     0,   312,   313,   322,   318,   319,
+     466,   585,     0,   558,     0,   312,   313,   322,   318,   319,
      321,   326,   323,   324,   325,   320,     0,   317,   311,   329,
      328,   327,   310,   442,   441,   296,   295,   280,   281,   279,
        0,   278,     0,     0,     0,   105,   106,   172,   169,   220,
@@ -1536,7 +2174,7 @@ static const yytype_uint16 yydefact[] =
      387,     0,   382,   134,     0,     0,     0,     0,   129,   117,
      116,   118,   119,   355,   361,   367,   370,   363,   369,   364,
      368,   366,   362,   365,     0,   360,   356,   268,     0,    41,
-      42,    43,   424,     0,   584,   557,   315,     0,   276,     0,
+      42,    43,   424,     0,   586,   559,   315,     0,   276,     0,
      294,   291,   290,     0,     0,     0,     0,     0,     0,   201,
        0,   174,     0,   380,     0,     0,     0,     0,     0,   128,
      358,     0,   269,   425,   316,   277,   206,   229,   204,   228,
@@ -1545,557 +2183,557 @@ static const yytype_uint16 yydefact[] =
        0,   140
 };
 
-  /* YYPGOTO[NTERM-NUM].  */
+/* YYPGOTO[NTERM-NUM].  */
 static const yytype_int16 yypgoto[] =
 {
-   -1038, -1038, -1038,  -448,  -306, -1037,  -635, -1038, -1038,   977,
-   -1038, -1038, -1038, -1038,   851, -1038, -1038, -1038, -1038, -1038,
-   -1038, -1038, -1038, -1038, -1038, -1038, -1038, -1038, -1038, -1038,
-   -1038, -1038, -1038,  1043, -1038, -1038, -1038, -1038, -1038, -1038,
-     644, -1038, -1038, -1038, -1038, -1038,   565, -1038, -1038, -1038,
-   -1038, -1038, -1038,   859, -1038, -1038, -1038, -1038,   107, -1038,
-   -1038, -1038, -1038, -1038,  -181, -1038, -1038, -1038,   641, -1038,
-   -1038, -1038, -1038, -1038, -1038, -1038, -1038, -1038, -1038, -1038,
-    -119, -1038, -1038, -1038,  -112, -1038, -1038, -1038,   944, -1038,
-   -1038, -1038, -1038, -1038, -1038, -1038, -1038, -1038, -1038, -1038,
-   -1038, -1038, -1038, -1038, -1038, -1038,   -83, -1038, -1038, -1038,
-   -1038, -1038,   -87, -1038,   685, -1038, -1038, -1038,    41, -1038,
-   -1038, -1038, -1038, -1038,   710, -1038, -1038, -1038, -1038, -1038,
-   -1038, -1038,   -75, -1038, -1038, -1038, -1038, -1038, -1038,   653,
-   -1038, -1038, -1038, -1038, -1038,   964, -1038, -1038, -1038, -1038,
-     590, -1038, -1038, -1038, -1038, -1038,   -95, -1038, -1038, -1038,
-     633, -1038, -1038, -1038, -1038,   -85, -1038, -1038, -1038,   850,
-   -1038, -1038, -1038, -1038, -1038, -1038, -1038, -1038, -1038, -1038,
-   -1038, -1038,   -60, -1038, -1038, -1038, -1038, -1038, -1038, -1038,
-   -1038,   728, -1038, -1038, -1038, -1038, -1038,   812, -1038, -1038,
-   -1038, -1038,  1082, -1038, -1038, -1038, -1038,   813, -1038, -1038,
-   -1038, -1038,  1033, -1038, -1038, -1038, -1038, -1038, -1038, -1038,
-   -1038, -1038, -1038, -1038, -1038, -1038, -1038, -1038, -1038, -1038,
-   -1038, -1038, -1038, -1038, -1038, -1038, -1038, -1038, -1038, -1038,
-   -1038, -1038, -1038, -1038, -1038, -1038, -1038, -1038, -1038, -1038,
-   -1038, -1038, -1038, -1038, -1038,    92, -1038, -1038, -1038,    95,
-   -1038, -1038, -1038, -1038, -1038, -1038,  1110, -1038, -1038, -1038,
-   -1038, -1038, -1038, -1038, -1038, -1038, -1038, -1038, -1038, -1038,
-   -1038, -1038, -1038, -1038,   969, -1038, -1038, -1038, -1038, -1038,
-   -1038, -1038, -1038, -1038
+    -966,  -966,  -966,  -264,  -310,  -965,  -641,  -966,  -966,   955,
+    -966,  -966,  -966,  -966,   956,  -966,  -966,  -966,  -966,  -966,
+    -966,  -966,  -966,  -966,  -966,  -966,  -966,  -966,  -966,  -966,
+    -966,  -966,  -966,  1067,  -966,  -966,  -966,  -966,  -966,  -966,
+     641,  -966,  -966,  -966,  -966,  -966,   561,  -966,  -966,  -966,
+    -966,  -966,  -966,   864,  -966,  -966,  -966,  -966,    97,  -966,
+    -966,  -966,  -966,  -966,  -166,  -966,  -966,  -966,   642,  -966,
+    -966,  -966,  -966,  -966,  -966,  -966,  -966,  -966,  -966,  -966,
+    -124,  -966,  -966,  -966,  -121,  -966,  -966,  -966,   820,  -966,
+    -966,  -966,  -966,  -966,  -966,  -966,  -966,  -966,  -966,  -966,
+    -966,  -966,  -966,  -966,  -966,  -966,   -95,  -966,  -966,  -966,
+    -966,  -966,  -104,  -966,   674,  -966,  -966,  -966,    42,  -966,
+    -966,  -966,  -966,  -966,   699,  -966,  -966,  -966,  -966,  -966,
+    -966,  -966,   -90,  -966,  -966,  -966,  -966,  -966,  -966,   661,
+    -966,  -966,  -966,  -966,  -966,   978,  -966,  -966,  -966,  -966,
+     600,  -966,  -966,  -966,  -966,  -966,  -106,  -966,  -966,  -966,
+     612,  -966,  -966,  -966,  -966,   -86,  -966,  -966,  -966,   822,
+    -966,  -966,  -966,  -966,  -966,  -966,  -966,  -966,  -966,  -966,
+    -966,  -966,   -59,  -966,  -966,  -966,  -966,  -966,  -966,  -966,
+    -966,   718,  -966,  -966,  -966,  -966,  -966,   821,  -966,  -966,
+    -966,  -966,  1085,  -966,  -966,  -966,  -966,   809,  -966,  -966,
+    -966,  -966,  1038,  -966,  -966,  -966,  -966,  -966,  -966,  -966,
+    -966,  -966,  -966,  -966,  -966,  -966,  -966,  -966,  -966,  -966,
+    -966,  -966,  -966,  -966,  -966,  -966,  -966,  -966,  -966,  -966,
+    -966,  -966,  -966,  -966,  -966,  -966,  -966,  -966,  -966,  -966,
+    -966,  -966,  -966,  -966,  -966,    93,  -966,  -966,  -966,    98,
+    -966,  -966,  -966,  -966,  -966,  -966,  -966,  -966,  1121,  -966,
+    -966,  -966,  -966,  -966,  -966,  -966,  -966,  -966,  -966,  -966,
+    -966,  -966,  -966,  -966,  -966,  -966,   979,  -966,  -966,  -966,
+    -966,  -966,  -966,  -966,  -966,  -966
 };
 
-  /* YYDEFGOTO[NTERM-NUM].  */
+/* YYDEFGOTO[NTERM-NUM].  */
 static const yytype_int16 yydefgoto[] =
 {
-      -1,     1,    26,   823,   824,  1084,  1085,    27,   223,   224,
-     225,   226,    28,   268,   269,   270,   271,   272,   273,   274,
-     275,   276,   277,   278,   279,   280,   281,   282,   283,   284,
-     285,    29,    77,    78,    79,    80,    81,    30,    63,   499,
-     500,   501,   502,    31,    70,   582,   583,   584,   585,   586,
-     587,    32,   289,   290,   291,   292,   293,  1043,  1044,  1045,
-    1046,  1047,  1226,  1306,  1307,    33,    64,   514,   515,   516,
-     517,   518,   519,   520,   521,   522,   523,   524,   749,  1201,
-    1202,   525,   746,  1174,  1175,    34,    53,   340,   341,   342,
-     343,   344,   345,   346,   347,   348,   349,   350,   351,   352,
-     353,   354,   355,   356,   625,  1070,  1071,    35,    61,   485,
-     731,  1140,  1141,   486,   487,   488,  1144,   987,   988,   489,
-     490,    36,    59,   463,   464,   465,   466,   467,   468,   469,
-     716,  1126,  1127,   470,   471,   472,    37,    65,   530,   531,
-     532,   533,   534,    38,   297,   298,   299,    39,    72,   595,
-     596,   597,   598,   599,   808,  1244,  1245,    40,    68,   568,
-     569,   570,   571,   791,  1221,  1222,    41,    54,   373,   374,
-     375,   376,   377,   378,   379,   380,   381,   382,   383,   384,
-     646,  1097,  1098,   385,   386,   387,   388,   389,    42,    60,
-     476,   477,   478,   479,    43,    55,   393,   394,   395,   396,
-      44,   120,   121,   122,    45,    57,   403,   404,   405,   406,
-      46,   170,   171,   172,   173,   174,   175,   176,   177,   178,
-     179,   180,   181,   182,   183,   184,   185,   186,   187,   188,
-     189,   190,   191,   192,   193,   194,   195,   196,   197,   198,
-     199,   200,   201,   202,   203,   204,   205,   206,   207,   208,
-     209,   210,   211,   433,   951,   952,   212,   432,   926,   927,
-     213,   214,   215,   216,    47,    98,    99,   100,   101,   102,
-     103,   104,   105,   106,   107,   108,   109,   110,   111,   112,
-     113,   114,    48,   240,   241,   242,   243,   244,   245,   246,
-     247,   248,   249,   250
+       0,     1,    26,   831,   832,  1094,  1095,    27,   227,   228,
+     229,   230,    28,   272,   273,   274,   275,   276,   277,   278,
+     279,   280,   281,   282,   283,   284,   285,   286,   287,   288,
+     289,    29,    77,    78,    79,    80,    81,    30,    63,   505,
+     506,   507,   508,    31,    70,   588,   589,   590,   591,   592,
+     593,    32,   293,   294,   295,   296,   297,  1053,  1054,  1055,
+    1056,  1057,  1236,  1316,  1317,    33,    64,   520,   521,   522,
+     523,   524,   525,   526,   527,   528,   529,   530,   757,  1211,
+    1212,   531,   754,  1184,  1185,    34,    53,   344,   345,   346,
+     347,   348,   349,   350,   351,   352,   353,   354,   355,   356,
+     357,   358,   359,   360,   631,  1080,  1081,    35,    61,   491,
+     739,  1150,  1151,   492,   493,   494,  1154,   997,   998,   495,
+     496,    36,    59,   469,   470,   471,   472,   473,   474,   475,
+     724,  1136,  1137,   476,   477,   478,    37,    65,   536,   537,
+     538,   539,   540,    38,   301,   302,   303,    39,    72,   601,
+     602,   603,   604,   605,   816,  1254,  1255,    40,    68,   574,
+     575,   576,   577,   799,  1231,  1232,    41,    54,   377,   378,
+     379,   380,   381,   382,   383,   384,   385,   386,   387,   388,
+     652,  1107,  1108,   389,   390,   391,   392,   393,    42,    60,
+     482,   483,   484,   485,    43,    55,   397,   398,   399,   400,
+      44,   120,   121,   122,    45,    57,   407,   408,   409,   410,
+      46,   172,   173,   174,   175,   176,   177,   178,   179,   180,
+     181,   182,   183,   184,   185,   186,   187,   188,   189,   190,
+     191,   192,   193,   194,   195,   196,   197,   198,   199,   200,
+     201,   202,   203,   204,   205,   206,   207,   208,   209,   210,
+     211,   212,   213,   437,   959,   960,   214,   436,   934,   935,
+     215,   216,   217,   218,   219,   220,    47,    98,    99,   100,
+     101,   102,   103,   104,   105,   106,   107,   108,   109,   110,
+     111,   112,   113,   114,    48,   244,   245,   246,   247,   248,
+     249,   250,   251,   252,   253,   254
 };
 
-  /* YYTABLE[YYPACT[STATE-NUM]] -- What to do in state STATE-NUM.  If
-     positive, shift that token.  If negative, reduce the rule whose
-     number is the opposite.  If YYTABLE_NINF, syntax error.  */
+/* YYTABLE[YYPACT[STATE-NUM]] -- What to do in state STATE-NUM.  If
+   positive, shift that token.  If negative, reduce the rule whose
+   number is the opposite.  If YYTABLE_NINF, syntax error.  */
 static const yytype_int16 yytable[] =
 {
-     853,   854,   606,   220,   287,    73,   610,   611,   612,   295,
-     614,   615,   287,  1095,   230,   503,  1068,    51,  1137,   118,
-     390,   400,   852,  1039,  1111,   577,   480,   118,  1112,   390,
-      52,   591,  1113,   504,    74,    56,  1114,  1247,    58,   473,
-     526,  1248,    75,   124,  1249,  1250,  1251,   231,   125,   126,
-     473,   127,   128,    62,   505,    66,   129,   591,   232,   233,
-     234,    73,    67,   235,   236,   130,   131,   132,   237,   238,
-     239,   496,  1252,   400,   133,    69,  1253,   134,   135,   136,
-     251,   527,   506,   481,   119,   391,   137,   565,  1069,    71,
-      74,   482,   119,   483,   391,  1256,   115,   496,    75,  1257,
-    1039,   221,   668,   138,   670,   671,    76,   252,   674,   253,
-     296,  1276,   295,   116,   139,   681,   507,   140,   141,   565,
-     686,   528,   401,   222,  1040,   142,   578,    49,    50,   695,
-     696,   143,   592,   144,   508,   145,   454,   146,   254,   147,
-     148,   707,   708,   709,   117,    82,   392,   402,   255,   484,
-     149,   123,   497,  1138,   455,   392,   150,   151,   592,   152,
-     153,   154,    76,  1139,   155,   474,   529,   857,   858,   256,
-      83,    84,  -127,   257,   401,   456,   474,    85,   497,   220,
-    -127,   258,   217,    86,   259,   260,   579,  1258,   566,   156,
-     218,  1259,   157,   158,   159,   160,   161,   162,   163,   402,
-    1096,  1040,   219,   457,   580,   227,    87,    88,    89,    90,
-     509,  1269,  1041,   296,   261,  1270,   228,   229,   581,   324,
-     566,    91,    92,    93,   510,   288,   526,   511,    94,    95,
-      96,   764,    97,   288,   494,   325,   326,   512,   301,   498,
-     327,   513,  1042,   574,   302,   544,   754,   577,   164,   165,
-     593,   659,   665,   594,  1227,   458,   802,   733,   398,   166,
-     167,   475,   810,   459,   460,   498,   286,   527,   168,   294,
-     169,   760,   475,   300,   452,   480,   593,   221,   357,   594,
-     358,   726,   359,   461,   303,   304,   328,   307,   262,  1041,
-     263,   264,   305,   265,   266,   267,   360,  1271,   308,   222,
-     576,  1272,   741,   309,   329,   330,   567,   528,  1273,  1280,
-     331,   563,  1274,  1281,   332,   310,   311,   361,   841,  1042,
-     333,   844,   312,   846,  1081,  1082,  1083,   313,   851,   334,
-     335,   336,   481,  1117,   314,   362,   315,   363,   567,   316,
-     482,   337,   483,   589,   317,   364,   869,   503,   578,  1298,
-     792,  1299,   529,   318,   319,   320,  1309,   365,   462,  1118,
-    1310,   321,   338,   454,   397,   504,   407,   722,  1058,  1059,
-    1060,  1061,  1062,  1063,  1064,   408,   322,   409,   491,   366,
-     410,   455,   124,   411,   412,   413,   505,   125,   126,   414,
-     127,   128,  1119,   415,  1300,   129,   416,   417,   484,   418,
-     339,   367,   456,   419,   130,   131,   132,   420,   579,   421,
-     422,  1301,   604,   133,   506,   423,   134,   135,   136,   424,
-     368,  1120,  1121,   852,   425,   137,   580,  1122,   426,   427,
-     457,   428,   429,   430,   431,   369,   434,   435,   436,   437,
-     581,   438,   138,  1302,  1303,   439,  1149,   440,   507,   441,
-     637,   442,  1123,   139,   443,   444,   140,   141,   445,   546,
-     446,   447,  1150,  1151,   142,   448,   508,   449,   450,   451,
-     143,   492,   144,  1152,   145,   493,   146,   535,   147,   148,
-     600,   536,   458,   537,   538,   370,   539,   371,   372,   149,
-     459,   460,   540,   541,   542,   150,   151,   543,   152,   153,
-     154,  1304,   547,   155,   548,   549,   550,  1305,   601,   655,
-     461,   602,  1153,  1154,   551,  1155,   552,   553,   554,   555,
-     556,   557,  1124,   558,   559,   560,   561,   562,   156,   572,
-     573,   157,   158,   159,   160,   161,   162,   163,   588,   603,
-     605,  1156,   509,   357,   607,   358,   608,   359,  1125,  1157,
-     609,   613,   620,   616,   617,   618,   510,   251,   619,   511,
-     621,   360,   622,   661,   623,   624,   626,   627,   628,   512,
-     629,   630,  1158,   513,  1159,  1160,   631,   632,   633,   634,
-     667,   635,   361,   636,   252,   462,   253,   164,   165,   639,
-    1277,  1161,   669,   640,   641,   642,   662,   643,   166,   167,
-     362,   644,   363,   645,   647,   648,   649,   168,  1162,   169,
-     364,   650,   651,  1163,   652,   254,   324,  1164,   653,   654,
-     672,  1165,   365,   657,   658,   255,  1166,   663,   664,   673,
-    1167,   675,   325,   326,   676,   677,   678,   327,   679,   680,
-    1168,   682,  1169,  1170,   366,  1171,   256,   683,     2,     3,
-     257,   684,     4,   685,   687,   688,   689,   690,   258,   691,
-     694,   259,   260,  1172,     5,   692,   367,     6,   697,     7,
-     693,  1173,   698,   699,   700,   701,   702,     8,   703,   704,
-     705,   706,   710,   328,   711,   368,   714,   230,   712,   713,
-       9,   261,   735,   715,  1211,   717,    10,    11,   718,   719,
-     369,   329,   330,   736,   765,   762,   720,   331,   767,   763,
-     721,   332,   724,   725,   928,    12,   728,   333,   729,    13,
-     231,   929,   730,   930,   931,   732,   334,   335,   336,    14,
-     737,   232,   233,   234,   738,   739,   235,   236,   337,   740,
-     743,   237,   238,   239,   744,   745,   747,   748,    15,    16,
-     370,   750,   371,   372,  1212,   751,   752,   753,   756,   338,
-     766,   771,   757,   758,    17,   262,  1178,   263,   264,   759,
-     265,   266,   267,  1179,   768,  1180,  1181,   769,  1213,   772,
-     770,    18,   773,   775,   776,   774,   777,  1214,   778,   779,
-     780,   781,   782,    19,    20,   783,  1215,   339,   784,   788,
-     785,   789,   786,   787,   794,   905,   804,   790,   795,   796,
-     839,    21,   906,   797,   840,   798,   805,   843,   799,  1216,
-     800,  1217,  1218,   801,    22,   806,   807,   809,   812,    23,
-     932,   933,   934,   813,    24,   935,   936,    25,   937,   938,
-     814,   939,  1219,   940,   815,   825,   941,   826,   942,   943,
-    1220,   827,   842,   828,   944,   829,   830,   831,   945,  1234,
-     832,   833,   946,   947,   948,   834,   835,   836,   949,   837,
-     838,   845,   847,   950,   848,   849,   850,   852,   855,   856,
-     859,   861,  1182,  1183,  1184,   860,   863,  1185,  1186,   866,
-    1187,  1188,   872,  1189,   862,  1190,   864,   865,  1191,   867,
-    1192,  1193,   868,   870,   972,   871,  1194,   873,   874,   877,
-    1195,   996,   878,   875,  1196,  1197,  1198,   973,   876,  1235,
-    1199,   907,   908,   909,   879,  1200,   910,   911,   880,   912,
-     913,   971,   914,   881,   915,   974,   882,   916,   975,   917,
-     918,    82,   883,  1236,   884,   919,   885,   886,   887,   920,
-     888,   889,  1237,   921,   922,   923,   890,   891,   892,   924,
-     893,  1238,   605,   894,   925,   895,    83,    84,   896,   897,
-     898,   899,   900,    85,   901,   902,   903,   904,   976,    86,
-     953,   954,   955,   956,  1239,   977,  1240,  1241,   816,   817,
-     818,   819,   820,   821,   822,   978,   980,   981,   983,   957,
-     984,   958,    87,    88,    89,    90,   959,  1242,   986,   992,
-     985,   993,   960,   995,   998,  1243,   961,    91,    92,    93,
-     962,   963,   964,   965,    94,    95,    96,   966,    97,   967,
-     968,   969,   970,   979,   982,   989,   990,   999,   991,   994,
-    1001,  1002,  1003,   997,  1004,  1000,  1005,  1006,  1007,  1008,
-    1009,  1010,  1011,  1012,  1013,  1014,  1015,  1016,  1017,  1035,
-    1018,  1019,  1020,  1021,  1022,  1023,  1024,  1048,  1025,  1026,
-    1027,  1028,  1029,  1030,  1031,  1032,  1033,  1034,  1049,  1037,
-    1038,  1036,  1050,  1051,  1054,  1052,  1053,  1056,  1057,  1065,
-    1055,  1260,  1066,  1067,  1072,  1073,  1074,  1075,  1076,  1077,
-    1078,  1275,  1286,  1287,  1288,  1079,  1290,  1080,  1086,  1087,
-    1088,  1089,  1090,  1091,  1092,  1289,  1093,  1291,  1094,   564,
-     306,  1099,  1100,  1101,  1102,  1103,  1104,  1105,  1106,  1311,
-    1107,  1108,  1109,  1110,  1115,  1116,  1128,  1129,  1130,  1131,
-    1132,  1133,  1134,   742,  1135,  1136,  1142,   803,   575,  1145,
-    1228,  1143,  1146,  1293,  1224,   755,  1147,  1148,  1292,  1176,
-    1177,  1203,  1204,  1205,  1206,  1282,  1207,  1208,  1209,  1210,
-    1223,   734,  1285,   723,  1229,  1225,  1230,  1231,  1232,  1233,
-    1246,  1262,  1284,   761,  1261,   811,  1308,  1263,  1264,  1294,
-    1265,  1266,  1267,  1283,  1279,  1278,  1268,  1295,  1296,  1297,
-     495,   793,   399,   453,   727,   660,  1255,  1254,   323,   545,
-       0,     0,     0,     0,     0,     0,   666,     0,     0,     0,
-       0,     0,     0,   656,     0,     0,     0,     0,     0,     0,
+     861,   862,   612,   234,   532,    73,   616,   617,   618,    51,
+     620,   621,   299,   583,  1105,   299,   118,    52,   291,  1078,
+    1147,   404,    49,    50,  1121,   394,   118,   224,  1122,   502,
+      56,   479,   860,  1049,    74,   571,   235,   532,    58,  1123,
+     597,   404,    75,  1124,   460,   533,  1257,   236,   237,   238,
+    1258,    62,   239,   240,   597,   479,  1262,   241,   242,   243,
+    1263,  1266,   461,  1268,   124,  1267,    66,  1269,   394,   125,
+     126,  1279,   127,   128,   571,  1280,  1281,   129,   533,    67,
+    1282,   119,    69,   462,    71,   534,   130,   131,   132,  1049,
+     395,   119,  1283,  1079,   305,   133,  1284,  1290,   134,   135,
+     136,  1291,   674,   224,   676,   677,    76,   137,   680,   115,
+     503,   463,   116,   300,   584,   687,   300,   291,   534,   502,
+     692,   255,   405,  1286,   138,   225,  1259,  1260,  1261,   701,
+     702,   703,   535,   395,  1050,   139,   572,   117,   140,   141,
+     486,   598,   405,   715,   716,   717,   142,   226,   256,   406,
+     257,   123,   143,   396,   144,   598,   145,  1148,   146,   480,
+     147,   148,   221,   464,  1319,   535,    82,  1149,  1320,   406,
+     222,   149,   223,   465,   466,   572,   585,   150,   151,   258,
+     152,   153,   154,   480,   231,   155,   156,   157,  -127,   259,
+    1050,    83,    84,   467,   586,   509,   396,   487,    85,   504,
+     503,   225,   232,  1106,    86,   488,   233,   489,   587,   290,
+     260,   298,   158,   510,   261,   159,   160,   161,   162,   163,
+     164,   165,   262,   226,  1051,   263,   264,    87,    88,    89,
+      90,   328,   304,   772,   511,   306,   550,   768,   309,   865,
+     866,   292,    91,    92,    93,   595,   810,   329,   330,    94,
+      95,    96,   331,    97,  1052,   481,   573,   265,   665,   402,
+     500,   599,   512,   307,   600,   490,  1237,   308,   468,   311,
+     497,   166,   167,   818,   671,   599,    73,   730,   600,   481,
+    1051,   312,   168,   169,  1091,  1092,  1093,  -127,   734,   504,
+     361,   170,   362,   171,   363,   573,   513,   458,   332,   582,
+     606,   313,   314,   610,   315,    74,   316,   800,   364,   804,
+    1052,   317,   318,    75,   514,   486,   333,   334,   319,   320,
+     849,   321,   335,   852,   611,   854,   336,   322,   323,   365,
+     859,   266,   337,   267,   268,   324,   269,   270,   271,   325,
+     292,   338,   339,   340,   401,   411,   412,   366,   877,   367,
+     580,   413,   749,   414,   569,   341,   607,   368,   415,   416,
+     417,   418,   124,   419,   583,   420,   421,   125,   126,   369,
+     127,   128,   487,   741,   422,   129,   342,    76,   423,   424,
+     488,   425,   489,   860,   130,   131,   132,   426,   427,   428,
+     509,   370,   515,   133,   429,   430,   134,   135,   136,   326,
+     431,   608,   432,   433,   434,   137,   516,   435,   510,   517,
+     438,   439,   440,   441,   343,   371,   442,   443,   444,   518,
+     445,   446,   138,   519,   447,   448,  1159,   449,   762,   511,
+     552,   450,   451,   139,   372,   452,   140,   141,   453,   255,
+     490,   454,  1160,  1161,   142,   455,   456,  1127,   457,   373,
+     143,   498,   144,  1162,   145,   499,   146,   512,   147,   148,
+     541,   542,   543,   544,   643,   584,   256,   545,   257,   149,
+     546,   547,   548,  1128,   549,   150,   151,   553,   152,   153,
+     154,   554,   555,   155,   156,   157,   460,   556,  1308,   557,
+    1309,   513,  1163,  1164,   558,  1165,   559,   258,   560,   374,
+     561,   375,   376,   562,   461,   563,  1129,   259,   564,   514,
+     158,   578,   565,   159,   160,   161,   162,   163,   164,   165,
+     566,  1166,   567,   661,   568,   462,   579,   585,   260,  1167,
+     594,   609,   261,  1310,   613,  1130,  1131,   614,   615,   619,
+     262,  1132,   626,   263,   264,   586,   622,   623,   627,   624,
+     625,   645,  1311,   463,  1168,   628,  1169,  1170,   629,   587,
+    1068,  1069,  1070,  1071,  1072,  1073,  1074,   630,  1133,   166,
+     167,   632,   633,  1171,   634,   265,   635,   636,   637,   638,
+     168,   169,   639,   640,  1312,  1313,   641,   515,   642,   170,
+    1172,   171,   646,   647,  1287,  1173,   648,   667,   649,  1174,
+     611,   516,   650,  1175,   517,   464,   651,   653,  1176,   654,
+    1221,   655,  1177,   656,   518,   465,   466,   657,   519,   361,
+     658,   362,  1178,   363,  1179,  1180,   659,  1181,   824,   825,
+     826,   827,   828,   829,   830,   467,   660,   364,  1134,   663,
+     664,   668,  1314,   669,   675,  1182,     2,     3,  1315,   266,
+       4,   267,   268,  1183,   269,   270,   271,   670,   365,   673,
+     678,   679,     5,   328,  1135,     6,   681,     7,   682,   683,
+     684,   685,  1222,   686,   688,     8,   366,   689,   367,   329,
+     330,   690,   691,   693,   331,   694,   368,   695,     9,   696,
+     697,   698,   699,   700,    10,    11,  1223,   704,   369,   705,
+     706,   707,   708,   709,   710,  1224,   711,   712,   713,  1244,
+     468,   714,   718,    12,  1225,   719,   722,    13,   723,   743,
+     370,   720,   721,   725,   936,   744,   773,    14,  1153,   770,
+     332,   937,   780,   938,   939,   771,   736,  1226,   726,  1227,
+    1228,   745,   727,   728,   371,   729,    15,    16,   333,   334,
+     732,   733,   737,   738,   335,   740,   746,   747,   336,   751,
+    1229,   748,    17,   372,   337,   752,   753,   755,  1230,   756,
+    1188,  1245,   758,   338,   339,   340,   759,  1189,   373,  1190,
+    1191,    18,   760,   761,   765,   764,   766,   341,   774,   767,
+     775,   776,   777,    19,    20,  1246,   778,   781,   779,   783,
+     782,   784,   785,   786,  1247,   787,   788,   789,   342,   913,
+     790,    21,   791,  1248,   792,   793,   914,   794,   798,   796,
+     795,   797,   802,   803,    22,   812,   847,   805,   374,    23,
+     375,   376,   806,   807,    24,   813,  1249,    25,  1250,  1251,
+     808,   814,   940,   941,   942,   809,   343,   943,   944,   815,
+     945,   946,   817,   947,   820,   948,   821,   822,   949,  1252,
+     950,   951,   823,   833,   834,   835,   952,  1253,   836,   848,
+     953,   837,   838,   839,   954,   955,   956,   840,   841,   850,
+     957,   842,   843,   844,   845,   958,   846,   851,  1192,  1193,
+    1194,   853,   855,  1195,  1196,   856,  1197,  1198,   857,  1199,
+     858,  1200,   860,   864,  1201,   867,  1202,  1203,   863,   868,
+     869,   870,  1204,   871,   872,   874,  1205,   880,   873,   883,
+    1206,  1207,  1208,   875,    82,   876,  1209,   915,   916,   917,
+     878,  1210,   918,   919,   879,   920,   921,   881,   922,   882,
+     923,   884,   885,   924,   886,   925,   926,   887,   888,    83,
+      84,   927,   889,   890,   891,   928,    85,   892,   893,   929,
+     930,   931,    86,   894,   895,   932,   896,   897,   898,   899,
+     933,   234,   900,   901,   902,   903,   904,   905,   906,   907,
+     908,   909,   910,   911,   912,    87,    88,    89,    90,   961,
+     962,   963,   981,   964,   965,   966,   967,   968,   984,   985,
+      91,    92,    93,   969,   235,   970,   971,    94,    95,    96,
+     983,    97,   972,   973,   986,   236,   237,   238,   982,   974,
+     239,   240,   975,   987,   988,   241,   242,   243,   976,   990,
+     977,   991,   978,   979,   980,   989,   993,   992,   994,   996,
+    1002,   999,   995,  1003,  1005,  1006,  1000,  1001,  1008,  1004,
+    1012,  1009,  1011,  1013,  1007,  1010,  1015,  1014,  1016,  1017,
+    1018,  1019,  1020,  1021,  1022,  1023,  1024,  1025,  1026,  1027,
+    1028,  1045,  1029,  1030,  1031,  1032,  1058,  1033,  1034,  1035,
+    1036,  1037,  1038,  1039,  1040,  1041,  1042,  1043,  1044,  1059,
+    1047,  1048,  1046,  1060,  1061,  1062,  1063,  1065,  1064,  1066,
+    1067,  1075,  1076,  1077,  1270,  1082,  1083,  1084,  1085,  1086,
+    1087,  1088,  1089,  1090,  1096,  1097,  1098,  1099,  1100,  1101,
+    1285,  1102,  1296,  1103,  1104,  1109,  1110,  1111,  1112,  1298,
+    1297,  1113,  1114,  1115,  1116,  1299,  1117,  1300,  1118,  1119,
+    1120,  1125,  1301,  1126,   310,  1138,   750,  1139,  1140,   811,
+    1238,  1141,  1142,  1143,  1321,  1144,  1152,   581,  1303,  1302,
+    1145,  1146,   763,  1292,   644,  1295,   742,  1155,   731,  1156,
+    1157,  1158,  1186,  1187,  1213,  1214,  1215,  1294,  1216,  1217,
+    1218,  1219,   501,  1220,  1233,  1318,   801,  1239,  1234,  1235,
+    1240,  1241,  1242,  1243,  1256,  1271,  1272,   769,  1304,   662,
+     735,   819,  1273,  1274,  1293,   403,  1275,  1276,  1289,  1305,
+     459,  1277,  1278,  1288,  1306,  1307,   672,  1265,   666,   327,
+    1264,     0,     0,   551,     0,     0,     0,     0,   570,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,   590,     0,     0,     0,     0,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,   638
+       0,     0,     0,     0,     0,     0,     0,     0,     0,   596
 };
 
 static const yytype_int16 yycheck[] =
 {
-     635,   636,   308,     1,     1,     1,   312,   313,   314,     1,
-     316,   317,     1,     8,     1,     1,    54,   233,    50,     1,
-       1,     1,   110,     1,   231,     1,     1,     1,   235,     1,
-     233,     1,   231,    19,    30,   233,   235,   231,   233,     1,
-       1,   235,    38,     1,  1081,  1082,  1083,    34,     6,     7,
-       1,     9,    10,   233,    40,   233,    14,     1,    45,    46,
-      47,     1,   233,    50,    51,    23,    24,    25,    55,    56,
-      57,     1,   231,     1,    32,   233,   235,    35,    36,    37,
-       1,    42,    68,    58,    66,    66,    44,     1,   126,   233,
-      30,    66,    66,    68,    66,   231,   233,     1,    38,   235,
-       1,    99,   408,    61,   410,   411,   102,    28,   414,    30,
-     102,   199,     1,   233,    72,   421,   102,    75,    76,     1,
-     426,    82,   102,   121,   102,    83,   102,   231,   232,   435,
-     436,    89,   102,    91,   120,    93,     1,    95,    59,    97,
-      98,   447,   448,   449,   233,     1,   127,   127,    69,   124,
-     108,   233,    82,   185,    19,   127,   114,   115,   102,   117,
-     118,   119,   102,   195,   122,   127,   127,   173,   174,    90,
-      26,    27,   169,    94,   102,    40,   127,    33,    82,     1,
-     169,   102,   233,    39,   105,   106,   162,   231,   102,   147,
-     233,   235,   150,   151,   152,   153,   154,   155,   156,   127,
-     195,   102,   233,    68,   180,   233,    62,    63,    64,    65,
-     196,   231,   190,   102,   135,   235,   233,   233,   194,     1,
-     102,    77,    78,    79,   210,   222,     1,   213,    84,    85,
-      86,   537,    88,   222,   232,    17,    18,   223,   231,   169,
-      22,   227,   220,   232,   234,   232,   232,     1,   206,   207,
-     220,   232,   232,   223,   232,   120,   232,   232,   232,   217,
-     218,   223,   232,   128,   129,   169,   233,    42,   226,   233,
-     228,   232,   223,   233,   232,     1,   220,    99,     1,   223,
-       3,   232,     5,   148,   234,   234,    68,   234,   209,   190,
-     211,   212,   232,   214,   215,   216,    19,   231,   234,   121,
-     169,   235,   232,   234,    86,    87,   220,    82,   231,   231,
-      92,   232,   235,   235,    96,   234,   234,    40,   624,   220,
-     102,   627,   234,   629,    11,    12,    13,   234,   634,   111,
-     112,   113,    58,    15,   234,    58,   234,    60,   220,   234,
-      66,   123,    68,   232,   234,    68,   652,     1,   102,    71,
-     232,    73,   127,   234,   234,   234,   231,    80,   223,    41,
-     235,   234,   144,     1,   234,    19,   234,   232,   816,   817,
-     818,   819,   820,   821,   822,   234,   232,   234,   231,   102,
-     234,    19,     1,   234,   234,   234,    40,     6,     7,   234,
-       9,    10,    74,   234,   116,    14,   234,   234,   124,   234,
-     182,   124,    40,   234,    23,    24,    25,   234,   162,   234,
-     234,   133,   110,    32,    68,   234,    35,    36,    37,   234,
-     143,   103,   104,   110,   234,    44,   180,   109,   234,   234,
-      68,   234,   234,   234,   234,   158,   234,   234,   234,   234,
-     194,   234,    61,   165,   166,   234,     4,   234,   102,   234,
-     232,   234,   134,    72,   234,   234,    75,    76,   234,   231,
-     234,   234,    20,    21,    83,   234,   120,   234,   234,   234,
-      89,   234,    91,    31,    93,   234,    95,   234,    97,    98,
-     125,   234,   120,   234,   234,   208,   234,   210,   211,   108,
-     128,   129,   234,   234,   234,   114,   115,   234,   117,   118,
-     119,   223,   234,   122,   234,   234,   234,   229,   125,   232,
-     148,   125,    70,    71,   234,    73,   234,   234,   234,   234,
-     234,   234,   204,   234,   234,   234,   234,   234,   147,   231,
-     234,   150,   151,   152,   153,   154,   155,   156,   234,   231,
-     110,    99,   196,     1,   205,     3,   205,     5,   230,   107,
-     110,   110,   231,   110,   110,   110,   210,     1,   110,   213,
-     231,    19,   234,   125,   234,   234,   234,   234,   234,   223,
-     234,   234,   130,   227,   132,   133,   234,   234,   234,   234,
-     205,   234,    40,   234,    28,   223,    30,   206,   207,   231,
-    1225,   149,   110,   234,   234,   234,   231,   234,   217,   218,
-      58,   234,    60,   234,   234,   234,   234,   226,   166,   228,
-      68,   234,   234,   171,   234,    59,     1,   175,   234,   234,
-     205,   179,    80,   234,   234,    69,   184,   234,   234,   110,
-     188,   205,    17,    18,   110,   110,   110,    22,   205,   205,
-     198,   110,   200,   201,   102,   203,    90,   110,     0,     1,
-      94,   110,     4,   110,   110,   110,   110,   110,   102,   205,
-     205,   105,   106,   221,    16,   234,   124,    19,   205,    21,
-     234,   229,   205,   205,   205,   205,   205,    29,   205,   205,
-     205,   110,   205,    68,   110,   143,   234,     1,   231,   231,
-      42,   135,   125,   234,    73,   234,    48,    49,   234,   234,
-     158,    86,    87,   125,   125,   205,   234,    92,   125,   205,
-     234,    96,   234,   234,    43,    67,   231,   102,   234,    71,
-      34,    50,   234,    52,    53,   234,   111,   112,   113,    81,
-     231,    45,    46,    47,   231,   234,    50,    51,   123,   234,
-     231,    55,    56,    57,   234,   234,   234,   234,   100,   101,
-     208,   234,   210,   211,   133,   234,   234,   234,   231,   144,
-     205,   231,   234,   234,   116,   209,    43,   211,   212,   234,
-     214,   215,   216,    50,   205,    52,    53,   205,   157,   110,
-     205,   133,   125,   125,   110,   205,   110,   166,   125,   125,
-     125,   125,   125,   145,   146,   125,   175,   182,   125,   231,
-     125,   231,   125,   125,   205,    43,   125,   234,   231,   233,
-     110,   163,    50,   231,   110,   234,   231,   110,   234,   198,
-     234,   200,   201,   234,   176,   231,   234,   234,   231,   181,
-     159,   160,   161,   231,   186,   164,   165,   189,   167,   168,
-     231,   170,   221,   172,   231,   231,   175,   231,   177,   178,
-     229,   231,   234,   231,   183,   231,   231,   231,   187,    73,
-     231,   231,   191,   192,   193,   231,   231,   231,   197,   231,
-     231,   110,   125,   202,   110,   110,   110,   110,   231,   125,
-     125,   125,   159,   160,   161,   205,   234,   164,   165,   110,
-     167,   168,   231,   170,   125,   172,   125,   125,   175,   125,
-     177,   178,   125,   125,   205,   125,   183,   125,   125,   125,
-     187,   205,   125,   231,   191,   192,   193,   234,   231,   133,
-     197,   159,   160,   161,   231,   202,   164,   165,   231,   167,
-     168,   125,   170,   231,   172,   125,   231,   175,   110,   177,
-     178,     1,   231,   157,   231,   183,   231,   231,   231,   187,
-     231,   231,   166,   191,   192,   193,   231,   231,   231,   197,
-     231,   175,   110,   231,   202,   231,    26,    27,   231,   231,
-     231,   231,   231,    33,   231,   231,   231,   231,   125,    39,
-     231,   231,   231,   231,   198,   125,   200,   201,   136,   137,
-     138,   139,   140,   141,   142,   125,   125,   125,   125,   231,
-     125,   231,    62,    63,    64,    65,   231,   221,   110,   125,
-     234,   125,   231,   125,   125,   229,   231,    77,    78,    79,
-     231,   231,   231,   231,    84,    85,    86,   231,    88,   231,
-     231,   231,   231,   231,   231,   231,   231,   125,   231,   231,
-     125,   205,   125,   234,   125,   234,   231,   125,   125,   125,
-     231,   231,   231,   231,   231,   231,   231,   231,   231,   125,
-     231,   231,   231,   231,   231,   231,   231,   125,   231,   231,
-     231,   231,   231,   231,   231,   231,   231,   231,   125,   231,
-     231,   234,   125,   125,   125,   231,   231,   125,   231,   231,
-     234,   110,   231,   231,   231,   231,   231,   231,   231,   231,
-     231,   125,   131,   133,   131,   231,   131,   231,   231,   231,
-     231,   231,   231,   231,   231,   133,   231,   131,   231,   268,
-      77,   231,   231,   231,   231,   231,   231,   231,   231,  1310,
-     231,   231,   231,   231,   231,   231,   231,   231,   231,   231,
-     231,   231,   231,   499,   231,   231,   219,   582,   289,   231,
-    1043,   235,   231,  1272,   234,   514,   231,   231,  1270,   231,
-     231,   231,   231,   231,   231,  1248,   231,   231,   231,   231,
-     231,   486,  1259,   463,   231,   234,   231,   231,   231,   231,
-     231,   231,  1257,   530,  1143,   595,  1281,   236,   236,  1274,
-     236,   236,   236,  1253,   231,   234,   236,   231,   231,   231,
-     223,   568,   120,   170,   476,   393,  1114,  1112,    98,   240,
-      -1,    -1,    -1,    -1,    -1,    -1,   403,    -1,    -1,    -1,
-      -1,    -1,    -1,   373,    -1,    -1,    -1,    -1,    -1,    -1,
+     641,   642,   312,     1,     1,     1,   316,   317,   318,   235,
+     320,   321,     1,     1,     8,     1,     1,   235,     1,    54,
+      50,     1,   233,   234,   233,     1,     1,     1,   237,     1,
+     235,     1,   110,     1,    30,     1,    34,     1,   235,   233,
+       1,     1,    38,   237,     1,    42,   233,    45,    46,    47,
+     237,   235,    50,    51,     1,     1,   233,    55,    56,    57,
+     237,   233,    19,   233,     1,   237,   235,   237,     1,     6,
+       7,   233,     9,    10,     1,   237,   233,    14,    42,   235,
+     237,    66,   235,    40,   235,    82,    23,    24,    25,     1,
+      66,    66,   233,   128,   233,    32,   237,   233,    35,    36,
+      37,   237,   412,     1,   414,   415,   102,    44,   418,   235,
+      82,    68,   235,   102,   102,   425,   102,     1,    82,     1,
+     430,     1,   102,   201,    61,    99,  1091,  1092,  1093,   439,
+     440,   441,   129,    66,   102,    72,   102,   235,    75,    76,
+       1,   102,   102,   453,   454,   455,    83,   121,    28,   129,
+      30,   235,    89,   129,    91,   102,    93,   187,    95,   129,
+      97,    98,   235,   120,   233,   129,     1,   197,   237,   129,
+     235,   108,   235,   130,   131,   102,   164,   114,   115,    59,
+     117,   118,   119,   129,   235,   122,   123,   124,   171,    69,
+     102,    26,    27,   150,   182,     1,   129,    58,    33,   171,
+      82,    99,   235,   197,    39,    66,   235,    68,   196,   235,
+      90,   235,   149,    19,    94,   152,   153,   154,   155,   156,
+     157,   158,   102,   121,   192,   105,   106,    62,    63,    64,
+      65,     1,   235,   543,    40,   236,   234,   234,   234,   175,
+     176,   224,    77,    78,    79,   234,   234,    17,    18,    84,
+      85,    86,    22,    88,   222,   225,   222,   137,   234,   234,
+     234,   222,    68,   236,   225,   126,   234,   236,   225,   236,
+     233,   208,   209,   234,   234,   222,     1,   234,   225,   225,
+     192,   236,   219,   220,    11,    12,    13,   171,   234,   171,
+       1,   228,     3,   230,     5,   222,   102,   234,    68,   171,
+     127,   236,   236,   110,   236,    30,   236,   234,    19,   235,
+     222,   236,   236,    38,   120,     1,    86,    87,   236,   236,
+     630,   236,    92,   633,   110,   635,    96,   236,   236,    40,
+     640,   211,   102,   213,   214,   236,   216,   217,   218,   236,
+     224,   111,   112,   113,   236,   236,   236,    58,   658,    60,
+     234,   236,   234,   236,   234,   125,   127,    68,   236,   236,
+     236,   236,     1,   236,     1,   236,   236,     6,     7,    80,
+       9,    10,    58,   234,   236,    14,   146,   102,   236,   236,
+      66,   236,    68,   110,    23,    24,    25,   236,   236,   236,
+       1,   102,   198,    32,   236,   236,    35,    36,    37,   234,
+     236,   127,   236,   236,   236,    44,   212,   236,    19,   215,
+     236,   236,   236,   236,   184,   126,   236,   236,   236,   225,
+     236,   236,    61,   229,   236,   236,     4,   236,   234,    40,
+     233,   236,   236,    72,   145,   236,    75,    76,   236,     1,
+     126,   236,    20,    21,    83,   236,   236,    15,   236,   160,
+      89,   236,    91,    31,    93,   236,    95,    68,    97,    98,
+     236,   236,   236,   236,   234,   102,    28,   236,    30,   108,
+     236,   236,   236,    41,   236,   114,   115,   236,   117,   118,
+     119,   236,   236,   122,   123,   124,     1,   236,    71,   236,
+      73,   102,    70,    71,   236,    73,   236,    59,   236,   210,
+     236,   212,   213,   236,    19,   236,    74,    69,   236,   120,
+     149,   233,   236,   152,   153,   154,   155,   156,   157,   158,
+     236,    99,   236,   234,   236,    40,   236,   164,    90,   107,
+     236,   233,    94,   116,   207,   103,   104,   207,   110,   110,
+     102,   109,   233,   105,   106,   182,   110,   110,   233,   110,
+     110,   233,   135,    68,   132,   236,   134,   135,   236,   196,
+     824,   825,   826,   827,   828,   829,   830,   236,   136,   208,
+     209,   236,   236,   151,   236,   137,   236,   236,   236,   236,
+     219,   220,   236,   236,   167,   168,   236,   198,   236,   228,
+     168,   230,   236,   236,  1235,   173,   236,   127,   236,   177,
+     110,   212,   236,   181,   215,   120,   236,   236,   186,   236,
+      73,   236,   190,   236,   225,   130,   131,   236,   229,     1,
+     236,     3,   200,     5,   202,   203,   236,   205,   138,   139,
+     140,   141,   142,   143,   144,   150,   236,    19,   206,   236,
+     236,   233,   225,   236,   110,   223,     0,     1,   231,   211,
+       4,   213,   214,   231,   216,   217,   218,   236,    40,   207,
+     207,   110,    16,     1,   232,    19,   207,    21,   110,   110,
+     110,   207,   135,   207,   110,    29,    58,   110,    60,    17,
+      18,   110,   110,   110,    22,   110,    68,   110,    42,   110,
+     207,   236,   236,   207,    48,    49,   159,   127,    80,   207,
+     207,   207,   207,   207,   207,   168,   207,   207,   207,    73,
+     225,   110,   207,    67,   177,   110,   236,    71,   236,   127,
+     102,   233,   233,   236,    43,   127,   127,    81,   237,   207,
+      68,    50,   110,    52,    53,   207,   233,   200,   236,   202,
+     203,   233,   236,   236,   126,   236,   100,   101,    86,    87,
+     236,   236,   236,   236,    92,   236,   233,   236,    96,   233,
+     223,   236,   116,   145,   102,   236,   236,   236,   231,   236,
+      43,   135,   236,   111,   112,   113,   236,    50,   160,    52,
+      53,   135,   236,   236,   236,   233,   236,   125,   207,   236,
+     127,   207,   207,   147,   148,   159,   207,   127,   233,   127,
+     207,   110,   110,   127,   168,   127,   127,   127,   146,    43,
+     127,   165,   127,   177,   127,   127,    50,   127,   236,   233,
+     127,   233,   207,   233,   178,   127,   110,   233,   210,   183,
+     212,   213,   236,   236,   188,   233,   200,   191,   202,   203,
+     236,   233,   161,   162,   163,   236,   184,   166,   167,   236,
+     169,   170,   236,   172,   233,   174,   233,   233,   177,   223,
+     179,   180,   233,   233,   233,   233,   185,   231,   233,   110,
+     189,   233,   233,   233,   193,   194,   195,   233,   233,   236,
+     199,   233,   233,   233,   233,   204,   233,   110,   161,   162,
+     163,   110,   127,   166,   167,   110,   169,   170,   110,   172,
+     110,   174,   110,   127,   177,   127,   179,   180,   233,   207,
+     127,   127,   185,   236,   127,   110,   189,   233,   127,   233,
+     193,   194,   195,   127,     1,   127,   199,   161,   162,   163,
+     127,   204,   166,   167,   127,   169,   170,   127,   172,   127,
+     174,   233,   127,   177,   127,   179,   180,   233,   233,    26,
+      27,   185,   233,   233,   233,   189,    33,   233,   233,   193,
+     194,   195,    39,   233,   233,   199,   233,   233,   233,   233,
+     204,     1,   233,   233,   233,   233,   233,   233,   233,   233,
+     233,   233,   233,   233,   233,    62,    63,    64,    65,   233,
+     233,   233,   127,   233,   233,   233,   233,   233,   127,   110,
+      77,    78,    79,   233,    34,   233,   233,    84,    85,    86,
+     236,    88,   233,   233,   127,    45,    46,    47,   207,   233,
+      50,    51,   233,   127,   127,    55,    56,    57,   233,   127,
+     233,   127,   233,   233,   233,   233,   127,   233,   127,   110,
+     127,   233,   236,   127,   127,   207,   233,   233,   127,   233,
+     207,   127,   127,   127,   236,   236,   233,   127,   127,   127,
+     127,   233,   233,   233,   233,   233,   233,   233,   233,   233,
+     233,   127,   233,   233,   233,   233,   127,   233,   233,   233,
+     233,   233,   233,   233,   233,   233,   233,   233,   233,   127,
+     233,   233,   236,   127,   127,   233,   233,   236,   127,   127,
+     233,   233,   233,   233,   110,   233,   233,   233,   233,   233,
+     233,   233,   233,   233,   233,   233,   233,   233,   233,   233,
+     127,   233,   133,   233,   233,   233,   233,   233,   233,   133,
+     135,   233,   233,   233,   233,   135,   233,   133,   233,   233,
+     233,   233,   133,   233,    77,   233,   505,   233,   233,   588,
+    1053,   233,   233,   233,  1320,   233,   221,   293,  1282,  1280,
+     233,   233,   520,  1258,   344,  1269,   492,   233,   469,   233,
+     233,   233,   233,   233,   233,   233,   233,  1267,   233,   233,
+     233,   233,   227,   233,   233,  1291,   574,   233,   236,   236,
+     233,   233,   233,   233,   233,  1153,   233,   536,  1284,   377,
+     482,   601,   238,   238,  1263,   120,   238,   238,   233,   233,
+     172,   238,   238,   236,   233,   233,   407,  1124,   397,    98,
+    1122,    -1,    -1,   244,    -1,    -1,    -1,    -1,   272,    -1,
       -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
       -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
       -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,   297,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
       -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,   340
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   301
 };
 
-  /* YYSTOS[STATE-NUM] -- The (internal number of the) accessing
-     symbol of state STATE-NUM.  */
-static const yytype_uint16 yystos[] =
-{
-       0,   238,     0,     1,     4,    16,    19,    21,    29,    42,
-      48,    49,    67,    71,    81,   100,   101,   116,   133,   145,
-     146,   163,   176,   181,   186,   189,   239,   244,   249,   268,
-     274,   280,   288,   302,   322,   344,   358,   373,   380,   384,
-     394,   403,   425,   431,   437,   441,   447,   501,   519,   231,
-     232,   233,   233,   323,   404,   432,   233,   442,   233,   359,
-     426,   345,   233,   275,   303,   374,   233,   233,   395,   233,
-     281,   233,   385,     1,    30,    38,   102,   269,   270,   271,
-     272,   273,     1,    26,    27,    33,    39,    62,    63,    64,
-      65,    77,    78,    79,    84,    85,    86,    88,   502,   503,
-     504,   505,   506,   507,   508,   509,   510,   511,   512,   513,
-     514,   515,   516,   517,   518,   233,   233,   233,     1,    66,
-     438,   439,   440,   233,     1,     6,     7,     9,    10,    14,
+/* YYSTOS[STATE-NUM] -- The symbol kind of the accessing symbol of
+   state STATE-NUM.  */
+static const yytype_int16 yystos[] =
+{
+       0,   240,     0,     1,     4,    16,    19,    21,    29,    42,
+      48,    49,    67,    71,    81,   100,   101,   116,   135,   147,
+     148,   165,   178,   183,   188,   191,   241,   246,   251,   270,
+     276,   282,   290,   304,   324,   346,   360,   375,   382,   386,
+     396,   405,   427,   433,   439,   443,   449,   505,   523,   233,
+     234,   235,   235,   325,   406,   434,   235,   444,   235,   361,
+     428,   347,   235,   277,   305,   376,   235,   235,   397,   235,
+     283,   235,   387,     1,    30,    38,   102,   271,   272,   273,
+     274,   275,     1,    26,    27,    33,    39,    62,    63,    64,
+      65,    77,    78,    79,    84,    85,    86,    88,   506,   507,
+     508,   509,   510,   511,   512,   513,   514,   515,   516,   517,
+     518,   519,   520,   521,   522,   235,   235,   235,     1,    66,
+     440,   441,   442,   235,     1,     6,     7,     9,    10,    14,
       23,    24,    25,    32,    35,    36,    37,    44,    61,    72,
       75,    76,    83,    89,    91,    93,    95,    97,    98,   108,
-     114,   115,   117,   118,   119,   122,   147,   150,   151,   152,
-     153,   154,   155,   156,   206,   207,   217,   218,   226,   228,
-     448,   449,   450,   451,   452,   453,   454,   455,   456,   457,
+     114,   115,   117,   118,   119,   122,   123,   124,   149,   152,
+     153,   154,   155,   156,   157,   158,   208,   209,   219,   220,
+     228,   230,   450,   451,   452,   453,   454,   455,   456,   457,
      458,   459,   460,   461,   462,   463,   464,   465,   466,   467,
      468,   469,   470,   471,   472,   473,   474,   475,   476,   477,
      478,   479,   480,   481,   482,   483,   484,   485,   486,   487,
-     488,   489,   493,   497,   498,   499,   500,   233,   233,   233,
-       1,    99,   121,   245,   246,   247,   248,   233,   233,   233,
-       1,    34,    45,    46,    47,    50,    51,    55,    56,    57,
-     520,   521,   522,   523,   524,   525,   526,   527,   528,   529,
-     530,     1,    28,    30,    59,    69,    90,    94,   102,   105,
-     106,   135,   209,   211,   212,   214,   215,   216,   250,   251,
-     252,   253,   254,   255,   256,   257,   258,   259,   260,   261,
-     262,   263,   264,   265,   266,   267,   233,     1,   222,   289,
-     290,   291,   292,   293,   233,     1,   102,   381,   382,   383,
-     233,   231,   234,   234,   234,   232,   270,   234,   234,   234,
-     234,   234,   234,   234,   234,   234,   234,   234,   234,   234,
-     234,   234,   232,   503,     1,    17,    18,    22,    68,    86,
-      87,    92,    96,   102,   111,   112,   113,   123,   144,   182,
-     324,   325,   326,   327,   328,   329,   330,   331,   332,   333,
-     334,   335,   336,   337,   338,   339,   340,     1,     3,     5,
-      19,    40,    58,    60,    68,    80,   102,   124,   143,   158,
-     208,   210,   211,   405,   406,   407,   408,   409,   410,   411,
-     412,   413,   414,   415,   416,   420,   421,   422,   423,   424,
-       1,    66,   127,   433,   434,   435,   436,   234,   232,   439,
-       1,   102,   127,   443,   444,   445,   446,   234,   234,   234,
-     234,   234,   234,   234,   234,   234,   234,   234,   234,   234,
-     234,   234,   234,   234,   234,   234,   234,   234,   234,   234,
-     234,   234,   494,   490,   234,   234,   234,   234,   234,   234,
-     234,   234,   234,   234,   234,   234,   234,   234,   234,   234,
-     234,   234,   232,   449,     1,    19,    40,    68,   120,   128,
-     129,   148,   223,   360,   361,   362,   363,   364,   365,   366,
-     370,   371,   372,     1,   127,   223,   427,   428,   429,   430,
-       1,    58,    66,    68,   124,   346,   350,   351,   352,   356,
-     357,   231,   234,   234,   232,   246,     1,    82,   169,   276,
-     277,   278,   279,     1,    19,    40,    68,   102,   120,   196,
-     210,   213,   223,   227,   304,   305,   306,   307,   308,   309,
-     310,   311,   312,   313,   314,   318,     1,    42,    82,   127,
-     375,   376,   377,   378,   379,   234,   234,   234,   234,   234,
-     234,   234,   234,   234,   232,   521,   231,   234,   234,   234,
-     234,   234,   234,   234,   234,   234,   234,   234,   234,   234,
-     234,   234,   234,   232,   251,     1,   102,   220,   396,   397,
-     398,   399,   231,   234,   232,   290,   169,     1,   102,   162,
-     180,   194,   282,   283,   284,   285,   286,   287,   234,   232,
-     382,     1,   102,   220,   223,   386,   387,   388,   389,   390,
-     125,   125,   125,   231,   110,   110,   241,   205,   205,   110,
-     241,   241,   241,   110,   241,   241,   110,   110,   110,   110,
-     231,   231,   234,   234,   234,   341,   234,   234,   234,   234,
-     234,   234,   234,   234,   234,   234,   234,   232,   325,   231,
-     234,   234,   234,   234,   234,   234,   417,   234,   234,   234,
-     234,   234,   234,   234,   234,   232,   406,   234,   234,   232,
-     434,   125,   231,   234,   234,   232,   444,   205,   241,   110,
-     241,   241,   205,   110,   241,   205,   110,   110,   110,   205,
-     205,   241,   110,   110,   110,   110,   241,   110,   110,   110,
-     110,   205,   234,   234,   205,   241,   241,   205,   205,   205,
-     205,   205,   205,   205,   205,   205,   110,   241,   241,   241,
-     205,   110,   231,   231,   234,   234,   367,   234,   234,   234,
-     234,   234,   232,   361,   234,   234,   232,   428,   231,   234,
-     234,   347,   234,   232,   351,   125,   125,   231,   231,   234,
-     234,   232,   277,   231,   234,   234,   319,   234,   234,   315,
-     234,   234,   234,   234,   232,   305,   231,   234,   234,   234,
-     232,   376,   205,   205,   241,   125,   205,   125,   205,   205,
-     205,   231,   110,   125,   205,   125,   110,   110,   125,   125,
-     125,   125,   125,   125,   125,   125,   125,   125,   231,   231,
-     234,   400,   232,   397,   205,   231,   233,   231,   234,   234,
-     234,   234,   232,   283,   125,   231,   231,   234,   391,   234,
-     232,   387,   231,   231,   231,   231,   136,   137,   138,   139,
-     140,   141,   142,   240,   241,   231,   231,   231,   231,   231,
-     231,   231,   231,   231,   231,   231,   231,   231,   231,   110,
-     110,   241,   234,   110,   241,   110,   241,   125,   110,   110,
-     110,   241,   110,   243,   243,   231,   125,   173,   174,   125,
-     205,   125,   125,   234,   125,   125,   110,   125,   125,   241,
-     125,   125,   231,   125,   125,   231,   231,   125,   125,   231,
-     231,   231,   231,   231,   231,   231,   231,   231,   231,   231,
-     231,   231,   231,   231,   231,   231,   231,   231,   231,   231,
-     231,   231,   231,   231,   231,    43,    50,   159,   160,   161,
-     164,   165,   167,   168,   170,   172,   175,   177,   178,   183,
-     187,   191,   192,   193,   197,   202,   495,   496,    43,    50,
-      52,    53,   159,   160,   161,   164,   165,   167,   168,   170,
-     172,   175,   177,   178,   183,   187,   191,   192,   193,   197,
-     202,   491,   492,   231,   231,   231,   231,   231,   231,   231,
-     231,   231,   231,   231,   231,   231,   231,   231,   231,   231,
-     231,   125,   205,   234,   125,   110,   125,   125,   125,   231,
-     125,   125,   231,   125,   125,   234,   110,   354,   355,   231,
-     231,   231,   125,   125,   231,   125,   205,   234,   125,   125,
-     234,   125,   205,   125,   125,   231,   125,   125,   125,   231,
-     231,   231,   231,   231,   231,   231,   231,   231,   231,   231,
-     231,   231,   231,   231,   231,   231,   231,   231,   231,   231,
-     231,   231,   231,   231,   231,   125,   234,   231,   231,     1,
-     102,   190,   220,   294,   295,   296,   297,   298,   125,   125,
-     125,   125,   231,   231,   125,   234,   125,   231,   240,   240,
-     240,   240,   240,   240,   240,   231,   231,   231,    54,   126,
-     342,   343,   231,   231,   231,   231,   231,   231,   231,   231,
-     231,    11,    12,    13,   242,   243,   231,   231,   231,   231,
-     231,   231,   231,   231,   231,     8,   195,   418,   419,   231,
-     231,   231,   231,   231,   231,   231,   231,   231,   231,   231,
-     231,   231,   235,   231,   235,   231,   231,    15,    41,    74,
-     103,   104,   109,   134,   204,   230,   368,   369,   231,   231,
-     231,   231,   231,   231,   231,   231,   231,    50,   185,   195,
-     348,   349,   219,   235,   353,   231,   231,   231,   231,     4,
-      20,    21,    31,    70,    71,    73,    99,   107,   130,   132,
-     133,   149,   166,   171,   175,   179,   184,   188,   198,   200,
-     201,   203,   221,   229,   320,   321,   231,   231,    43,    50,
-      52,    53,   159,   160,   161,   164,   165,   167,   168,   170,
-     172,   175,   177,   178,   183,   187,   191,   192,   193,   197,
-     202,   316,   317,   231,   231,   231,   231,   231,   231,   231,
-     231,    73,   133,   157,   166,   175,   198,   200,   201,   221,
-     229,   401,   402,   231,   234,   234,   299,   232,   295,   231,
-     231,   231,   231,   231,    73,   133,   157,   166,   175,   198,
-     200,   201,   221,   229,   392,   393,   231,   231,   235,   242,
-     242,   242,   231,   235,   496,   492,   231,   235,   231,   235,
-     110,   355,   231,   236,   236,   236,   236,   236,   236,   231,
-     235,   231,   235,   231,   235,   125,   199,   243,   234,   231,
-     231,   235,   343,   419,   369,   349,   131,   133,   131,   133,
-     131,   131,   321,   317,   402,   231,   231,   231,    71,    73,
-     116,   133,   165,   166,   223,   229,   300,   301,   393,   231,
-     235,   301
+     488,   489,   490,   491,   495,   499,   500,   501,   502,   503,
+     504,   235,   235,   235,     1,    99,   121,   247,   248,   249,
+     250,   235,   235,   235,     1,    34,    45,    46,    47,    50,
+      51,    55,    56,    57,   524,   525,   526,   527,   528,   529,
+     530,   531,   532,   533,   534,     1,    28,    30,    59,    69,
+      90,    94,   102,   105,   106,   137,   211,   213,   214,   216,
+     217,   218,   252,   253,   254,   255,   256,   257,   258,   259,
+     260,   261,   262,   263,   264,   265,   266,   267,   268,   269,
+     235,     1,   224,   291,   292,   293,   294,   295,   235,     1,
+     102,   383,   384,   385,   235,   233,   236,   236,   236,   234,
+     272,   236,   236,   236,   236,   236,   236,   236,   236,   236,
+     236,   236,   236,   236,   236,   236,   234,   507,     1,    17,
+      18,    22,    68,    86,    87,    92,    96,   102,   111,   112,
+     113,   125,   146,   184,   326,   327,   328,   329,   330,   331,
+     332,   333,   334,   335,   336,   337,   338,   339,   340,   341,
+     342,     1,     3,     5,    19,    40,    58,    60,    68,    80,
+     102,   126,   145,   160,   210,   212,   213,   407,   408,   409,
+     410,   411,   412,   413,   414,   415,   416,   417,   418,   422,
+     423,   424,   425,   426,     1,    66,   129,   435,   436,   437,
+     438,   236,   234,   441,     1,   102,   129,   445,   446,   447,
+     448,   236,   236,   236,   236,   236,   236,   236,   236,   236,
+     236,   236,   236,   236,   236,   236,   236,   236,   236,   236,
+     236,   236,   236,   236,   236,   236,   496,   492,   236,   236,
+     236,   236,   236,   236,   236,   236,   236,   236,   236,   236,
+     236,   236,   236,   236,   236,   236,   236,   236,   234,   451,
+       1,    19,    40,    68,   120,   130,   131,   150,   225,   362,
+     363,   364,   365,   366,   367,   368,   372,   373,   374,     1,
+     129,   225,   429,   430,   431,   432,     1,    58,    66,    68,
+     126,   348,   352,   353,   354,   358,   359,   233,   236,   236,
+     234,   248,     1,    82,   171,   278,   279,   280,   281,     1,
+      19,    40,    68,   102,   120,   198,   212,   215,   225,   229,
+     306,   307,   308,   309,   310,   311,   312,   313,   314,   315,
+     316,   320,     1,    42,    82,   129,   377,   378,   379,   380,
+     381,   236,   236,   236,   236,   236,   236,   236,   236,   236,
+     234,   525,   233,   236,   236,   236,   236,   236,   236,   236,
+     236,   236,   236,   236,   236,   236,   236,   236,   236,   234,
+     253,     1,   102,   222,   398,   399,   400,   401,   233,   236,
+     234,   292,   171,     1,   102,   164,   182,   196,   284,   285,
+     286,   287,   288,   289,   236,   234,   384,     1,   102,   222,
+     225,   388,   389,   390,   391,   392,   127,   127,   127,   233,
+     110,   110,   243,   207,   207,   110,   243,   243,   243,   110,
+     243,   243,   110,   110,   110,   110,   233,   233,   236,   236,
+     236,   343,   236,   236,   236,   236,   236,   236,   236,   236,
+     236,   236,   236,   234,   327,   233,   236,   236,   236,   236,
+     236,   236,   419,   236,   236,   236,   236,   236,   236,   236,
+     236,   234,   408,   236,   236,   234,   436,   127,   233,   236,
+     236,   234,   446,   207,   243,   110,   243,   243,   207,   110,
+     243,   207,   110,   110,   110,   207,   207,   243,   110,   110,
+     110,   110,   243,   110,   110,   110,   110,   207,   236,   236,
+     207,   243,   243,   243,   127,   207,   207,   207,   207,   207,
+     207,   207,   207,   207,   110,   243,   243,   243,   207,   110,
+     233,   233,   236,   236,   369,   236,   236,   236,   236,   236,
+     234,   363,   236,   236,   234,   430,   233,   236,   236,   349,
+     236,   234,   353,   127,   127,   233,   233,   236,   236,   234,
+     279,   233,   236,   236,   321,   236,   236,   317,   236,   236,
+     236,   236,   234,   307,   233,   236,   236,   236,   234,   378,
+     207,   207,   243,   127,   207,   127,   207,   207,   207,   233,
+     110,   127,   207,   127,   110,   110,   127,   127,   127,   127,
+     127,   127,   127,   127,   127,   127,   233,   233,   236,   402,
+     234,   399,   207,   233,   235,   233,   236,   236,   236,   236,
+     234,   285,   127,   233,   233,   236,   393,   236,   234,   389,
+     233,   233,   233,   233,   138,   139,   140,   141,   142,   143,
+     144,   242,   243,   233,   233,   233,   233,   233,   233,   233,
+     233,   233,   233,   233,   233,   233,   233,   110,   110,   243,
+     236,   110,   243,   110,   243,   127,   110,   110,   110,   243,
+     110,   245,   245,   233,   127,   175,   176,   127,   207,   127,
+     127,   236,   127,   127,   110,   127,   127,   243,   127,   127,
+     233,   127,   127,   233,   233,   127,   127,   233,   233,   233,
+     233,   233,   233,   233,   233,   233,   233,   233,   233,   233,
+     233,   233,   233,   233,   233,   233,   233,   233,   233,   233,
+     233,   233,   233,    43,    50,   161,   162,   163,   166,   167,
+     169,   170,   172,   174,   177,   179,   180,   185,   189,   193,
+     194,   195,   199,   204,   497,   498,    43,    50,    52,    53,
+     161,   162,   163,   166,   167,   169,   170,   172,   174,   177,
+     179,   180,   185,   189,   193,   194,   195,   199,   204,   493,
+     494,   233,   233,   233,   233,   233,   233,   233,   233,   233,
+     233,   233,   233,   233,   233,   233,   233,   233,   233,   233,
+     233,   127,   207,   236,   127,   110,   127,   127,   127,   233,
+     127,   127,   233,   127,   127,   236,   110,   356,   357,   233,
+     233,   233,   127,   127,   233,   127,   207,   236,   127,   127,
+     236,   127,   207,   127,   127,   233,   127,   127,   127,   233,
+     233,   233,   233,   233,   233,   233,   233,   233,   233,   233,
+     233,   233,   233,   233,   233,   233,   233,   233,   233,   233,
+     233,   233,   233,   233,   233,   127,   236,   233,   233,     1,
+     102,   192,   222,   296,   297,   298,   299,   300,   127,   127,
+     127,   127,   233,   233,   127,   236,   127,   233,   242,   242,
+     242,   242,   242,   242,   242,   233,   233,   233,    54,   128,
+     344,   345,   233,   233,   233,   233,   233,   233,   233,   233,
+     233,    11,    12,    13,   244,   245,   233,   233,   233,   233,
+     233,   233,   233,   233,   233,     8,   197,   420,   421,   233,
+     233,   233,   233,   233,   233,   233,   233,   233,   233,   233,
+     233,   233,   237,   233,   237,   233,   233,    15,    41,    74,
+     103,   104,   109,   136,   206,   232,   370,   371,   233,   233,
+     233,   233,   233,   233,   233,   233,   233,    50,   187,   197,
+     350,   351,   221,   237,   355,   233,   233,   233,   233,     4,
+      20,    21,    31,    70,    71,    73,    99,   107,   132,   134,
+     135,   151,   168,   173,   177,   181,   186,   190,   200,   202,
+     203,   205,   223,   231,   322,   323,   233,   233,    43,    50,
+      52,    53,   161,   162,   163,   166,   167,   169,   170,   172,
+     174,   177,   179,   180,   185,   189,   193,   194,   195,   199,
+     204,   318,   319,   233,   233,   233,   233,   233,   233,   233,
+     233,    73,   135,   159,   168,   177,   200,   202,   203,   223,
+     231,   403,   404,   233,   236,   236,   301,   234,   297,   233,
+     233,   233,   233,   233,    73,   135,   159,   168,   177,   200,
+     202,   203,   223,   231,   394,   395,   233,   233,   237,   244,
+     244,   244,   233,   237,   498,   494,   233,   237,   233,   237,
+     110,   357,   233,   238,   238,   238,   238,   238,   238,   233,
+     237,   233,   237,   233,   237,   127,   201,   245,   236,   233,
+     233,   237,   345,   421,   371,   351,   133,   135,   133,   135,
+     133,   133,   323,   319,   404,   233,   233,   233,    71,    73,
+     116,   135,   167,   168,   225,   231,   302,   303,   395,   233,
+     237,   303
 };
 
-  /* YYR1[YYN] -- Symbol number of symbol that rule YYN derives.  */
-static const yytype_uint16 yyr1[] =
+/* YYR1[RULE-NUM] -- Symbol kind of the left-hand side of rule RULE-NUM.  */
+static const yytype_int16 yyr1[] =
 {
-       0,   237,   238,   238,   239,   239,   239,   239,   239,   239,
-     239,   239,   239,   239,   239,   239,   239,   239,   239,   239,
-     239,   239,   239,   239,   239,   239,   239,   239,   240,   240,
+       0,   239,   240,   240,   241,   241,   241,   241,   241,   241,
+     241,   241,   241,   241,   241,   241,   241,   241,   241,   241,
      241,   241,   241,   241,   241,   241,   241,   241,   242,   242,
-     243,   243,   243,   243,   244,   245,   245,   246,   246,   246,
-     247,   248,   249,   250,   250,   251,   251,   251,   251,   251,
-     251,   251,   251,   251,   251,   251,   251,   251,   251,   251,
-     251,   251,   252,   253,   254,   255,   256,   257,   258,   259,
-     260,   261,   262,   263,   264,   265,   266,   267,   268,   269,
-     269,   270,   270,   270,   270,   271,   272,   273,   275,   274,
-     276,   276,   277,   277,   277,   278,   279,   281,   280,   282,
-     282,   283,   283,   283,   283,   283,   284,   285,   286,   287,
-     288,   289,   289,   290,   290,   290,   291,   293,   292,   294,
-     294,   295,   295,   295,   295,   296,   297,   297,   299,   298,
-     300,   300,   301,   301,   301,   301,   301,   301,   301,   301,
-     303,   302,   304,   304,   305,   305,   305,   305,   305,   305,
-     305,   305,   305,   305,   305,   306,   307,   308,   309,   310,
-     311,   312,   313,   315,   314,   316,   316,   317,   317,   317,
-     317,   317,   317,   317,   317,   317,   317,   317,   317,   317,
-     317,   317,   317,   317,   317,   317,   317,   317,   317,   317,
-     319,   318,   320,   320,   321,   321,   321,   321,   321,   321,
-     321,   321,   321,   321,   321,   321,   321,   321,   321,   321,
-     321,   321,   321,   321,   321,   321,   321,   321,   321,   321,
-     321,   321,   321,   323,   322,   324,   324,   325,   325,   325,
-     325,   325,   325,   325,   325,   325,   325,   325,   325,   325,
-     325,   325,   325,   326,   327,   328,   329,   330,   331,   332,
-     333,   334,   335,   336,   337,   338,   339,   341,   340,   342,
-     342,   343,   343,   345,   344,   347,   346,   348,   348,   349,
-     349,   349,   350,   350,   351,   351,   351,   351,   351,   353,
-     352,   354,   354,   355,   355,   356,   357,   359,   358,   360,
-     360,   361,   361,   361,   361,   361,   361,   361,   361,   361,
-     362,   363,   364,   365,   367,   366,   368,   368,   369,   369,
-     369,   369,   369,   369,   369,   369,   369,   370,   371,   372,
-     374,   373,   375,   375,   376,   376,   376,   376,   377,   378,
-     379,   380,   381,   381,   382,   382,   383,   385,   384,   386,
-     386,   387,   387,   387,   387,   388,   389,   391,   390,   392,
-     392,   393,   393,   393,   393,   393,   393,   393,   393,   393,
-     393,   395,   394,   396,   396,   397,   397,   397,   398,   400,
-     399,   401,   401,   402,   402,   402,   402,   402,   402,   402,
-     402,   402,   402,   404,   403,   405,   405,   406,   406,   406,
-     406,   406,   406,   406,   406,   406,   406,   406,   406,   406,
-     406,   406,   406,   407,   408,   409,   410,   411,   412,   413,
-     414,   415,   415,   417,   416,   418,   418,   419,   419,   420,
-     421,   422,   423,   424,   426,   425,   427,   427,   428,   428,
-     428,   429,   430,   432,   431,   433,   433,   434,   434,   434,
-     435,   436,   437,   438,   438,   439,   439,   440,   442,   441,
-     443,   443,   444,   444,   444,   445,   446,   447,   448,   448,
-     449,   449,   449,   449,   449,   449,   449,   449,   449,   449,
-     449,   449,   449,   449,   449,   449,   449,   449,   449,   449,
-     449,   449,   449,   449,   449,   449,   449,   449,   449,   449,
-     449,   449,   449,   449,   449,   449,   449,   449,   449,   449,
-     449,   449,   449,   449,   449,   449,   450,   451,   452,   453,
+     243,   243,   243,   243,   243,   243,   243,   243,   244,   244,
+     245,   245,   245,   245,   246,   247,   247,   248,   248,   248,
+     249,   250,   251,   252,   252,   253,   253,   253,   253,   253,
+     253,   253,   253,   253,   253,   253,   253,   253,   253,   253,
+     253,   253,   254,   255,   256,   257,   258,   259,   260,   261,
+     262,   263,   264,   265,   266,   267,   268,   269,   270,   271,
+     271,   272,   272,   272,   272,   273,   274,   275,   277,   276,
+     278,   278,   279,   279,   279,   280,   281,   283,   282,   284,
+     284,   285,   285,   285,   285,   285,   286,   287,   288,   289,
+     290,   291,   291,   292,   292,   292,   293,   295,   294,   296,
+     296,   297,   297,   297,   297,   298,   299,   299,   301,   300,
+     302,   302,   303,   303,   303,   303,   303,   303,   303,   303,
+     305,   304,   306,   306,   307,   307,   307,   307,   307,   307,
+     307,   307,   307,   307,   307,   308,   309,   310,   311,   312,
+     313,   314,   315,   317,   316,   318,   318,   319,   319,   319,
+     319,   319,   319,   319,   319,   319,   319,   319,   319,   319,
+     319,   319,   319,   319,   319,   319,   319,   319,   319,   319,
+     321,   320,   322,   322,   323,   323,   323,   323,   323,   323,
+     323,   323,   323,   323,   323,   323,   323,   323,   323,   323,
+     323,   323,   323,   323,   323,   323,   323,   323,   323,   323,
+     323,   323,   323,   325,   324,   326,   326,   327,   327,   327,
+     327,   327,   327,   327,   327,   327,   327,   327,   327,   327,
+     327,   327,   327,   328,   329,   330,   331,   332,   333,   334,
+     335,   336,   337,   338,   339,   340,   341,   343,   342,   344,
+     344,   345,   345,   347,   346,   349,   348,   350,   350,   351,
+     351,   351,   352,   352,   353,   353,   353,   353,   353,   355,
+     354,   356,   356,   357,   357,   358,   359,   361,   360,   362,
+     362,   363,   363,   363,   363,   363,   363,   363,   363,   363,
+     364,   365,   366,   367,   369,   368,   370,   370,   371,   371,
+     371,   371,   371,   371,   371,   371,   371,   372,   373,   374,
+     376,   375,   377,   377,   378,   378,   378,   378,   379,   380,
+     381,   382,   383,   383,   384,   384,   385,   387,   386,   388,
+     388,   389,   389,   389,   389,   390,   391,   393,   392,   394,
+     394,   395,   395,   395,   395,   395,   395,   395,   395,   395,
+     395,   397,   396,   398,   398,   399,   399,   399,   400,   402,
+     401,   403,   403,   404,   404,   404,   404,   404,   404,   404,
+     404,   404,   404,   406,   405,   407,   407,   408,   408,   408,
+     408,   408,   408,   408,   408,   408,   408,   408,   408,   408,
+     408,   408,   408,   409,   410,   411,   412,   413,   414,   415,
+     416,   417,   417,   419,   418,   420,   420,   421,   421,   422,
+     423,   424,   425,   426,   428,   427,   429,   429,   430,   430,
+     430,   431,   432,   434,   433,   435,   435,   436,   436,   436,
+     437,   438,   439,   440,   440,   441,   441,   442,   444,   443,
+     445,   445,   446,   446,   446,   447,   448,   449,   450,   450,
+     451,   451,   451,   451,   451,   451,   451,   451,   451,   451,
+     451,   451,   451,   451,   451,   451,   451,   451,   451,   451,
+     451,   451,   451,   451,   451,   451,   451,   451,   451,   451,
+     451,   451,   451,   451,   451,   451,   451,   451,   451,   451,
+     451,   451,   451,   451,   451,   451,   451,   451,   452,   453,
      454,   455,   456,   457,   458,   459,   460,   461,   462,   463,
      464,   465,   466,   467,   468,   469,   470,   471,   472,   473,
      474,   475,   476,   477,   478,   479,   480,   481,   482,   483,
-     484,   485,   486,   487,   488,   490,   489,   491,   491,   492,
-     492,   492,   492,   492,   492,   492,   492,   492,   492,   492,
-     492,   492,   492,   492,   492,   492,   492,   492,   492,   492,
-     492,   492,   494,   493,   495,   495,   496,   496,   496,   496,
-     496,   496,   496,   496,   496,   496,   496,   496,   496,   496,
-     496,   496,   496,   496,   496,   496,   496,   497,   498,   499,
-     500,   501,   502,   502,   503,   503,   503,   503,   503,   503,
-     503,   503,   503,   503,   503,   503,   503,   503,   503,   503,
-     504,   505,   506,   507,   508,   509,   510,   511,   512,   513,
-     514,   515,   516,   517,   518,   519,   520,   520,   521,   521,
-     521,   521,   521,   521,   521,   521,   521,   521,   522,   523,
-     524,   525,   526,   527,   528,   529,   530
+     484,   485,   486,   487,   488,   489,   490,   492,   491,   493,
+     493,   494,   494,   494,   494,   494,   494,   494,   494,   494,
+     494,   494,   494,   494,   494,   494,   494,   494,   494,   494,
+     494,   494,   494,   494,   496,   495,   497,   497,   498,   498,
+     498,   498,   498,   498,   498,   498,   498,   498,   498,   498,
+     498,   498,   498,   498,   498,   498,   498,   498,   498,   499,
+     500,   501,   502,   503,   504,   505,   506,   506,   507,   507,
+     507,   507,   507,   507,   507,   507,   507,   507,   507,   507,
+     507,   507,   507,   507,   508,   509,   510,   511,   512,   513,
+     514,   515,   516,   517,   518,   519,   520,   521,   522,   523,
+     524,   524,   525,   525,   525,   525,   525,   525,   525,   525,
+     525,   525,   526,   527,   528,   529,   530,   531,   532,   533,
+     534
 };
 
-  /* YYR2[YYN] -- Number of symbols on the right hand side of rule YYN.  */
-static const yytype_uint8 yyr2[] =
+/* YYR2[RULE-NUM] -- Number of symbols on the right-hand side of rule RULE-NUM.  */
+static const yytype_int8 yyr2[] =
 {
        0,     2,     0,     2,     1,     1,     1,     1,     1,     1,
        1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
@@ -2148,33 +2786,35 @@ static const yytype_uint8 yyr2[] =
        1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
        1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
        1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
-       1,     1,     1,     1,     1,     1,     4,     4,     4,     4,
+       1,     1,     1,     1,     1,     1,     1,     1,     4,     4,
        4,     4,     4,     4,     4,     4,     4,     4,     4,     4,
        4,     4,     4,     4,     4,     4,     4,     4,     4,     4,
        4,     4,     4,     4,     4,     4,     4,     4,     4,     4,
-       4,     4,     4,     4,     4,     0,     5,     3,     1,     1,
-       1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
+       4,     4,     4,     4,     4,     4,     4,     0,     5,     3,
        1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
-       1,     1,     0,     5,     3,     1,     1,     1,     1,     1,
        1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
-       1,     1,     1,     1,     1,     1,     1,     4,     4,     4,
-       4,     5,     2,     1,     1,     1,     1,     1,     1,     1,
+       1,     1,     1,     1,     0,     5,     3,     1,     1,     1,
        1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
-       4,     4,     4,     4,     4,     4,     4,     4,     4,     4,
+       1,     1,     1,     1,     1,     1,     1,     1,     1,     4,
        4,     4,     4,     4,     4,     5,     2,     1,     1,     1,
-       1,     1,     1,     1,     1,     1,     1,     1,     4,     4,
-       4,     4,     4,     4,     4,     4,     4
+       1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
+       1,     1,     1,     1,     4,     4,     4,     4,     4,     4,
+       4,     4,     4,     4,     4,     4,     4,     4,     4,     5,
+       2,     1,     1,     1,     1,     1,     1,     1,     1,     1,
+       1,     1,     4,     4,     4,     4,     4,     4,     4,     4,
+       4
 };
 
 
+enum { YYENOMEM = -2 };
+
 #define yyerrok         (yyerrstatus = 0)
 #define yyclearin       (yychar = YYEMPTY)
-#define YYEMPTY         (-2)
-#define YYEOF           0
 
 #define YYACCEPT        goto yyacceptlab
 #define YYABORT         goto yyabortlab
 #define YYERROR         goto yyerrorlab
+#define YYNOMEM         goto yyexhaustedlab
 
 
 #define YYRECOVERING()  (!!yyerrstatus)
@@ -2196,10 +2836,9 @@ static const yytype_uint8 yyr2[] =
       }                                                           \
   while (0)
 
-/* Error token number */
-#define YYTERROR        1
-#define YYERRCODE       256
-
+/* Backward compatibility with an undocumented macro.
+   Use YYerror or YYUNDEF. */
+#define YYERRCODE YYUNDEF
 
 
 /* Enable debugging if requested.  */
@@ -2216,19 +2855,16 @@ do {                                            \
     YYFPRINTF Args;                             \
 } while (0)
 
-/* This macro is provided for backward compatibility. */
-#ifndef YY_LOCATION_PRINT
-# define YY_LOCATION_PRINT(File, Loc) ((void) 0)
-#endif
 
 
-# define YY_SYMBOL_PRINT(Title, Type, Value, Location)                    \
+
+# define YY_SYMBOL_PRINT(Title, Kind, Value, Location)                    \
 do {                                                                      \
   if (yydebug)                                                            \
     {                                                                     \
       YYFPRINTF (stderr, "%s ", Title);                                   \
       yy_symbol_print (stderr,                                            \
-                  Type, Value); \
+                  Kind, Value); \
       YYFPRINTF (stderr, "\n");                                           \
     }                                                                     \
 } while (0)
@@ -2239,17 +2875,16 @@ do {                                                                      \
 `-----------------------------------*/
 
 static void
-yy_symbol_value_print (FILE *yyo, int yytype, YYSTYPE const * const yyvaluep)
+yy_symbol_value_print (FILE *yyo,
+                       yysymbol_kind_t yykind, YYSTYPE const * const yyvaluep)
 {
   FILE *yyoutput = yyo;
-  YYUSE (yyoutput);
+  YY_USE (yyoutput);
   if (!yyvaluep)
     return;
-# ifdef YYPRINT
-  if (yytype < YYNTOKENS)
-    YYPRINT (yyo, yytoknum[yytype], *yyvaluep);
-# endif
-  YYUSE (yytype);
+  YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
+  YY_USE (yykind);
+  YY_IGNORE_MAYBE_UNINITIALIZED_END
 }
 
 
@@ -2258,12 +2893,13 @@ yy_symbol_value_print (FILE *yyo, int yytype, YYSTYPE const * const yyvaluep)
 `---------------------------*/
 
 static void
-yy_symbol_print (FILE *yyo, int yytype, YYSTYPE const * const yyvaluep)
+yy_symbol_print (FILE *yyo,
+                 yysymbol_kind_t yykind, YYSTYPE const * const yyvaluep)
 {
   YYFPRINTF (yyo, "%s %s (",
-             yytype < YYNTOKENS ? "token" : "nterm", yytname[yytype]);
+             yykind < YYNTOKENS ? "token" : "nterm", yysymbol_name (yykind));
 
-  yy_symbol_value_print (yyo, yytype, yyvaluep);
+  yy_symbol_value_print (yyo, yykind, yyvaluep);
   YYFPRINTF (yyo, ")");
 }
 
@@ -2273,7 +2909,7 @@ yy_symbol_print (FILE *yyo, int yytype, YYSTYPE const * const yyvaluep)
 `------------------------------------------------------------------*/
 
 static void
-yy_stack_print (yytype_int16 *yybottom, yytype_int16 *yytop)
+yy_stack_print (yy_state_t *yybottom, yy_state_t *yytop)
 {
   YYFPRINTF (stderr, "Stack now");
   for (; yybottom <= yytop; yybottom++)
@@ -2296,21 +2932,21 @@ do {                                                            \
 `------------------------------------------------*/
 
 static void
-yy_reduce_print (yytype_int16 *yyssp, YYSTYPE *yyvsp, int yyrule)
+yy_reduce_print (yy_state_t *yyssp, YYSTYPE *yyvsp,
+                 int yyrule)
 {
-  unsigned long yylno = yyrline[yyrule];
+  int yylno = yyrline[yyrule];
   int yynrhs = yyr2[yyrule];
   int yyi;
-  YYFPRINTF (stderr, "Reducing stack by rule %d (line %lu):\n",
+  YYFPRINTF (stderr, "Reducing stack by rule %d (line %d):\n",
              yyrule - 1, yylno);
   /* The symbols being reduced.  */
   for (yyi = 0; yyi < yynrhs; yyi++)
     {
       YYFPRINTF (stderr, "   $%d = ", yyi + 1);
       yy_symbol_print (stderr,
-                       yystos[yyssp[yyi + 1 - yynrhs]],
-                       &yyvsp[(yyi + 1) - (yynrhs)]
-                                              );
+                       YY_ACCESSING_SYMBOL (+yyssp[yyi + 1 - yynrhs]),
+                       &yyvsp[(yyi + 1) - (yynrhs)]);
       YYFPRINTF (stderr, "\n");
     }
 }
@@ -2325,8 +2961,8 @@ do {                                    \
    multiple parsers can coexist.  */
 int yydebug;
 #else /* !YYDEBUG */
-# define YYDPRINTF(Args)
-# define YY_SYMBOL_PRINT(Title, Type, Value, Location)
+# define YYDPRINTF(Args) ((void) 0)
+# define YY_SYMBOL_PRINT(Title, Kind, Value, Location)
 # define YY_STACK_PRINT(Bottom, Top)
 # define YY_REDUCE_PRINT(Rule)
 #endif /* !YYDEBUG */
@@ -2349,254 +2985,30 @@ int yydebug;
 #endif
 
 
-#if YYERROR_VERBOSE
-
-# ifndef yystrlen
-#  if defined __GLIBC__ && defined _STRING_H
-#   define yystrlen strlen
-#  else
-/* Return the length of YYSTR.  */
-static YYSIZE_T
-yystrlen (const char *yystr)
-{
-  YYSIZE_T yylen;
-  for (yylen = 0; yystr[yylen]; yylen++)
-    continue;
-  return yylen;
-}
-#  endif
-# endif
-
-# ifndef yystpcpy
-#  if defined __GLIBC__ && defined _STRING_H && defined _GNU_SOURCE
-#   define yystpcpy stpcpy
-#  else
-/* Copy YYSRC to YYDEST, returning the address of the terminating '\0' in
-   YYDEST.  */
-static char *
-yystpcpy (char *yydest, const char *yysrc)
-{
-  char *yyd = yydest;
-  const char *yys = yysrc;
-
-  while ((*yyd++ = *yys++) != '\0')
-    continue;
-
-  return yyd - 1;
-}
-#  endif
-# endif
-
-# ifndef yytnamerr
-/* Copy to YYRES the contents of YYSTR after stripping away unnecessary
-   quotes and backslashes, so that it's suitable for yyerror.  The
-   heuristic is that double-quoting is unnecessary unless the string
-   contains an apostrophe, a comma, or backslash (other than
-   backslash-backslash).  YYSTR is taken from yytname.  If YYRES is
-   null, do not copy; instead, return the length of what the result
-   would have been.  */
-static YYSIZE_T
-yytnamerr (char *yyres, const char *yystr)
-{
-  if (*yystr == '"')
-    {
-      YYSIZE_T yyn = 0;
-      char const *yyp = yystr;
-
-      for (;;)
-        switch (*++yyp)
-          {
-          case '\'':
-          case ',':
-            goto do_not_strip_quotes;
-
-          case '\\':
-            if (*++yyp != '\\')
-              goto do_not_strip_quotes;
-            else
-              goto append;
-
-          append:
-          default:
-            if (yyres)
-              yyres[yyn] = *yyp;
-            yyn++;
-            break;
-
-          case '"':
-            if (yyres)
-              yyres[yyn] = '\0';
-            return yyn;
-          }
-    do_not_strip_quotes: ;
-    }
-
-  if (! yyres)
-    return yystrlen (yystr);
-
-  return (YYSIZE_T) (yystpcpy (yyres, yystr) - yyres);
-}
-# endif
-
-/* Copy into *YYMSG, which is of size *YYMSG_ALLOC, an error message
-   about the unexpected token YYTOKEN for the state stack whose top is
-   YYSSP.
-
-   Return 0 if *YYMSG was successfully written.  Return 1 if *YYMSG is
-   not large enough to hold the message.  In that case, also set
-   *YYMSG_ALLOC to the required number of bytes.  Return 2 if the
-   required number of bytes is too large to store.  */
-static int
-yysyntax_error (YYSIZE_T *yymsg_alloc, char **yymsg,
-                yytype_int16 *yyssp, int yytoken)
-{
-  YYSIZE_T yysize0 = yytnamerr (YY_NULLPTR, yytname[yytoken]);
-  YYSIZE_T yysize = yysize0;
-  enum { YYERROR_VERBOSE_ARGS_MAXIMUM = 5 };
-  /* Internationalized format string. */
-  const char *yyformat = YY_NULLPTR;
-  /* Arguments of yyformat. */
-  char const *yyarg[YYERROR_VERBOSE_ARGS_MAXIMUM];
-  /* Number of reported tokens (one for the "unexpected", one per
-     "expected"). */
-  int yycount = 0;
-
-  /* There are many possibilities here to consider:
-     - If this state is a consistent state with a default action, then
-       the only way this function was invoked is if the default action
-       is an error action.  In that case, don't check for expected
-       tokens because there are none.
-     - The only way there can be no lookahead present (in yychar) is if
-       this state is a consistent state with a default action.  Thus,
-       detecting the absence of a lookahead is sufficient to determine
-       that there is no unexpected or expected token to report.  In that
-       case, just report a simple "syntax error".
-     - Don't assume there isn't a lookahead just because this state is a
-       consistent state with a default action.  There might have been a
-       previous inconsistent state, consistent state with a non-default
-       action, or user semantic action that manipulated yychar.
-     - Of course, the expected token list depends on states to have
-       correct lookahead information, and it depends on the parser not
-       to perform extra reductions after fetching a lookahead from the
-       scanner and before detecting a syntax error.  Thus, state merging
-       (from LALR or IELR) and default reductions corrupt the expected
-       token list.  However, the list is correct for canonical LR with
-       one exception: it will still contain any token that will not be
-       accepted due to an error action in a later state.
-  */
-  if (yytoken != YYEMPTY)
-    {
-      int yyn = yypact[*yyssp];
-      yyarg[yycount++] = yytname[yytoken];
-      if (!yypact_value_is_default (yyn))
-        {
-          /* Start YYX at -YYN if negative to avoid negative indexes in
-             YYCHECK.  In other words, skip the first -YYN actions for
-             this state because they are default actions.  */
-          int yyxbegin = yyn < 0 ? -yyn : 0;
-          /* Stay within bounds of both yycheck and yytname.  */
-          int yychecklim = YYLAST - yyn + 1;
-          int yyxend = yychecklim < YYNTOKENS ? yychecklim : YYNTOKENS;
-          int yyx;
-
-          for (yyx = yyxbegin; yyx < yyxend; ++yyx)
-            if (yycheck[yyx + yyn] == yyx && yyx != YYTERROR
-                && !yytable_value_is_error (yytable[yyx + yyn]))
-              {
-                if (yycount == YYERROR_VERBOSE_ARGS_MAXIMUM)
-                  {
-                    yycount = 1;
-                    yysize = yysize0;
-                    break;
-                  }
-                yyarg[yycount++] = yytname[yyx];
-                {
-                  YYSIZE_T yysize1 = yysize + yytnamerr (YY_NULLPTR, yytname[yyx]);
-                  if (yysize <= yysize1 && yysize1 <= YYSTACK_ALLOC_MAXIMUM)
-                    yysize = yysize1;
-                  else
-                    return 2;
-                }
-              }
-        }
-    }
-
-  switch (yycount)
-    {
-# define YYCASE_(N, S)                      \
-      case N:                               \
-        yyformat = S;                       \
-      break
-    default: /* Avoid compiler warnings. */
-      YYCASE_(0, YY_("syntax error"));
-      YYCASE_(1, YY_("syntax error, unexpected %s"));
-      YYCASE_(2, YY_("syntax error, unexpected %s, expecting %s"));
-      YYCASE_(3, YY_("syntax error, unexpected %s, expecting %s or %s"));
-      YYCASE_(4, YY_("syntax error, unexpected %s, expecting %s or %s or %s"));
-      YYCASE_(5, YY_("syntax error, unexpected %s, expecting %s or %s or %s or %s"));
-# undef YYCASE_
-    }
 
-  {
-    YYSIZE_T yysize1 = yysize + yystrlen (yyformat);
-    if (yysize <= yysize1 && yysize1 <= YYSTACK_ALLOC_MAXIMUM)
-      yysize = yysize1;
-    else
-      return 2;
-  }
 
-  if (*yymsg_alloc < yysize)
-    {
-      *yymsg_alloc = 2 * yysize;
-      if (! (yysize <= *yymsg_alloc
-             && *yymsg_alloc <= YYSTACK_ALLOC_MAXIMUM))
-        *yymsg_alloc = YYSTACK_ALLOC_MAXIMUM;
-      return 1;
-    }
 
-  /* Avoid sprintf, as that infringes on the user's name space.
-     Don't have undefined behavior even if the translation
-     produced a string with the wrong number of "%s"s.  */
-  {
-    char *yyp = *yymsg;
-    int yyi = 0;
-    while ((*yyp = *yyformat) != '\0')
-      if (*yyp == '%' && yyformat[1] == 's' && yyi < yycount)
-        {
-          yyp += yytnamerr (yyp, yyarg[yyi++]);
-          yyformat += 2;
-        }
-      else
-        {
-          yyp++;
-          yyformat++;
-        }
-  }
-  return 0;
-}
-#endif /* YYERROR_VERBOSE */
 
 /*-----------------------------------------------.
 | Release the memory associated to this symbol.  |
 `-----------------------------------------------*/
 
 static void
-yydestruct (const char *yymsg, int yytype, YYSTYPE *yyvaluep)
+yydestruct (const char *yymsg,
+            yysymbol_kind_t yykind, YYSTYPE *yyvaluep)
 {
-  YYUSE (yyvaluep);
+  YY_USE (yyvaluep);
   if (!yymsg)
     yymsg = "Deleting";
-  YY_SYMBOL_PRINT (yymsg, yytype, yyvaluep, yylocationp);
+  YY_SYMBOL_PRINT (yymsg, yykind, yyvaluep, yylocationp);
 
   YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
-  YYUSE (yytype);
+  YY_USE (yykind);
   YY_IGNORE_MAYBE_UNINITIALIZED_END
 }
 
 
-
-
-/* The lookahead symbol.  */
+/* Lookahead token kind.  */
 int yychar;
 
 /* The semantic value of the lookahead symbol.  */
@@ -2605,6 +3017,8 @@ YYSTYPE yylval;
 int yynerrs;
 
 
+
+
 /*----------.
 | yyparse.  |
 `----------*/
@@ -2612,43 +3026,36 @@ int yynerrs;
 int
 yyparse (void)
 {
-    int yystate;
+    yy_state_fast_t yystate = 0;
     /* Number of tokens to shift before error messages enabled.  */
-    int yyerrstatus;
-
-    /* The stacks and their tools:
-       'yyss': related to states.
-       'yyvs': related to semantic values.
+    int yyerrstatus = 0;
 
-       Refer to the stacks through separate pointers, to allow yyoverflow
+    /* Refer to the stacks through separate pointers, to allow yyoverflow
        to reallocate them elsewhere.  */
 
-    /* The state stack.  */
-    yytype_int16 yyssa[YYINITDEPTH];
-    yytype_int16 *yyss;
-    yytype_int16 *yyssp;
+    /* Their size.  */
+    YYPTRDIFF_T yystacksize = YYINITDEPTH;
 
-    /* The semantic value stack.  */
-    YYSTYPE yyvsa[YYINITDEPTH];
-    YYSTYPE *yyvs;
-    YYSTYPE *yyvsp;
+    /* The state stack: array, bottom, top.  */
+    yy_state_t yyssa[YYINITDEPTH];
+    yy_state_t *yyss = yyssa;
+    yy_state_t *yyssp = yyss;
 
-    YYSIZE_T yystacksize;
+    /* The semantic value stack: array, bottom, top.  */
+    YYSTYPE yyvsa[YYINITDEPTH];
+    YYSTYPE *yyvs = yyvsa;
+    YYSTYPE *yyvsp = yyvs;
 
   int yyn;
+  /* The return value of yyparse.  */
   int yyresult;
-  /* Lookahead token as an internal (translated) token number.  */
-  int yytoken = 0;
+  /* Lookahead symbol kind.  */
+  yysymbol_kind_t yytoken = YYSYMBOL_YYEMPTY;
   /* The variables used to return semantic value and location from the
      action routines.  */
   YYSTYPE yyval;
 
-#if YYERROR_VERBOSE
-  /* Buffer for error messages, and its allocated size.  */
-  char yymsgbuf[128];
-  char *yymsg = yymsgbuf;
-  YYSIZE_T yymsg_alloc = sizeof yymsgbuf;
-#endif
+
 
 #define YYPOPSTACK(N)   (yyvsp -= (N), yyssp -= (N))
 
@@ -2656,16 +3063,10 @@ yyparse (void)
      Keep to zero when no symbol should be popped.  */
   int yylen = 0;
 
-  yyssp = yyss = yyssa;
-  yyvsp = yyvs = yyvsa;
-  yystacksize = YYINITDEPTH;
-
   YYDPRINTF ((stderr, "Starting parse\n"));
 
-  yystate = 0;
-  yyerrstatus = 0;
-  yynerrs = 0;
   yychar = YYEMPTY; /* Cause a token to be read.  */
+
   goto yysetstate;
 
 
@@ -2679,34 +3080,39 @@ yynewstate:
 
 
 /*--------------------------------------------------------------------.
-| yynewstate -- set current state (the top of the stack) to yystate.  |
+| yysetstate -- set current state (the top of the stack) to yystate.  |
 `--------------------------------------------------------------------*/
 yysetstate:
-  *yyssp = (yytype_int16) yystate;
+  YYDPRINTF ((stderr, "Entering state %d\n", yystate));
+  YY_ASSERT (0 <= yystate && yystate < YYNSTATES);
+  YY_IGNORE_USELESS_CAST_BEGIN
+  *yyssp = YY_CAST (yy_state_t, yystate);
+  YY_IGNORE_USELESS_CAST_END
+  YY_STACK_PRINT (yyss, yyssp);
 
   if (yyss + yystacksize - 1 <= yyssp)
 #if !defined yyoverflow && !defined YYSTACK_RELOCATE
-    goto yyexhaustedlab;
+    YYNOMEM;
 #else
     {
       /* Get the current used size of the three stacks, in elements.  */
-      YYSIZE_T yysize = (YYSIZE_T) (yyssp - yyss + 1);
+      YYPTRDIFF_T yysize = yyssp - yyss + 1;
 
 # if defined yyoverflow
       {
         /* Give user a chance to reallocate the stack.  Use copies of
            these so that the &'s don't force the real ones into
            memory.  */
+        yy_state_t *yyss1 = yyss;
         YYSTYPE *yyvs1 = yyvs;
-        yytype_int16 *yyss1 = yyss;
 
         /* Each stack pointer address is followed by the size of the
            data in use in that stack, in bytes.  This used to be a
            conditional around just the two extra args, but that might
            be undefined if yyoverflow is a macro.  */
         yyoverflow (YY_("memory exhausted"),
-                    &yyss1, yysize * sizeof (*yyssp),
-                    &yyvs1, yysize * sizeof (*yyvsp),
+                    &yyss1, yysize * YYSIZEOF (*yyssp),
+                    &yyvs1, yysize * YYSIZEOF (*yyvsp),
                     &yystacksize);
         yyss = yyss1;
         yyvs = yyvs1;
@@ -2714,20 +3120,21 @@ yysetstate:
 # else /* defined YYSTACK_RELOCATE */
       /* Extend the stack our own way.  */
       if (YYMAXDEPTH <= yystacksize)
-        goto yyexhaustedlab;
+        YYNOMEM;
       yystacksize *= 2;
       if (YYMAXDEPTH < yystacksize)
         yystacksize = YYMAXDEPTH;
 
       {
-        yytype_int16 *yyss1 = yyss;
+        yy_state_t *yyss1 = yyss;
         union yyalloc *yyptr =
-          (union yyalloc *) YYSTACK_ALLOC (YYSTACK_BYTES (yystacksize));
+          YY_CAST (union yyalloc *,
+                   YYSTACK_ALLOC (YY_CAST (YYSIZE_T, YYSTACK_BYTES (yystacksize))));
         if (! yyptr)
-          goto yyexhaustedlab;
+          YYNOMEM;
         YYSTACK_RELOCATE (yyss_alloc, yyss);
         YYSTACK_RELOCATE (yyvs_alloc, yyvs);
-# undef YYSTACK_RELOCATE
+#  undef YYSTACK_RELOCATE
         if (yyss1 != yyssa)
           YYSTACK_FREE (yyss1);
       }
@@ -2736,15 +3143,16 @@ yysetstate:
       yyssp = yyss + yysize - 1;
       yyvsp = yyvs + yysize - 1;
 
-      YYDPRINTF ((stderr, "Stack size increased to %lu\n",
-                  (unsigned long) yystacksize));
+      YY_IGNORE_USELESS_CAST_BEGIN
+      YYDPRINTF ((stderr, "Stack size increased to %ld\n",
+                  YY_CAST (long, yystacksize)));
+      YY_IGNORE_USELESS_CAST_END
 
       if (yyss + yystacksize - 1 <= yyssp)
         YYABORT;
     }
 #endif /* !defined yyoverflow && !defined YYSTACK_RELOCATE */
 
-  YYDPRINTF ((stderr, "Entering state %d\n", yystate));
 
   if (yystate == YYFINAL)
     YYACCEPT;
@@ -2766,18 +3174,29 @@ yybackup:
 
   /* Not known => get a lookahead token if don't already have one.  */
 
-  /* YYCHAR is either YYEMPTY or YYEOF or a valid lookahead symbol.  */
+  /* YYCHAR is either empty, or end-of-input, or a valid lookahead.  */
   if (yychar == YYEMPTY)
     {
-      YYDPRINTF ((stderr, "Reading a token: "));
+      YYDPRINTF ((stderr, "Reading a token\n"));
       yychar = yylex ();
     }
 
   if (yychar <= YYEOF)
     {
-      yychar = yytoken = YYEOF;
+      yychar = YYEOF;
+      yytoken = YYSYMBOL_YYEOF;
       YYDPRINTF ((stderr, "Now at end of input.\n"));
     }
+  else if (yychar == YYerror)
+    {
+      /* The scanner already issued an error message, process directly
+         to error recovery.  But do not keep the error token as
+         lookahead, it is too special and may lead us to an endless
+         loop in error recovery. */
+      yychar = YYUNDEF;
+      yytoken = YYSYMBOL_YYerror;
+      goto yyerrlab1;
+    }
   else
     {
       yytoken = YYTRANSLATE (yychar);
@@ -2805,15 +3224,13 @@ yybackup:
 
   /* Shift the lookahead token.  */
   YY_SYMBOL_PRINT ("Shifting", yytoken, &yylval, &yylloc);
-
-  /* Discard the shifted token.  */
-  yychar = YYEMPTY;
-
   yystate = yyn;
   YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
   *++yyvsp = yylval;
   YY_IGNORE_MAYBE_UNINITIALIZED_END
 
+  /* Discard the shifted token.  */
+  yychar = YYEMPTY;
   goto yynewstate;
 
 
@@ -2848,195 +3265,195 @@ yyreduce:
   YY_REDUCE_PRINT (yyn);
   switch (yyn)
     {
-        case 28:
-#line 398 "conf_parser.y" /* yacc.c:1652  */
-    { (yyval.number) = 0; }
-#line 2855 "conf_parser.c" /* yacc.c:1652  */
+  case 28: /* timespec_: %empty  */
+#line 400 "conf_parser.y"
+           { (yyval.number) = 0; }
+#line 3272 "conf_parser.c"
     break;
 
-  case 30:
-#line 399 "conf_parser.y" /* yacc.c:1652  */
-    { (yyval.number) = (yyvsp[-1].number) + (yyvsp[0].number); }
-#line 2861 "conf_parser.c" /* yacc.c:1652  */
+  case 30: /* timespec: NUMBER timespec_  */
+#line 401 "conf_parser.y"
+                                    { (yyval.number) = (yyvsp[-1].number) + (yyvsp[0].number); }
+#line 3278 "conf_parser.c"
     break;
 
-  case 31:
-#line 400 "conf_parser.y" /* yacc.c:1652  */
-    { (yyval.number) = (yyvsp[-2].number) + (yyvsp[0].number); }
-#line 2867 "conf_parser.c" /* yacc.c:1652  */
+  case 31: /* timespec: NUMBER SECONDS timespec_  */
+#line 402 "conf_parser.y"
+                                    { (yyval.number) = (yyvsp[-2].number) + (yyvsp[0].number); }
+#line 3284 "conf_parser.c"
     break;
 
-  case 32:
-#line 401 "conf_parser.y" /* yacc.c:1652  */
-    { (yyval.number) = (yyvsp[-2].number) * 60 + (yyvsp[0].number); }
-#line 2873 "conf_parser.c" /* yacc.c:1652  */
+  case 32: /* timespec: NUMBER MINUTES timespec_  */
+#line 403 "conf_parser.y"
+                                    { (yyval.number) = (yyvsp[-2].number) * 60 + (yyvsp[0].number); }
+#line 3290 "conf_parser.c"
     break;
 
-  case 33:
-#line 402 "conf_parser.y" /* yacc.c:1652  */
-    { (yyval.number) = (yyvsp[-2].number) * 60 * 60 + (yyvsp[0].number); }
-#line 2879 "conf_parser.c" /* yacc.c:1652  */
+  case 33: /* timespec: NUMBER HOURS timespec_  */
+#line 404 "conf_parser.y"
+                                    { (yyval.number) = (yyvsp[-2].number) * 60 * 60 + (yyvsp[0].number); }
+#line 3296 "conf_parser.c"
     break;
 
-  case 34:
-#line 403 "conf_parser.y" /* yacc.c:1652  */
-    { (yyval.number) = (yyvsp[-2].number) * 60 * 60 * 24 + (yyvsp[0].number); }
-#line 2885 "conf_parser.c" /* yacc.c:1652  */
+  case 34: /* timespec: NUMBER DAYS timespec_  */
+#line 405 "conf_parser.y"
+                                    { (yyval.number) = (yyvsp[-2].number) * 60 * 60 * 24 + (yyvsp[0].number); }
+#line 3302 "conf_parser.c"
     break;
 
-  case 35:
-#line 404 "conf_parser.y" /* yacc.c:1652  */
-    { (yyval.number) = (yyvsp[-2].number) * 60 * 60 * 24 * 7 + (yyvsp[0].number); }
-#line 2891 "conf_parser.c" /* yacc.c:1652  */
+  case 35: /* timespec: NUMBER WEEKS timespec_  */
+#line 406 "conf_parser.y"
+                                    { (yyval.number) = (yyvsp[-2].number) * 60 * 60 * 24 * 7 + (yyvsp[0].number); }
+#line 3308 "conf_parser.c"
     break;
 
-  case 36:
-#line 405 "conf_parser.y" /* yacc.c:1652  */
-    { (yyval.number) = (yyvsp[-2].number) * 60 * 60 * 24 * 7 * 4 + (yyvsp[0].number); }
-#line 2897 "conf_parser.c" /* yacc.c:1652  */
+  case 36: /* timespec: NUMBER MONTHS timespec_  */
+#line 407 "conf_parser.y"
+                                    { (yyval.number) = (yyvsp[-2].number) * 60 * 60 * 24 * 7 * 4 + (yyvsp[0].number); }
+#line 3314 "conf_parser.c"
     break;
 
-  case 37:
-#line 406 "conf_parser.y" /* yacc.c:1652  */
-    { (yyval.number) = (yyvsp[-2].number) * 60 * 60 * 24 * 365 + (yyvsp[0].number); }
-#line 2903 "conf_parser.c" /* yacc.c:1652  */
+  case 37: /* timespec: NUMBER YEARS timespec_  */
+#line 408 "conf_parser.y"
+                                    { (yyval.number) = (yyvsp[-2].number) * 60 * 60 * 24 * 365 + (yyvsp[0].number); }
+#line 3320 "conf_parser.c"
     break;
 
-  case 38:
-#line 409 "conf_parser.y" /* yacc.c:1652  */
-    { (yyval.number) = 0; }
-#line 2909 "conf_parser.c" /* yacc.c:1652  */
+  case 38: /* sizespec_: %empty  */
+#line 411 "conf_parser.y"
+            { (yyval.number) = 0; }
+#line 3326 "conf_parser.c"
     break;
 
-  case 40:
-#line 410 "conf_parser.y" /* yacc.c:1652  */
-    { (yyval.number) = (yyvsp[-1].number) + (yyvsp[0].number); }
-#line 2915 "conf_parser.c" /* yacc.c:1652  */
+  case 40: /* sizespec: NUMBER sizespec_  */
+#line 412 "conf_parser.y"
+                             { (yyval.number) = (yyvsp[-1].number) + (yyvsp[0].number); }
+#line 3332 "conf_parser.c"
     break;
 
-  case 41:
-#line 411 "conf_parser.y" /* yacc.c:1652  */
-    { (yyval.number) = (yyvsp[-2].number) + (yyvsp[0].number); }
-#line 2921 "conf_parser.c" /* yacc.c:1652  */
+  case 41: /* sizespec: NUMBER BYTES sizespec_  */
+#line 413 "conf_parser.y"
+                                   { (yyval.number) = (yyvsp[-2].number) + (yyvsp[0].number); }
+#line 3338 "conf_parser.c"
     break;
 
-  case 42:
-#line 412 "conf_parser.y" /* yacc.c:1652  */
-    { (yyval.number) = (yyvsp[-2].number) * 1024 + (yyvsp[0].number); }
-#line 2927 "conf_parser.c" /* yacc.c:1652  */
+  case 42: /* sizespec: NUMBER KBYTES sizespec_  */
+#line 414 "conf_parser.y"
+                                    { (yyval.number) = (yyvsp[-2].number) * 1024 + (yyvsp[0].number); }
+#line 3344 "conf_parser.c"
     break;
 
-  case 43:
-#line 413 "conf_parser.y" /* yacc.c:1652  */
-    { (yyval.number) = (yyvsp[-2].number) * 1024 * 1024 + (yyvsp[0].number); }
-#line 2933 "conf_parser.c" /* yacc.c:1652  */
+  case 43: /* sizespec: NUMBER MBYTES sizespec_  */
+#line 415 "conf_parser.y"
+                                    { (yyval.number) = (yyvsp[-2].number) * 1024 * 1024 + (yyvsp[0].number); }
+#line 3350 "conf_parser.c"
     break;
 
-  case 50:
-#line 426 "conf_parser.y" /* yacc.c:1652  */
-    {
+  case 50: /* modules_module: MODULE '=' QSTRING ';'  */
+#line 428 "conf_parser.y"
+{
   if (conf_parser_ctx.pass == 2)
     add_conf_module(libio_basename(yylval.string));
 }
-#line 2942 "conf_parser.c" /* yacc.c:1652  */
+#line 3359 "conf_parser.c"
     break;
 
-  case 51:
-#line 432 "conf_parser.y" /* yacc.c:1652  */
-    {
+  case 51: /* modules_path: PATH '=' QSTRING ';'  */
+#line 434 "conf_parser.y"
+{
   if (conf_parser_ctx.pass == 2)
     mod_add_path(yylval.string);
 }
-#line 2951 "conf_parser.c" /* yacc.c:1652  */
+#line 3368 "conf_parser.c"
     break;
 
-  case 72:
-#line 464 "conf_parser.y" /* yacc.c:1652  */
-    {
+  case 72: /* serverinfo_tls_certificate_file: TLS_CERTIFICATE_FILE '=' QSTRING ';'  */
+#line 466 "conf_parser.y"
+{
   if (conf_parser_ctx.pass == 2)
   {
     xfree(ConfigServerInfo.tls_certificate_file);
     ConfigServerInfo.tls_certificate_file = xstrdup(yylval.string);
   }
 }
-#line 2963 "conf_parser.c" /* yacc.c:1652  */
+#line 3380 "conf_parser.c"
     break;
 
-  case 73:
-#line 473 "conf_parser.y" /* yacc.c:1652  */
-    {
+  case 73: /* serverinfo_rsa_private_key_file: RSA_PRIVATE_KEY_FILE '=' QSTRING ';'  */
+#line 475 "conf_parser.y"
+{
   if (conf_parser_ctx.pass == 2)
   {
     xfree(ConfigServerInfo.rsa_private_key_file);
     ConfigServerInfo.rsa_private_key_file = xstrdup(yylval.string);
   }
 }
-#line 2975 "conf_parser.c" /* yacc.c:1652  */
+#line 3392 "conf_parser.c"
     break;
 
-  case 74:
-#line 482 "conf_parser.y" /* yacc.c:1652  */
-    {
+  case 74: /* serverinfo_tls_dh_param_file: TLS_DH_PARAM_FILE '=' QSTRING ';'  */
+#line 484 "conf_parser.y"
+{
   if (conf_parser_ctx.pass == 2)
   {
     xfree(ConfigServerInfo.tls_dh_param_file);
     ConfigServerInfo.tls_dh_param_file = xstrdup(yylval.string);
   }
 }
-#line 2987 "conf_parser.c" /* yacc.c:1652  */
+#line 3404 "conf_parser.c"
     break;
 
-  case 75:
-#line 491 "conf_parser.y" /* yacc.c:1652  */
-    {
+  case 75: /* serverinfo_tls_cipher_list: TLS_CIPHER_LIST '=' QSTRING ';'  */
+#line 493 "conf_parser.y"
+{
   if (conf_parser_ctx.pass == 2)
   {
     xfree(ConfigServerInfo.tls_cipher_list);
     ConfigServerInfo.tls_cipher_list = xstrdup(yylval.string);
   }
 }
-#line 2999 "conf_parser.c" /* yacc.c:1652  */
+#line 3416 "conf_parser.c"
     break;
 
-  case 76:
-#line 500 "conf_parser.y" /* yacc.c:1652  */
-    {
+  case 76: /* serverinfo_tls_cipher_suites: TLS_CIPHER_SUITES '=' QSTRING ';'  */
+#line 502 "conf_parser.y"
+{
   if (conf_parser_ctx.pass == 2)
   {
     xfree(ConfigServerInfo.tls_cipher_suites);
     ConfigServerInfo.tls_cipher_suites = xstrdup(yylval.string);
   }
 }
-#line 3011 "conf_parser.c" /* yacc.c:1652  */
+#line 3428 "conf_parser.c"
     break;
 
-  case 77:
-#line 509 "conf_parser.y" /* yacc.c:1652  */
-    {
+  case 77: /* serverinfo_tls_message_digest_algorithm: TLS_MESSAGE_DIGEST_ALGORITHM '=' QSTRING ';'  */
+#line 511 "conf_parser.y"
+{
   if (conf_parser_ctx.pass == 2)
   {
     xfree(ConfigServerInfo.tls_message_digest_algorithm);
     ConfigServerInfo.tls_message_digest_algorithm = xstrdup(yylval.string);
   }
 }
-#line 3023 "conf_parser.c" /* yacc.c:1652  */
+#line 3440 "conf_parser.c"
     break;
 
-  case 78:
-#line 518 "conf_parser.y" /* yacc.c:1652  */
-    {
+  case 78: /* serverinfo_tls_supported_groups: TLS_SUPPORTED_GROUPS '=' QSTRING ';'  */
+#line 520 "conf_parser.y"
+{
   if (conf_parser_ctx.pass == 2)
   {
     xfree(ConfigServerInfo.tls_supported_groups);
     ConfigServerInfo.tls_supported_groups = xstrdup(yylval.string);
   }
 }
-#line 3035 "conf_parser.c" /* yacc.c:1652  */
+#line 3452 "conf_parser.c"
     break;
 
-  case 79:
-#line 527 "conf_parser.y" /* yacc.c:1652  */
-    {
+  case 79: /* serverinfo_name: NAME '=' QSTRING ';'  */
+#line 529 "conf_parser.y"
+{
   /* This isn't rehashable */
   if (conf_parser_ctx.pass == 2 && ConfigServerInfo.name == NULL)
   {
@@ -3049,12 +3466,12 @@ yyreduce:
     }
   }
 }
-#line 3053 "conf_parser.c" /* yacc.c:1652  */
+#line 3470 "conf_parser.c"
     break;
 
-  case 80:
-#line 542 "conf_parser.y" /* yacc.c:1652  */
-    {
+  case 80: /* serverinfo_sid: IRCD_SID '=' QSTRING ';'  */
+#line 544 "conf_parser.y"
+{
   /* This isn't rehashable */
   if (conf_parser_ctx.pass == 2 && ConfigServerInfo.sid == NULL)
   {
@@ -3067,25 +3484,25 @@ yyreduce:
     }
   }
 }
-#line 3071 "conf_parser.c" /* yacc.c:1652  */
+#line 3488 "conf_parser.c"
     break;
 
-  case 81:
-#line 557 "conf_parser.y" /* yacc.c:1652  */
-    {
+  case 81: /* serverinfo_description: DESCRIPTION '=' QSTRING ';'  */
+#line 559 "conf_parser.y"
+{
   if (conf_parser_ctx.pass == 2)
   {
     xfree(ConfigServerInfo.description);
     ConfigServerInfo.description = xstrdup(yylval.string);
-    strlcpy(me.info, ConfigServerInfo.description, sizeof(me.info));
+    strlcpy(me.cold->info, ConfigServerInfo.description, sizeof(me.cold->info));
   }
 }
-#line 3084 "conf_parser.c" /* yacc.c:1652  */
+#line 3501 "conf_parser.c"
     break;
 
-  case 82:
-#line 567 "conf_parser.y" /* yacc.c:1652  */
-    {
+  case 82: /* serverinfo_network_name: NETWORK_NAME '=' QSTRING ';'  */
+#line 569 "conf_parser.y"
+{
   if (conf_parser_ctx.pass == 2)
   {
     char *p = strchr(yylval.string, ' ');
@@ -3097,24 +3514,24 @@ yyreduce:
     ConfigServerInfo.network_name = xstrdup(yylval.string);
   }
 }
-#line 3101 "conf_parser.c" /* yacc.c:1652  */
+#line 3518 "conf_parser.c"
     break;
 
-  case 83:
-#line 581 "conf_parser.y" /* yacc.c:1652  */
-    {
+  case 83: /* serverinfo_network_desc: NETWORK_DESC '=' QSTRING ';'  */
+#line 583 "conf_parser.y"
+{
   if (conf_parser_ctx.pass != 2)
     break;
 
   xfree(ConfigServerInfo.network_desc);
   ConfigServerInfo.network_desc = xstrdup(yylval.string);
 }
-#line 3113 "conf_parser.c" /* yacc.c:1652  */
+#line 3530 "conf_parser.c"
     break;
 
-  case 84:
-#line 590 "conf_parser.y" /* yacc.c:1652  */
-    {
+  case 84: /* serverinfo_default_max_clients: DEFAULT_MAX_CLIENTS '=' NUMBER ';'  */
+#line 592 "conf_parser.y"
+{
   if (conf_parser_ctx.pass != 2)
     break;
 
@@ -3135,12 +3552,12 @@ yyreduce:
   else
     ConfigServerInfo.default_max_clients = (yyvsp[-1].number);
 }
-#line 3139 "conf_parser.c" /* yacc.c:1652  */
+#line 3556 "conf_parser.c"
     break;
 
-  case 85:
-#line 613 "conf_parser.y" /* yacc.c:1652  */
-    {
+  case 85: /* serverinfo_max_nick_length: MAX_NICK_LENGTH '=' NUMBER ';'  */
+#line 615 "conf_parser.y"
+{
   if (conf_parser_ctx.pass != 2)
     break;
 
@@ -3161,12 +3578,12 @@ yyreduce:
   else
     ConfigServerInfo.max_nick_length = (yyvsp[-1].number);
 }
-#line 3165 "conf_parser.c" /* yacc.c:1652  */
+#line 3582 "conf_parser.c"
     break;
 
-  case 86:
-#line 636 "conf_parser.y" /* yacc.c:1652  */
-    {
+  case 86: /* serverinfo_max_topic_length: MAX_TOPIC_LENGTH '=' NUMBER ';'  */
+#line 638 "conf_parser.y"
+{
   if (conf_parser_ctx.pass != 2)
     break;
 
@@ -3187,66 +3604,66 @@ yyreduce:
   else
     ConfigServerInfo.max_topic_length = (yyvsp[-1].number);
 }
-#line 3191 "conf_parser.c" /* yacc.c:1652  */
+#line 3608 "conf_parser.c"
     break;
 
-  case 87:
-#line 659 "conf_parser.y" /* yacc.c:1652  */
-    {
+  case 87: /* serverinfo_hub: HUB '=' TBOOL ';'  */
+#line 661 "conf_parser.y"
+{
   if (conf_parser_ctx.pass == 2)
     ConfigServerInfo.hub = yylval.number;
 }
-#line 3200 "conf_parser.c" /* yacc.c:1652  */
+#line 3617 "conf_parser.c"
     break;
 
-  case 95:
-#line 677 "conf_parser.y" /* yacc.c:1652  */
-    {
+  case 95: /* admin_name: NAME '=' QSTRING ';'  */
+#line 679 "conf_parser.y"
+{
   if (conf_parser_ctx.pass != 2)
     break;
 
   xfree(ConfigAdminInfo.name);
   ConfigAdminInfo.name = xstrdup(yylval.string);
 }
-#line 3212 "conf_parser.c" /* yacc.c:1652  */
+#line 3629 "conf_parser.c"
     break;
 
-  case 96:
-#line 686 "conf_parser.y" /* yacc.c:1652  */
-    {
+  case 96: /* admin_email: EMAIL '=' QSTRING ';'  */
+#line 688 "conf_parser.y"
+{
   if (conf_parser_ctx.pass != 2)
     break;
 
   xfree(ConfigAdminInfo.email);
   ConfigAdminInfo.email = xstrdup(yylval.string);
 }
-#line 3224 "conf_parser.c" /* yacc.c:1652  */
+#line 3641 "conf_parser.c"
     break;
 
-  case 97:
-#line 695 "conf_parser.y" /* yacc.c:1652  */
-    {
+  case 97: /* admin_description: DESCRIPTION '=' QSTRING ';'  */
+#line 697 "conf_parser.y"
+{
   if (conf_parser_ctx.pass != 2)
     break;
 
   xfree(ConfigAdminInfo.description);
   ConfigAdminInfo.description = xstrdup(yylval.string);
 }
-#line 3236 "conf_parser.c" /* yacc.c:1652  */
+#line 3653 "conf_parser.c"
     break;
 
-  case 98:
-#line 708 "conf_parser.y" /* yacc.c:1652  */
-    {
+  case 98: /* $@1: %empty  */
+#line 710 "conf_parser.y"
+{
   if (conf_parser_ctx.pass == 2)
     reset_block_state();
 }
-#line 3245 "conf_parser.c" /* yacc.c:1652  */
+#line 3662 "conf_parser.c"
     break;
 
-  case 99:
-#line 712 "conf_parser.y" /* yacc.c:1652  */
-    {
+  case 99: /* motd_entry: MOTD $@1 '{' motd_items '}' ';'  */
+#line 714 "conf_parser.y"
+{
   dlink_node *node;
 
   if (conf_parser_ctx.pass != 2)
@@ -3258,39 +3675,39 @@ yyreduce:
   DLINK_FOREACH(node, block_state.mask.list.head)
     motd_add(node->data, block_state.file.buf);
 }
-#line 3262 "conf_parser.c" /* yacc.c:1652  */
+#line 3679 "conf_parser.c"
     break;
 
-  case 105:
-#line 729 "conf_parser.y" /* yacc.c:1652  */
-    {
+  case 105: /* motd_mask: MASK '=' QSTRING ';'  */
+#line 731 "conf_parser.y"
+{
   if (conf_parser_ctx.pass == 2)
     dlinkAdd(xstrdup(yylval.string), make_dlink_node(), &block_state.mask.list);
 }
-#line 3271 "conf_parser.c" /* yacc.c:1652  */
+#line 3688 "conf_parser.c"
     break;
 
-  case 106:
-#line 735 "conf_parser.y" /* yacc.c:1652  */
-    {
+  case 106: /* motd_file: T_FILE '=' QSTRING ';'  */
+#line 737 "conf_parser.y"
+{
   if (conf_parser_ctx.pass == 2)
     strlcpy(block_state.file.buf, yylval.string, sizeof(block_state.file.buf));
 }
-#line 3280 "conf_parser.c" /* yacc.c:1652  */
+#line 3697 "conf_parser.c"
     break;
 
-  case 107:
-#line 745 "conf_parser.y" /* yacc.c:1652  */
-    {
+  case 107: /* $@2: %empty  */
+#line 747 "conf_parser.y"
+{
   if (conf_parser_ctx.pass == 2)
     reset_block_state();
 }
-#line 3289 "conf_parser.c" /* yacc.c:1652  */
+#line 3706 "conf_parser.c"
     break;
 
-  case 108:
-#line 749 "conf_parser.y" /* yacc.c:1652  */
-    {
+  case 108: /* pseudo_entry: T_PSEUDO $@2 '{' pseudo_items '}' ';'  */
+#line 751 "conf_parser.y"
+{
   if (conf_parser_ctx.pass != 2)
     break;
 
@@ -3303,39 +3720,39 @@ yyreduce:
   pseudo_register(block_state.name.buf, block_state.nick.buf, block_state.host.buf,
                   block_state.prepend.buf, block_state.command.buf);
 }
-#line 3307 "conf_parser.c" /* yacc.c:1652  */
+#line 3724 "conf_parser.c"
     break;
 
-  case 116:
-#line 767 "conf_parser.y" /* yacc.c:1652  */
-    {
+  case 116: /* pseudo_command: T_COMMAND '=' QSTRING ';'  */
+#line 769 "conf_parser.y"
+{
   if (conf_parser_ctx.pass == 2)
     strlcpy(block_state.command.buf, yylval.string, sizeof(block_state.command.buf));
 }
-#line 3316 "conf_parser.c" /* yacc.c:1652  */
+#line 3733 "conf_parser.c"
     break;
 
-  case 117:
-#line 773 "conf_parser.y" /* yacc.c:1652  */
-    {
+  case 117: /* pseudo_name: NAME '=' QSTRING ';'  */
+#line 775 "conf_parser.y"
+{
   if (conf_parser_ctx.pass == 2)
     strlcpy(block_state.name.buf, yylval.string, sizeof(block_state.name.buf));
 }
-#line 3325 "conf_parser.c" /* yacc.c:1652  */
+#line 3742 "conf_parser.c"
     break;
 
-  case 118:
-#line 779 "conf_parser.y" /* yacc.c:1652  */
-    {
+  case 118: /* pseudo_prepend: T_PREPEND '=' QSTRING ';'  */
+#line 781 "conf_parser.y"
+{
   if (conf_parser_ctx.pass == 2)
     strlcpy(block_state.prepend.buf, yylval.string, sizeof(block_state.prepend.buf));
 }
-#line 3334 "conf_parser.c" /* yacc.c:1652  */
+#line 3751 "conf_parser.c"
     break;
 
-  case 119:
-#line 785 "conf_parser.y" /* yacc.c:1652  */
-    {
+  case 119: /* pseudo_target: T_TARGET '=' QSTRING ';'  */
+#line 787 "conf_parser.y"
+{
   if (conf_parser_ctx.pass == 2)
   {
     struct split_nuh_item nuh;
@@ -3351,30 +3768,30 @@ yyreduce:
     split_nuh(&nuh);
   }
 }
-#line 3355 "conf_parser.c" /* yacc.c:1652  */
+#line 3772 "conf_parser.c"
     break;
 
-  case 126:
-#line 813 "conf_parser.y" /* yacc.c:1652  */
-    {
+  case 126: /* logging_use_logging: USE_LOGGING '=' TBOOL ';'  */
+#line 815 "conf_parser.y"
+{
   if (conf_parser_ctx.pass == 2)
     ConfigLog.use_logging = yylval.number;
 }
-#line 3364 "conf_parser.c" /* yacc.c:1652  */
+#line 3781 "conf_parser.c"
     break;
 
-  case 127:
-#line 819 "conf_parser.y" /* yacc.c:1652  */
-    {
+  case 127: /* $@3: %empty  */
+#line 821 "conf_parser.y"
+{
   if (conf_parser_ctx.pass == 2)
     reset_block_state();
 }
-#line 3373 "conf_parser.c" /* yacc.c:1652  */
+#line 3790 "conf_parser.c"
     break;
 
-  case 128:
-#line 823 "conf_parser.y" /* yacc.c:1652  */
-    {
+  case 128: /* logging_file_entry: $@3 T_FILE '{' logging_file_items '}' ';'  */
+#line 825 "conf_parser.y"
+{
   if (conf_parser_ctx.pass != 2)
     break;
 
@@ -3382,132 +3799,132 @@ yyreduce:
     log_set_file(block_state.type.value, block_state.size.value,
                  block_state.file.buf);
 }
-#line 3386 "conf_parser.c" /* yacc.c:1652  */
+#line 3803 "conf_parser.c"
     break;
 
-  case 135:
-#line 839 "conf_parser.y" /* yacc.c:1652  */
-    {
+  case 135: /* logging_file_name: NAME '=' QSTRING ';'  */
+#line 841 "conf_parser.y"
+{
   if (conf_parser_ctx.pass != 2)
     break;
 
   strlcpy(block_state.file.buf, yylval.string, sizeof(block_state.file.buf));
 }
-#line 3397 "conf_parser.c" /* yacc.c:1652  */
+#line 3814 "conf_parser.c"
     break;
 
-  case 136:
-#line 847 "conf_parser.y" /* yacc.c:1652  */
-    {
+  case 136: /* logging_file_size: T_SIZE '=' sizespec ';'  */
+#line 849 "conf_parser.y"
+{
   block_state.size.value = (yyvsp[-1].number);
 }
-#line 3405 "conf_parser.c" /* yacc.c:1652  */
+#line 3822 "conf_parser.c"
     break;
 
-  case 137:
-#line 850 "conf_parser.y" /* yacc.c:1652  */
-    {
+  case 137: /* logging_file_size: T_SIZE '=' T_UNLIMITED ';'  */
+#line 852 "conf_parser.y"
+{
   block_state.size.value = 0;
 }
-#line 3413 "conf_parser.c" /* yacc.c:1652  */
+#line 3830 "conf_parser.c"
     break;
 
-  case 138:
-#line 855 "conf_parser.y" /* yacc.c:1652  */
-    {
+  case 138: /* $@4: %empty  */
+#line 857 "conf_parser.y"
+{
   if (conf_parser_ctx.pass == 2)
     block_state.type.value = 0;
 }
-#line 3422 "conf_parser.c" /* yacc.c:1652  */
+#line 3839 "conf_parser.c"
     break;
 
-  case 142:
-#line 862 "conf_parser.y" /* yacc.c:1652  */
-    {
+  case 142: /* logging_file_type_item: USER  */
+#line 864 "conf_parser.y"
+{
   if (conf_parser_ctx.pass == 2)
     block_state.type.value = LOG_TYPE_USER;
 }
-#line 3431 "conf_parser.c" /* yacc.c:1652  */
+#line 3848 "conf_parser.c"
     break;
 
-  case 143:
-#line 866 "conf_parser.y" /* yacc.c:1652  */
-    {
+  case 143: /* logging_file_type_item: OPERATOR  */
+#line 868 "conf_parser.y"
+{
   if (conf_parser_ctx.pass == 2)
     block_state.type.value = LOG_TYPE_OPER;
 }
-#line 3440 "conf_parser.c" /* yacc.c:1652  */
+#line 3857 "conf_parser.c"
     break;
 
-  case 144:
-#line 870 "conf_parser.y" /* yacc.c:1652  */
-    {
+  case 144: /* logging_file_type_item: XLINE  */
+#line 872 "conf_parser.y"
+{
   if (conf_parser_ctx.pass == 2)
     block_state.type.value = LOG_TYPE_XLINE;
 }
-#line 3449 "conf_parser.c" /* yacc.c:1652  */
+#line 3866 "conf_parser.c"
     break;
 
-  case 145:
-#line 874 "conf_parser.y" /* yacc.c:1652  */
-    {
+  case 145: /* logging_file_type_item: RESV  */
+#line 876 "conf_parser.y"
+{
   if (conf_parser_ctx.pass == 2)
     block_state.type.value = LOG_TYPE_RESV;
 }
-#line 3458 "conf_parser.c" /* yacc.c:1652  */
+#line 3875 "conf_parser.c"
     break;
 
-  case 146:
-#line 878 "conf_parser.y" /* yacc.c:1652  */
-    {
+  case 146: /* logging_file_type_item: T_DLINE  */
+#line 880 "conf_parser.y"
+{
   if (conf_parser_ctx.pass == 2)
     block_state.type.value = LOG_TYPE_DLINE;
 }
-#line 3467 "conf_parser.c" /* yacc.c:1652  */
+#line 3884 "conf_parser.c"
     break;
 
-  case 147:
-#line 882 "conf_parser.y" /* yacc.c:1652  */
-    {
+  case 147: /* logging_file_type_item: KLINE  */
+#line 884 "conf_parser.y"
+{
   if (conf_parser_ctx.pass == 2)
     block_state.type.value = LOG_TYPE_KLINE;
 }
-#line 3476 "conf_parser.c" /* yacc.c:1652  */
+#line 3893 "conf_parser.c"
     break;
 
-  case 148:
-#line 886 "conf_parser.y" /* yacc.c:1652  */
-    {
+  case 148: /* logging_file_type_item: KILL  */
+#line 888 "conf_parser.y"
+{
   if (conf_parser_ctx.pass == 2)
     block_state.type.value = LOG_TYPE_KILL;
 }
-#line 3485 "conf_parser.c" /* yacc.c:1652  */
+#line 3902 "conf_parser.c"
     break;
 
-  case 149:
-#line 890 "conf_parser.y" /* yacc.c:1652  */
-    {
+  case 149: /* logging_file_type_item: T_DEBUG  */
+#line 892 "conf_parser.y"
+{
   if (conf_parser_ctx.pass == 2)
     block_state.type.value = LOG_TYPE_DEBUG;
 }
-#line 3494 "conf_parser.c" /* yacc.c:1652  */
+#line 3911 "conf_parser.c"
     break;
 
-  case 150:
-#line 900 "conf_parser.y" /* yacc.c:1652  */
-    {
+  case 150: /* $@5: %empty  */
+#line 902 "conf_parser.y"
+{
   if (conf_parser_ctx.pass != 2)
     break;
 
   reset_block_state();
   block_state.flags.value |= CONF_FLAGS_ENCRYPTED;
 }
-#line 3506 "conf_parser.c" /* yacc.c:1652  */
+#line 3923 "conf_parser.c"
     break;
 
-  case 151:
-#line 907 "conf_parser.y" /* yacc.c:1652  */
-    {
+  case 151: /* oper_entry: OPERATOR $@5 '{' oper_items '}' ';'  */
+#line 909 "conf_parser.y"
+{
   dlink_node *node;
 
   if (conf_parser_ctx.pass != 2)
@@ -3561,48 +3978,48 @@ yyreduce:
     conf_add_class_to_conf(conf, block_state.class.buf);
   }
 }
-#line 3565 "conf_parser.c" /* yacc.c:1652  */
+#line 3982 "conf_parser.c"
     break;
 
-  case 165:
-#line 976 "conf_parser.y" /* yacc.c:1652  */
-    {
+  case 165: /* oper_name: NAME '=' QSTRING ';'  */
+#line 978 "conf_parser.y"
+{
   if (conf_parser_ctx.pass == 2)
     strlcpy(block_state.name.buf, yylval.string, sizeof(block_state.name.buf));
 }
-#line 3574 "conf_parser.c" /* yacc.c:1652  */
+#line 3991 "conf_parser.c"
     break;
 
-  case 166:
-#line 982 "conf_parser.y" /* yacc.c:1652  */
-    {
+  case 166: /* oper_user: USER '=' QSTRING ';'  */
+#line 984 "conf_parser.y"
+{
   if (conf_parser_ctx.pass == 2)
     dlinkAdd(xstrdup(yylval.string), make_dlink_node(), &block_state.mask.list);
 }
-#line 3583 "conf_parser.c" /* yacc.c:1652  */
+#line 4000 "conf_parser.c"
     break;
 
-  case 167:
-#line 988 "conf_parser.y" /* yacc.c:1652  */
-    {
+  case 167: /* oper_password: PASSWORD '=' QSTRING ';'  */
+#line 990 "conf_parser.y"
+{
   if (conf_parser_ctx.pass == 2)
     strlcpy(block_state.rpass.buf, yylval.string, sizeof(block_state.rpass.buf));
 }
-#line 3592 "conf_parser.c" /* yacc.c:1652  */
+#line 4009 "conf_parser.c"
     break;
 
-  case 168:
-#line 994 "conf_parser.y" /* yacc.c:1652  */
-    {
+  case 168: /* oper_whois: WHOIS '=' QSTRING ';'  */
+#line 996 "conf_parser.y"
+{
   if (conf_parser_ctx.pass == 2)
     strlcpy(block_state.whois.buf, yylval.string, sizeof(block_state.whois.buf));
 }
-#line 3601 "conf_parser.c" /* yacc.c:1652  */
+#line 4018 "conf_parser.c"
     break;
 
-  case 169:
-#line 1000 "conf_parser.y" /* yacc.c:1652  */
-    {
+  case 169: /* oper_encrypted: ENCRYPTED '=' TBOOL ';'  */
+#line 1002 "conf_parser.y"
+{
   if (conf_parser_ctx.pass != 2)
     break;
 
@@ -3611,21 +4028,21 @@ yyreduce:
   else
     block_state.flags.value &= ~CONF_FLAGS_ENCRYPTED;
 }
-#line 3615 "conf_parser.c" /* yacc.c:1652  */
+#line 4032 "conf_parser.c"
     break;
 
-  case 170:
-#line 1011 "conf_parser.y" /* yacc.c:1652  */
-    {
+  case 170: /* oper_tls_certificate_fingerprint: TLS_CERTIFICATE_FINGERPRINT '=' QSTRING ';'  */
+#line 1013 "conf_parser.y"
+{
   if (conf_parser_ctx.pass == 2)
     strlcpy(block_state.cert.buf, yylval.string, sizeof(block_state.cert.buf));
 }
-#line 3624 "conf_parser.c" /* yacc.c:1652  */
+#line 4041 "conf_parser.c"
     break;
 
-  case 171:
-#line 1017 "conf_parser.y" /* yacc.c:1652  */
-    {
+  case 171: /* oper_tls_connection_required: TLS_CONNECTION_REQUIRED '=' TBOOL ';'  */
+#line 1019 "conf_parser.y"
+{
   if (conf_parser_ctx.pass != 2)
     break;
 
@@ -3634,507 +4051,507 @@ yyreduce:
   else
     block_state.flags.value &= ~CONF_FLAGS_TLS;
 }
-#line 3638 "conf_parser.c" /* yacc.c:1652  */
+#line 4055 "conf_parser.c"
     break;
 
-  case 172:
-#line 1028 "conf_parser.y" /* yacc.c:1652  */
-    {
+  case 172: /* oper_class: CLASS '=' QSTRING ';'  */
+#line 1030 "conf_parser.y"
+{
   if (conf_parser_ctx.pass == 2)
     strlcpy(block_state.class.buf, yylval.string, sizeof(block_state.class.buf));
 }
-#line 3647 "conf_parser.c" /* yacc.c:1652  */
+#line 4064 "conf_parser.c"
     break;
 
-  case 173:
-#line 1034 "conf_parser.y" /* yacc.c:1652  */
-    {
+  case 173: /* $@6: %empty  */
+#line 1036 "conf_parser.y"
+{
   if (conf_parser_ctx.pass == 2)
     block_state.modes.value = 0;
 }
-#line 3656 "conf_parser.c" /* yacc.c:1652  */
+#line 4073 "conf_parser.c"
     break;
 
-  case 177:
-#line 1041 "conf_parser.y" /* yacc.c:1652  */
-    {
+  case 177: /* oper_umodes_item: T_BOTS  */
+#line 1043 "conf_parser.y"
+{
   if (conf_parser_ctx.pass == 2)
     block_state.modes.value |= UMODE_BOTS;
 }
-#line 3665 "conf_parser.c" /* yacc.c:1652  */
+#line 4082 "conf_parser.c"
     break;
 
-  case 178:
-#line 1045 "conf_parser.y" /* yacc.c:1652  */
-    {
+  case 178: /* oper_umodes_item: T_CCONN  */
+#line 1047 "conf_parser.y"
+{
   if (conf_parser_ctx.pass == 2)
     block_state.modes.value |= UMODE_CCONN;
 }
-#line 3674 "conf_parser.c" /* yacc.c:1652  */
+#line 4091 "conf_parser.c"
     break;
 
-  case 179:
-#line 1049 "conf_parser.y" /* yacc.c:1652  */
-    {
+  case 179: /* oper_umodes_item: T_DEAF  */
+#line 1051 "conf_parser.y"
+{
   if (conf_parser_ctx.pass == 2)
     block_state.modes.value |= UMODE_DEAF;
 }
-#line 3683 "conf_parser.c" /* yacc.c:1652  */
+#line 4100 "conf_parser.c"
     break;
 
-  case 180:
-#line 1053 "conf_parser.y" /* yacc.c:1652  */
-    {
+  case 180: /* oper_umodes_item: T_DEBUG  */
+#line 1055 "conf_parser.y"
+{
   if (conf_parser_ctx.pass == 2)
     block_state.modes.value |= UMODE_DEBUG;
 }
-#line 3692 "conf_parser.c" /* yacc.c:1652  */
+#line 4109 "conf_parser.c"
     break;
 
-  case 181:
-#line 1057 "conf_parser.y" /* yacc.c:1652  */
-    {
+  case 181: /* oper_umodes_item: T_FULL  */
+#line 1059 "conf_parser.y"
+{
   if (conf_parser_ctx.pass == 2)
     block_state.modes.value |= UMODE_FULL;
 }
-#line 3701 "conf_parser.c" /* yacc.c:1652  */
+#line 4118 "conf_parser.c"
     break;
 
-  case 182:
-#line 1061 "conf_parser.y" /* yacc.c:1652  */
-    {
+  case 182: /* oper_umodes_item: HIDDEN  */
+#line 1063 "conf_parser.y"
+{
   if (conf_parser_ctx.pass == 2)
     block_state.modes.value |= UMODE_HIDDEN;
 }
-#line 3710 "conf_parser.c" /* yacc.c:1652  */
+#line 4127 "conf_parser.c"
     break;
 
-  case 183:
-#line 1065 "conf_parser.y" /* yacc.c:1652  */
-    {
+  case 183: /* oper_umodes_item: HIDE_CHANS  */
+#line 1067 "conf_parser.y"
+{
   if (conf_parser_ctx.pass == 2)
     block_state.modes.value |= UMODE_HIDECHANS;
 }
-#line 3719 "conf_parser.c" /* yacc.c:1652  */
+#line 4136 "conf_parser.c"
     break;
 
-  case 184:
-#line 1069 "conf_parser.y" /* yacc.c:1652  */
-    {
+  case 184: /* oper_umodes_item: HIDE_IDLE  */
+#line 1071 "conf_parser.y"
+{
   if (conf_parser_ctx.pass == 2)
     block_state.modes.value |= UMODE_HIDEIDLE;
 }
-#line 3728 "conf_parser.c" /* yacc.c:1652  */
+#line 4145 "conf_parser.c"
     break;
 
-  case 185:
-#line 1073 "conf_parser.y" /* yacc.c:1652  */
-    {
+  case 185: /* oper_umodes_item: T_SKILL  */
+#line 1075 "conf_parser.y"
+{
   if (conf_parser_ctx.pass == 2)
     block_state.modes.value |= UMODE_SKILL;
 }
-#line 3737 "conf_parser.c" /* yacc.c:1652  */
+#line 4154 "conf_parser.c"
     break;
 
-  case 186:
-#line 1077 "conf_parser.y" /* yacc.c:1652  */
-    {
+  case 186: /* oper_umodes_item: T_NCHANGE  */
+#line 1079 "conf_parser.y"
+{
   if (conf_parser_ctx.pass == 2)
     block_state.modes.value |= UMODE_NCHANGE;
 }
-#line 3746 "conf_parser.c" /* yacc.c:1652  */
+#line 4163 "conf_parser.c"
     break;
 
-  case 187:
-#line 1081 "conf_parser.y" /* yacc.c:1652  */
-    {
+  case 187: /* oper_umodes_item: T_REJ  */
+#line 1083 "conf_parser.y"
+{
   if (conf_parser_ctx.pass == 2)
     block_state.modes.value |= UMODE_REJ;
 }
-#line 3755 "conf_parser.c" /* yacc.c:1652  */
+#line 4172 "conf_parser.c"
     break;
 
-  case 188:
-#line 1085 "conf_parser.y" /* yacc.c:1652  */
-    {
+  case 188: /* oper_umodes_item: T_UNAUTH  */
+#line 1087 "conf_parser.y"
+{
   if (conf_parser_ctx.pass == 2)
     block_state.modes.value |= UMODE_UNAUTH;
 }
-#line 3764 "conf_parser.c" /* yacc.c:1652  */
+#line 4181 "conf_parser.c"
     break;
 
-  case 189:
-#line 1089 "conf_parser.y" /* yacc.c:1652  */
-    {
+  case 189: /* oper_umodes_item: T_SPY  */
+#line 1091 "conf_parser.y"
+{
   if (conf_parser_ctx.pass == 2)
     block_state.modes.value |= UMODE_SPY;
 }
-#line 3773 "conf_parser.c" /* yacc.c:1652  */
+#line 4190 "conf_parser.c"
     break;
 
-  case 190:
-#line 1093 "conf_parser.y" /* yacc.c:1652  */
-    {
+  case 190: /* oper_umodes_item: T_EXTERNAL  */
+#line 1095 "conf_parser.y"
+{
   if (conf_parser_ctx.pass == 2)
     block_state.modes.value |= UMODE_EXTERNAL;
 }
-#line 3782 "conf_parser.c" /* yacc.c:1652  */
+#line 4199 "conf_parser.c"
     break;
 
-  case 191:
-#line 1097 "conf_parser.y" /* yacc.c:1652  */
-    {
+  case 191: /* oper_umodes_item: T_SERVNOTICE  */
+#line 1099 "conf_parser.y"
+{
   if (conf_parser_ctx.pass == 2)
     block_state.modes.value |= UMODE_SERVNOTICE;
 }
-#line 3791 "conf_parser.c" /* yacc.c:1652  */
+#line 4208 "conf_parser.c"
     break;
 
-  case 192:
-#line 1101 "conf_parser.y" /* yacc.c:1652  */
-    {
+  case 192: /* oper_umodes_item: T_INVISIBLE  */
+#line 1103 "conf_parser.y"
+{
   if (conf_parser_ctx.pass == 2)
     block_state.modes.value |= UMODE_INVISIBLE;
 }
-#line 3800 "conf_parser.c" /* yacc.c:1652  */
+#line 4217 "conf_parser.c"
     break;
 
-  case 193:
-#line 1105 "conf_parser.y" /* yacc.c:1652  */
-    {
+  case 193: /* oper_umodes_item: T_WALLOP  */
+#line 1107 "conf_parser.y"
+{
   if (conf_parser_ctx.pass == 2)
     block_state.modes.value |= UMODE_WALLOP;
 }
-#line 3809 "conf_parser.c" /* yacc.c:1652  */
+#line 4226 "conf_parser.c"
     break;
 
-  case 194:
-#line 1109 "conf_parser.y" /* yacc.c:1652  */
-    {
+  case 194: /* oper_umodes_item: T_SOFTCALLERID  */
+#line 1111 "conf_parser.y"
+{
   if (conf_parser_ctx.pass == 2)
     block_state.modes.value |= UMODE_SOFTCALLERID;
 }
-#line 3818 "conf_parser.c" /* yacc.c:1652  */
+#line 4235 "conf_parser.c"
     break;
 
-  case 195:
-#line 1113 "conf_parser.y" /* yacc.c:1652  */
-    {
+  case 195: /* oper_umodes_item: T_CALLERID  */
+#line 1115 "conf_parser.y"
+{
   if (conf_parser_ctx.pass == 2)
     block_state.modes.value |= UMODE_CALLERID;
 }
-#line 3827 "conf_parser.c" /* yacc.c:1652  */
+#line 4244 "conf_parser.c"
     break;
 
-  case 196:
-#line 1117 "conf_parser.y" /* yacc.c:1652  */
-    {
+  case 196: /* oper_umodes_item: T_LOCOPS  */
+#line 1119 "conf_parser.y"
+{
   if (conf_parser_ctx.pass == 2)
     block_state.modes.value |= UMODE_LOCOPS;
 }
-#line 3836 "conf_parser.c" /* yacc.c:1652  */
+#line 4253 "conf_parser.c"
     break;
 
-  case 197:
-#line 1121 "conf_parser.y" /* yacc.c:1652  */
-    {
+  case 197: /* oper_umodes_item: T_NONONREG  */
+#line 1123 "conf_parser.y"
+{
   if (conf_parser_ctx.pass == 2)
     block_state.modes.value |= UMODE_REGONLY;
 }
-#line 3845 "conf_parser.c" /* yacc.c:1652  */
+#line 4262 "conf_parser.c"
     break;
 
-  case 198:
-#line 1125 "conf_parser.y" /* yacc.c:1652  */
-    {
+  case 198: /* oper_umodes_item: T_FARCONNECT  */
+#line 1127 "conf_parser.y"
+{
   if (conf_parser_ctx.pass == 2)
     block_state.modes.value |= UMODE_FARCONNECT;
 }
-#line 3854 "conf_parser.c" /* yacc.c:1652  */
+#line 4271 "conf_parser.c"
     break;
 
-  case 199:
-#line 1129 "conf_parser.y" /* yacc.c:1652  */
-    {
+  case 199: /* oper_umodes_item: EXPIRATION  */
+#line 1131 "conf_parser.y"
+{
   if (conf_parser_ctx.pass == 2)
     block_state.modes.value |= UMODE_EXPIRATION;
 }
-#line 3863 "conf_parser.c" /* yacc.c:1652  */
+#line 4280 "conf_parser.c"
     break;
 
-  case 200:
-#line 1135 "conf_parser.y" /* yacc.c:1652  */
-    {
+  case 200: /* $@7: %empty  */
+#line 1137 "conf_parser.y"
+{
   if (conf_parser_ctx.pass == 2)
     block_state.port.value = 0;
 }
-#line 3872 "conf_parser.c" /* yacc.c:1652  */
+#line 4289 "conf_parser.c"
     break;
 
-  case 204:
-#line 1142 "conf_parser.y" /* yacc.c:1652  */
-    {
+  case 204: /* oper_flags_item: KILL ':' REMOTE  */
+#line 1144 "conf_parser.y"
+{
   if (conf_parser_ctx.pass == 2)
     block_state.port.value |= OPER_FLAG_KILL_REMOTE;
 }
-#line 3881 "conf_parser.c" /* yacc.c:1652  */
+#line 4298 "conf_parser.c"
     break;
 
-  case 205:
-#line 1146 "conf_parser.y" /* yacc.c:1652  */
-    {
+  case 205: /* oper_flags_item: KILL  */
+#line 1148 "conf_parser.y"
+{
   if (conf_parser_ctx.pass == 2)
     block_state.port.value |= OPER_FLAG_KILL;
 }
-#line 3890 "conf_parser.c" /* yacc.c:1652  */
+#line 4307 "conf_parser.c"
     break;
 
-  case 206:
-#line 1150 "conf_parser.y" /* yacc.c:1652  */
-    {
+  case 206: /* oper_flags_item: CONNECT ':' REMOTE  */
+#line 1152 "conf_parser.y"
+{
   if (conf_parser_ctx.pass == 2)
     block_state.port.value |= OPER_FLAG_CONNECT_REMOTE;
 }
-#line 3899 "conf_parser.c" /* yacc.c:1652  */
+#line 4316 "conf_parser.c"
     break;
 
-  case 207:
-#line 1154 "conf_parser.y" /* yacc.c:1652  */
-    {
+  case 207: /* oper_flags_item: CONNECT  */
+#line 1156 "conf_parser.y"
+{
   if (conf_parser_ctx.pass == 2)
     block_state.port.value |= OPER_FLAG_CONNECT;
 }
-#line 3908 "conf_parser.c" /* yacc.c:1652  */
+#line 4325 "conf_parser.c"
     break;
 
-  case 208:
-#line 1158 "conf_parser.y" /* yacc.c:1652  */
-    {
+  case 208: /* oper_flags_item: SQUIT ':' REMOTE  */
+#line 1160 "conf_parser.y"
+{
   if (conf_parser_ctx.pass == 2)
     block_state.port.value |= OPER_FLAG_SQUIT_REMOTE;
 }
-#line 3917 "conf_parser.c" /* yacc.c:1652  */
+#line 4334 "conf_parser.c"
     break;
 
-  case 209:
-#line 1162 "conf_parser.y" /* yacc.c:1652  */
-    {
+  case 209: /* oper_flags_item: SQUIT  */
+#line 1164 "conf_parser.y"
+{
   if (conf_parser_ctx.pass == 2)
     block_state.port.value |= OPER_FLAG_SQUIT;
 }
-#line 3926 "conf_parser.c" /* yacc.c:1652  */
+#line 4343 "conf_parser.c"
     break;
 
-  case 210:
-#line 1166 "conf_parser.y" /* yacc.c:1652  */
-    {
+  case 210: /* oper_flags_item: KLINE  */
+#line 1168 "conf_parser.y"
+{
   if (conf_parser_ctx.pass == 2)
     block_state.port.value |= OPER_FLAG_KLINE;
 }
-#line 3935 "conf_parser.c" /* yacc.c:1652  */
+#line 4352 "conf_parser.c"
     break;
 
-  case 211:
-#line 1170 "conf_parser.y" /* yacc.c:1652  */
-    {
+  case 211: /* oper_flags_item: UNKLINE  */
+#line 1172 "conf_parser.y"
+{
   if (conf_parser_ctx.pass == 2)
     block_state.port.value |= OPER_FLAG_UNKLINE;
 }
-#line 3944 "conf_parser.c" /* yacc.c:1652  */
+#line 4361 "conf_parser.c"
     break;
 
-  case 212:
-#line 1174 "conf_parser.y" /* yacc.c:1652  */
-    {
+  case 212: /* oper_flags_item: T_DLINE  */
+#line 1176 "conf_parser.y"
+{
   if (conf_parser_ctx.pass == 2)
     block_state.port.value |= OPER_FLAG_DLINE;
 }
-#line 3953 "conf_parser.c" /* yacc.c:1652  */
+#line 4370 "conf_parser.c"
     break;
 
-  case 213:
-#line 1178 "conf_parser.y" /* yacc.c:1652  */
-    {
+  case 213: /* oper_flags_item: T_UNDLINE  */
+#line 1180 "conf_parser.y"
+{
   if (conf_parser_ctx.pass == 2)
     block_state.port.value |= OPER_FLAG_UNDLINE;
 }
-#line 3962 "conf_parser.c" /* yacc.c:1652  */
+#line 4379 "conf_parser.c"
     break;
 
-  case 214:
-#line 1182 "conf_parser.y" /* yacc.c:1652  */
-    {
+  case 214: /* oper_flags_item: XLINE  */
+#line 1184 "conf_parser.y"
+{
   if (conf_parser_ctx.pass == 2)
     block_state.port.value |= OPER_FLAG_XLINE;
 }
-#line 3971 "conf_parser.c" /* yacc.c:1652  */
+#line 4388 "conf_parser.c"
     break;
 
-  case 215:
-#line 1186 "conf_parser.y" /* yacc.c:1652  */
-    {
+  case 215: /* oper_flags_item: T_UNXLINE  */
+#line 1188 "conf_parser.y"
+{
   if (conf_parser_ctx.pass == 2)
     block_state.port.value |= OPER_FLAG_UNXLINE;
 }
-#line 3980 "conf_parser.c" /* yacc.c:1652  */
+#line 4397 "conf_parser.c"
     break;
 
-  case 216:
-#line 1190 "conf_parser.y" /* yacc.c:1652  */
-    {
+  case 216: /* oper_flags_item: DIE  */
+#line 1192 "conf_parser.y"
+{
   if (conf_parser_ctx.pass == 2)
     block_state.port.value |= OPER_FLAG_DIE;
 }
-#line 3989 "conf_parser.c" /* yacc.c:1652  */
+#line 4406 "conf_parser.c"
     break;
 
-  case 217:
-#line 1194 "conf_parser.y" /* yacc.c:1652  */
-    {
+  case 217: /* oper_flags_item: T_RESTART  */
+#line 1196 "conf_parser.y"
+{
   if (conf_parser_ctx.pass == 2)
     block_state.port.value |= OPER_FLAG_RESTART;
 }
-#line 3998 "conf_parser.c" /* yacc.c:1652  */
+#line 4415 "conf_parser.c"
     break;
 
-  case 218:
-#line 1198 "conf_parser.y" /* yacc.c:1652  */
-    {
+  case 218: /* oper_flags_item: REHASH ':' REMOTE  */
+#line 1200 "conf_parser.y"
+{
   if (conf_parser_ctx.pass == 2)
     block_state.port.value |= OPER_FLAG_REHASH_REMOTE;
 }
-#line 4007 "conf_parser.c" /* yacc.c:1652  */
+#line 4424 "conf_parser.c"
     break;
 
-  case 219:
-#line 1202 "conf_parser.y" /* yacc.c:1652  */
-    {
+  case 219: /* oper_flags_item: REHASH  */
+#line 1204 "conf_parser.y"
+{
   if (conf_parser_ctx.pass == 2)
     block_state.port.value |= OPER_FLAG_REHASH;
 }
-#line 4016 "conf_parser.c" /* yacc.c:1652  */
+#line 4433 "conf_parser.c"
     break;
 
-  case 220:
-#line 1206 "conf_parser.y" /* yacc.c:1652  */
-    {
+  case 220: /* oper_flags_item: ADMIN  */
+#line 1208 "conf_parser.y"
+{
   if (conf_parser_ctx.pass == 2)
     block_state.port.value |= OPER_FLAG_ADMIN;
 }
-#line 4025 "conf_parser.c" /* yacc.c:1652  */
+#line 4442 "conf_parser.c"
     break;
 
-  case 221:
-#line 1210 "conf_parser.y" /* yacc.c:1652  */
-    {
+  case 221: /* oper_flags_item: T_GLOBOPS  */
+#line 1212 "conf_parser.y"
+{
   if (conf_parser_ctx.pass == 2)
     block_state.port.value |= OPER_FLAG_GLOBOPS;
 }
-#line 4034 "conf_parser.c" /* yacc.c:1652  */
+#line 4451 "conf_parser.c"
     break;
 
-  case 222:
-#line 1214 "conf_parser.y" /* yacc.c:1652  */
-    {
+  case 222: /* oper_flags_item: T_WALLOPS  */
+#line 1216 "conf_parser.y"
+{
   if (conf_parser_ctx.pass == 2)
     block_state.port.value |= OPER_FLAG_WALLOPS;
 }
-#line 4043 "conf_parser.c" /* yacc.c:1652  */
+#line 4460 "conf_parser.c"
     break;
 
-  case 223:
-#line 1218 "conf_parser.y" /* yacc.c:1652  */
-    {
+  case 223: /* oper_flags_item: T_LOCOPS  */
+#line 1220 "conf_parser.y"
+{
   if (conf_parser_ctx.pass == 2)
     block_state.port.value |= OPER_FLAG_LOCOPS;
 }
-#line 4052 "conf_parser.c" /* yacc.c:1652  */
+#line 4469 "conf_parser.c"
     break;
 
-  case 224:
-#line 1222 "conf_parser.y" /* yacc.c:1652  */
-    {
+  case 224: /* oper_flags_item: REMOTEBAN  */
+#line 1224 "conf_parser.y"
+{
   if (conf_parser_ctx.pass == 2)
     block_state.port.value |= OPER_FLAG_REMOTEBAN;
 }
-#line 4061 "conf_parser.c" /* yacc.c:1652  */
+#line 4478 "conf_parser.c"
     break;
 
-  case 225:
-#line 1226 "conf_parser.y" /* yacc.c:1652  */
-    {
+  case 225: /* oper_flags_item: T_SET  */
+#line 1228 "conf_parser.y"
+{
   if (conf_parser_ctx.pass == 2)
     block_state.port.value |= OPER_FLAG_SET;
 }
-#line 4070 "conf_parser.c" /* yacc.c:1652  */
+#line 4487 "conf_parser.c"
     break;
 
-  case 226:
-#line 1230 "conf_parser.y" /* yacc.c:1652  */
-    {
+  case 226: /* oper_flags_item: MODULE  */
+#line 1232 "conf_parser.y"
+{
   if (conf_parser_ctx.pass == 2)
     block_state.port.value |= OPER_FLAG_MODULE;
 }
-#line 4079 "conf_parser.c" /* yacc.c:1652  */
+#line 4496 "conf_parser.c"
     break;
 
-  case 227:
-#line 1234 "conf_parser.y" /* yacc.c:1652  */
-    {
+  case 227: /* oper_flags_item: T_OPME  */
+#line 1236 "conf_parser.y"
+{
   if (conf_parser_ctx.pass == 2)
     block_state.port.value |= OPER_FLAG_OPME;
 }
-#line 4088 "conf_parser.c" /* yacc.c:1652  */
+#line 4505 "conf_parser.c"
     break;
 
-  case 228:
-#line 1238 "conf_parser.y" /* yacc.c:1652  */
-    {
+  case 228: /* oper_flags_item: NICK ':' RESV  */
+#line 1240 "conf_parser.y"
+{
   if (conf_parser_ctx.pass == 2)
     block_state.port.value |= OPER_FLAG_NICK_RESV;
 }
-#line 4097 "conf_parser.c" /* yacc.c:1652  */
+#line 4514 "conf_parser.c"
     break;
 
-  case 229:
-#line 1242 "conf_parser.y" /* yacc.c:1652  */
-    {
+  case 229: /* oper_flags_item: JOIN ':' RESV  */
+#line 1244 "conf_parser.y"
+{
   if (conf_parser_ctx.pass == 2)
     block_state.port.value |= OPER_FLAG_JOIN_RESV;
 }
-#line 4106 "conf_parser.c" /* yacc.c:1652  */
+#line 4523 "conf_parser.c"
     break;
 
-  case 230:
-#line 1246 "conf_parser.y" /* yacc.c:1652  */
-    {
+  case 230: /* oper_flags_item: RESV  */
+#line 1248 "conf_parser.y"
+{
   if (conf_parser_ctx.pass == 2)
     block_state.port.value |= OPER_FLAG_RESV;
 }
-#line 4115 "conf_parser.c" /* yacc.c:1652  */
+#line 4532 "conf_parser.c"
     break;
 
-  case 231:
-#line 1250 "conf_parser.y" /* yacc.c:1652  */
-    {
+  case 231: /* oper_flags_item: T_UNRESV  */
+#line 1252 "conf_parser.y"
+{
   if (conf_parser_ctx.pass == 2)
     block_state.port.value |= OPER_FLAG_UNRESV;
 }
-#line 4124 "conf_parser.c" /* yacc.c:1652  */
+#line 4541 "conf_parser.c"
     break;
 
-  case 232:
-#line 1254 "conf_parser.y" /* yacc.c:1652  */
-    {
+  case 232: /* oper_flags_item: CLOSE  */
+#line 1256 "conf_parser.y"
+{
   if (conf_parser_ctx.pass == 2)
     block_state.port.value |= OPER_FLAG_CLOSE;
 }
-#line 4133 "conf_parser.c" /* yacc.c:1652  */
+#line 4550 "conf_parser.c"
     break;
 
-  case 233:
-#line 1264 "conf_parser.y" /* yacc.c:1652  */
-    {
+  case 233: /* $@8: %empty  */
+#line 1266 "conf_parser.y"
+{
   if (conf_parser_ctx.pass != 1)
     break;
 
@@ -4146,12 +4563,12 @@ yyreduce:
   block_state.max_sendq.value = DEFAULT_SENDQ;
   block_state.max_recvq.value = DEFAULT_RECVQ;
 }
-#line 4150 "conf_parser.c" /* yacc.c:1652  */
+#line 4567 "conf_parser.c"
     break;
 
-  case 234:
-#line 1276 "conf_parser.y" /* yacc.c:1652  */
-    {
+  case 234: /* class_entry: CLASS $@8 '{' class_items '}' ';'  */
+#line 1278 "conf_parser.y"
+{
   if (conf_parser_ctx.pass != 1)
     break;
 
@@ -4194,222 +4611,222 @@ yyreduce:
   if (diff)
     class_ip_limit_rebuild(class);
 }
-#line 4198 "conf_parser.c" /* yacc.c:1652  */
+#line 4615 "conf_parser.c"
     break;
 
-  case 253:
-#line 1339 "conf_parser.y" /* yacc.c:1652  */
-    {
+  case 253: /* class_name: NAME '=' QSTRING ';'  */
+#line 1341 "conf_parser.y"
+{
   if (conf_parser_ctx.pass == 1)
     strlcpy(block_state.class.buf, yylval.string, sizeof(block_state.class.buf));
 }
-#line 4207 "conf_parser.c" /* yacc.c:1652  */
+#line 4624 "conf_parser.c"
     break;
 
-  case 254:
-#line 1345 "conf_parser.y" /* yacc.c:1652  */
-    {
+  case 254: /* class_ping_time: PING_TIME '=' timespec ';'  */
+#line 1347 "conf_parser.y"
+{
   if (conf_parser_ctx.pass == 1)
     block_state.ping_freq.value = (yyvsp[-1].number);
 }
-#line 4216 "conf_parser.c" /* yacc.c:1652  */
+#line 4633 "conf_parser.c"
     break;
 
-  case 255:
-#line 1351 "conf_parser.y" /* yacc.c:1652  */
-    {
+  case 255: /* class_number_per_ip_local: NUMBER_PER_IP_LOCAL '=' NUMBER ';'  */
+#line 1353 "conf_parser.y"
+{
   if (conf_parser_ctx.pass == 1)
     block_state.max_perip_local.value = (yyvsp[-1].number);
 }
-#line 4225 "conf_parser.c" /* yacc.c:1652  */
+#line 4642 "conf_parser.c"
     break;
 
-  case 256:
-#line 1357 "conf_parser.y" /* yacc.c:1652  */
-    {
+  case 256: /* class_number_per_ip_global: NUMBER_PER_IP_GLOBAL '=' NUMBER ';'  */
+#line 1359 "conf_parser.y"
+{
   if (conf_parser_ctx.pass == 1)
     block_state.max_perip_global.value = (yyvsp[-1].number);
 }
-#line 4234 "conf_parser.c" /* yacc.c:1652  */
+#line 4651 "conf_parser.c"
     break;
 
-  case 257:
-#line 1363 "conf_parser.y" /* yacc.c:1652  */
-    {
+  case 257: /* class_connectfreq: CONNECTFREQ '=' timespec ';'  */
+#line 1365 "conf_parser.y"
+{
   if (conf_parser_ctx.pass == 1)
     block_state.con_freq.value = (yyvsp[-1].number);
 }
-#line 4243 "conf_parser.c" /* yacc.c:1652  */
+#line 4660 "conf_parser.c"
     break;
 
-  case 258:
-#line 1369 "conf_parser.y" /* yacc.c:1652  */
-    {
+  case 258: /* class_max_channels: MAX_CHANNELS '=' NUMBER ';'  */
+#line 1371 "conf_parser.y"
+{
   if (conf_parser_ctx.pass == 1)
     block_state.max_channels.value = (yyvsp[-1].number);
 }
-#line 4252 "conf_parser.c" /* yacc.c:1652  */
+#line 4669 "conf_parser.c"
     break;
 
-  case 259:
-#line 1375 "conf_parser.y" /* yacc.c:1652  */
-    {
+  case 259: /* class_max_number: MAX_NUMBER '=' NUMBER ';'  */
+#line 1377 "conf_parser.y"
+{
   if (conf_parser_ctx.pass == 1)
     block_state.max_total.value = (yyvsp[-1].number);
 }
-#line 4261 "conf_parser.c" /* yacc.c:1652  */
+#line 4678 "conf_parser.c"
     break;
 
-  case 260:
-#line 1381 "conf_parser.y" /* yacc.c:1652  */
-    {
+  case 260: /* class_sendq: SENDQ '=' sizespec ';'  */
+#line 1383 "conf_parser.y"
+{
   if (conf_parser_ctx.pass == 1)
     block_state.max_sendq.value = (yyvsp[-1].number);
 }
-#line 4270 "conf_parser.c" /* yacc.c:1652  */
+#line 4687 "conf_parser.c"
     break;
 
-  case 261:
-#line 1387 "conf_parser.y" /* yacc.c:1652  */
-    {
+  case 261: /* class_recvq: T_RECVQ '=' sizespec ';'  */
+#line 1389 "conf_parser.y"
+{
   if (conf_parser_ctx.pass == 1)
     if ((yyvsp[-1].number) >= CLIENT_FLOOD_MIN && (yyvsp[-1].number) <= CLIENT_FLOOD_MAX)
       block_state.max_recvq.value = (yyvsp[-1].number);
 }
-#line 4280 "conf_parser.c" /* yacc.c:1652  */
+#line 4697 "conf_parser.c"
     break;
 
-  case 262:
-#line 1394 "conf_parser.y" /* yacc.c:1652  */
-    {
+  case 262: /* class_cidr_bitlen_ipv4: CIDR_BITLEN_IPV4 '=' NUMBER ';'  */
+#line 1396 "conf_parser.y"
+{
   if (conf_parser_ctx.pass == 1)
     block_state.cidr_bitlen_ipv4.value = (yyvsp[-1].number) > 32 ? 32 : (yyvsp[-1].number);
 }
-#line 4289 "conf_parser.c" /* yacc.c:1652  */
+#line 4706 "conf_parser.c"
     break;
 
-  case 263:
-#line 1400 "conf_parser.y" /* yacc.c:1652  */
-    {
+  case 263: /* class_cidr_bitlen_ipv6: CIDR_BITLEN_IPV6 '=' NUMBER ';'  */
+#line 1402 "conf_parser.y"
+{
   if (conf_parser_ctx.pass == 1)
     block_state.cidr_bitlen_ipv6.value = (yyvsp[-1].number) > 128 ? 128 : (yyvsp[-1].number);
 }
-#line 4298 "conf_parser.c" /* yacc.c:1652  */
+#line 4715 "conf_parser.c"
     break;
 
-  case 264:
-#line 1406 "conf_parser.y" /* yacc.c:1652  */
-    {
+  case 264: /* class_number_per_cidr: NUMBER_PER_CIDR '=' NUMBER ';'  */
+#line 1408 "conf_parser.y"
+{
   if (conf_parser_ctx.pass == 1)
     block_state.number_per_cidr.value = (yyvsp[-1].number);
 }
-#line 4307 "conf_parser.c" /* yacc.c:1652  */
+#line 4724 "conf_parser.c"
     break;
 
-  case 265:
-#line 1412 "conf_parser.y" /* yacc.c:1652  */
-    {
+  case 265: /* class_min_idle: MIN_IDLE '=' timespec ';'  */
+#line 1414 "conf_parser.y"
+{
   if (conf_parser_ctx.pass != 1)
     break;
 
   block_state.min_idle.value = (yyvsp[-1].number);
   block_state.flags.value |= CLASS_FLAGS_FAKE_IDLE;
 }
-#line 4319 "conf_parser.c" /* yacc.c:1652  */
+#line 4736 "conf_parser.c"
     break;
 
-  case 266:
-#line 1421 "conf_parser.y" /* yacc.c:1652  */
-    {
+  case 266: /* class_max_idle: MAX_IDLE '=' timespec ';'  */
+#line 1423 "conf_parser.y"
+{
   if (conf_parser_ctx.pass != 1)
     break;
 
   block_state.max_idle.value = (yyvsp[-1].number);
   block_state.flags.value |= CLASS_FLAGS_FAKE_IDLE;
 }
-#line 4331 "conf_parser.c" /* yacc.c:1652  */
+#line 4748 "conf_parser.c"
     break;
 
-  case 267:
-#line 1430 "conf_parser.y" /* yacc.c:1652  */
-    {
+  case 267: /* $@9: %empty  */
+#line 1432 "conf_parser.y"
+{
   if (conf_parser_ctx.pass == 1)
     block_state.flags.value &= CLASS_FLAGS_FAKE_IDLE;
 }
-#line 4340 "conf_parser.c" /* yacc.c:1652  */
+#line 4757 "conf_parser.c"
     break;
 
-  case 271:
-#line 1437 "conf_parser.y" /* yacc.c:1652  */
-    {
+  case 271: /* class_flags_item: RANDOM_IDLE  */
+#line 1439 "conf_parser.y"
+{
   if (conf_parser_ctx.pass == 1)
     block_state.flags.value |= CLASS_FLAGS_RANDOM_IDLE;
 }
-#line 4349 "conf_parser.c" /* yacc.c:1652  */
+#line 4766 "conf_parser.c"
     break;
 
-  case 272:
-#line 1441 "conf_parser.y" /* yacc.c:1652  */
-    {
+  case 272: /* class_flags_item: HIDE_IDLE_FROM_OPERS  */
+#line 1443 "conf_parser.y"
+{
   if (conf_parser_ctx.pass == 1)
     block_state.flags.value |= CLASS_FLAGS_HIDE_IDLE_FROM_OPERS;
 }
-#line 4358 "conf_parser.c" /* yacc.c:1652  */
+#line 4775 "conf_parser.c"
     break;
 
-  case 273:
-#line 1451 "conf_parser.y" /* yacc.c:1652  */
-    {
+  case 273: /* $@10: %empty  */
+#line 1453 "conf_parser.y"
+{
   if (conf_parser_ctx.pass == 2)
     reset_block_state();
 }
-#line 4367 "conf_parser.c" /* yacc.c:1652  */
+#line 4784 "conf_parser.c"
     break;
 
-  case 275:
-#line 1457 "conf_parser.y" /* yacc.c:1652  */
-    {
+  case 275: /* $@11: %empty  */
+#line 1459 "conf_parser.y"
+{
   block_state.flags.value = 0;
 }
-#line 4375 "conf_parser.c" /* yacc.c:1652  */
+#line 4792 "conf_parser.c"
     break;
 
-  case 279:
-#line 1463 "conf_parser.y" /* yacc.c:1652  */
-    {
+  case 279: /* listen_flags_item: T_TLS  */
+#line 1465 "conf_parser.y"
+{
   if (conf_parser_ctx.pass == 2)
     block_state.flags.value |= LISTENER_TLS;
 }
-#line 4384 "conf_parser.c" /* yacc.c:1652  */
+#line 4801 "conf_parser.c"
     break;
 
-  case 280:
-#line 1467 "conf_parser.y" /* yacc.c:1652  */
-    {
+  case 280: /* listen_flags_item: HIDDEN  */
+#line 1469 "conf_parser.y"
+{
   if (conf_parser_ctx.pass == 2)
     block_state.flags.value |= LISTENER_HIDDEN;
 }
-#line 4393 "conf_parser.c" /* yacc.c:1652  */
+#line 4810 "conf_parser.c"
     break;
 
-  case 281:
-#line 1471 "conf_parser.y" /* yacc.c:1652  */
-    {
+  case 281: /* listen_flags_item: T_SERVER  */
+#line 1473 "conf_parser.y"
+{
   if (conf_parser_ctx.pass == 2)
    block_state.flags.value |= LISTENER_SERVER;
 }
-#line 4402 "conf_parser.c" /* yacc.c:1652  */
+#line 4819 "conf_parser.c"
     break;
 
-  case 289:
-#line 1479 "conf_parser.y" /* yacc.c:1652  */
-    { block_state.flags.value = 0; }
-#line 4408 "conf_parser.c" /* yacc.c:1652  */
+  case 289: /* $@12: %empty  */
+#line 1481 "conf_parser.y"
+                                 { block_state.flags.value = 0; }
+#line 4825 "conf_parser.c"
     break;
 
-  case 293:
-#line 1484 "conf_parser.y" /* yacc.c:1652  */
-    {
+  case 293: /* port_item: NUMBER  */
+#line 1486 "conf_parser.y"
+{
   if (conf_parser_ctx.pass == 2)
   {
 #ifndef HAVE_TLS
@@ -4422,12 +4839,12 @@ yyreduce:
     listener_add((yyvsp[0].number), block_state.addr.buf, block_state.flags.value);
   }
 }
-#line 4426 "conf_parser.c" /* yacc.c:1652  */
+#line 4843 "conf_parser.c"
     break;
 
-  case 294:
-#line 1497 "conf_parser.y" /* yacc.c:1652  */
-    {
+  case 294: /* port_item: NUMBER TWODOTS NUMBER  */
+#line 1499 "conf_parser.y"
+{
   if (conf_parser_ctx.pass == 2)
   {
 #ifndef HAVE_TLS
@@ -4442,39 +4859,39 @@ yyreduce:
       listener_add(i, block_state.addr.buf, block_state.flags.value);
   }
 }
-#line 4446 "conf_parser.c" /* yacc.c:1652  */
+#line 4863 "conf_parser.c"
     break;
 
-  case 295:
-#line 1514 "conf_parser.y" /* yacc.c:1652  */
-    {
+  case 295: /* listen_address: IP '=' QSTRING ';'  */
+#line 1516 "conf_parser.y"
+{
   if (conf_parser_ctx.pass == 2)
     strlcpy(block_state.addr.buf, yylval.string, sizeof(block_state.addr.buf));
 }
-#line 4455 "conf_parser.c" /* yacc.c:1652  */
+#line 4872 "conf_parser.c"
     break;
 
-  case 296:
-#line 1520 "conf_parser.y" /* yacc.c:1652  */
-    {
+  case 296: /* listen_host: HOST '=' QSTRING ';'  */
+#line 1522 "conf_parser.y"
+{
   if (conf_parser_ctx.pass == 2)
     strlcpy(block_state.addr.buf, yylval.string, sizeof(block_state.addr.buf));
 }
-#line 4464 "conf_parser.c" /* yacc.c:1652  */
+#line 4881 "conf_parser.c"
     break;
 
-  case 297:
-#line 1530 "conf_parser.y" /* yacc.c:1652  */
-    {
+  case 297: /* $@13: %empty  */
+#line 1532 "conf_parser.y"
+{
   if (conf_parser_ctx.pass == 2)
     reset_block_state();
 }
-#line 4473 "conf_parser.c" /* yacc.c:1652  */
+#line 4890 "conf_parser.c"
     break;
 
-  case 298:
-#line 1534 "conf_parser.y" /* yacc.c:1652  */
-    {
+  case 298: /* auth_entry: IRCD_AUTH $@13 '{' auth_items '}' ';'  */
+#line 1536 "conf_parser.y"
+{
   dlink_node *node;
 
   if (conf_parser_ctx.pass != 2)
@@ -4515,39 +4932,39 @@ yyreduce:
     add_conf_by_address(CONF_CLIENT, conf);
   }
 }
-#line 4519 "conf_parser.c" /* yacc.c:1652  */
+#line 4936 "conf_parser.c"
     break;
 
-  case 310:
-#line 1588 "conf_parser.y" /* yacc.c:1652  */
-    {
+  case 310: /* auth_user: USER '=' QSTRING ';'  */
+#line 1590 "conf_parser.y"
+{
   if (conf_parser_ctx.pass == 2)
     dlinkAdd(xstrdup(yylval.string), make_dlink_node(), &block_state.mask.list);
 }
-#line 4528 "conf_parser.c" /* yacc.c:1652  */
+#line 4945 "conf_parser.c"
     break;
 
-  case 311:
-#line 1594 "conf_parser.y" /* yacc.c:1652  */
-    {
+  case 311: /* auth_passwd: PASSWORD '=' QSTRING ';'  */
+#line 1596 "conf_parser.y"
+{
   if (conf_parser_ctx.pass == 2)
     strlcpy(block_state.rpass.buf, yylval.string, sizeof(block_state.rpass.buf));
 }
-#line 4537 "conf_parser.c" /* yacc.c:1652  */
+#line 4954 "conf_parser.c"
     break;
 
-  case 312:
-#line 1600 "conf_parser.y" /* yacc.c:1652  */
-    {
+  case 312: /* auth_class: CLASS '=' QSTRING ';'  */
+#line 1602 "conf_parser.y"
+{
   if (conf_parser_ctx.pass == 2)
     strlcpy(block_state.class.buf, yylval.string, sizeof(block_state.class.buf));
 }
-#line 4546 "conf_parser.c" /* yacc.c:1652  */
+#line 4963 "conf_parser.c"
     break;
 
-  case 313:
-#line 1606 "conf_parser.y" /* yacc.c:1652  */
-    {
+  case 313: /* auth_encrypted: ENCRYPTED '=' TBOOL ';'  */
+#line 1608 "conf_parser.y"
+{
   if (conf_parser_ctx.pass == 2)
   {
     if (yylval.number)
@@ -4556,102 +4973,102 @@ yyreduce:
       block_state.flags.value &= ~CONF_FLAGS_ENCRYPTED;
   }
 }
-#line 4560 "conf_parser.c" /* yacc.c:1652  */
+#line 4977 "conf_parser.c"
     break;
 
-  case 314:
-#line 1617 "conf_parser.y" /* yacc.c:1652  */
-    {
+  case 314: /* $@14: %empty  */
+#line 1619 "conf_parser.y"
+{
   if (conf_parser_ctx.pass == 2)
     block_state.flags.value &= (CONF_FLAGS_ENCRYPTED | CONF_FLAGS_SPOOF_IP);
 }
-#line 4569 "conf_parser.c" /* yacc.c:1652  */
+#line 4986 "conf_parser.c"
     break;
 
-  case 318:
-#line 1624 "conf_parser.y" /* yacc.c:1652  */
-    {
+  case 318: /* auth_flags_item: EXCEED_LIMIT  */
+#line 1626 "conf_parser.y"
+{
   if (conf_parser_ctx.pass == 2)
     block_state.flags.value |= CONF_FLAGS_NOLIMIT;
 }
-#line 4578 "conf_parser.c" /* yacc.c:1652  */
+#line 4995 "conf_parser.c"
     break;
 
-  case 319:
-#line 1628 "conf_parser.y" /* yacc.c:1652  */
-    {
+  case 319: /* auth_flags_item: KLINE_EXEMPT  */
+#line 1630 "conf_parser.y"
+{
   if (conf_parser_ctx.pass == 2)
     block_state.flags.value |= CONF_FLAGS_EXEMPTKLINE;
 }
-#line 4587 "conf_parser.c" /* yacc.c:1652  */
+#line 5004 "conf_parser.c"
     break;
 
-  case 320:
-#line 1632 "conf_parser.y" /* yacc.c:1652  */
-    {
+  case 320: /* auth_flags_item: XLINE_EXEMPT  */
+#line 1634 "conf_parser.y"
+{
   if (conf_parser_ctx.pass == 2)
     block_state.flags.value |= CONF_FLAGS_EXEMPTXLINE;
 }
-#line 4596 "conf_parser.c" /* yacc.c:1652  */
+#line 5013 "conf_parser.c"
     break;
 
-  case 321:
-#line 1636 "conf_parser.y" /* yacc.c:1652  */
-    {
+  case 321: /* auth_flags_item: NEED_IDENT  */
+#line 1638 "conf_parser.y"
+{
   if (conf_parser_ctx.pass == 2)
     block_state.flags.value |= CONF_FLAGS_NEED_IDENTD;
 }
-#line 4605 "conf_parser.c" /* yacc.c:1652  */
+#line 5022 "conf_parser.c"
     break;
 
-  case 322:
-#line 1640 "conf_parser.y" /* yacc.c:1652  */
-    {
+  case 322: /* auth_flags_item: CAN_FLOOD  */
+#line 1642 "conf_parser.y"
+{
   if (conf_parser_ctx.pass == 2)
     block_state.flags.value |= CONF_FLAGS_CAN_FLOOD;
 }
-#line 4614 "conf_parser.c" /* yacc.c:1652  */
+#line 5031 "conf_parser.c"
     break;
 
-  case 323:
-#line 1644 "conf_parser.y" /* yacc.c:1652  */
-    {
+  case 323: /* auth_flags_item: NO_TILDE  */
+#line 1646 "conf_parser.y"
+{
   if (conf_parser_ctx.pass == 2)
     block_state.flags.value |= CONF_FLAGS_NO_TILDE;
 }
-#line 4623 "conf_parser.c" /* yacc.c:1652  */
+#line 5040 "conf_parser.c"
     break;
 
-  case 324:
-#line 1648 "conf_parser.y" /* yacc.c:1652  */
-    {
+  case 324: /* auth_flags_item: RESV_EXEMPT  */
+#line 1650 "conf_parser.y"
+{
   if (conf_parser_ctx.pass == 2)
     block_state.flags.value |= CONF_FLAGS_EXEMPTRESV;
 }
-#line 4632 "conf_parser.c" /* yacc.c:1652  */
+#line 5049 "conf_parser.c"
     break;
 
-  case 325:
-#line 1652 "conf_parser.y" /* yacc.c:1652  */
-    {
+  case 325: /* auth_flags_item: T_WEBIRC  */
+#line 1654 "conf_parser.y"
+{
   if (conf_parser_ctx.pass == 2)
     block_state.flags.value |= CONF_FLAGS_WEBIRC;
 }
-#line 4641 "conf_parser.c" /* yacc.c:1652  */
+#line 5058 "conf_parser.c"
     break;
 
-  case 326:
-#line 1656 "conf_parser.y" /* yacc.c:1652  */
-    {
+  case 326: /* auth_flags_item: NEED_PASSWORD  */
+#line 1658 "conf_parser.y"
+{
   if (conf_parser_ctx.pass == 2)
     block_state.flags.value |= CONF_FLAGS_NEED_PASSWORD;
 }
-#line 4650 "conf_parser.c" /* yacc.c:1652  */
+#line 5067 "conf_parser.c"
     break;
 
-  case 327:
-#line 1662 "conf_parser.y" /* yacc.c:1652  */
-    {
+  case 327: /* auth_spoof: SPOOF '=' QSTRING ';'  */
+#line 1664 "conf_parser.y"
+{
   if (conf_parser_ctx.pass != 2)
     break;
 
@@ -4663,86 +5080,86 @@ yyreduce:
   else
     ilog(LOG_TYPE_IRCD, "Spoof either is too long or contains invalid characters. Ignoring it.");
 }
-#line 4667 "conf_parser.c" /* yacc.c:1652  */
+#line 5084 "conf_parser.c"
     break;
 
-  case 328:
-#line 1676 "conf_parser.y" /* yacc.c:1652  */
-    {
+  case 328: /* auth_redir_serv: REDIRSERV '=' QSTRING ';'  */
+#line 1678 "conf_parser.y"
+{
   if (conf_parser_ctx.pass != 2)
     break;
 
   strlcpy(block_state.name.buf, yylval.string, sizeof(block_state.name.buf));
   block_state.flags.value |= CONF_FLAGS_REDIR;
 }
-#line 4679 "conf_parser.c" /* yacc.c:1652  */
+#line 5096 "conf_parser.c"
     break;
 
-  case 329:
-#line 1685 "conf_parser.y" /* yacc.c:1652  */
-    {
+  case 329: /* auth_redir_port: REDIRPORT '=' NUMBER ';'  */
+#line 1687 "conf_parser.y"
+{
   if (conf_parser_ctx.pass != 2)
     break;
 
   block_state.flags.value |= CONF_FLAGS_REDIR;
   block_state.port.value = (yyvsp[-1].number);
 }
-#line 4691 "conf_parser.c" /* yacc.c:1652  */
+#line 5108 "conf_parser.c"
     break;
 
-  case 330:
-#line 1698 "conf_parser.y" /* yacc.c:1652  */
-    {
+  case 330: /* $@15: %empty  */
+#line 1700 "conf_parser.y"
+{
   if (conf_parser_ctx.pass != 2)
     break;
 
   reset_block_state();
   strlcpy(block_state.rpass.buf, CONF_NOREASON, sizeof(block_state.rpass.buf));
 }
-#line 4703 "conf_parser.c" /* yacc.c:1652  */
+#line 5120 "conf_parser.c"
     break;
 
-  case 331:
-#line 1705 "conf_parser.y" /* yacc.c:1652  */
-    {
+  case 331: /* resv_entry: RESV $@15 '{' resv_items '}' ';'  */
+#line 1707 "conf_parser.y"
+{
   if (conf_parser_ctx.pass != 2)
     break;
 
   resv_make(block_state.name.buf, block_state.rpass.buf, &block_state.mask.list);
 }
-#line 4714 "conf_parser.c" /* yacc.c:1652  */
+#line 5131 "conf_parser.c"
     break;
 
-  case 338:
-#line 1716 "conf_parser.y" /* yacc.c:1652  */
-    {
+  case 338: /* resv_mask: MASK '=' QSTRING ';'  */
+#line 1718 "conf_parser.y"
+{
   if (conf_parser_ctx.pass == 2)
     strlcpy(block_state.name.buf, yylval.string, sizeof(block_state.name.buf));
 }
-#line 4723 "conf_parser.c" /* yacc.c:1652  */
+#line 5140 "conf_parser.c"
     break;
 
-  case 339:
-#line 1722 "conf_parser.y" /* yacc.c:1652  */
-    {
+  case 339: /* resv_reason: REASON '=' QSTRING ';'  */
+#line 1724 "conf_parser.y"
+{
   if (conf_parser_ctx.pass == 2)
     strlcpy(block_state.rpass.buf, yylval.string, sizeof(block_state.rpass.buf));
 }
-#line 4732 "conf_parser.c" /* yacc.c:1652  */
+#line 5149 "conf_parser.c"
     break;
 
-  case 340:
-#line 1728 "conf_parser.y" /* yacc.c:1652  */
-    {
+  case 340: /* resv_exempt: EXEMPT '=' QSTRING ';'  */
+#line 1730 "conf_parser.y"
+{
   if (conf_parser_ctx.pass == 2)
     dlinkAdd(xstrdup(yylval.string), make_dlink_node(), &block_state.mask.list);
 }
-#line 4741 "conf_parser.c" /* yacc.c:1652  */
+#line 5158 "conf_parser.c"
     break;
 
-  case 346:
-#line 1743 "conf_parser.y" /* yacc.c:1652  */
-    {
+  case 346: /* service_name: NAME '=' QSTRING ';'  */
+#line 1745 "conf_parser.y"
+{
   if (conf_parser_ctx.pass != 2)
     break;
 
@@ -4752,12 +5169,12 @@ yyreduce:
     service->name = xstrdup(yylval.string);
   }
 }
-#line 4756 "conf_parser.c" /* yacc.c:1652  */
+#line 5173 "conf_parser.c"
     break;
 
-  case 347:
-#line 1759 "conf_parser.y" /* yacc.c:1652  */
-    {
+  case 347: /* $@16: %empty  */
+#line 1761 "conf_parser.y"
+{
   if (conf_parser_ctx.pass != 2)
     break;
 
@@ -4768,12 +5185,12 @@ yyreduce:
   strlcpy(block_state.host.buf, "*", sizeof(block_state.host.buf));
   block_state.flags.value = SHARED_ALL;
 }
-#line 4772 "conf_parser.c" /* yacc.c:1652  */
+#line 5189 "conf_parser.c"
     break;
 
-  case 348:
-#line 1770 "conf_parser.y" /* yacc.c:1652  */
-    {
+  case 348: /* shared_entry: T_SHARED $@16 '{' shared_items '}' ';'  */
+#line 1772 "conf_parser.y"
+{
   if (conf_parser_ctx.pass != 2)
     break;
 
@@ -4783,21 +5200,21 @@ yyreduce:
   shared->user = xstrdup(block_state.user.buf);
   shared->host = xstrdup(block_state.host.buf);
 }
-#line 4787 "conf_parser.c" /* yacc.c:1652  */
+#line 5204 "conf_parser.c"
     break;
 
-  case 355:
-#line 1785 "conf_parser.y" /* yacc.c:1652  */
-    {
+  case 355: /* shared_name: NAME '=' QSTRING ';'  */
+#line 1787 "conf_parser.y"
+{
   if (conf_parser_ctx.pass == 2)
     strlcpy(block_state.name.buf, yylval.string, sizeof(block_state.name.buf));
 }
-#line 4796 "conf_parser.c" /* yacc.c:1652  */
+#line 5213 "conf_parser.c"
     break;
 
-  case 356:
-#line 1791 "conf_parser.y" /* yacc.c:1652  */
-    {
+  case 356: /* shared_user: USER '=' QSTRING ';'  */
+#line 1793 "conf_parser.y"
+{
   if (conf_parser_ctx.pass == 2)
   {
     struct split_nuh_item nuh;
@@ -4814,111 +5231,111 @@ yyreduce:
     split_nuh(&nuh);
   }
 }
-#line 4818 "conf_parser.c" /* yacc.c:1652  */
+#line 5235 "conf_parser.c"
     break;
 
-  case 357:
-#line 1810 "conf_parser.y" /* yacc.c:1652  */
-    {
+  case 357: /* $@17: %empty  */
+#line 1812 "conf_parser.y"
+{
   if (conf_parser_ctx.pass == 2)
     block_state.flags.value = 0;
 }
-#line 4827 "conf_parser.c" /* yacc.c:1652  */
+#line 5244 "conf_parser.c"
     break;
 
-  case 361:
-#line 1817 "conf_parser.y" /* yacc.c:1652  */
-    {
+  case 361: /* shared_type_item: KLINE  */
+#line 1819 "conf_parser.y"
+{
   if (conf_parser_ctx.pass == 2)
     block_state.flags.value |= SHARED_KLINE;
 }
-#line 4836 "conf_parser.c" /* yacc.c:1652  */
+#line 5253 "conf_parser.c"
     break;
 
-  case 362:
-#line 1821 "conf_parser.y" /* yacc.c:1652  */
-    {
+  case 362: /* shared_type_item: UNKLINE  */
+#line 1823 "conf_parser.y"
+{
   if (conf_parser_ctx.pass == 2)
     block_state.flags.value |= SHARED_UNKLINE;
 }
-#line 4845 "conf_parser.c" /* yacc.c:1652  */
+#line 5262 "conf_parser.c"
     break;
 
-  case 363:
-#line 1825 "conf_parser.y" /* yacc.c:1652  */
-    {
+  case 363: /* shared_type_item: T_DLINE  */
+#line 1827 "conf_parser.y"
+{
   if (conf_parser_ctx.pass == 2)
     block_state.flags.value |= SHARED_DLINE;
 }
-#line 4854 "conf_parser.c" /* yacc.c:1652  */
+#line 5271 "conf_parser.c"
     break;
 
-  case 364:
-#line 1829 "conf_parser.y" /* yacc.c:1652  */
-    {
+  case 364: /* shared_type_item: T_UNDLINE  */
+#line 1831 "conf_parser.y"
+{
   if (conf_parser_ctx.pass == 2)
     block_state.flags.value |= SHARED_UNDLINE;
 }
-#line 4863 "conf_parser.c" /* yacc.c:1652  */
+#line 5280 "conf_parser.c"
     break;
 
-  case 365:
-#line 1833 "conf_parser.y" /* yacc.c:1652  */
-    {
+  case 365: /* shared_type_item: XLINE  */
+#line 1835 "conf_parser.y"
+{
   if (conf_parser_ctx.pass == 2)
     block_state.flags.value |= SHARED_XLINE;
 }
-#line 4872 "conf_parser.c" /* yacc.c:1652  */
+#line 5289 "conf_parser.c"
     break;
 
-  case 366:
-#line 1837 "conf_parser.y" /* yacc.c:1652  */
-    {
+  case 366: /* shared_type_item: T_UNXLINE  */
+#line 1839 "conf_parser.y"
+{
   if (conf_parser_ctx.pass == 2)
     block_state.flags.value |= SHARED_UNXLINE;
 }
-#line 4881 "conf_parser.c" /* yacc.c:1652  */
+#line 5298 "conf_parser.c"
     break;
 
-  case 367:
-#line 1841 "conf_parser.y" /* yacc.c:1652  */
-    {
+  case 367: /* shared_type_item: RESV  */
+#line 1843 "conf_parser.y"
+{
   if (conf_parser_ctx.pass == 2)
     block_state.flags.value |= SHARED_RESV;
 }
-#line 4890 "conf_parser.c" /* yacc.c:1652  */
+#line 5307 "conf_parser.c"
     break;
 
-  case 368:
-#line 1845 "conf_parser.y" /* yacc.c:1652  */
-    {
+  case 368: /* shared_type_item: T_UNRESV  */
+#line 1847 "conf_parser.y"
+{
   if (conf_parser_ctx.pass == 2)
     block_state.flags.value |= SHARED_UNRESV;
 }
-#line 4899 "conf_parser.c" /* yacc.c:1652  */
+#line 5316 "conf_parser.c"
     break;
 
-  case 369:
-#line 1849 "conf_parser.y" /* yacc.c:1652  */
-    {
+  case 369: /* shared_type_item: T_LOCOPS  */
+#line 1851 "conf_parser.y"
+{
   if (conf_parser_ctx.pass == 2)
     block_state.flags.value |= SHARED_LOCOPS;
 }
-#line 4908 "conf_parser.c" /* yacc.c:1652  */
+#line 5325 "conf_parser.c"
     break;
 
-  case 370:
-#line 1853 "conf_parser.y" /* yacc.c:1652  */
-    {
+  case 370: /* shared_type_item: T_ALL  */
+#line 1855 "conf_parser.y"
+{
   if (conf_parser_ctx.pass == 2)
     block_state.flags.value = SHARED_ALL;
 }
-#line 4917 "conf_parser.c" /* yacc.c:1652  */
+#line 5334 "conf_parser.c"
     break;
 
-  case 371:
-#line 1863 "conf_parser.y" /* yacc.c:1652  */
-    {
+  case 371: /* $@18: %empty  */
+#line 1865 "conf_parser.y"
+{
   if (conf_parser_ctx.pass != 2)
     break;
 
@@ -4927,12 +5344,12 @@ yyreduce:
   strlcpy(block_state.name.buf, "*", sizeof(block_state.name.buf));
   block_state.flags.value = CLUSTER_ALL;
 }
-#line 4931 "conf_parser.c" /* yacc.c:1652  */
+#line 5348 "conf_parser.c"
     break;
 
-  case 372:
-#line 1872 "conf_parser.y" /* yacc.c:1652  */
-    {
+  case 372: /* cluster_entry: T_CLUSTER $@18 '{' cluster_items '}' ';'  */
+#line 1874 "conf_parser.y"
+{
   if (conf_parser_ctx.pass != 2)
     break;
 
@@ -4940,120 +5357,120 @@ yyreduce:
   cluster->type = block_state.flags.value;
   cluster->server = xstrdup(block_state.name.buf);
 }
-#line 4944 "conf_parser.c" /* yacc.c:1652  */
+#line 5361 "conf_parser.c"
     break;
 
-  case 378:
-#line 1885 "conf_parser.y" /* yacc.c:1652  */
-    {
+  case 378: /* cluster_name: NAME '=' QSTRING ';'  */
+#line 1887 "conf_parser.y"
+{
   if (conf_parser_ctx.pass == 2)
     strlcpy(block_state.name.buf, yylval.string, sizeof(block_state.name.buf));
 }
-#line 4953 "conf_parser.c" /* yacc.c:1652  */
+#line 5370 "conf_parser.c"
     break;
 
-  case 379:
-#line 1891 "conf_parser.y" /* yacc.c:1652  */
-    {
+  case 379: /* $@19: %empty  */
+#line 1893 "conf_parser.y"
+{
   if (conf_parser_ctx.pass == 2)
     block_state.flags.value = 0;
 }
-#line 4962 "conf_parser.c" /* yacc.c:1652  */
+#line 5379 "conf_parser.c"
     break;
 
-  case 383:
-#line 1898 "conf_parser.y" /* yacc.c:1652  */
-    {
+  case 383: /* cluster_type_item: KLINE  */
+#line 1900 "conf_parser.y"
+{
   if (conf_parser_ctx.pass == 2)
     block_state.flags.value |= CLUSTER_KLINE;
 }
-#line 4971 "conf_parser.c" /* yacc.c:1652  */
+#line 5388 "conf_parser.c"
     break;
 
-  case 384:
-#line 1902 "conf_parser.y" /* yacc.c:1652  */
-    {
+  case 384: /* cluster_type_item: UNKLINE  */
+#line 1904 "conf_parser.y"
+{
   if (conf_parser_ctx.pass == 2)
     block_state.flags.value |= CLUSTER_UNKLINE;
 }
-#line 4980 "conf_parser.c" /* yacc.c:1652  */
+#line 5397 "conf_parser.c"
     break;
 
-  case 385:
-#line 1906 "conf_parser.y" /* yacc.c:1652  */
-    {
+  case 385: /* cluster_type_item: T_DLINE  */
+#line 1908 "conf_parser.y"
+{
   if (conf_parser_ctx.pass == 2)
     block_state.flags.value |= CLUSTER_DLINE;
 }
-#line 4989 "conf_parser.c" /* yacc.c:1652  */
+#line 5406 "conf_parser.c"
     break;
 
-  case 386:
-#line 1910 "conf_parser.y" /* yacc.c:1652  */
-    {
+  case 386: /* cluster_type_item: T_UNDLINE  */
+#line 1912 "conf_parser.y"
+{
   if (conf_parser_ctx.pass == 2)
     block_state.flags.value |= CLUSTER_UNDLINE;
 }
-#line 4998 "conf_parser.c" /* yacc.c:1652  */
+#line 5415 "conf_parser.c"
     break;
 
-  case 387:
-#line 1914 "conf_parser.y" /* yacc.c:1652  */
-    {
+  case 387: /* cluster_type_item: XLINE  */
+#line 1916 "conf_parser.y"
+{
   if (conf_parser_ctx.pass == 2)
     block_state.flags.value |= CLUSTER_XLINE;
 }
-#line 5007 "conf_parser.c" /* yacc.c:1652  */
+#line 5424 "conf_parser.c"
     break;
 
-  case 388:
-#line 1918 "conf_parser.y" /* yacc.c:1652  */
-    {
+  case 388: /* cluster_type_item: T_UNXLINE  */
+#line 1920 "conf_parser.y"
+{
   if (conf_parser_ctx.pass == 2)
     block_state.flags.value |= CLUSTER_UNXLINE;
 }
-#line 5016 "conf_parser.c" /* yacc.c:1652  */
+#line 5433 "conf_parser.c"
     break;
 
-  case 389:
-#line 1922 "conf_parser.y" /* yacc.c:1652  */
-    {
+  case 389: /* cluster_type_item: RESV  */
+#line 1924 "conf_parser.y"
+{
   if (conf_parser_ctx.pass == 2)
     block_state.flags.value |= CLUSTER_RESV;
 }
-#line 5025 "conf_parser.c" /* yacc.c:1652  */
+#line 5442 "conf_parser.c"
     break;
 
-  case 390:
-#line 1926 "conf_parser.y" /* yacc.c:1652  */
-    {
+  case 390: /* cluster_type_item: T_UNRESV  */
+#line 1928 "conf_parser.y"
+{
   if (conf_parser_ctx.pass == 2)
     block_state.flags.value |= CLUSTER_UNRESV;
 }
-#line 5034 "conf_parser.c" /* yacc.c:1652  */
+#line 5451 "conf_parser.c"
     break;
 
-  case 391:
-#line 1930 "conf_parser.y" /* yacc.c:1652  */
-    {
+  case 391: /* cluster_type_item: T_LOCOPS  */
+#line 1932 "conf_parser.y"
+{
   if (conf_parser_ctx.pass == 2)
     block_state.flags.value |= CLUSTER_LOCOPS;
 }
-#line 5043 "conf_parser.c" /* yacc.c:1652  */
+#line 5460 "conf_parser.c"
     break;
 
-  case 392:
-#line 1934 "conf_parser.y" /* yacc.c:1652  */
-    {
+  case 392: /* cluster_type_item: T_ALL  */
+#line 1936 "conf_parser.y"
+{
   if (conf_parser_ctx.pass == 2)
     block_state.flags.value = CLUSTER_ALL;
 }
-#line 5052 "conf_parser.c" /* yacc.c:1652  */
+#line 5469 "conf_parser.c"
     break;
 
-  case 393:
-#line 1944 "conf_parser.y" /* yacc.c:1652  */
-    {
+  case 393: /* $@20: %empty  */
+#line 1946 "conf_parser.y"
+{
 
   if (conf_parser_ctx.pass != 2)
     break;
@@ -5063,12 +5480,12 @@ yyreduce:
   block_state.port.value = PORTNUM;
   block_state.timeout.value = CONNECTTIMEOUT;
 }
-#line 5067 "conf_parser.c" /* yacc.c:1652  */
+#line 5484 "conf_parser.c"
     break;
 
-  case 394:
-#line 1954 "conf_parser.y" /* yacc.c:1652  */
-    {
+  case 394: /* connect_entry: CONNECT $@20 '{' connect_items '}' ';'  */
+#line 1956 "conf_parser.y"
+{
   struct addrinfo hints, *res;
 
   if (conf_parser_ctx.pass != 2)
@@ -5134,48 +5551,48 @@ yyreduce:
   conf_add_class_to_conf(conf, block_state.class.buf);
   conf_dns_lookup(conf);
 }
-#line 5138 "conf_parser.c" /* yacc.c:1652  */
+#line 5555 "conf_parser.c"
     break;
 
-  case 413:
-#line 2040 "conf_parser.y" /* yacc.c:1652  */
-    {
+  case 413: /* connect_name: NAME '=' QSTRING ';'  */
+#line 2042 "conf_parser.y"
+{
   if (conf_parser_ctx.pass == 2)
     strlcpy(block_state.name.buf, yylval.string, sizeof(block_state.name.buf));
 }
-#line 5147 "conf_parser.c" /* yacc.c:1652  */
+#line 5564 "conf_parser.c"
     break;
 
-  case 414:
-#line 2046 "conf_parser.y" /* yacc.c:1652  */
-    {
+  case 414: /* connect_host: HOST '=' QSTRING ';'  */
+#line 2048 "conf_parser.y"
+{
   if (conf_parser_ctx.pass == 2)
     strlcpy(block_state.host.buf, yylval.string, sizeof(block_state.host.buf));
 }
-#line 5156 "conf_parser.c" /* yacc.c:1652  */
+#line 5573 "conf_parser.c"
     break;
 
-  case 415:
-#line 2052 "conf_parser.y" /* yacc.c:1652  */
-    {
+  case 415: /* connect_timeout: TIMEOUT '=' timespec ';'  */
+#line 2054 "conf_parser.y"
+{
   if (conf_parser_ctx.pass == 2)
     block_state.timeout.value = (yyvsp[-1].number);
 }
-#line 5165 "conf_parser.c" /* yacc.c:1652  */
+#line 5582 "conf_parser.c"
     break;
 
-  case 416:
-#line 2058 "conf_parser.y" /* yacc.c:1652  */
-    {
+  case 416: /* connect_bind: T_BIND '=' QSTRING ';'  */
+#line 2060 "conf_parser.y"
+{
   if (conf_parser_ctx.pass == 2)
     strlcpy(block_state.bind.buf, yylval.string, sizeof(block_state.bind.buf));
 }
-#line 5174 "conf_parser.c" /* yacc.c:1652  */
+#line 5591 "conf_parser.c"
     break;
 
-  case 417:
-#line 2064 "conf_parser.y" /* yacc.c:1652  */
-    {
+  case 417: /* connect_send_password: SEND_PASSWORD '=' QSTRING ';'  */
+#line 2066 "conf_parser.y"
+{
   if (conf_parser_ctx.pass != 2)
     break;
 
@@ -5186,12 +5603,12 @@ yyreduce:
   else
     strlcpy(block_state.spass.buf, yylval.string, sizeof(block_state.spass.buf));
 }
-#line 5190 "conf_parser.c" /* yacc.c:1652  */
+#line 5607 "conf_parser.c"
     break;
 
-  case 418:
-#line 2077 "conf_parser.y" /* yacc.c:1652  */
-    {
+  case 418: /* connect_accept_password: ACCEPT_PASSWORD '=' QSTRING ';'  */
+#line 2079 "conf_parser.y"
+{
   if (conf_parser_ctx.pass != 2)
     break;
 
@@ -5202,74 +5619,74 @@ yyreduce:
   else
     strlcpy(block_state.rpass.buf, yylval.string, sizeof(block_state.rpass.buf));
 }
-#line 5206 "conf_parser.c" /* yacc.c:1652  */
+#line 5623 "conf_parser.c"
     break;
 
-  case 419:
-#line 2090 "conf_parser.y" /* yacc.c:1652  */
-    {
+  case 419: /* connect_tls_certificate_fingerprint: TLS_CERTIFICATE_FINGERPRINT '=' QSTRING ';'  */
+#line 2092 "conf_parser.y"
+{
   if (conf_parser_ctx.pass == 2)
     strlcpy(block_state.cert.buf, yylval.string, sizeof(block_state.cert.buf));
 }
-#line 5215 "conf_parser.c" /* yacc.c:1652  */
+#line 5632 "conf_parser.c"
     break;
 
-  case 420:
-#line 2096 "conf_parser.y" /* yacc.c:1652  */
-    {
+  case 420: /* connect_port: PORT '=' NUMBER ';'  */
+#line 2098 "conf_parser.y"
+{
   if (conf_parser_ctx.pass == 2)
     block_state.port.value = (yyvsp[-1].number);
 }
-#line 5224 "conf_parser.c" /* yacc.c:1652  */
+#line 5641 "conf_parser.c"
     break;
 
-  case 421:
-#line 2102 "conf_parser.y" /* yacc.c:1652  */
-    {
+  case 421: /* connect_aftype: AFTYPE '=' T_IPV4 ';'  */
+#line 2104 "conf_parser.y"
+{
   if (conf_parser_ctx.pass == 2)
     block_state.aftype.value = AF_INET;
 }
-#line 5233 "conf_parser.c" /* yacc.c:1652  */
+#line 5650 "conf_parser.c"
     break;
 
-  case 422:
-#line 2106 "conf_parser.y" /* yacc.c:1652  */
-    {
+  case 422: /* connect_aftype: AFTYPE '=' T_IPV6 ';'  */
+#line 2108 "conf_parser.y"
+{
   if (conf_parser_ctx.pass == 2)
     block_state.aftype.value = AF_INET6;
 }
-#line 5242 "conf_parser.c" /* yacc.c:1652  */
+#line 5659 "conf_parser.c"
     break;
 
-  case 423:
-#line 2112 "conf_parser.y" /* yacc.c:1652  */
-    {
+  case 423: /* $@21: %empty  */
+#line 2114 "conf_parser.y"
+{
   block_state.flags.value &= CONF_FLAGS_ENCRYPTED;
 }
-#line 5250 "conf_parser.c" /* yacc.c:1652  */
+#line 5667 "conf_parser.c"
     break;
 
-  case 427:
-#line 2118 "conf_parser.y" /* yacc.c:1652  */
-    {
+  case 427: /* connect_flags_item: AUTOCONN  */
+#line 2120 "conf_parser.y"
+{
   if (conf_parser_ctx.pass == 2)
     block_state.flags.value |= CONF_FLAGS_ALLOW_AUTO_CONN;
 }
-#line 5259 "conf_parser.c" /* yacc.c:1652  */
+#line 5676 "conf_parser.c"
     break;
 
-  case 428:
-#line 2122 "conf_parser.y" /* yacc.c:1652  */
-    {
+  case 428: /* connect_flags_item: T_TLS  */
+#line 2124 "conf_parser.y"
+{
   if (conf_parser_ctx.pass == 2)
     block_state.flags.value |= CONF_FLAGS_TLS;
 }
-#line 5268 "conf_parser.c" /* yacc.c:1652  */
+#line 5685 "conf_parser.c"
     break;
 
-  case 429:
-#line 2128 "conf_parser.y" /* yacc.c:1652  */
-    {
+  case 429: /* connect_encrypted: ENCRYPTED '=' TBOOL ';'  */
+#line 2130 "conf_parser.y"
+{
   if (conf_parser_ctx.pass == 2)
   {
     if (yylval.number)
@@ -5278,39 +5695,39 @@ yyreduce:
       block_state.flags.value &= ~CONF_FLAGS_ENCRYPTED;
   }
 }
-#line 5282 "conf_parser.c" /* yacc.c:1652  */
+#line 5699 "conf_parser.c"
     break;
 
-  case 430:
-#line 2139 "conf_parser.y" /* yacc.c:1652  */
-    {
+  case 430: /* connect_hub_mask: HUB_MASK '=' QSTRING ';'  */
+#line 2141 "conf_parser.y"
+{
   if (conf_parser_ctx.pass == 2)
     dlinkAdd(xstrdup(yylval.string), make_dlink_node(), &block_state.hub.list);
 }
-#line 5291 "conf_parser.c" /* yacc.c:1652  */
+#line 5708 "conf_parser.c"
     break;
 
-  case 431:
-#line 2145 "conf_parser.y" /* yacc.c:1652  */
-    {
+  case 431: /* connect_leaf_mask: LEAF_MASK '=' QSTRING ';'  */
+#line 2147 "conf_parser.y"
+{
   if (conf_parser_ctx.pass == 2)
     dlinkAdd(xstrdup(yylval.string), make_dlink_node(), &block_state.leaf.list);
 }
-#line 5300 "conf_parser.c" /* yacc.c:1652  */
+#line 5717 "conf_parser.c"
     break;
 
-  case 432:
-#line 2151 "conf_parser.y" /* yacc.c:1652  */
-    {
+  case 432: /* connect_class: CLASS '=' QSTRING ';'  */
+#line 2153 "conf_parser.y"
+{
   if (conf_parser_ctx.pass == 2)
     strlcpy(block_state.class.buf, yylval.string, sizeof(block_state.class.buf));
 }
-#line 5309 "conf_parser.c" /* yacc.c:1652  */
+#line 5726 "conf_parser.c"
     break;
 
-  case 433:
-#line 2157 "conf_parser.y" /* yacc.c:1652  */
-    {
+  case 433: /* connect_tls_cipher_list: TLS_CIPHER_LIST '=' QSTRING ';'  */
+#line 2159 "conf_parser.y"
+{
 #ifdef HAVE_TLS
   if (conf_parser_ctx.pass == 2)
     strlcpy(block_state.ciph.buf, yylval.string, sizeof(block_state.ciph.buf));
@@ -5319,21 +5736,21 @@ yyreduce:
     conf_error_report("Ignoring connect::tls_cipher_list -- no TLS support");
 #endif
 }
-#line 5323 "conf_parser.c" /* yacc.c:1652  */
+#line 5740 "conf_parser.c"
     break;
 
-  case 434:
-#line 2172 "conf_parser.y" /* yacc.c:1652  */
-    {
+  case 434: /* $@22: %empty  */
+#line 2174 "conf_parser.y"
+{
   if (conf_parser_ctx.pass == 2)
     reset_block_state();
 }
-#line 5332 "conf_parser.c" /* yacc.c:1652  */
+#line 5749 "conf_parser.c"
     break;
 
-  case 435:
-#line 2176 "conf_parser.y" /* yacc.c:1652  */
-    {
+  case 435: /* kill_entry: KILL $@22 '{' kill_items '}' ';'  */
+#line 2178 "conf_parser.y"
+{
   if (conf_parser_ctx.pass != 2)
     break;
 
@@ -5351,12 +5768,12 @@ yyreduce:
     conf->reason = xstrdup(CONF_NOREASON);
   add_conf_by_address(CONF_KLINE, conf);
 }
-#line 5355 "conf_parser.c" /* yacc.c:1652  */
+#line 5772 "conf_parser.c"
     break;
 
-  case 441:
-#line 2199 "conf_parser.y" /* yacc.c:1652  */
-    {
+  case 441: /* kill_user: USER '=' QSTRING ';'  */
+#line 2201 "conf_parser.y"
+{
 
   if (conf_parser_ctx.pass == 2)
   {
@@ -5374,30 +5791,30 @@ yyreduce:
     split_nuh(&nuh);
   }
 }
-#line 5378 "conf_parser.c" /* yacc.c:1652  */
+#line 5795 "conf_parser.c"
     break;
 
-  case 442:
-#line 2219 "conf_parser.y" /* yacc.c:1652  */
-    {
+  case 442: /* kill_reason: REASON '=' QSTRING ';'  */
+#line 2221 "conf_parser.y"
+{
   if (conf_parser_ctx.pass == 2)
     strlcpy(block_state.rpass.buf, yylval.string, sizeof(block_state.rpass.buf));
 }
-#line 5387 "conf_parser.c" /* yacc.c:1652  */
+#line 5804 "conf_parser.c"
     break;
 
-  case 443:
-#line 2229 "conf_parser.y" /* yacc.c:1652  */
-    {
+  case 443: /* $@23: %empty  */
+#line 2231 "conf_parser.y"
+{
   if (conf_parser_ctx.pass == 2)
     reset_block_state();
 }
-#line 5396 "conf_parser.c" /* yacc.c:1652  */
+#line 5813 "conf_parser.c"
     break;
 
-  case 444:
-#line 2233 "conf_parser.y" /* yacc.c:1652  */
-    {
+  case 444: /* deny_entry: DENY $@23 '{' deny_items '}' ';'  */
+#line 2235 "conf_parser.y"
+{
   if (conf_parser_ctx.pass != 2)
     break;
 
@@ -5416,30 +5833,30 @@ yyreduce:
     add_conf_by_address(CONF_DLINE, conf);
   }
 }
-#line 5420 "conf_parser.c" /* yacc.c:1652  */
+#line 5837 "conf_parser.c"
     break;
 
-  case 450:
-#line 2257 "conf_parser.y" /* yacc.c:1652  */
-    {
+  case 450: /* deny_ip: IP '=' QSTRING ';'  */
+#line 2259 "conf_parser.y"
+{
   if (conf_parser_ctx.pass == 2)
     strlcpy(block_state.addr.buf, yylval.string, sizeof(block_state.addr.buf));
 }
-#line 5429 "conf_parser.c" /* yacc.c:1652  */
+#line 5846 "conf_parser.c"
     break;
 
-  case 451:
-#line 2263 "conf_parser.y" /* yacc.c:1652  */
-    {
+  case 451: /* deny_reason: REASON '=' QSTRING ';'  */
+#line 2265 "conf_parser.y"
+{
   if (conf_parser_ctx.pass == 2)
     strlcpy(block_state.rpass.buf, yylval.string, sizeof(block_state.rpass.buf));
 }
-#line 5438 "conf_parser.c" /* yacc.c:1652  */
+#line 5855 "conf_parser.c"
     break;
 
-  case 457:
-#line 2278 "conf_parser.y" /* yacc.c:1652  */
-    {
+  case 457: /* exempt_ip: IP '=' QSTRING ';'  */
+#line 2280 "conf_parser.y"
+{
   if (conf_parser_ctx.pass == 2)
   {
     if (*yylval.string && parse_netmask(yylval.string, NULL, NULL) != HM_HOST)
@@ -5451,21 +5868,21 @@ yyreduce:
     }
   }
 }
-#line 5455 "conf_parser.c" /* yacc.c:1652  */
+#line 5872 "conf_parser.c"
     break;
 
-  case 458:
-#line 2295 "conf_parser.y" /* yacc.c:1652  */
-    {
+  case 458: /* $@24: %empty  */
+#line 2297 "conf_parser.y"
+{
   if (conf_parser_ctx.pass == 2)
     reset_block_state();
 }
-#line 5464 "conf_parser.c" /* yacc.c:1652  */
+#line 5881 "conf_parser.c"
     break;
 
-  case 459:
-#line 2299 "conf_parser.y" /* yacc.c:1652  */
-    {
+  case 459: /* gecos_entry: GECOS $@24 '{' gecos_items '}' ';'  */
+#line 2301 "conf_parser.y"
+{
   if (conf_parser_ctx.pass != 2)
     break;
 
@@ -5480,871 +5897,891 @@ yyreduce:
   else
     gecos->reason = xstrdup(CONF_NOREASON);
 }
-#line 5484 "conf_parser.c" /* yacc.c:1652  */
+#line 5901 "conf_parser.c"
     break;
 
-  case 465:
-#line 2319 "conf_parser.y" /* yacc.c:1652  */
-    {
+  case 465: /* gecos_name: NAME '=' QSTRING ';'  */
+#line 2321 "conf_parser.y"
+{
   if (conf_parser_ctx.pass == 2)
     strlcpy(block_state.name.buf, yylval.string, sizeof(block_state.name.buf));
 }
-#line 5493 "conf_parser.c" /* yacc.c:1652  */
+#line 5910 "conf_parser.c"
     break;
 
-  case 466:
-#line 2325 "conf_parser.y" /* yacc.c:1652  */
-    {
+  case 466: /* gecos_reason: REASON '=' QSTRING ';'  */
+#line 2327 "conf_parser.y"
+{
   if (conf_parser_ctx.pass == 2)
     strlcpy(block_state.rpass.buf, yylval.string, sizeof(block_state.rpass.buf));
 }
-#line 5502 "conf_parser.c" /* yacc.c:1652  */
+#line 5919 "conf_parser.c"
     break;
 
-  case 516:
-#line 2386 "conf_parser.y" /* yacc.c:1652  */
-    {
+  case 518: /* general_away_count: AWAY_COUNT '=' NUMBER ';'  */
+#line 2390 "conf_parser.y"
+{
   ConfigGeneral.away_count = (yyvsp[-1].number);
 }
-#line 5510 "conf_parser.c" /* yacc.c:1652  */
+#line 5927 "conf_parser.c"
     break;
 
-  case 517:
-#line 2391 "conf_parser.y" /* yacc.c:1652  */
-    {
+  case 519: /* general_away_time: AWAY_TIME '=' timespec ';'  */
+#line 2395 "conf_parser.y"
+{
   ConfigGeneral.away_time = (yyvsp[-1].number);
 }
-#line 5518 "conf_parser.c" /* yacc.c:1652  */
+#line 5935 "conf_parser.c"
     break;
 
-  case 518:
-#line 2396 "conf_parser.y" /* yacc.c:1652  */
-    {
+  case 520: /* general_max_watch: MAX_WATCH '=' NUMBER ';'  */
+#line 2400 "conf_parser.y"
+{
   ConfigGeneral.max_watch = (yyvsp[-1].number);
 }
-#line 5526 "conf_parser.c" /* yacc.c:1652  */
+#line 5943 "conf_parser.c"
     break;
 
-  case 519:
-#line 2401 "conf_parser.y" /* yacc.c:1652  */
-    {
+  case 521: /* general_whowas_history_length: WHOWAS_HISTORY_LENGTH '=' NUMBER ';'  */
+#line 2405 "conf_parser.y"
+{
   ConfigGeneral.whowas_history_length = (yyvsp[-1].number);
 }
-#line 5534 "conf_parser.c" /* yacc.c:1652  */
+#line 5951 "conf_parser.c"
     break;
 
-  case 520:
-#line 2406 "conf_parser.y" /* yacc.c:1652  */
-    {
+  case 522: /* general_cycle_on_host_change: CYCLE_ON_HOST_CHANGE '=' TBOOL ';'  */
+#line 2410 "conf_parser.y"
+{
   ConfigGeneral.cycle_on_host_change = yylval.number;
 }
-#line 5542 "conf_parser.c" /* yacc.c:1652  */
+#line 5959 "conf_parser.c"
     break;
 
-  case 521:
-#line 2411 "conf_parser.y" /* yacc.c:1652  */
-    {
+  case 523: /* general_dline_min_cidr: DLINE_MIN_CIDR '=' NUMBER ';'  */
+#line 2415 "conf_parser.y"
+{
   ConfigGeneral.dline_min_cidr = (yyvsp[-1].number);
 }
-#line 5550 "conf_parser.c" /* yacc.c:1652  */
+#line 5967 "conf_parser.c"
     break;
 
-  case 522:
-#line 2416 "conf_parser.y" /* yacc.c:1652  */
-    {
+  case 524: /* general_dline_min_cidr6: DLINE_MIN_CIDR6 '=' NUMBER ';'  */
+#line 2420 "conf_parser.y"
+{
   ConfigGeneral.dline_min_cidr6 = (yyvsp[-1].number);
 }
-#line 5558 "conf_parser.c" /* yacc.c:1652  */
+#line 5975 "conf_parser.c"
     break;
 
-  case 523:
-#line 2421 "conf_parser.y" /* yacc.c:1652  */
-    {
+  case 525: /* general_kline_min_cidr: KLINE_MIN_CIDR '=' NUMBER ';'  */
+#line 2425 "conf_parser.y"
+{
   ConfigGeneral.kline_min_cidr = (yyvsp[-1].number);
 }
-#line 5566 "conf_parser.c" /* yacc.c:1652  */
+#line 5983 "conf_parser.c"
     break;
 
-  case 524:
-#line 2426 "conf_parser.y" /* yacc.c:1652  */
-    {
+  case 526: /* general_kline_min_cidr6: KLINE_MIN_CIDR6 '=' NUMBER ';'  */
+#line 2430 "conf_parser.y"
+{
   ConfigGeneral.kline_min_cidr6 = (yyvsp[-1].number);
 }
-#line 5574 "conf_parser.c" /* yacc.c:1652  */
+#line 5991 "conf_parser.c"
     break;
 
-  case 525:
-#line 2431 "conf_parser.y" /* yacc.c:1652  */
-    {
+  case 527: /* general_kill_chase_time_limit: KILL_CHASE_TIME_LIMIT '=' timespec ';'  */
+#line 2435 "conf_parser.y"
+{
   ConfigGeneral.kill_chase_time_limit = (yyvsp[-1].number);
 }
-#line 5582 "conf_parser.c" /* yacc.c:1652  */
+#line 5999 "conf_parser.c"
     break;
 
-  case 526:
-#line 2436 "conf_parser.y" /* yacc.c:1652  */
-    {
+  case 528: /* general_failed_oper_notice: FAILED_OPER_NOTICE '=' TBOOL ';'  */
+#line 2440 "conf_parser.y"
+{
   ConfigGeneral.failed_oper_notice = yylval.number;
 }
-#line 5590 "conf_parser.c" /* yacc.c:1652  */
+#line 6007 "conf_parser.c"
     break;
 
-  case 527:
-#line 2441 "conf_parser.y" /* yacc.c:1652  */
-    {
+  case 529: /* general_anti_nick_flood: ANTI_NICK_FLOOD '=' TBOOL ';'  */
+#line 2445 "conf_parser.y"
+{
   ConfigGeneral.anti_nick_flood = yylval.number;
 }
-#line 5598 "conf_parser.c" /* yacc.c:1652  */
+#line 6015 "conf_parser.c"
     break;
 
-  case 528:
-#line 2446 "conf_parser.y" /* yacc.c:1652  */
-    {
+  case 530: /* general_max_nick_time: MAX_NICK_TIME '=' timespec ';'  */
+#line 2450 "conf_parser.y"
+{
   ConfigGeneral.max_nick_time = (yyvsp[-1].number);
 }
-#line 5606 "conf_parser.c" /* yacc.c:1652  */
+#line 6023 "conf_parser.c"
     break;
 
-  case 529:
-#line 2451 "conf_parser.y" /* yacc.c:1652  */
-    {
+  case 531: /* general_max_nick_changes: MAX_NICK_CHANGES '=' NUMBER ';'  */
+#line 2455 "conf_parser.y"
+{
   ConfigGeneral.max_nick_changes = (yyvsp[-1].number);
 }
-#line 5614 "conf_parser.c" /* yacc.c:1652  */
+#line 6031 "conf_parser.c"
     break;
 
-  case 530:
-#line 2456 "conf_parser.y" /* yacc.c:1652  */
-    {
+  case 532: /* general_max_accept: MAX_ACCEPT '=' NUMBER ';'  */
+#line 2460 "conf_parser.y"
+{
   ConfigGeneral.max_accept = (yyvsp[-1].number);
 }
-#line 5622 "conf_parser.c" /* yacc.c:1652  */
+#line 6039 "conf_parser.c"
     break;
 
-  case 531:
-#line 2461 "conf_parser.y" /* yacc.c:1652  */
-    {
+  case 533: /* general_anti_spam_exit_message_time: ANTI_SPAM_EXIT_MESSAGE_TIME '=' timespec ';'  */
+#line 2465 "conf_parser.y"
+{
   ConfigGeneral.anti_spam_exit_message_time = (yyvsp[-1].number);
 }
-#line 5630 "conf_parser.c" /* yacc.c:1652  */
+#line 6047 "conf_parser.c"
     break;
 
-  case 532:
-#line 2466 "conf_parser.y" /* yacc.c:1652  */
-    {
+  case 534: /* general_ts_warn_delta: TS_WARN_DELTA '=' timespec ';'  */
+#line 2470 "conf_parser.y"
+{
   ConfigGeneral.ts_warn_delta = (yyvsp[-1].number);
 }
-#line 5638 "conf_parser.c" /* yacc.c:1652  */
+#line 6055 "conf_parser.c"
     break;
 
-  case 533:
-#line 2471 "conf_parser.y" /* yacc.c:1652  */
-    {
+  case 535: /* general_ts_max_delta: TS_MAX_DELTA '=' timespec ';'  */
+#line 2475 "conf_parser.y"
+{
   ConfigGeneral.ts_max_delta = (yyvsp[-1].number);
 }
-#line 5646 "conf_parser.c" /* yacc.c:1652  */
+#line 6063 "conf_parser.c"
     break;
 
-  case 534:
-#line 2476 "conf_parser.y" /* yacc.c:1652  */
-    {
+  case 536: /* general_invisible_on_connect: INVISIBLE_ON_CONNECT '=' TBOOL ';'  */
+#line 2480 "conf_parser.y"
+{
   ConfigGeneral.invisible_on_connect = yylval.number;
 }
-#line 5654 "conf_parser.c" /* yacc.c:1652  */
+#line 6071 "conf_parser.c"
     break;
 
-  case 535:
-#line 2481 "conf_parser.y" /* yacc.c:1652  */
-    {
+  case 537: /* general_warn_no_connect_block: WARN_NO_CONNECT_BLOCK '=' TBOOL ';'  */
+#line 2485 "conf_parser.y"
+{
   ConfigGeneral.warn_no_connect_block = yylval.number;
 }
-#line 5662 "conf_parser.c" /* yacc.c:1652  */
+#line 6079 "conf_parser.c"
     break;
 
-  case 536:
-#line 2486 "conf_parser.y" /* yacc.c:1652  */
-    {
+  case 538: /* general_stats_e_disabled: STATS_E_DISABLED '=' TBOOL ';'  */
+#line 2490 "conf_parser.y"
+{
   ConfigGeneral.stats_e_disabled = yylval.number;
 }
-#line 5670 "conf_parser.c" /* yacc.c:1652  */
+#line 6087 "conf_parser.c"
     break;
 
-  case 537:
-#line 2491 "conf_parser.y" /* yacc.c:1652  */
-    {
+  case 539: /* general_stats_m_oper_only: STATS_M_OPER_ONLY '=' TBOOL ';'  */
+#line 2495 "conf_parser.y"
+{
   ConfigGeneral.stats_m_oper_only = yylval.number;
 }
-#line 5678 "conf_parser.c" /* yacc.c:1652  */
+#line 6095 "conf_parser.c"
     break;
 
-  case 538:
-#line 2496 "conf_parser.y" /* yacc.c:1652  */
-    {
+  case 540: /* general_stats_o_oper_only: STATS_O_OPER_ONLY '=' TBOOL ';'  */
+#line 2500 "conf_parser.y"
+{
   ConfigGeneral.stats_o_oper_only = yylval.number;
 }
-#line 5686 "conf_parser.c" /* yacc.c:1652  */
+#line 6103 "conf_parser.c"
     break;
 
-  case 539:
-#line 2501 "conf_parser.y" /* yacc.c:1652  */
-    {
+  case 541: /* general_stats_P_oper_only: STATS_P_OPER_ONLY '=' TBOOL ';'  */
+#line 2505 "conf_parser.y"
+{
   ConfigGeneral.stats_P_oper_only = yylval.number;
 }
-#line 5694 "conf_parser.c" /* yacc.c:1652  */
+#line 6111 "conf_parser.c"
     break;
 
-  case 540:
-#line 2506 "conf_parser.y" /* yacc.c:1652  */
-    {
+  case 542: /* general_stats_u_oper_only: STATS_U_OPER_ONLY '=' TBOOL ';'  */
+#line 2510 "conf_parser.y"
+{
   ConfigGeneral.stats_u_oper_only = yylval.number;
 }
-#line 5702 "conf_parser.c" /* yacc.c:1652  */
+#line 6119 "conf_parser.c"
     break;
 
-  case 541:
-#line 2511 "conf_parser.y" /* yacc.c:1652  */
-    {
+  case 543: /* general_stats_k_oper_only: STATS_K_OPER_ONLY '=' TBOOL ';'  */
+#line 2515 "conf_parser.y"
+{
   ConfigGeneral.stats_k_oper_only = yylval.number;
 }
-#line 5710 "conf_parser.c" /* yacc.c:1652  */
+#line 6127 "conf_parser.c"
     break;
 
-  case 542:
-#line 2516 "conf_parser.y" /* yacc.c:1652  */
-    {
+  case 544: /* general_stats_i_oper_only: STATS_I_OPER_ONLY '=' TBOOL ';'  */
+#line 2520 "conf_parser.y"
+{
   ConfigGeneral.stats_i_oper_only = yylval.number;
 }
-#line 5718 "conf_parser.c" /* yacc.c:1652  */
+#line 6135 "conf_parser.c"
     break;
 
-  case 543:
-#line 2521 "conf_parser.y" /* yacc.c:1652  */
-    {
+  case 545: /* general_pace_wait: PACE_WAIT '=' timespec ';'  */
+#line 2525 "conf_parser.y"
+{
   ConfigGeneral.pace_wait = (yyvsp[-1].number);
 }
-#line 5726 "conf_parser.c" /* yacc.c:1652  */
+#line 6143 "conf_parser.c"
     break;
 
-  case 544:
-#line 2526 "conf_parser.y" /* yacc.c:1652  */
-    {
+  case 546: /* general_caller_id_wait: CALLER_ID_WAIT '=' timespec ';'  */
+#line 2530 "conf_parser.y"
+{
   ConfigGeneral.caller_id_wait = (yyvsp[-1].number);
 }
-#line 5734 "conf_parser.c" /* yacc.c:1652  */
+#line 6151 "conf_parser.c"
     break;
 
-  case 545:
-#line 2531 "conf_parser.y" /* yacc.c:1652  */
-    {
+  case 547: /* general_opers_bypass_callerid: OPERS_BYPASS_CALLERID '=' TBOOL ';'  */
+#line 2535 "conf_parser.y"
+{
   ConfigGeneral.opers_bypass_callerid = yylval.number;
 }
-#line 5742 "conf_parser.c" /* yacc.c:1652  */
+#line 6159 "conf_parser.c"
     break;
 
-  case 546:
-#line 2536 "conf_parser.y" /* yacc.c:1652  */
-    {
+  case 548: /* general_pace_wait_simple: PACE_WAIT_SIMPLE '=' timespec ';'  */
+#line 2540 "conf_parser.y"
+{
   ConfigGeneral.pace_wait_simple = (yyvsp[-1].number);
 }
-#line 5750 "conf_parser.c" /* yacc.c:1652  */
+#line 6167 "conf_parser.c"
     break;
 
-  case 547:
-#line 2541 "conf_parser.y" /* yacc.c:1652  */
-    {
+  case 549: /* general_short_motd: SHORT_MOTD '=' TBOOL ';'  */
+#line 2545 "conf_parser.y"
+{
   ConfigGeneral.short_motd = yylval.number;
 }
-#line 5758 "conf_parser.c" /* yacc.c:1652  */
+#line 6175 "conf_parser.c"
     break;
 
-  case 548:
-#line 2546 "conf_parser.y" /* yacc.c:1652  */
-    {
+  case 550: /* general_no_oper_flood: NO_OPER_FLOOD '=' TBOOL ';'  */
+#line 2550 "conf_parser.y"
+{
   ConfigGeneral.no_oper_flood = yylval.number;
 }
-#line 5766 "conf_parser.c" /* yacc.c:1652  */
+#line 6183 "conf_parser.c"
     break;
 
-  case 549:
-#line 2551 "conf_parser.y" /* yacc.c:1652  */
-    {
+  case 551: /* general_dots_in_ident: DOTS_IN_IDENT '=' NUMBER ';'  */
+#line 2555 "conf_parser.y"
+{
   ConfigGeneral.dots_in_ident = (yyvsp[-1].number);
 }
-#line 5774 "conf_parser.c" /* yacc.c:1652  */
+#line 6191 "conf_parser.c"
     break;
 
-  case 550:
-#line 2556 "conf_parser.y" /* yacc.c:1652  */
-    {
+  case 552: /* general_max_targets: MAX_TARGETS '=' NUMBER ';'  */
+#line 2560 "conf_parser.y"
+{
   ConfigGeneral.max_targets = (yyvsp[-1].number);
 }
-#line 5782 "conf_parser.c" /* yacc.c:1652  */
+#line 6199 "conf_parser.c"
     break;
 
-  case 551:
-#line 2561 "conf_parser.y" /* yacc.c:1652  */
-    {
+  case 553: /* general_ping_cookie: PING_COOKIE '=' TBOOL ';'  */
+#line 2565 "conf_parser.y"
+{
   ConfigGeneral.ping_cookie = yylval.number;
 }
-#line 5790 "conf_parser.c" /* yacc.c:1652  */
+#line 6207 "conf_parser.c"
     break;
 
-  case 552:
-#line 2566 "conf_parser.y" /* yacc.c:1652  */
-    {
+  case 554: /* general_disable_auth: DISABLE_AUTH '=' TBOOL ';'  */
+#line 2570 "conf_parser.y"
+{
   ConfigGeneral.disable_auth = yylval.number;
 }
-#line 5798 "conf_parser.c" /* yacc.c:1652  */
+#line 6215 "conf_parser.c"
     break;
 
-  case 553:
-#line 2571 "conf_parser.y" /* yacc.c:1652  */
-    {
+  case 555: /* general_throttle_count: THROTTLE_COUNT '=' NUMBER ';'  */
+#line 2575 "conf_parser.y"
+{
   ConfigGeneral.throttle_count = (yyvsp[-1].number);
 }
-#line 5806 "conf_parser.c" /* yacc.c:1652  */
+#line 6223 "conf_parser.c"
     break;
 
-  case 554:
-#line 2576 "conf_parser.y" /* yacc.c:1652  */
-    {
+  case 556: /* general_throttle_time: THROTTLE_TIME '=' timespec ';'  */
+#line 2580 "conf_parser.y"
+{
   ConfigGeneral.throttle_time = (yyvsp[-1].number);
 }
-#line 5814 "conf_parser.c" /* yacc.c:1652  */
+#line 6231 "conf_parser.c"
     break;
 
-  case 555:
-#line 2581 "conf_parser.y" /* yacc.c:1652  */
-    {
+  case 557: /* $@25: %empty  */
+#line 2585 "conf_parser.y"
+{
   ConfigGeneral.oper_umodes = 0;
 }
-#line 5822 "conf_parser.c" /* yacc.c:1652  */
+#line 6239 "conf_parser.c"
     break;
 
-  case 559:
-#line 2587 "conf_parser.y" /* yacc.c:1652  */
-    {
+  case 561: /* umode_oitem: T_BOTS  */
+#line 2591 "conf_parser.y"
+{
   ConfigGeneral.oper_umodes |= UMODE_BOTS;
 }
-#line 5830 "conf_parser.c" /* yacc.c:1652  */
+#line 6247 "conf_parser.c"
     break;
 
-  case 560:
-#line 2590 "conf_parser.y" /* yacc.c:1652  */
-    {
+  case 562: /* umode_oitem: T_CCONN  */
+#line 2594 "conf_parser.y"
+{
   ConfigGeneral.oper_umodes |= UMODE_CCONN;
 }
-#line 5838 "conf_parser.c" /* yacc.c:1652  */
+#line 6255 "conf_parser.c"
     break;
 
-  case 561:
-#line 2593 "conf_parser.y" /* yacc.c:1652  */
-    {
+  case 563: /* umode_oitem: T_DEAF  */
+#line 2597 "conf_parser.y"
+{
   ConfigGeneral.oper_umodes |= UMODE_DEAF;
 }
-#line 5846 "conf_parser.c" /* yacc.c:1652  */
+#line 6263 "conf_parser.c"
     break;
 
-  case 562:
-#line 2596 "conf_parser.y" /* yacc.c:1652  */
-    {
+  case 564: /* umode_oitem: T_DEBUG  */
+#line 2600 "conf_parser.y"
+{
   ConfigGeneral.oper_umodes |= UMODE_DEBUG;
 }
-#line 5854 "conf_parser.c" /* yacc.c:1652  */
+#line 6271 "conf_parser.c"
     break;
 
-  case 563:
-#line 2599 "conf_parser.y" /* yacc.c:1652  */
-    {
+  case 565: /* umode_oitem: T_FULL  */
+#line 2603 "conf_parser.y"
+{
   ConfigGeneral.oper_umodes |= UMODE_FULL;
 }
-#line 5862 "conf_parser.c" /* yacc.c:1652  */
+#line 6279 "conf_parser.c"
     break;
 
-  case 564:
-#line 2602 "conf_parser.y" /* yacc.c:1652  */
-    {
+  case 566: /* umode_oitem: HIDDEN  */
+#line 2606 "conf_parser.y"
+{
   ConfigGeneral.oper_umodes |= UMODE_HIDDEN;
 }
-#line 5870 "conf_parser.c" /* yacc.c:1652  */
+#line 6287 "conf_parser.c"
     break;
 
-  case 565:
-#line 2605 "conf_parser.y" /* yacc.c:1652  */
-    {
+  case 567: /* umode_oitem: HIDE_CHANS  */
+#line 2609 "conf_parser.y"
+{
   ConfigGeneral.oper_umodes |= UMODE_HIDECHANS;
 }
-#line 5878 "conf_parser.c" /* yacc.c:1652  */
+#line 6295 "conf_parser.c"
     break;
 
-  case 566:
-#line 2608 "conf_parser.y" /* yacc.c:1652  */
-    {
+  case 568: /* umode_oitem: HIDE_IDLE  */
+#line 2612 "conf_parser.y"
+{
   ConfigGeneral.oper_umodes |= UMODE_HIDEIDLE;
 }
-#line 5886 "conf_parser.c" /* yacc.c:1652  */
+#line 6303 "conf_parser.c"
     break;
 
-  case 567:
-#line 2611 "conf_parser.y" /* yacc.c:1652  */
-    {
+  case 569: /* umode_oitem: T_SKILL  */
+#line 2615 "conf_parser.y"
+{
   ConfigGeneral.oper_umodes |= UMODE_SKILL;
 }
-#line 5894 "conf_parser.c" /* yacc.c:1652  */
+#line 6311 "conf_parser.c"
     break;
 
-  case 568:
-#line 2614 "conf_parser.y" /* yacc.c:1652  */
-    {
+  case 570: /* umode_oitem: T_NCHANGE  */
+#line 2618 "conf_parser.y"
+{
   ConfigGeneral.oper_umodes |= UMODE_NCHANGE;
 }
-#line 5902 "conf_parser.c" /* yacc.c:1652  */
+#line 6319 "conf_parser.c"
     break;
 
-  case 569:
-#line 2617 "conf_parser.y" /* yacc.c:1652  */
-    {
+  case 571: /* umode_oitem: T_REJ  */
+#line 2621 "conf_parser.y"
+{
   ConfigGeneral.oper_umodes |= UMODE_REJ;
 }
-#line 5910 "conf_parser.c" /* yacc.c:1652  */
+#line 6327 "conf_parser.c"
     break;
 
-  case 570:
-#line 2620 "conf_parser.y" /* yacc.c:1652  */
-    {
+  case 572: /* umode_oitem: T_UNAUTH  */
+#line 2624 "conf_parser.y"
+{
   ConfigGeneral.oper_umodes |= UMODE_UNAUTH;
 }
-#line 5918 "conf_parser.c" /* yacc.c:1652  */
+#line 6335 "conf_parser.c"
     break;
 
-  case 571:
-#line 2623 "conf_parser.y" /* yacc.c:1652  */
-    {
+  case 573: /* umode_oitem: T_SPY  */
+#line 2627 "conf_parser.y"
+{
   ConfigGeneral.oper_umodes |= UMODE_SPY;
 }
-#line 5926 "conf_parser.c" /* yacc.c:1652  */
+#line 6343 "conf_parser.c"
     break;
 
-  case 572:
-#line 2626 "conf_parser.y" /* yacc.c:1652  */
-    {
+  case 574: /* umode_oitem: T_EXTERNAL  */
+#line 2630 "conf_parser.y"
+{
   ConfigGeneral.oper_umodes |= UMODE_EXTERNAL;
 }
-#line 5934 "conf_parser.c" /* yacc.c:1652  */
+#line 6351 "conf_parser.c"
     break;
 
-  case 573:
-#line 2629 "conf_parser.y" /* yacc.c:1652  */
-    {
+  case 575: /* umode_oitem: T_SERVNOTICE  */
+#line 2633 "conf_parser.y"
+{
   ConfigGeneral.oper_umodes |= UMODE_SERVNOTICE;
 }
-#line 5942 "conf_parser.c" /* yacc.c:1652  */
+#line 6359 "conf_parser.c"
     break;
 
-  case 574:
-#line 2632 "conf_parser.y" /* yacc.c:1652  */
-    {
+  case 576: /* umode_oitem: T_INVISIBLE  */
+#line 2636 "conf_parser.y"
+{
   ConfigGeneral.oper_umodes |= UMODE_INVISIBLE;
 }
-#line 5950 "conf_parser.c" /* yacc.c:1652  */
+#line 6367 "conf_parser.c"
     break;
 
-  case 575:
-#line 2635 "conf_parser.y" /* yacc.c:1652  */
-    {
+  case 577: /* umode_oitem: T_WALLOP  */
+#line 2639 "conf_parser.y"
+{
   ConfigGeneral.oper_umodes |= UMODE_WALLOP;
 }
-#line 5958 "conf_parser.c" /* yacc.c:1652  */
+#line 6375 "conf_parser.c"
     break;
 
-  case 576:
-#line 2638 "conf_parser.y" /* yacc.c:1652  */
-    {
+  case 578: /* umode_oitem: T_SOFTCALLERID  */
+#line 2642 "conf_parser.y"
+{
   ConfigGeneral.oper_umodes |= UMODE_SOFTCALLERID;
 }
-#line 5966 "conf_parser.c" /* yacc.c:1652  */
+#line 6383 "conf_parser.c"
     break;
 
-  case 577:
-#line 2641 "conf_parser.y" /* yacc.c:1652  */
-    {
+  case 579: /* umode_oitem: T_CALLERID  */
+#line 2645 "conf_parser.y"
+{
   ConfigGeneral.oper_umodes |= UMODE_CALLERID;
 }
-#line 5974 "conf_parser.c" /* yacc.c:1652  */
+#line 6391 "conf_parser.c"
     break;
 
-  case 578:
-#line 2644 "conf_parser.y" /* yacc.c:1652  */
-    {
+  case 580: /* umode_oitem: T_LOCOPS  */
+#line 2648 "conf_parser.y"
+{
   ConfigGeneral.oper_umodes |= UMODE_LOCOPS;
 }
-#line 5982 "conf_parser.c" /* yacc.c:1652  */
+#line 6399 "conf_parser.c"
     break;
 
-  case 579:
-#line 2647 "conf_parser.y" /* yacc.c:1652  */
-    {
+  case 581: /* umode_oitem: T_NONONREG  */
+#line 2651 "conf_parser.y"
+{
   ConfigGeneral.oper_umodes |= UMODE_REGONLY;
 }
-#line 5990 "conf_parser.c" /* yacc.c:1652  */
+#line 6407 "conf_parser.c"
     break;
 
-  case 580:
-#line 2650 "conf_parser.y" /* yacc.c:1652  */
-    {
+  case 582: /* umode_oitem: T_FARCONNECT  */
+#line 2654 "conf_parser.y"
+{
   ConfigGeneral.oper_umodes |= UMODE_FARCONNECT;
 }
-#line 5998 "conf_parser.c" /* yacc.c:1652  */
+#line 6415 "conf_parser.c"
     break;
 
-  case 581:
-#line 2653 "conf_parser.y" /* yacc.c:1652  */
-    {
+  case 583: /* umode_oitem: EXPIRATION  */
+#line 2657 "conf_parser.y"
+{
   ConfigGeneral.oper_umodes |= UMODE_EXPIRATION;
 }
-#line 6006 "conf_parser.c" /* yacc.c:1652  */
+#line 6423 "conf_parser.c"
     break;
 
-  case 582:
-#line 2658 "conf_parser.y" /* yacc.c:1652  */
-    {
+  case 584: /* $@26: %empty  */
+#line 2662 "conf_parser.y"
+{
   ConfigGeneral.oper_only_umodes = 0;
 }
-#line 6014 "conf_parser.c" /* yacc.c:1652  */
+#line 6431 "conf_parser.c"
     break;
 
-  case 586:
-#line 2664 "conf_parser.y" /* yacc.c:1652  */
-    {
+  case 588: /* umode_item: T_BOTS  */
+#line 2668 "conf_parser.y"
+{
   ConfigGeneral.oper_only_umodes |= UMODE_BOTS;
 }
-#line 6022 "conf_parser.c" /* yacc.c:1652  */
+#line 6439 "conf_parser.c"
     break;
 
-  case 587:
-#line 2667 "conf_parser.y" /* yacc.c:1652  */
-    {
+  case 589: /* umode_item: T_CCONN  */
+#line 2671 "conf_parser.y"
+{
   ConfigGeneral.oper_only_umodes |= UMODE_CCONN;
 }
-#line 6030 "conf_parser.c" /* yacc.c:1652  */
+#line 6447 "conf_parser.c"
     break;
 
-  case 588:
-#line 2670 "conf_parser.y" /* yacc.c:1652  */
-    {
+  case 590: /* umode_item: T_DEAF  */
+#line 2674 "conf_parser.y"
+{
   ConfigGeneral.oper_only_umodes |= UMODE_DEAF;
 }
-#line 6038 "conf_parser.c" /* yacc.c:1652  */
+#line 6455 "conf_parser.c"
     break;
 
-  case 589:
-#line 2673 "conf_parser.y" /* yacc.c:1652  */
-    {
+  case 591: /* umode_item: T_DEBUG  */
+#line 2677 "conf_parser.y"
+{
   ConfigGeneral.oper_only_umodes |= UMODE_DEBUG;
 }
-#line 6046 "conf_parser.c" /* yacc.c:1652  */
+#line 6463 "conf_parser.c"
     break;
 
-  case 590:
-#line 2676 "conf_parser.y" /* yacc.c:1652  */
-    {
+  case 592: /* umode_item: T_FULL  */
+#line 2680 "conf_parser.y"
+{
   ConfigGeneral.oper_only_umodes |= UMODE_FULL;
 }
-#line 6054 "conf_parser.c" /* yacc.c:1652  */
+#line 6471 "conf_parser.c"
     break;
 
-  case 591:
-#line 2679 "conf_parser.y" /* yacc.c:1652  */
-    {
+  case 593: /* umode_item: T_SKILL  */
+#line 2683 "conf_parser.y"
+{
   ConfigGeneral.oper_only_umodes |= UMODE_SKILL;
 }
-#line 6062 "conf_parser.c" /* yacc.c:1652  */
+#line 6479 "conf_parser.c"
     break;
 
-  case 592:
-#line 2682 "conf_parser.y" /* yacc.c:1652  */
-    {
+  case 594: /* umode_item: HIDDEN  */
+#line 2686 "conf_parser.y"
+{
   ConfigGeneral.oper_only_umodes |= UMODE_HIDDEN;
 }
-#line 6070 "conf_parser.c" /* yacc.c:1652  */
+#line 6487 "conf_parser.c"
     break;
 
-  case 593:
-#line 2685 "conf_parser.y" /* yacc.c:1652  */
-    {
+  case 595: /* umode_item: T_NCHANGE  */
+#line 2689 "conf_parser.y"
+{
   ConfigGeneral.oper_only_umodes |= UMODE_NCHANGE;
 }
-#line 6078 "conf_parser.c" /* yacc.c:1652  */
+#line 6495 "conf_parser.c"
     break;
 
-  case 594:
-#line 2688 "conf_parser.y" /* yacc.c:1652  */
-    {
+  case 596: /* umode_item: T_REJ  */
+#line 2692 "conf_parser.y"
+{
   ConfigGeneral.oper_only_umodes |= UMODE_REJ;
 }
-#line 6086 "conf_parser.c" /* yacc.c:1652  */
+#line 6503 "conf_parser.c"
     break;
 
-  case 595:
-#line 2691 "conf_parser.y" /* yacc.c:1652  */
-    {
+  case 597: /* umode_item: T_UNAUTH  */
+#line 2695 "conf_parser.y"
+{
   ConfigGeneral.oper_only_umodes |= UMODE_UNAUTH;
 }
-#line 6094 "conf_parser.c" /* yacc.c:1652  */
+#line 6511 "conf_parser.c"
     break;
 
-  case 596:
-#line 2694 "conf_parser.y" /* yacc.c:1652  */
-    {
+  case 598: /* umode_item: T_SPY  */
+#line 2698 "conf_parser.y"
+{
   ConfigGeneral.oper_only_umodes |= UMODE_SPY;
 }
-#line 6102 "conf_parser.c" /* yacc.c:1652  */
+#line 6519 "conf_parser.c"
     break;
 
-  case 597:
-#line 2697 "conf_parser.y" /* yacc.c:1652  */
-    {
+  case 599: /* umode_item: T_EXTERNAL  */
+#line 2701 "conf_parser.y"
+{
   ConfigGeneral.oper_only_umodes |= UMODE_EXTERNAL;
 }
-#line 6110 "conf_parser.c" /* yacc.c:1652  */
+#line 6527 "conf_parser.c"
     break;
 
-  case 598:
-#line 2700 "conf_parser.y" /* yacc.c:1652  */
-    {
+  case 600: /* umode_item: T_SERVNOTICE  */
+#line 2704 "conf_parser.y"
+{
   ConfigGeneral.oper_only_umodes |= UMODE_SERVNOTICE;
 }
-#line 6118 "conf_parser.c" /* yacc.c:1652  */
+#line 6535 "conf_parser.c"
     break;
 
-  case 599:
-#line 2703 "conf_parser.y" /* yacc.c:1652  */
-    {
+  case 601: /* umode_item: T_INVISIBLE  */
+#line 2707 "conf_parser.y"
+{
   ConfigGeneral.oper_only_umodes |= UMODE_INVISIBLE;
 }
-#line 6126 "conf_parser.c" /* yacc.c:1652  */
+#line 6543 "conf_parser.c"
     break;
 
-  case 600:
-#line 2706 "conf_parser.y" /* yacc.c:1652  */
-    {
+  case 602: /* umode_item: T_WALLOP  */
+#line 2710 "conf_parser.y"
+{
   ConfigGeneral.oper_only_umodes |= UMODE_WALLOP;
 }
-#line 6134 "conf_parser.c" /* yacc.c:1652  */
+#line 6551 "conf_parser.c"
     break;
 
-  case 601:
-#line 2709 "conf_parser.y" /* yacc.c:1652  */
-    {
+  case 603: /* umode_item: T_SOFTCALLERID  */
+#line 2713 "conf_parser.y"
+{
   ConfigGeneral.oper_only_umodes |= UMODE_SOFTCALLERID;
 }
-#line 6142 "conf_parser.c" /* yacc.c:1652  */
+#line 6559 "conf_parser.c"
     break;
 
-  case 602:
-#line 2712 "conf_parser.y" /* yacc.c:1652  */
-    {
+  case 604: /* umode_item: T_CALLERID  */
+#line 2716 "conf_parser.y"
+{
   ConfigGeneral.oper_only_umodes |= UMODE_CALLERID;
 }
-#line 6150 "conf_parser.c" /* yacc.c:1652  */
+#line 6567 "conf_parser.c"
     break;
 
-  case 603:
-#line 2715 "conf_parser.y" /* yacc.c:1652  */
-    {
+  case 605: /* umode_item: T_LOCOPS  */
+#line 2719 "conf_parser.y"
+{
   ConfigGeneral.oper_only_umodes |= UMODE_LOCOPS;
 }
-#line 6158 "conf_parser.c" /* yacc.c:1652  */
+#line 6575 "conf_parser.c"
     break;
 
-  case 604:
-#line 2718 "conf_parser.y" /* yacc.c:1652  */
-    {
+  case 606: /* umode_item: T_NONONREG  */
+#line 2722 "conf_parser.y"
+{
   ConfigGeneral.oper_only_umodes |= UMODE_REGONLY;
 }
-#line 6166 "conf_parser.c" /* yacc.c:1652  */
+#line 6583 "conf_parser.c"
     break;
 
-  case 605:
-#line 2721 "conf_parser.y" /* yacc.c:1652  */
-    {
+  case 607: /* umode_item: T_FARCONNECT  */
+#line 2725 "conf_parser.y"
+{
   ConfigGeneral.oper_only_umodes |= UMODE_FARCONNECT;
 }
-#line 6174 "conf_parser.c" /* yacc.c:1652  */
+#line 6591 "conf_parser.c"
     break;
 
-  case 606:
-#line 2724 "conf_parser.y" /* yacc.c:1652  */
-    {
+  case 608: /* umode_item: EXPIRATION  */
+#line 2728 "conf_parser.y"
+{
   ConfigGeneral.oper_only_umodes |= UMODE_EXPIRATION;
 }
-#line 6182 "conf_parser.c" /* yacc.c:1652  */
+#line 6599 "conf_parser.c"
     break;
 
-  case 607:
-#line 2729 "conf_parser.y" /* yacc.c:1652  */
-    {
+  case 609: /* general_min_nonwildcard: MIN_NONWILDCARD '=' NUMBER ';'  */
+#line 2733 "conf_parser.y"
+{
   ConfigGeneral.min_nonwildcard = (yyvsp[-1].number);
 }
-#line 6190 "conf_parser.c" /* yacc.c:1652  */
+#line 6607 "conf_parser.c"
     break;
 
-  case 608:
-#line 2734 "conf_parser.y" /* yacc.c:1652  */
-    {
+  case 610: /* general_min_nonwildcard_simple: MIN_NONWILDCARD_SIMPLE '=' NUMBER ';'  */
+#line 2738 "conf_parser.y"
+{
   ConfigGeneral.min_nonwildcard_simple = (yyvsp[-1].number);
 }
-#line 6198 "conf_parser.c" /* yacc.c:1652  */
+#line 6615 "conf_parser.c"
     break;
 
-  case 609:
-#line 2739 "conf_parser.y" /* yacc.c:1652  */
-    {
+  case 611: /* general_default_floodcount: DEFAULT_FLOODCOUNT '=' NUMBER ';'  */
+#line 2743 "conf_parser.y"
+{
   ConfigGeneral.default_floodcount = (yyvsp[-1].number);
 }
-#line 6206 "conf_parser.c" /* yacc.c:1652  */
+#line 6623 "conf_parser.c"
     break;
 
-  case 610:
-#line 2744 "conf_parser.y" /* yacc.c:1652  */
-    {
+  case 612: /* general_default_floodtime: DEFAULT_FLOODTIME '=' timespec ';'  */
+#line 2748 "conf_parser.y"
+{
   ConfigGeneral.default_floodtime = (yyvsp[-1].number);
 }
-#line 6214 "conf_parser.c" /* yacc.c:1652  */
+#line 6631 "conf_parser.c"
     break;
 
-  case 630:
-#line 2773 "conf_parser.y" /* yacc.c:1652  */
-    {
+  case 613: /* general_perf_export_delay: PERF_EXPORT_DELAY '=' timespec ';'  */
+#line 2753 "conf_parser.y"
+{
+  ConfigGeneral.perf_export_delay = (yyvsp[-1].number);
+}
+#line 6639 "conf_parser.c"
+    break;
+
+  case 614: /* general_perf_export_file: PERF_EXPORT_FILE '=' QSTRING ';'  */
+#line 2758 "conf_parser.y"
+{
+  if (conf_parser_ctx.pass == 2)
+  {
+    xfree(ConfigGeneral.perf_export_file);
+    ConfigGeneral.perf_export_file = xstrdup(yylval.string);
+  }
+}
+#line 6651 "conf_parser.c"
+    break;
+
+  case 634: /* channel_enable_extbans: ENABLE_EXTBANS '=' TBOOL ';'  */
+#line 2791 "conf_parser.y"
+{
   ConfigChannel.enable_extbans = yylval.number;
 }
-#line 6222 "conf_parser.c" /* yacc.c:1652  */
+#line 6659 "conf_parser.c"
     break;
 
-  case 631:
-#line 2778 "conf_parser.y" /* yacc.c:1652  */
-    {
+  case 635: /* channel_disable_fake_channels: DISABLE_FAKE_CHANNELS '=' TBOOL ';'  */
+#line 2796 "conf_parser.y"
+{
   ConfigChannel.disable_fake_channels = yylval.number;
 }
-#line 6230 "conf_parser.c" /* yacc.c:1652  */
+#line 6667 "conf_parser.c"
     break;
 
-  case 632:
-#line 2783 "conf_parser.y" /* yacc.c:1652  */
-    {
+  case 636: /* channel_invite_client_count: INVITE_CLIENT_COUNT '=' NUMBER ';'  */
+#line 2801 "conf_parser.y"
+{
   ConfigChannel.invite_client_count = (yyvsp[-1].number);
 }
-#line 6238 "conf_parser.c" /* yacc.c:1652  */
+#line 6675 "conf_parser.c"
     break;
 
-  case 633:
-#line 2788 "conf_parser.y" /* yacc.c:1652  */
-    {
+  case 637: /* channel_invite_client_time: INVITE_CLIENT_TIME '=' timespec ';'  */
+#line 2806 "conf_parser.y"
+{
   ConfigChannel.invite_client_time = (yyvsp[-1].number);
 }
-#line 6246 "conf_parser.c" /* yacc.c:1652  */
+#line 6683 "conf_parser.c"
     break;
 
-  case 634:
-#line 2793 "conf_parser.y" /* yacc.c:1652  */
-    {
+  case 638: /* channel_invite_delay_channel: INVITE_DELAY_CHANNEL '=' timespec ';'  */
+#line 2811 "conf_parser.y"
+{
   ConfigChannel.invite_delay_channel = (yyvsp[-1].number);
 }
-#line 6254 "conf_parser.c" /* yacc.c:1652  */
+#line 6691 "conf_parser.c"
     break;
 
-  case 635:
-#line 2798 "conf_parser.y" /* yacc.c:1652  */
-    {
+  case 639: /* channel_invite_expire_time: INVITE_EXPIRE_TIME '=' timespec ';'  */
+#line 2816 "conf_parser.y"
+{
   ConfigChannel.invite_expire_time = (yyvsp[-1].number);
 }
-#line 6262 "conf_parser.c" /* yacc.c:1652  */
+#line 6699 "conf_parser.c"
     break;
 
-  case 636:
-#line 2803 "conf_parser.y" /* yacc.c:1652  */
-    {
+  case 640: /* channel_knock_client_count: KNOCK_CLIENT_COUNT '=' NUMBER ';'  */
+#line 2821 "conf_parser.y"
+{
   ConfigChannel.knock_client_count = (yyvsp[-1].number);
 }
-#line 6270 "conf_parser.c" /* yacc.c:1652  */
+#line 6707 "conf_parser.c"
     break;
 
-  case 637:
-#line 2808 "conf_parser.y" /* yacc.c:1652  */
-    {
+  case 641: /* channel_knock_client_time: KNOCK_CLIENT_TIME '=' timespec ';'  */
+#line 2826 "conf_parser.y"
+{
   ConfigChannel.knock_client_time = (yyvsp[-1].number);
 }
-#line 6278 "conf_parser.c" /* yacc.c:1652  */
+#line 6715 "conf_parser.c"
     break;
 
-  case 638:
-#line 2813 "conf_parser.y" /* yacc.c:1652  */
-    {
+  case 642: /* channel_knock_delay_channel: KNOCK_DELAY_CHANNEL '=' timespec ';'  */
+#line 2831 "conf_parser.y"
+{
   ConfigChannel.knock_delay_channel = (yyvsp[-1].number);
 }
-#line 6286 "conf_parser.c" /* yacc.c:1652  */
+#line 6723 "conf_parser.c"
     break;
 
-  case 639:
-#line 2818 "conf_parser.y" /* yacc.c:1652  */
-    {
+  case 643: /* channel_max_channels: MAX_CHANNELS '=' NUMBER ';'  */
+#line 2836 "conf_parser.y"
+{
   ConfigChannel.max_channels = (yyvsp[-1].number);
 }
-#line 6294 "conf_parser.c" /* yacc.c:1652  */
+#line 6731 "conf_parser.c"
     break;
 
-  case 640:
-#line 2823 "conf_parser.y" /* yacc.c:1652  */
-    {
+  case 644: /* channel_max_invites: MAX_INVITES '=' NUMBER ';'  */
+#line 2841 "conf_parser.y"
+{
   ConfigChannel.max_invites = (yyvsp[-1].number);
 }
-#line 6302 "conf_parser.c" /* yacc.c:1652  */
+#line 6739 "conf_parser.c"
     break;
 
-  case 641:
-#line 2828 "conf_parser.y" /* yacc.c:1652  */
-    {
+  case 645: /* channel_max_bans: MAX_BANS '=' NUMBER ';'  */
+#line 2846 "conf_parser.y"
+{
   ConfigChannel.max_bans = (yyvsp[-1].number);
 }
-#line 6310 "conf_parser.c" /* yacc.c:1652  */
+#line 6747 "conf_parser.c"
     break;
 
-  case 642:
-#line 2833 "conf_parser.y" /* yacc.c:1652  */
-    {
+  case 646: /* channel_max_bans_large: MAX_BANS_LARGE '=' NUMBER ';'  */
+#line 2851 "conf_parser.y"
+{
   ConfigChannel.max_bans_large = (yyvsp[-1].number);
 }
-#line 6318 "conf_parser.c" /* yacc.c:1652  */
+#line 6755 "conf_parser.c"
     break;
 
-  case 643:
-#line 2838 "conf_parser.y" /* yacc.c:1652  */
-    {
+  case 647: /* channel_default_join_flood_count: DEFAULT_JOIN_FLOOD_COUNT '=' NUMBER ';'  */
+#line 2856 "conf_parser.y"
+{
   ConfigChannel.default_join_flood_count = yylval.number;
 }
-#line 6326 "conf_parser.c" /* yacc.c:1652  */
+#line 6763 "conf_parser.c"
     break;
 
-  case 644:
-#line 2843 "conf_parser.y" /* yacc.c:1652  */
-    {
+  case 648: /* channel_default_join_flood_time: DEFAULT_JOIN_FLOOD_TIME '=' timespec ';'  */
+#line 2861 "conf_parser.y"
+{
   ConfigChannel.default_join_flood_time = (yyvsp[-1].number);
 }
-#line 6334 "conf_parser.c" /* yacc.c:1652  */
+#line 6771 "conf_parser.c"
     break;
 
-  case 658:
-#line 2866 "conf_parser.y" /* yacc.c:1652  */
-    {
+  case 662: /* serverhide_flatten_links: FLATTEN_LINKS '=' TBOOL ';'  */
+#line 2884 "conf_parser.y"
+{
   if (conf_parser_ctx.pass == 2)
     ConfigServerHide.flatten_links = yylval.number;
 }
-#line 6343 "conf_parser.c" /* yacc.c:1652  */
+#line 6780 "conf_parser.c"
     break;
 
-  case 659:
-#line 2872 "conf_parser.y" /* yacc.c:1652  */
-    {
+  case 663: /* serverhide_flatten_links_delay: FLATTEN_LINKS_DELAY '=' timespec ';'  */
+#line 2890 "conf_parser.y"
+{
   if (conf_parser_ctx.pass == 2)
   {
     if ((yyvsp[-1].number) > 0)
@@ -6358,80 +6795,81 @@ yyreduce:
     ConfigServerHide.flatten_links_delay = (yyvsp[-1].number);
   }
 }
-#line 6362 "conf_parser.c" /* yacc.c:1652  */
+#line 6799 "conf_parser.c"
     break;
 
-  case 660:
-#line 2888 "conf_parser.y" /* yacc.c:1652  */
-    {
+  case 664: /* serverhide_flatten_links_file: FLATTEN_LINKS_FILE '=' QSTRING ';'  */
+#line 2906 "conf_parser.y"
+{
   if (conf_parser_ctx.pass == 2)
   {
     xfree(ConfigServerHide.flatten_links_file);
     ConfigServerHide.flatten_links_file = xstrdup(yylval.string);
   }
 }
-#line 6374 "conf_parser.c" /* yacc.c:1652  */
+#line 6811 "conf_parser.c"
     break;
 
-  case 661:
-#line 2897 "conf_parser.y" /* yacc.c:1652  */
-    {
+  case 665: /* serverhide_disable_remote_commands: DISABLE_REMOTE_COMMANDS '=' TBOOL ';'  */
+#line 2915 "conf_parser.y"
+{
   if (conf_parser_ctx.pass == 2)
     ConfigServerHide.disable_remote_commands = yylval.number;
 }
-#line 6383 "conf_parser.c" /* yacc.c:1652  */
+#line 6820 "conf_parser.c"
     break;
 
-  case 662:
-#line 2903 "conf_parser.y" /* yacc.c:1652  */
-    {
+  case 666: /* serverhide_hide_servers: HIDE_SERVERS '=' TBOOL ';'  */
+#line 2921 "conf_parser.y"
+{
   if (conf_parser_ctx.pass == 2)
     ConfigServerHide.hide_servers = yylval.number;
 }
-#line 6392 "conf_parser.c" /* yacc.c:1652  */
+#line 6829 "conf_parser.c"
     break;
 
-  case 663:
-#line 2909 "conf_parser.y" /* yacc.c:1652  */
-    {
+  case 667: /* serverhide_hide_services: HIDE_SERVICES '=' TBOOL ';'  */
+#line 2927 "conf_parser.y"
+{
   if (conf_parser_ctx.pass == 2)
     ConfigServerHide.hide_services = yylval.number;
 }
-#line 6401 "conf_parser.c" /* yacc.c:1652  */
+#line 6838 "conf_parser.c"
     break;
 
-  case 664:
-#line 2915 "conf_parser.y" /* yacc.c:1652  */
-    {
+  case 668: /* serverhide_hidden_name: HIDDEN_NAME '=' QSTRING ';'  */
+#line 2933 "conf_parser.y"
+{
   if (conf_parser_ctx.pass == 2)
   {
     xfree(ConfigServerHide.hidden_name);
     ConfigServerHide.hidden_name = xstrdup(yylval.string);
   }
 }
-#line 6413 "conf_parser.c" /* yacc.c:1652  */
+#line 6850 "conf_parser.c"
     break;
 
-  case 665:
-#line 2924 "conf_parser.y" /* yacc.c:1652  */
-    {
+  case 669: /* serverhide_hidden: HIDDEN '=' TBOOL ';'  */
+#line 2942 "conf_parser.y"
+{
   if (conf_parser_ctx.pass == 2)
     ConfigServerHide.hidden = yylval.number;
 }
-#line 6422 "conf_parser.c" /* yacc.c:1652  */
+#line 6859 "conf_parser.c"
     break;
 
-  case 666:
-#line 2930 "conf_parser.y" /* yacc.c:1652  */
-    {
+  case 670: /* serverhide_hide_server_ips: HIDE_SERVER_IPS '=' TBOOL ';'  */
+#line 2948 "conf_parser.y"
+{
   if (conf_parser_ctx.pass == 2)
     ConfigServerHide.hide_server_ips = yylval.number;
 }
-#line 6431 "conf_parser.c" /* yacc.c:1652  */
+#line 6868 "conf_parser.c"
     break;
 
 
-#line 6435 "conf_parser.c" /* yacc.c:1652  */
+#line 6872 "conf_parser.c"
+
       default: break;
     }
   /* User semantic actions sometimes alter yychar, and that requires
@@ -6445,11 +6883,10 @@ yyreduce:
      case of YYERROR or YYBACKUP, subsequent parser actions might lead
      to an incorrect destructor call or verbose syntax error message
      before the lookahead is translated.  */
-  YY_SYMBOL_PRINT ("-> $$ =", yyr1[yyn], &yyval, &yyloc);
+  YY_SYMBOL_PRINT ("-> $$ =", YY_CAST (yysymbol_kind_t, yyr1[yyn]), &yyval, &yyloc);
 
   YYPOPSTACK (yylen);
   yylen = 0;
-  YY_STACK_PRINT (yyss, yyssp);
 
   *++yyvsp = yyval;
 
@@ -6473,50 +6910,14 @@ yyreduce:
 yyerrlab:
   /* Make sure we have latest lookahead translation.  See comments at
      user semantic actions for why this is necessary.  */
-  yytoken = yychar == YYEMPTY ? YYEMPTY : YYTRANSLATE (yychar);
-
+  yytoken = yychar == YYEMPTY ? YYSYMBOL_YYEMPTY : YYTRANSLATE (yychar);
   /* If not already recovering from an error, report this error.  */
   if (!yyerrstatus)
     {
       ++yynerrs;
-#if ! YYERROR_VERBOSE
       yyerror (YY_("syntax error"));
-#else
-# define YYSYNTAX_ERROR yysyntax_error (&yymsg_alloc, &yymsg, \
-                                        yyssp, yytoken)
-      {
-        char const *yymsgp = YY_("syntax error");
-        int yysyntax_error_status;
-        yysyntax_error_status = YYSYNTAX_ERROR;
-        if (yysyntax_error_status == 0)
-          yymsgp = yymsg;
-        else if (yysyntax_error_status == 1)
-          {
-            if (yymsg != yymsgbuf)
-              YYSTACK_FREE (yymsg);
-            yymsg = (char *) YYSTACK_ALLOC (yymsg_alloc);
-            if (!yymsg)
-              {
-                yymsg = yymsgbuf;
-                yymsg_alloc = sizeof yymsgbuf;
-                yysyntax_error_status = 2;
-              }
-            else
-              {
-                yysyntax_error_status = YYSYNTAX_ERROR;
-                yymsgp = yymsg;
-              }
-          }
-        yyerror (yymsgp);
-        if (yysyntax_error_status == 2)
-          goto yyexhaustedlab;
-      }
-# undef YYSYNTAX_ERROR
-#endif
     }
 
-
-
   if (yyerrstatus == 3)
     {
       /* If just tried and failed to reuse lookahead token after an
@@ -6549,6 +6950,7 @@ yyerrorlab:
      label yyerrorlab therefore never appears in user code.  */
   if (0)
     YYERROR;
+  ++yynerrs;
 
   /* Do not reclaim the symbols of the rule whose action triggered
      this YYERROR.  */
@@ -6565,13 +6967,14 @@ yyerrorlab:
 yyerrlab1:
   yyerrstatus = 3;      /* Each real token shifted decrements this.  */
 
+  /* Pop stack until we find a state that shifts the error token.  */
   for (;;)
     {
       yyn = yypact[yystate];
       if (!yypact_value_is_default (yyn))
         {
-          yyn += YYTERROR;
-          if (0 <= yyn && yyn <= YYLAST && yycheck[yyn] == YYTERROR)
+          yyn += YYSYMBOL_YYerror;
+          if (0 <= yyn && yyn <= YYLAST && yycheck[yyn] == YYSYMBOL_YYerror)
             {
               yyn = yytable[yyn];
               if (0 < yyn)
@@ -6585,7 +6988,7 @@ yyerrlab1:
 
 
       yydestruct ("Error: popping",
-                  yystos[yystate], yyvsp);
+                  YY_ACCESSING_SYMBOL (yystate), yyvsp);
       YYPOPSTACK (1);
       yystate = *yyssp;
       YY_STACK_PRINT (yyss, yyssp);
@@ -6597,7 +7000,7 @@ yyerrlab1:
 
 
   /* Shift the error token.  */
-  YY_SYMBOL_PRINT ("Shifting", yystos[yyn], yyvsp, yylsp);
+  YY_SYMBOL_PRINT ("Shifting", YY_ACCESSING_SYMBOL (yyn), yyvsp, yylsp);
 
   yystate = yyn;
   goto yynewstate;
@@ -6608,7 +7011,7 @@ yyerrlab1:
 `-------------------------------------*/
 yyacceptlab:
   yyresult = 0;
-  goto yyreturn;
+  goto yyreturnlab;
 
 
 /*-----------------------------------.
@@ -6616,24 +7019,22 @@ yyacceptlab:
 `-----------------------------------*/
 yyabortlab:
   yyresult = 1;
-  goto yyreturn;
+  goto yyreturnlab;
 
 
-#if !defined yyoverflow || YYERROR_VERBOSE
-/*-------------------------------------------------.
-| yyexhaustedlab -- memory exhaustion comes here.  |
-`-------------------------------------------------*/
+/*-----------------------------------------------------------.
+| yyexhaustedlab -- YYNOMEM (memory exhaustion) comes here.  |
+`-----------------------------------------------------------*/
 yyexhaustedlab:
   yyerror (YY_("memory exhausted"));
   yyresult = 2;
-  /* Fall through.  */
-#endif
+  goto yyreturnlab;
 
 
-/*-----------------------------------------------------.
-| yyreturn -- parsing is finished, return the result.  |
-`-----------------------------------------------------*/
-yyreturn:
+/*----------------------------------------------------------.
+| yyreturnlab -- parsing is finished, clean up and return.  |
+`----------------------------------------------------------*/
+yyreturnlab:
   if (yychar != YYEMPTY)
     {
       /* Make sure we have latest lookahead translation.  See comments at
@@ -6649,16 +7050,14 @@ yyreturn:
   while (yyssp != yyss)
     {
       yydestruct ("Cleanup: popping",
-                  yystos[*yyssp], yyvsp);
+                  YY_ACCESSING_SYMBOL (+*yyssp), yyvsp);
       YYPOPSTACK (1);
     }
 #ifndef yyoverflow
   if (yyss != yyssa)
     YYSTACK_FREE (yyss);
 #endif
-#if YYERROR_VERBOSE
-  if (yymsg != yymsgbuf)
-    YYSTACK_FREE (yymsg);
-#endif
+
   return yyresult;
 }
+
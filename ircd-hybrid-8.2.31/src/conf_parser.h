@@ -1,8 +1,8 @@
-/* A Bison parser, made by GNU Bison 3.3.2.  */
+/* A Bison parser, made by GNU Bison 3.8.2.  */
 
 /* Bison interface for Yacc-like parsers in C
 
-   Copyright (C) 1984, 1989-1990, 2000-2015, 2018-2019 Free Software Foundation,
+   Copyright (C) 1984, 1989-1990, 2000-2015, 2018-2021 Free Software Foundation,
    Inc.
 
    This program is free software: you can redistribute it and/or modify
@@ -16,7 +16,7 @@
    GNU General Public License for more details.
 
    You should have received a copy of the GNU General Public License
-   along with this program.  If not, see <http://www.gnu.org/licenses/>.  */
+   along with this program.  If not, see <https://www.gnu.org/licenses/>.  */
 
 /* As a special exception, you may create a larger work that contains
    part or all of the Bison parser skeleton and distribute that work
@@ -31,8 +31,9 @@
    This special exception was added by the Free Software Foundation in
    version 2.2 of Bison.  */
 
-/* Undocumented macros, especially those whose name start with YY_,
-   are private implementation details.  Do not rely on them.  */
+/* DO NOT RELY ON FEATURES THAT ARE NOT DOCUMENTED in the manual,
+   especially those whose name start with YY_ or yy_.  They are
+   private implementation details that can be changed or removed.  */
 
 #ifndef YY_YY_CONF_PARSER_H_INCLUDED
 # define YY_YY_CONF_PARSER_H_INCLUDED
@@ -44,242 +45,253 @@
 extern int yydebug;
 #endif
 
-/* Token type.  */
+/* Token kinds.  */
 #ifndef YYTOKENTYPE
 # define YYTOKENTYPE
   enum yytokentype
   {
-    ACCEPT_PASSWORD = 258,
-    ADMIN = 259,
-    AFTYPE = 260,
-    ANTI_NICK_FLOOD = 261,
-    ANTI_SPAM_EXIT_MESSAGE_TIME = 262,
-    AUTOCONN = 263,
-    AWAY_COUNT = 264,
-    AWAY_TIME = 265,
-    BYTES = 266,
-    KBYTES = 267,
-    MBYTES = 268,
-    CALLER_ID_WAIT = 269,
-    CAN_FLOOD = 270,
-    CHANNEL = 271,
-    CIDR_BITLEN_IPV4 = 272,
-    CIDR_BITLEN_IPV6 = 273,
-    CLASS = 274,
-    CLOSE = 275,
-    CONNECT = 276,
-    CONNECTFREQ = 277,
-    CYCLE_ON_HOST_CHANGE = 278,
-    DEFAULT_FLOODCOUNT = 279,
-    DEFAULT_FLOODTIME = 280,
-    DEFAULT_JOIN_FLOOD_COUNT = 281,
-    DEFAULT_JOIN_FLOOD_TIME = 282,
-    DEFAULT_MAX_CLIENTS = 283,
-    DENY = 284,
-    DESCRIPTION = 285,
-    DIE = 286,
-    DISABLE_AUTH = 287,
-    DISABLE_FAKE_CHANNELS = 288,
-    DISABLE_REMOTE_COMMANDS = 289,
-    DLINE_MIN_CIDR = 290,
-    DLINE_MIN_CIDR6 = 291,
-    DOTS_IN_IDENT = 292,
-    EMAIL = 293,
-    ENABLE_EXTBANS = 294,
-    ENCRYPTED = 295,
-    EXCEED_LIMIT = 296,
-    EXEMPT = 297,
-    EXPIRATION = 298,
-    FAILED_OPER_NOTICE = 299,
-    FLATTEN_LINKS = 300,
-    FLATTEN_LINKS_DELAY = 301,
-    FLATTEN_LINKS_FILE = 302,
-    GECOS = 303,
-    GENERAL = 304,
-    HIDDEN = 305,
-    HIDDEN_NAME = 306,
-    HIDE_CHANS = 307,
-    HIDE_IDLE = 308,
-    HIDE_IDLE_FROM_OPERS = 309,
-    HIDE_SERVER_IPS = 310,
-    HIDE_SERVERS = 311,
-    HIDE_SERVICES = 312,
-    HOST = 313,
-    HUB = 314,
-    HUB_MASK = 315,
-    INVISIBLE_ON_CONNECT = 316,
-    INVITE_CLIENT_COUNT = 317,
-    INVITE_CLIENT_TIME = 318,
-    INVITE_DELAY_CHANNEL = 319,
-    INVITE_EXPIRE_TIME = 320,
-    IP = 321,
-    IRCD_AUTH = 322,
-    IRCD_FLAGS = 323,
-    IRCD_SID = 324,
-    JOIN = 325,
-    KILL = 326,
-    KILL_CHASE_TIME_LIMIT = 327,
-    KLINE = 328,
-    KLINE_EXEMPT = 329,
-    KLINE_MIN_CIDR = 330,
-    KLINE_MIN_CIDR6 = 331,
-    KNOCK_CLIENT_COUNT = 332,
-    KNOCK_CLIENT_TIME = 333,
-    KNOCK_DELAY_CHANNEL = 334,
-    LEAF_MASK = 335,
-    LISTEN = 336,
-    MASK = 337,
-    MAX_ACCEPT = 338,
-    MAX_BANS = 339,
-    MAX_BANS_LARGE = 340,
-    MAX_CHANNELS = 341,
-    MAX_IDLE = 342,
-    MAX_INVITES = 343,
-    MAX_NICK_CHANGES = 344,
-    MAX_NICK_LENGTH = 345,
-    MAX_NICK_TIME = 346,
-    MAX_NUMBER = 347,
-    MAX_TARGETS = 348,
-    MAX_TOPIC_LENGTH = 349,
-    MAX_WATCH = 350,
-    MIN_IDLE = 351,
-    MIN_NONWILDCARD = 352,
-    MIN_NONWILDCARD_SIMPLE = 353,
-    MODULE = 354,
-    MODULES = 355,
-    MOTD = 356,
-    NAME = 357,
-    NEED_IDENT = 358,
-    NEED_PASSWORD = 359,
-    NETWORK_DESC = 360,
-    NETWORK_NAME = 361,
-    NICK = 362,
-    NO_OPER_FLOOD = 363,
-    NO_TILDE = 364,
-    NUMBER = 365,
-    NUMBER_PER_CIDR = 366,
-    NUMBER_PER_IP_GLOBAL = 367,
-    NUMBER_PER_IP_LOCAL = 368,
-    OPER_ONLY_UMODES = 369,
-    OPER_UMODES = 370,
-    OPERATOR = 371,
-    OPERS_BYPASS_CALLERID = 372,
-    PACE_WAIT = 373,
-    PACE_WAIT_SIMPLE = 374,
-    PASSWORD = 375,
-    PATH = 376,
-    PING_COOKIE = 377,
-    PING_TIME = 378,
-    PORT = 379,
-    QSTRING = 380,
-    RANDOM_IDLE = 381,
-    REASON = 382,
-    REDIRPORT = 383,
-    REDIRSERV = 384,
-    REHASH = 385,
-    REMOTE = 386,
-    REMOTEBAN = 387,
-    RESV = 388,
-    RESV_EXEMPT = 389,
-    RSA_PRIVATE_KEY_FILE = 390,
-    SECONDS = 391,
-    MINUTES = 392,
-    HOURS = 393,
-    DAYS = 394,
-    WEEKS = 395,
-    MONTHS = 396,
-    YEARS = 397,
-    SEND_PASSWORD = 398,
-    SENDQ = 399,
-    SERVERHIDE = 400,
-    SERVERINFO = 401,
-    SHORT_MOTD = 402,
-    SPOOF = 403,
-    SQUIT = 404,
-    STATS_E_DISABLED = 405,
-    STATS_I_OPER_ONLY = 406,
-    STATS_K_OPER_ONLY = 407,
-    STATS_M_OPER_ONLY = 408,
-    STATS_O_OPER_ONLY = 409,
-    STATS_P_OPER_ONLY = 410,
-    STATS_U_OPER_ONLY = 411,
-    T_ALL = 412,
-    T_BIND = 413,
-    T_BOTS = 414,
-    T_CALLERID = 415,
-    T_CCONN = 416,
-    T_COMMAND = 417,
-    T_CLUSTER = 418,
-    T_DEAF = 419,
-    T_DEBUG = 420,
-    T_DLINE = 421,
-    T_EXTERNAL = 422,
-    T_FARCONNECT = 423,
-    T_FILE = 424,
-    T_FULL = 425,
-    T_GLOBOPS = 426,
-    T_INVISIBLE = 427,
-    T_IPV4 = 428,
-    T_IPV6 = 429,
-    T_LOCOPS = 430,
-    T_LOG = 431,
-    T_NCHANGE = 432,
-    T_NONONREG = 433,
-    T_OPME = 434,
-    T_PREPEND = 435,
-    T_PSEUDO = 436,
-    T_RECVQ = 437,
-    T_REJ = 438,
-    T_RESTART = 439,
-    T_SERVER = 440,
-    T_SERVICE = 441,
-    T_SERVNOTICE = 442,
-    T_SET = 443,
-    T_SHARED = 444,
-    T_SIZE = 445,
-    T_SKILL = 446,
-    T_SOFTCALLERID = 447,
-    T_SPY = 448,
-    T_TARGET = 449,
-    T_TLS = 450,
-    T_UMODES = 451,
-    T_UNAUTH = 452,
-    T_UNDLINE = 453,
-    T_UNLIMITED = 454,
-    T_UNRESV = 455,
-    T_UNXLINE = 456,
-    T_WALLOP = 457,
-    T_WALLOPS = 458,
-    T_WEBIRC = 459,
-    TBOOL = 460,
-    THROTTLE_COUNT = 461,
-    THROTTLE_TIME = 462,
-    TIMEOUT = 463,
-    TLS_CERTIFICATE_FILE = 464,
-    TLS_CERTIFICATE_FINGERPRINT = 465,
-    TLS_CIPHER_LIST = 466,
-    TLS_CIPHER_SUITES = 467,
-    TLS_CONNECTION_REQUIRED = 468,
-    TLS_DH_PARAM_FILE = 469,
-    TLS_MESSAGE_DIGEST_ALGORITHM = 470,
-    TLS_SUPPORTED_GROUPS = 471,
-    TS_MAX_DELTA = 472,
-    TS_WARN_DELTA = 473,
-    TWODOTS = 474,
-    TYPE = 475,
-    UNKLINE = 476,
-    USE_LOGGING = 477,
-    USER = 478,
-    VHOST = 479,
-    VHOST6 = 480,
-    WARN_NO_CONNECT_BLOCK = 481,
-    WHOIS = 482,
-    WHOWAS_HISTORY_LENGTH = 483,
-    XLINE = 484,
-    XLINE_EXEMPT = 485
+    YYEMPTY = -2,
+    YYEOF = 0,                     /* "end of file"  */
+    YYerror = 256,                 /* error  */
+    YYUNDEF = 257,                 /* "invalid token"  */
+    ACCEPT_PASSWORD = 258,         /* ACCEPT_PASSWORD  */
+    ADMIN = 259,                   /* ADMIN  */
+    AFTYPE = 260,                  /* AFTYPE  */
+    ANTI_NICK_FLOOD = 261,         /* ANTI_NICK_FLOOD  */
+    ANTI_SPAM_EXIT_MESSAGE_TIME = 262, /* ANTI_SPAM_EXIT_MESSAGE_TIME  */
+    AUTOCONN = 263,                /* AUTOCONN  */
+    AWAY_COUNT = 264,              /* AWAY_COUNT  */
+    AWAY_TIME = 265,               /* AWAY_TIME  */
+    BYTES = 266,                   /* BYTES  */
+    KBYTES = 267,                  /* KBYTES  */
+    MBYTES = 268,                  /* MBYTES  */
+    CALLER_ID_WAIT = 269,          /* CALLER_ID_WAIT  */
+    CAN_FLOOD = 270,               /* CAN_FLOOD  */
+    CHANNEL = 271,                 /* CHANNEL  */
+    CIDR_BITLEN_IPV4 = 272,        /* CIDR_BITLEN_IPV4  */
+    CIDR_BITLEN_IPV6 = 273,        /* CIDR_BITLEN_IPV6  */
+    CLASS = 274,                   /* CLASS  */
+    CLOSE = 275,                   /* CLOSE  */
+    CONNECT = 276,                 /* CONNECT  */
+    CONNECTFREQ = 277,             /* CONNECTFREQ  */
+    CYCLE_ON_HOST_CHANGE = 278,    /* CYCLE_ON_HOST_CHANGE  */
+    DEFAULT_FLOODCOUNT = 279,      /* DEFAULT_FLOODCOUNT  */
+    DEFAULT_FLOODTIME = 280,       /* DEFAULT_FLOODTIME  */
+    DEFAULT_JOIN_FLOOD_COUNT = 281, /* DEFAULT_JOIN_FLOOD_COUNT  */
+    DEFAULT_JOIN_FLOOD_TIME = 282, /* DEFAULT_JOIN_FLOOD_TIME  */
+    DEFAULT_MAX_CLIENTS = 283,     /* DEFAULT_MAX_CLIENTS  */
+    DENY = 284,                    /* DENY  */
+    DESCRIPTION = 285,             /* DESCRIPTION  */
+    DIE = 286,                     /* DIE  */
+    DISABLE_AUTH = 287,            /* DISABLE_AUTH  */
+    DISABLE_FAKE_CHANNELS = 288,   /* DISABLE_FAKE_CHANNELS  */
+    DISABLE_REMOTE_COMMANDS = 289, /* DISABLE_REMOTE_COMMANDS  */
+    DLINE_MIN_CIDR = 290,          /* DLINE_MIN_CIDR  */
+    DLINE_MIN_CIDR6 = 291,         /* DLINE_MIN_CIDR6  */
+    DOTS_IN_IDENT = 292,           /* DOTS_IN_IDENT  */
+    EMAIL = 293,                   /* EMAIL  */
+    ENABLE_EXTBANS = 294,          /* ENABLE_EXTBANS  */
+    ENCRYPTED = 295,               /* ENCRYPTED  */
+    EXCEED_LIMIT = 296,            /* EXCEED_LIMIT  */
+    EXEMPT = 297,                  /* EXEMPT  */
+    EXPIRATION = 298,              /* EXPIRATION  */
+    FAILED_OPER_NOTICE = 299,      /* FAILED_OPER_NOTICE  */
+    FLATTEN_LINKS = 300,           /* FLATTEN_LINKS  */
+    FLATTEN_LINKS_DELAY = 301,     /* FLATTEN_LINKS_DELAY  */
+    FLATTEN_LINKS_FILE = 302,      /* FLATTEN_LINKS_FILE  */
+    GECOS = 303,                   /* GECOS  */
+    GENERAL = 304,                 /* GENERAL  */
+    HIDDEN = 305,                  /* HIDDEN  */
+    HIDDEN_NAME = 306,             /* HIDDEN_NAME  */
+    HIDE_CHANS = 307,              /* HIDE_CHANS  */
+    HIDE_IDLE = 308,               /* HIDE_IDLE  */
+    HIDE_IDLE_FROM_OPERS = 309,    /* HIDE_IDLE_FROM_OPERS  */
+    HIDE_SERVER_IPS = 310,         /* HIDE_SERVER_IPS  */
+    HIDE_SERVERS = 311,            /* HIDE_SERVERS  */
+    HIDE_SERVICES = 312,           /* HIDE_SERVICES  */
+    HOST = 313,                    /* HOST  */
+    HUB = 314,                     /* HUB  */
+    HUB_MASK = 315,                /* HUB_MASK  */
+    INVISIBLE_ON_CONNECT = 316,    /* INVISIBLE_ON_CONNECT  */
+    INVITE_CLIENT_COUNT = 317,     /* INVITE_CLIENT_COUNT  */
+    INVITE_CLIENT_TIME = 318,      /* INVITE_CLIENT_TIME  */
+    INVITE_DELAY_CHANNEL = 319,    /* INVITE_DELAY_CHANNEL  */
+    INVITE_EXPIRE_TIME = 320,      /* INVITE_EXPIRE_TIME  */
+    IP = 321,                      /* IP  */
+    IRCD_AUTH = 322,               /* IRCD_AUTH  */
+    IRCD_FLAGS = 323,              /* IRCD_FLAGS  */
+    IRCD_SID = 324,                /* IRCD_SID  */
+    JOIN = 325,                    /* JOIN  */
+    KILL = 326,                    /* KILL  */
+    KILL_CHASE_TIME_LIMIT = 327,   /* KILL_CHASE_TIME_LIMIT  */
+    KLINE = 328,                   /* KLINE  */
+    KLINE_EXEMPT = 329,            /* KLINE_EXEMPT  */
+    KLINE_MIN_CIDR = 330,          /* KLINE_MIN_CIDR  */
+    KLINE_MIN_CIDR6 = 331,         /* KLINE_MIN_CIDR6  */
+    KNOCK_CLIENT_COUNT = 332,      /* KNOCK_CLIENT_COUNT  */
+    KNOCK_CLIENT_TIME = 333,       /* KNOCK_CLIENT_TIME  */
+    KNOCK_DELAY_CHANNEL = 334,     /* KNOCK_DELAY_CHANNEL  */
+    LEAF_MASK = 335,               /* LEAF_MASK  */
+    LISTEN = 336,                  /* LISTEN  */
+    MASK = 337,                    /* MASK  */
+    MAX_ACCEPT = 338,              /* MAX_ACCEPT  */
+    MAX_BANS = 339,                /* MAX_BANS  */
+    MAX_BANS_LARGE = 340,          /* MAX_BANS_LARGE  */
+    MAX_CHANNELS = 341,            /* MAX_CHANNELS  */
+    MAX_IDLE = 342,                /* MAX_IDLE  */
+    MAX_INVITES = 343,             /* MAX_INVITES  */
+    MAX_NICK_CHANGES = 344,        /* MAX_NICK_CHANGES  */
+    MAX_NICK_LENGTH = 345,         /* MAX_NICK_LENGTH  */
+    MAX_NICK_TIME = 346,           /* MAX_NICK_TIME  */
+    MAX_NUMBER = 347,              /* MAX_NUMBER  */
+    MAX_TARGETS = 348,             /* MAX_TARGETS  */
+    MAX_TOPIC_LENGTH = 349,        /* MAX_TOPIC_LENGTH  */
+    MAX_WATCH = 350,               /* MAX_WATCH  */
+    MIN_IDLE = 351,                /* MIN_IDLE  */
+    MIN_NONWILDCARD = 352,         /* MIN_NONWILDCARD  */
+    MIN_NONWILDCARD_SIMPLE = 353,  /* MIN_NONWILDCARD_SIMPLE  */
+    MODULE = 354,                  /* MODULE  */
+    MODULES = 355,                 /* MODULES  */
+    MOTD = 356,                    /* MOTD  */
+    NAME = 357,                    /* NAME  */
+    NEED_IDENT = 358,              /* NEED_IDENT  */
+    NEED_PASSWORD = 359,           /* NEED_PASSWORD  */
+    NETWORK_DESC = 360,            /* NETWORK_DESC  */
+    NETWORK_NAME = 361,            /* NETWORK_NAME  */
+    NICK = 362,                    /* NICK  */
+    NO_OPER_FLOOD = 363,           /* NO_OPER_FLOOD  */
+    NO_TILDE = 364,                /* NO_TILDE  */
+    NUMBER = 365,                  /* NUMBER  */
+    NUMBER_PER_CIDR = 366,         /* NUMBER_PER_CIDR  */
+    NUMBER_PER_IP_GLOBAL = 367,    /* NUMBER_PER_IP_GLOBAL  */
+    NUMBER_PER_IP_LOCAL = 368,     /* NUMBER_PER_IP_LOCAL  */
+    OPER_ONLY_UMODES = 369,        /* OPER_ONLY_UMODES  */
+    OPER_UMODES = 370,             /* OPER_UMODES  */
+    OPERATOR = 371,                /* OPERATOR  */
+    OPERS_BYPASS_CALLERID = 372,   /* OPERS_BYPASS_CALLERID  */
+    PACE_WAIT = 373,               /* PACE_WAIT  */
+    PACE_WAIT_SIMPLE = 374,        /* PACE_WAIT_SIMPLE  */
+    PASSWORD = 375,                /* PASSWORD  */
+    PATH = 376,                    /* PATH  */
+    PERF_EXPORT_DELAY = 377,       /* PERF_EXPORT_DELAY  */
+    PERF_EXPORT_FILE = 378,        /* PERF_EXPORT_FILE  */
+    PING_COOKIE = 379,             /* PING_COOKIE  */
+    PING_TIME = 380,               /* PING_TIME  */
+    PORT = 381,                    /* PORT  */
+    QSTRING = 382,                 /* QSTRING  */
+    RANDOM_IDLE = 383,             /* RANDOM_IDLE  */
+    REASON = 384,                  /* REASON  */
+    REDIRPORT = 385,               /* REDIRPORT  */
+    REDIRSERV = 386,               /* REDIRSERV  */
+    REHASH = 387,                  /* REHASH  */
+    REMOTE = 388,                  /* REMOTE  */
+    REMOTEBAN = 389,               /* REMOTEBAN  */
+    RESV = 390,                    /* RESV  */
+    RESV_EXEMPT = 391,             /* RESV_EXEMPT  */
+    RSA_PRIVATE_KEY_FILE = 392,    /* RSA_PRIVATE_KEY_FILE  */
+    SECONDS = 393,                 /* SECONDS  */
+    MINUTES = 394,                 /* MINUTES  */
+    HOURS = 395,                   /* HOURS  */
+    DAYS = 396,                    /* DAYS  */
+    WEEKS = 397,                   /* WEEKS  */
+    MONTHS = 398,                  /* MONTHS  */
+    YEARS = 399,                   /* YEARS  */
+    SEND_PASSWORD = 400,           /* SEND_PASSWORD  */
+    SENDQ = 401,                   /* SENDQ  */
+    SERVERHIDE = 402,              /* SERVERHIDE  */
+    SERVERINFO = 403,              /* SERVERINFO  */
+    SHORT_MOTD = 404,              /* SHORT_MOTD  */
+    SPOOF = 405,                   /* SPOOF  */
+    SQUIT = 406,                   /* SQUIT  */
+    STATS_E_DISABLED = 407,        /* STATS_E_DISABLED  */
+    STATS_I_OPER_ONLY = 408,       /* STATS_I_OPER_ONLY  */
+    STATS_K_OPER_ONLY = 409,       /* STATS_K_OPER_ONLY  */
+    STATS_M_OPER_ONLY = 410,       /* STATS_M_OPER_ONLY  */
+    STATS_O_OPER_ONLY = 411,       /* STATS_O_OPER_ONLY  */
+    STATS_P_OPER_ONLY = 412,       /* STATS_P_OPER_ONLY  */
+    STATS_U_OPER_ONLY = 413,       /* STATS_U_OPER_ONLY  */
+    T_ALL = 414,                   /* T_ALL  */
+    T_BIND = 415,                  /* T_BIND  */
+    T_BOTS = 416,                  /* T_BOTS  */
+    T_CALLERID = 417,              /* T_CALLERID  */
+    T_CCONN = 418,                 /* T_CCONN  */
+    T_COMMAND = 419,               /* T_COMMAND  */
+    T_CLUSTER = 420,               /* T_CLUSTER  */
+    T_DEAF = 421,                  /* T_DEAF  */
+    T_DEBUG = 422,                 /* T_DEBUG  */
+    T_DLINE = 423,                 /* T_DLINE  */
+    T_EXTERNAL = 424,              /* T_EXTERNAL  */
+    T_FARCONNECT = 425,            /* T_FARCONNECT  */
+    T_FILE = 426,                  /* T_FILE  */
+    T_FULL = 427,                  /* T_FULL  */
+    T_GLOBOPS = 428,               /* T_GLOBOPS  */
+    T_INVISIBLE = 429,             /* T_INVISIBLE  */
+    T_IPV4 = 430,                  /* T_IPV4  */
+    T_IPV6 = 431,                  /* T_IPV6  */
+    T_LOCOPS = 432,                /* T_LOCOPS  */
+    T_LOG = 433,                   /* T_LOG  */
+    T_NCHANGE = 434,               /* T_NCHANGE  */
+    T_NONONREG = 435,              /* T_NONONREG  */
+    T_OPME = 436,                  /* T_OPME  */
+    T_PREPEND = 437,               /* T_PREPEND  */
+    T_PSEUDO = 438,                /* T_PSEUDO  */
+    T_RECVQ = 439,                 /* T_RECVQ  */
+    T_REJ = 440,                   /* T_REJ  */
+    T_RESTART = 441,               /* T_RESTART  */
+    T_SERVER = 442,                /* T_SERVER  */
+    T_SERVICE = 443,               /* T_SERVICE  */
+    T_SERVNOTICE = 444,            /* T_SERVNOTICE  */
+    T_SET = 445,                   /* T_SET  */
+    T_SHARED = 446,                /* T_SHARED  */
+    T_SIZE = 447,                  /* T_SIZE  */
+    T_SKILL = 448,                 /* T_SKILL  */
+    T_SOFTCALLERID = 449,          /* T_SOFTCALLERID  */
+    T_SPY = 450,                   /* T_SPY  */
+    T_TARGET = 451,                /* T_TARGET  */
+    T_TLS = 452,                   /* T_TLS  */
+    T_UMODES = 453,                /* T_UMODES  */
+    T_UNAUTH = 454,                /* T_UNAUTH  */
+    T_UNDLINE = 455,               /* T_UNDLINE  */
+    T_UNLIMITED = 456,             /* T_UNLIMITED  */
+    T_UNRESV = 457,                /* T_UNRESV  */
+    T_UNXLINE = 458,               /* T_UNXLINE  */
+    T_WALLOP = 459,                /* T_WALLOP  */
+    T_WALLOPS = 460,               /* T_WALLOPS  */
+    T_WEBIRC = 461,                /* T_WEBIRC  */
+    TBOOL = 462,                   /* TBOOL  */
+    THROTTLE_COUNT = 463,          /* THROTTLE_COUNT  */
+    THROTTLE_TIME = 464,           /* THROTTLE_TIME  */
+    TIMEOUT = 465,                 /* TIMEOUT  */
+    TLS_CERTIFICATE_FILE = 466,    /* TLS_CERTIFICATE_FILE  */
+    TLS_CERTIFICATE_FINGERPRINT = 467, /* TLS_CERTIFICATE_FINGERPRINT  */
+    TLS_CIPHER_LIST = 468,         /* TLS_CIPHER_LIST  */
+    TLS_CIPHER_SUITES = 469,       /* TLS_CIPHER_SUITES  */
+    TLS_CONNECTION_REQUIRED = 470, /* TLS_CONNECTION_REQUIRED  */
+    TLS_DH_PARAM_FILE = 471,       /* TLS_DH_PARAM_FILE  */
+    TLS_MESSAGE_DIGEST_ALGORITHM = 472, /* TLS_MESSAGE_DIGEST_ALGORITHM  */
+    TLS_SUPPORTED_GROUPS = 473,    /* TLS_SUPPORTED_GROUPS  */
+    TS_MAX_DELTA = 474,            /* TS_MAX_DELTA  */
+    TS_WARN_DELTA = 475,           /* TS_WARN_DELTA  */
+    TWODOTS = 476,                 /* TWODOTS  */
+    TYPE = 477,                    /* TYPE  */
+    UNKLINE = 478,                 /* UNKLINE  */
+    USE_LOGGING = 479,             /* USE_LOGGING  */
+    USER = 480,                    /* USER  */
+    VHOST = 481,                   /* VHOST  */
+    VHOST6 = 482,                  /* VHOST6  */
+    WARN_NO_CONNECT_BLOCK = 483,   /* WARN_NO_CONNECT_BLOCK  */
+    WHOIS = 484,                   /* WHOIS  */
+    WHOWAS_HISTORY_LENGTH = 485,   /* WHOWAS_HISTORY_LENGTH  */
+    XLINE = 486,                   /* XLINE  */
+    XLINE_EXEMPT = 487             /* XLINE_EXEMPT  */
   };
+  typedef enum yytokentype yytoken_kind_t;
 #endif
-/* Tokens.  */
+/* Token kinds.  */
+#define YYEMPTY -2
+#define YYEOF 0
+#define YYerror 256
+#define YYUNDEF 257
 #define ACCEPT_PASSWORD 258
 #define ADMIN 259
 #define AFTYPE 260
@@ -399,129 +411,130 @@ extern int yydebug;
 #define PACE_WAIT_SIMPLE 374
 #define PASSWORD 375
 #define PATH 376
-#define PING_COOKIE 377
-#define PING_TIME 378
-#define PORT 379
-#define QSTRING 380
-#define RANDOM_IDLE 381
-#define REASON 382
-#define REDIRPORT 383
-#define REDIRSERV 384
-#define REHASH 385
-#define REMOTE 386
-#define REMOTEBAN 387
-#define RESV 388
-#define RESV_EXEMPT 389
-#define RSA_PRIVATE_KEY_FILE 390
-#define SECONDS 391
-#define MINUTES 392
-#define HOURS 393
-#define DAYS 394
-#define WEEKS 395
-#define MONTHS 396
-#define YEARS 397
-#define SEND_PASSWORD 398
-#define SENDQ 399
-#define SERVERHIDE 400
-#define SERVERINFO 401
-#define SHORT_MOTD 402
-#define SPOOF 403
-#define SQUIT 404
-#define STATS_E_DISABLED 405
-#define STATS_I_OPER_ONLY 406
-#define STATS_K_OPER_ONLY 407
-#define STATS_M_OPER_ONLY 408
-#define STATS_O_OPER_ONLY 409
-#define STATS_P_OPER_ONLY 410
-#define STATS_U_OPER_ONLY 411
-#define T_ALL 412
-#define T_BIND 413
-#define T_BOTS 414
-#define T_CALLERID 415
-#define T_CCONN 416
-#define T_COMMAND 417
-#define T_CLUSTER 418
-#define T_DEAF 419
-#define T_DEBUG 420
-#define T_DLINE 421
-#define T_EXTERNAL 422
-#define T_FARCONNECT 423
-#define T_FILE 424
-#define T_FULL 425
-#define T_GLOBOPS 426
-#define T_INVISIBLE 427
-#define T_IPV4 428
-#define T_IPV6 429
-#define T_LOCOPS 430
-#define T_LOG 431
-#define T_NCHANGE 432
-#define T_NONONREG 433
-#define T_OPME 434
-#define T_PREPEND 435
-#define T_PSEUDO 436
-#define T_RECVQ 437
-#define T_REJ 438
-#define T_RESTART 439
-#define T_SERVER 440
-#define T_SERVICE 441
-#define T_SERVNOTICE 442
-#define T_SET 443
-#define T_SHARED 444
-#define T_SIZE 445
-#define T_SKILL 446
-#define T_SOFTCALLERID 447
-#define T_SPY 448
-#define T_TARGET 449
-#define T_TLS 450
-#define T_UMODES 451
-#define T_UNAUTH 452
-#define T_UNDLINE 453
-#define T_UNLIMITED 454
-#define T_UNRESV 455
-#define T_UNXLINE 456
-#define T_WALLOP 457
-#define T_WALLOPS 458
-#define T_WEBIRC 459
-#define TBOOL 460
-#define THROTTLE_COUNT 461
-#define THROTTLE_TIME 462
-#define TIMEOUT 463
-#define TLS_CERTIFICATE_FILE 464
-#define TLS_CERTIFICATE_FINGERPRINT 465
-#define TLS_CIPHER_LIST 466
-#define TLS_CIPHER_SUITES 467
-#define TLS_CONNECTION_REQUIRED 468
-#define TLS_DH_PARAM_FILE 469
-#define TLS_MESSAGE_DIGEST_ALGORITHM 470
-#define TLS_SUPPORTED_GROUPS 471
-#define TS_MAX_DELTA 472
-#define TS_WARN_DELTA 473
-#define TWODOTS 474
-#define TYPE 475
-#define UNKLINE 476
-#define USE_LOGGING 477
-#define USER 478
-#define VHOST 479
-#define VHOST6 480
-#define WARN_NO_CONNECT_BLOCK 481
-#define WHOIS 482
-#define WHOWAS_HISTORY_LENGTH 483
-#define XLINE 484
-#define XLINE_EXEMPT 485
+#define PERF_EXPORT_DELAY 377
+#define PERF_EXPORT_FILE 378
+#define PING_COOKIE 379
+#define PING_TIME 380
+#define PORT 381
+#define QSTRING 382
+#define RANDOM_IDLE 383
+#define REASON 384
+#define REDIRPORT 385
+#define REDIRSERV 386
+#define REHASH 387
+#define REMOTE 388
+#define REMOTEBAN 389
+#define RESV 390
+#define RESV_EXEMPT 391
+#define RSA_PRIVATE_KEY_FILE 392
+#define SECONDS 393
+#define MINUTES 394
+#define HOURS 395
+#define DAYS 396
+#define WEEKS 397
+#define MONTHS 398
+#define YEARS 399
+#define SEND_PASSWORD 400
+#define SENDQ 401
+#define SERVERHIDE 402
+#define SERVERINFO 403
+#define SHORT_MOTD 404
+#define SPOOF 405
+#define SQUIT 406
+#define STATS_E_DISABLED 407
+#define STATS_I_OPER_ONLY 408
+#define STATS_K_OPER_ONLY 409
+#define STATS_M_OPER_ONLY 410
+#define STATS_O_OPER_ONLY 411
+#define STATS_P_OPER_ONLY 412
+#define STATS_U_OPER_ONLY 413
+#define T_ALL 414
+#define T_BIND 415
+#define T_BOTS 416
+#define T_CALLERID 417
+#define T_CCONN 418
+#define T_COMMAND 419
+#define T_CLUSTER 420
+#define T_DEAF 421
+#define T_DEBUG 422
+#define T_DLINE 423
+#define T_EXTERNAL 424
+#define T_FARCONNECT 425
+#define T_FILE 426
+#define T_FULL 427
+#define T_GLOBOPS 428
+#define T_INVISIBLE 429
+#define T_IPV4 430
+#define T_IPV6 431
+#define T_LOCOPS 432
+#define T_LOG 433
+#define T_NCHANGE 434
+#define T_NONONREG 435
+#define T_OPME 436
+#define T_PREPEND 437
+#define T_PSEUDO 438
+#define T_RECVQ 439
+#define T_REJ 440
+#define T_RESTART 441
+#define T_SERVER 442
+#define T_SERVICE 443
+#define T_SERVNOTICE 444
+#define T_SET 445
+#define T_SHARED 446
+#define T_SIZE 447
+#define T_SKILL 448
+#define T_SOFTCALLERID 449
+#define T_SPY 450
+#define T_TARGET 451
+#define T_TLS 452
+#define T_UMODES 453
+#define T_UNAUTH 454
+#define T_UNDLINE 455
+#define T_UNLIMITED 456
+#define T_UNRESV 457
+#define T_UNXLINE 458
+#define T_WALLOP 459
+#define T_WALLOPS 460
+#define T_WEBIRC 461
+#define TBOOL 462
+#define THROTTLE_COUNT 463
+#define THROTTLE_TIME 464
+#define TIMEOUT 465
+#define TLS_CERTIFICATE_FILE 466
+#define TLS_CERTIFICATE_FINGERPRINT 467
+#define TLS_CIPHER_LIST 468
+#define TLS_CIPHER_SUITES 469
+#define TLS_CONNECTION_REQUIRED 470
+#define TLS_DH_PARAM_FILE 471
+#define TLS_MESSAGE_DIGEST_ALGORITHM 472
+#define TLS_SUPPORTED_GROUPS 473
+#define TS_MAX_DELTA 474
+#define TS_WARN_DELTA 475
+#define TWODOTS 476
+#define TYPE 477
+#define UNKLINE 478
+#define USE_LOGGING 479
+#define USER 480
+#define VHOST 481
+#define VHOST6 482
+#define WARN_NO_CONNECT_BLOCK 483
+#define WHOIS 484
+#define WHOWAS_HISTORY_LENGTH 485
+#define XLINE 486
+#define XLINE_EXEMPT 487
 
 /* Value type.  */
 #if ! defined YYSTYPE && ! defined YYSTYPE_IS_DECLARED
-
 union YYSTYPE
 {
-#line 133 "conf_parser.y" /* yacc.c:1921  */
+#line 133 "conf_parser.y"
 
   int number;
   char *string;
 
-#line 523 "conf_parser.h" /* yacc.c:1921  */
-};
+#line 536 "conf_parser.h"
 
+};
 typedef union YYSTYPE YYSTYPE;
 # define YYSTYPE_IS_TRIVIAL 1
 # define YYSTYPE_IS_DECLARED 1
@@ -530,6 +543,8 @@ typedef union YYSTYPE YYSTYPE;
 
 extern YYSTYPE yylval;
 
+
 int yyparse (void);
 
+
 #endif /* !YY_YY_CONF_PARSER_H_INCLUDED  */
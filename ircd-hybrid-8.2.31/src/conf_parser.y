@@ -252,6 +252,8 @@ reset_block_state(void)
 %token  PACE_WAIT_SIMPLE
 %token  PASSWORD
 %token  PATH
+%token  PERF_EXPORT_DELAY
+%token  PERF_EXPORT_FILE
 %token  PING_COOKIE
 %token  PING_TIME
 %token  PORT
@@ -559,7 +561,7 @@ serverinfo_description: DESCRIPTION '=' QSTRING ';'
   {
     xfree(ConfigServerInfo.description);
     ConfigServerInfo.description = xstrdup(yylval.string);
-    strlcpy(me.info, ConfigServerInfo.description, sizeof(me.info));
+    strlcpy(me.cold->info, ConfigServerInfo.description, sizeof(me.cold->info));
   }
 };
 
@@ -2366,6 +2368,8 @@ general_item:       general_away_count |
                     general_opers_bypass_callerid |
                     general_default_floodcount |
                     general_default_floodtime |
+                    general_perf_export_delay |
+                    general_perf_export_file |
                     general_min_nonwildcard |
                     general_min_nonwildcard_simple |
                     general_throttle_count |
@@ -2745,6 +2749,20 @@ general_default_floodtime: DEFAULT_FLOODTIME '=' timespec ';'
   ConfigGeneral.default_floodtime = $3;
 };
 
+general_perf_export_delay: PERF_EXPORT_DELAY '=' timespec ';'
+{
+  ConfigGeneral.perf_export_delay = $3;
+};
+
+general_perf_export_file: PERF_EXPORT_FILE '=' QSTRING ';'
+{
+  if (conf_parser_ctx.pass == 2)
+  {
+    xfree(ConfigGeneral.perf_export_file);
+    ConfigGeneral.perf_export_file = xstrdup(yylval.string);
+  }
+};
+
 
 /***************************************************************************
  * channel {} section
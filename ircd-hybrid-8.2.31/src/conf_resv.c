@@ -72,6 +72,7 @@ resv_delete(struct ResvItem *resv, bool expired)
     xfree(exempt);
   }
 
+  conf_expire_delete(&resv->expire_item);
   dlinkDelete(&resv->node, resv->list);
   xfree(resv->mask);
   xfree(resv->reason);
@@ -137,10 +138,35 @@ resv_make(const char *mask, const char *reason, const dlink_list *elist)
   return resv;
 }
 
+static void
+resv_expire(void *data)
+{
+  resv_delete(data, true);
+}
+
+/* resv_set_expire()
+ *
+ * inputs       - pointer to struct ResvItem
+ *              - expiration time; calendar time, 0 for a permanent RESV
+ * output       - NONE
+ * side effects - the RESV is queued for expiration, or taken out of
+ *                the queue if it is made permanent
+ */
+void
+resv_set_expire(struct ResvItem *resv, uintmax_t expire)
+{
+  resv->expire = expire;
+
+  if (expire)
+    conf_expire_add(&resv->expire_item, expire, resv_expire, resv);
+  else
+    conf_expire_delete(&resv->expire_item);
+}
+
 struct ResvItem *
 resv_find(const char *name, int (*compare)(const char *, const char *))
 {
-  dlink_node *node, *node_next;
+  dlink_node *node;
   dlink_list *list;
 
   if (IsChanPrefix(*name))
@@ -148,14 +174,11 @@ resv_find(const char *name, int (*compare)(const char *, const char *))
   else
     list = &resv_nick_list;
 
-  DLINK_FOREACH_SAFE(node, node_next, list->head)
+  DLINK_FOREACH(node, list->head)
   {
     struct ResvItem *resv = node->data;
 
-    if (resv->expire &&
-        (resv->expire <= event_base->time.sec_real))
-      resv_delete(resv, true);
-    else if (compare(resv->mask, name) == 0)
+    if (compare(resv->mask, name) == 0)
       return resv;
   }
 
@@ -176,7 +199,7 @@ resv_exempt_find(const struct Client *client, const struct ResvItem *resv)
       switch (exempt->type)
       {
         case HM_HOST:
-          if (match(exempt->host, client->host) == 0 || match(exempt->host, client->sockhost) == 0)
+          if (match(exempt->host, client->host) == 0 || match(exempt->host, client->cold->sockhost) == 0)
             return true;
           break;
         case HM_IPV4:
@@ -216,23 +239,3 @@ resv_clear(void)
     }
   }
 }
-
-void
-resv_expire(void)
-{
-  dlink_list *tab[] = { &resv_chan_list, &resv_nick_list, NULL };
-
-  for (dlink_list **list = tab; *list; ++list)
-  {
-    dlink_node *node, *node_next;
-
-    DLINK_FOREACH_SAFE(node, node_next, (*list)->head)
-    {
-      struct ResvItem *resv = node->data;
-
-      if (resv->expire &&
-          (resv->expire <= event_base->time.sec_real))
-        resv_delete(resv, true);
-    }
-  }
-}
@@ -30,10 +30,37 @@
 #include "memory.h"
 
 
+struct dbuf_total dbuf_sendq_total;
+struct dbuf_total dbuf_recvq_total;
+
+
+static void
+dbuf_total_add(struct dbuf_queue *queue, size_t size)
+{
+  queue->total_size += size;
+
+  if (queue->total)
+  {
+    queue->total->size += size;
+
+    if (queue->total->peak < queue->total->size)
+      queue->total->peak = queue->total->size;
+  }
+}
+
+static void
+dbuf_total_sub(struct dbuf_queue *queue, size_t size)
+{
+  queue->total_size -= size;
+
+  if (queue->total)
+    queue->total->size -= size;
+}
+
 struct dbuf_block *
 dbuf_alloc(void)
 {
-  struct dbuf_block *block = xcalloc(sizeof(*block));
+  struct dbuf_block *block = xcalloc_tag(MEMORY_DBUF, sizeof(*block));
 
   ++block->refs;
   return block;
@@ -43,7 +70,7 @@ void
 dbuf_ref_free(struct dbuf_block *block)
 {
   if (--block->refs <= 0)
-    xfree(block);
+    xfree_tag(MEMORY_DBUF, block, sizeof(*block));
 }
 
 void
@@ -51,7 +78,7 @@ dbuf_add(struct dbuf_queue *queue, struct dbuf_block *block)
 {
   block->refs++;
   dlinkAddTail(block, make_dlink_node(), &queue->blocks);
-  queue->total_size += block->size;
+  dbuf_total_add(queue, block->size);
 }
 
 void
@@ -66,7 +93,7 @@ dbuf_delete(struct dbuf_queue *queue, size_t count)
     if (count >= avail)
     {
       count -= avail;
-      queue->total_size -= avail;
+      dbuf_total_sub(queue, avail);
 
       dbuf_ref_free(block);
 
@@ -79,7 +106,7 @@ dbuf_delete(struct dbuf_queue *queue, size_t count)
     {
       queue->pos += count;
 
-      queue->total_size -= count;
+      dbuf_total_sub(queue, count);
       count -= count;
     }
   }
@@ -116,7 +143,8 @@ dbuf_put(struct dbuf_queue *queue, const char *buf, size_t sz)
   {
     struct dbuf_block *block = dbuf_length(queue) ? queue->blocks.tail->data : NULL;
 
-    if (block == NULL || sizeof(block->data) - block->size == 0)
+    /* Never append to a block that is shared with other queues */
+    if (block == NULL || block->refs > 1 || sizeof(block->data) - block->size == 0)
     {
       block = dbuf_alloc();
       dlinkAddTail(block, make_dlink_node(), &queue->blocks);
@@ -129,7 +157,7 @@ dbuf_put(struct dbuf_queue *queue, const char *buf, size_t sz)
     memcpy(&block->data[block->size], buf, avail);
     block->size += avail;
 
-    queue->total_size += avail;
+    dbuf_total_add(queue, avail);
 
     sz -= avail;
     buf += avail;
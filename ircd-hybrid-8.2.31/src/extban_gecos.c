@@ -37,7 +37,7 @@
 static enum extban_match
 extban_gecos_matches(struct Client *client, struct Channel *channel, struct Ban *ban)
 {
-  if (match(ban->host, client->info) == 0)
+  if (match(ban->host, client->cold->info) == 0)
     return EXTBAN_MATCH;
 
   return EXTBAN_NO_MATCH;
@@ -415,24 +415,6 @@ hash_get_bucket(int type, unsigned int hashv)
  * - Dianora
  */
 
-/* exceeding_sendq()
- *
- * inputs       - pointer to client to check
- * output	- 1 if client is in danger of blowing its sendq
- *		  0 if it is not.
- * side effects -
- *
- * Sendq limit is fairly conservative at 1/2 (In original anyway)
- */
-static bool
-exceeding_sendq(const struct Client *to)
-{
-  if (dbuf_length(&to->connection->buf_sendq) > (get_sendq(&to->connection->confs) / 2))
-    return true;
-  else
-    return false;
-}
-
 void
 free_list_task(struct Client *client)
 {
@@ -443,19 +425,19 @@ free_list_task(struct Client *client)
 
   DLINK_FOREACH_SAFE(node, node_next, lt->show_mask.head)
   {
-    xfree(node->data);
+    xfree_str_tag(MEMORY_LIST_TASK, node->data);
     dlinkDelete(node, &lt->show_mask);
     free_dlink_node(node);
   }
 
   DLINK_FOREACH_SAFE(node, node_next, lt->hide_mask.head)
   {
-    xfree(node->data);
+    xfree_str_tag(MEMORY_LIST_TASK, node->data);
     dlinkDelete(node, &lt->hide_mask);
     free_dlink_node(node);
   }
 
-  xfree(lt);
+  xfree_tag(MEMORY_LIST_TASK, lt, sizeof(*lt));
   client->connection->list_task = NULL;
 }
 
@@ -503,8 +485,8 @@ list_one_channel(struct Client *client, struct Channel *channel)
       !(HasUMode(client, UMODE_ADMIN) || IsMember(client, channel)))
     return;
 
-  if (dlink_list_length(&channel->members) < lt->users_min ||
-      dlink_list_length(&channel->members) > lt->users_max ||
+  if (channel->members.count < lt->users_min ||
+      channel->members.count > lt->users_max ||
       (channel->creation_time != 0 &&
        ((unsigned int)channel->creation_time < lt->created_min ||
         (unsigned int)channel->creation_time > lt->created_max)) ||
@@ -526,9 +508,10 @@ list_one_channel(struct Client *client, struct Channel *channel)
   else
     snprintf(listbuf, sizeof(listbuf), "[%s]",  modebuf);
 
-  sendto_one_numeric(client, &me, RPL_LIST, channel->name,
-                     dlink_list_length(&channel->members),
-                     listbuf, channel->topic);
+  struct Reply reply = { .body_numeric = 0 };
+
+  reply_body(&reply, RPL_LIST, channel->name, channel->members.count, listbuf, channel->topic);
+  sendto_one_reply(client, &reply);
 }
 
 /* safe_list_channels()
@@ -47,6 +47,12 @@
 /* Hashtable stuff...now external as it's used in m_stats.c */
 dlink_list atable[ATABLE_SIZE];
 
+/* Bookkeeping of a rehash; see address_conf_mark_stale() */
+static bool address_reloading;
+static unsigned int address_stale_count;
+static unsigned int address_added_count;
+static unsigned int address_kept_count;
+
 /* The mask parser/type determination code... */
 
 /* int try_parse_v6_netmask(const char *, struct irc_ssaddr *, int *);
@@ -398,6 +404,30 @@ get_mask_hash(const char *text)
   return hash_text(text);
 }
 
+/* address_bucket()
+ *
+ * inputs       - type of the mask as returned by parse_netmask()
+ *              - its address and number of bits, or its hostname
+ * output       - the atable bucket a record of this mask belongs in
+ * side effects - NONE
+ */
+static dlink_list *
+address_bucket(enum hostmask_type masktype, const struct irc_ssaddr *addr, int bits,
+               const char *hostname)
+{
+  switch (masktype)
+  {
+    case HM_IPV4:
+      /* We have to do this, since we do not re-hash for every bit -A1kmm. */
+      return &atable[hash_ipv4(addr, bits - bits % 8)];
+    case HM_IPV6:
+      /* We have to do this, since we do not re-hash for every bit -A1kmm. */
+      return &atable[hash_ipv6(addr, bits - bits % 16)];
+    default: /* HM_HOST */
+      return &atable[get_mask_hash(hostname)];
+  }
+}
+
 /* struct MaskItem *find_conf_by_address(const char *, struct irc_ssaddr *,
  *                                         int type, int fam, const char *username)
  * Input: The hostname, the address, the type of mask to find, the address
@@ -549,6 +579,46 @@ find_address_conf(const char *host, const char *user, const struct irc_ssaddr *a
   return authcnf;
 }
 
+static bool
+address_string_equal(const char *a, const char *b)
+{
+  if (a == NULL || b == NULL)
+    return a == b;
+  return strcmp(a, b) == 0;
+}
+
+/* find_conf_by_mask()
+ *
+ * inputs       - type of mask to find
+ *              - the user and host mask it was configured with
+ * output       - the configured item with exactly these masks, or NULL
+ * side effects - NONE
+ *
+ * Unlike find_conf_by_address() no password is needed, for picking up
+ * again an auth {} block a client has been let in by before.
+ */
+struct MaskItem *
+find_conf_by_mask(unsigned int type, const char *user, const char *host)
+{
+  struct irc_ssaddr addr;
+  int bits = 0;
+  dlink_node *node;
+
+  const enum hostmask_type masktype = parse_netmask(host, &addr, &bits);
+
+  DLINK_FOREACH(node, address_bucket(masktype, &addr, bits, host)->head)
+  {
+    const struct AddressRec *arec = node->data;
+
+    if (arec->type == type && arec->stale == false &&
+        address_string_equal(arec->conf->host, host) &&
+        address_string_equal(arec->conf->user, user))
+      return arec->conf;
+  }
+
+  return NULL;
+}
+
 /* struct MaskItem* find_dline_conf(struct irc_ssaddr*, int)
  *
  * Input:	An address, an address family.
@@ -567,10 +637,98 @@ find_dline_conf(const struct irc_ssaddr *addr)
   return find_conf_by_address(NULL, addr, CONF_DLINE, NULL, NULL, 1);
 }
 
+static void
+hostmask_send_expiration(const struct AddressRec *const arec)
+{
+  char ban_type = '?';
+
+  switch (arec->type)
+  {
+    case CONF_KLINE:
+      ban_type = 'K';
+      break;
+    case CONF_DLINE:
+      ban_type = 'D';
+      break;
+    default: break;
+  }
+
+  sendto_realops_flags(UMODE_EXPIRATION, L_ALL, SEND_NOTICE,
+                       "Temporary %c-line for [%s@%s] expired", ban_type,
+                       (arec->conf->user) ? arec->conf->user : "*",
+                       (arec->conf->host) ? arec->conf->host : "*");
+}
+
+/* hostmask_expire()
+ *
+ * inputs       - pointer to the struct AddressRec of a temporary K/D-line
+ * output       - NONE
+ * side effects - the K/D-line is removed once it is due;
+ *                called from conf_expire_run()
+ */
+static void
+hostmask_expire(void *data)
+{
+  struct AddressRec *arec = data;
+
+  hostmask_send_expiration(arec);
+
+  dlinkDelete(&arec->node, arec->list);
+  conf_free(arec->conf);
+  xfree(arec);
+}
+
+/* address_conf_revive()
+ *
+ * inputs       - address record about to be added
+ * output       - an identical stale record from before the rehash, or NULL
+ * side effects - the stale record, if found, is taken into the new
+ *                configuration with the precedence of the new one
+ */
+static struct AddressRec *
+address_conf_revive(const struct AddressRec *arec)
+{
+  const struct MaskItem *const conf = arec->conf;
+  dlink_node *node;
+
+  DLINK_FOREACH(node, arec->list->head)
+  {
+    struct AddressRec *old = node->data;
+
+    if (old->stale == false || old->type != arec->type)
+      continue;
+
+    const struct MaskItem *const old_conf = old->conf;
+
+    if (old_conf->flags != conf->flags ||
+        old_conf->port != conf->port ||
+        old_conf->class != conf->class ||
+        old_conf->until != conf->until ||
+        !address_string_equal(old_conf->host, conf->host) ||
+        !address_string_equal(old_conf->user, conf->user) ||
+        !address_string_equal(old_conf->name, conf->name) ||
+        !address_string_equal(old_conf->passwd, conf->passwd) ||
+        !address_string_equal(old_conf->reason, conf->reason) ||
+        !address_string_equal(old_conf->certfp, conf->certfp) ||
+        !address_string_equal(old_conf->whois, conf->whois))
+      continue;
+
+    old->stale = false;
+    old->precedence = arec->precedence;
+    --address_stale_count;
+    ++address_kept_count;
+    return old;
+  }
+
+  return NULL;
+}
+
 /* void add_conf_by_address(int, struct MaskItem *aconf)
  * Input:
  * Output: None
- * Side-effects: Adds this entry to the hash table.
+ * Side-effects: Adds this entry to the hash table.  While ircd.conf is
+ *               being reloaded, an identical entry from before is kept
+ *               instead and 'conf' is freed.
  */
 struct AddressRec *
 add_conf_by_address(const unsigned int type, struct MaskItem *conf)
@@ -590,24 +748,29 @@ add_conf_by_address(const unsigned int type, struct MaskItem *conf)
   arec->precedence = prec_value--;
   arec->type = type;
 
-  switch (arec->masktype)
+  if (arec->masktype == HM_HOST)
+    arec->Mask.hostname = hostname;
+  arec->list = address_bucket(arec->masktype, &arec->Mask.ipa.addr, bits, hostname);
+
+  if (address_reloading && !IsConfDatabase(conf))
   {
-    case HM_IPV4:
-      /* We have to do this, since we do not re-hash for every bit -A1kmm. */
-      bits -= bits % 8;
-      dlinkAdd(arec, &arec->node, &atable[hash_ipv4(&arec->Mask.ipa.addr, bits)]);
-      break;
-    case HM_IPV6:
-      /* We have to do this, since we do not re-hash for every bit -A1kmm. */
-      bits -= bits % 16;
-      dlinkAdd(arec, &arec->node, &atable[hash_ipv6(&arec->Mask.ipa.addr, bits)]);
-      break;
-    default: /* HM_HOST */
-      arec->Mask.hostname = hostname;
-      dlinkAdd(arec, &arec->node, &atable[get_mask_hash(hostname)]);
-      break;
+    struct AddressRec *old = address_stale_count ? address_conf_revive(arec) : NULL;
+
+    if (old)
+    {
+      xfree(arec);
+      conf_free(conf);
+      return old;
+    }
+
+    ++address_added_count;
   }
 
+  dlinkAdd(arec, &arec->node, arec->list);
+
+  if (conf->until && (type == CONF_KLINE || type == CONF_DLINE))
+    conf_expire_add(&arec->expire_item, conf->until, hostmask_expire, arec);
+
   return arec;
 }
 
@@ -648,6 +811,7 @@ delete_one_address_conf(const char *address, struct MaskItem *conf)
 
     if (arec->conf == conf)
     {
+      conf_expire_delete(&arec->expire_item);
       dlinkDelete(&arec->node, &atable[hv]);
 
       if (conf->ref_count == 0)
@@ -659,88 +823,80 @@ delete_one_address_conf(const char *address, struct MaskItem *conf)
   }
 }
 
-/* void clear_out_address_conf(void)
+/* void address_conf_mark_stale(void)
  * Input: None
  * Output: None
- * Side effects: Clears out all address records in the hash table,
- *               frees them, and frees the MaskItems if nothing references
- *               them, otherwise sets them as illegal.
+ * Side effects: Marks every address record that came from ircd.conf as
+ *               stale before the configuration is read again.  Records
+ *               the new configuration still has are revived by
+ *               add_conf_by_address(); address_conf_sweep_stale() then
+ *               removes the rest.
  */
 void
-clear_out_address_conf(void)
+address_conf_mark_stale(void)
 {
-  dlink_node *node, *node_next;
+  dlink_node *node;
+
+  address_reloading = true;
+  address_stale_count = 0;
+  address_added_count = 0;
+  address_kept_count = 0;
 
   for (unsigned int i = 0; i < ATABLE_SIZE; ++i)
   {
-    DLINK_FOREACH_SAFE(node, node_next, atable[i].head)
+    DLINK_FOREACH(node, atable[i].head)
     {
       struct AddressRec *arec = node->data;
 
-      /*
-       * Destroy the ircd.conf items and keep those that are in the databases
-       */
+      /* Keep those that are in the databases */
       if (IsConfDatabase(arec->conf))
         continue;
 
-      dlinkDelete(&arec->node, &atable[i]);
-      arec->conf->active = false;
-
-      if (arec->conf->ref_count == 0)
-        conf_free(arec->conf);
-      xfree(arec);
+      arec->stale = true;
+      ++address_stale_count;
     }
   }
 }
 
-static void
-hostmask_send_expiration(const struct AddressRec *const arec)
-{
-  char ban_type = '?';
-
-  switch (arec->type)
-  {
-    case CONF_KLINE:
-      ban_type = 'K';
-      break;
-    case CONF_DLINE:
-      ban_type = 'D';
-      break;
-    default: break;
-  }
-
-  sendto_realops_flags(UMODE_EXPIRATION, L_ALL, SEND_NOTICE,
-                       "Temporary %c-line for [%s@%s] expired", ban_type,
-                       (arec->conf->user) ? arec->conf->user : "*",
-                       (arec->conf->host) ? arec->conf->host : "*");
-}
-
+/* void address_conf_sweep_stale(unsigned int *, unsigned int *, unsigned int *)
+ * Input: Where to store how many records were kept, added and removed
+ * Output: None
+ * Side effects: Frees the address records the new configuration no longer
+ *               has, and frees their MaskItems if nothing references them,
+ *               otherwise sets them as illegal.
+ */
 void
-hostmask_expire_temporary(void)
+address_conf_sweep_stale(unsigned int *const kept, unsigned int *const added,
+                         unsigned int *const removed)
 {
   dlink_node *node, *node_next;
 
-  for (unsigned int i = 0; i < ATABLE_SIZE; ++i)
+  address_reloading = false;
+
+  *kept = address_kept_count;
+  *added = address_added_count;
+  *removed = address_stale_count;
+
+  for (unsigned int i = 0; i < ATABLE_SIZE && address_stale_count; ++i)
   {
     DLINK_FOREACH_SAFE(node, node_next, atable[i].head)
     {
       struct AddressRec *arec = node->data;
 
-      if (arec->conf->until == 0 || arec->conf->until > event_base->time.sec_real)
+      if (arec->stale == false)
         continue;
 
-      switch (arec->type)
-      {
-        case CONF_KLINE:
-        case CONF_DLINE:
-          hostmask_send_expiration(arec);
-
-          dlinkDelete(&arec->node, &atable[i]);
-          conf_free(arec->conf);
-          xfree(arec);
-          break;
-        default: break;
-      }
+      --address_stale_count;
+
+      conf_expire_delete(&arec->expire_item);
+      dlinkDelete(&arec->node, &atable[i]);
+      arec->conf->active = false;
+
+      if (arec->conf->ref_count == 0)
+        conf_free(arec->conf);
+      xfree(arec);
     }
   }
+
+  assert(address_stale_count == 0);
 }
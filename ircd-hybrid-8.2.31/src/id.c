@@ -120,7 +120,7 @@ generate_sid(void)
 
   for (p = me.name; *p; ++p)
     sid = 5 * sid + *p;
-  for (p = me.info; *p; ++p)
+  for (p = me.cold->info; *p; ++p)
     sid = 5 * sid + *p;
 
   snprintf(me.id, IRC_MAXSID + 1, "%03d", sid % 1000);
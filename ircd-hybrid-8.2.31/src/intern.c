@@ -0,0 +1,171 @@
+/*
+ *  ircd-hybrid: an advanced, lightweight Internet Relay Chat Daemon (ircd)
+ *
+ *  Copyright (c) 2020 ircd-hybrid development team
+ *
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301
+ *  USA
+ */
+
+/*! \file intern.c
+ * \brief Shared, reference counted copies of strings that repeat between clients.
+ * \version $Id$
+ *
+ * Host names repeat a lot between clients: cloaks and spoofs are shared
+ * by many users, bouncers and shell providers put hundreds of them on one
+ * host, and every remote client has the same "0" or "255.255.255.255" as
+ * its IP address string.  Instead of a buffer of HOSTLEN + 1 bytes in
+ * every client and WHOWAS entry, they point to a single copy kept here.
+ *
+ * Interned strings are compared byte for byte, and must not be modified.
+ * Every intern_get() or intern_ref() is matched by an intern_put(); the
+ * copy is freed once the last reference is put.
+ */
+
+#include "stdinc.h"
+#include "intern.h"
+#include "memory.h"
+
+
+struct InternString
+{
+  struct InternString *next;  /**< Next string in the same bucket */
+  unsigned int refcount;  /**< Number of references handed out */
+  uint32_t hash;  /**< Hash of InternString::string */
+  char string[];  /**< The string itself */
+};
+
+static struct InternString *intern_table[INTERN_HASH_SIZE];
+static unsigned int intern_count;
+
+
+static uint32_t
+intern_hash(const char *string, size_t len)
+{
+  uint32_t hash = 2166136261U;
+
+  while (len--)
+  {
+    hash ^= (unsigned char)*string++;
+    hash *= 16777619U;
+  }
+
+  return hash;
+}
+
+static struct InternString *
+intern_item(const char *string)
+{
+  return (struct InternString *)(string - offsetof(struct InternString, string));
+}
+
+/* intern_get()
+ *
+ * inputs       - string to intern
+ *              - maximum number of characters to keep of it
+ * output       - pointer to the shared copy of the string
+ * side effects - the copy is created if there is none yet
+ */
+const char *
+intern_get(const char *string, size_t max)
+{
+  const size_t len = strnlen(string, max);
+  const uint32_t hash = intern_hash(string, len);
+  struct InternString **bucket = &intern_table[hash & (INTERN_HASH_SIZE - 1)];
+
+  for (struct InternString *item = *bucket; item; item = item->next)
+  {
+    if (item->hash == hash && strncmp(item->string, string, len) == 0 && item->string[len] == '\0')
+    {
+      ++item->refcount;
+      return item->string;
+    }
+  }
+
+  struct InternString *item = xcalloc_tag(MEMORY_INTERN, sizeof(*item) + len + 1);
+  memcpy(item->string, string, len);
+  item->refcount = 1;
+  item->hash = hash;
+  item->next = *bucket;
+  *bucket = item;
+
+  ++intern_count;
+  return item->string;
+}
+
+/* intern_ref()
+ *
+ * inputs       - an interned string
+ * output       - the same string
+ * side effects - one more reference to it is held
+ */
+const char *
+intern_ref(const char *string)
+{
+  ++intern_item(string)->refcount;
+  return string;
+}
+
+/* intern_put()
+ *
+ * inputs       - an interned string, or NULL
+ * output       - NONE
+ * side effects - a reference is dropped; the copy is freed with the last one
+ */
+void
+intern_put(const char *string)
+{
+  if (string == NULL)
+    return;
+
+  struct InternString *item = intern_item(string);
+
+  assert(item->refcount);
+  if (--item->refcount)
+    return;
+
+  struct InternString **prev = &intern_table[item->hash & (INTERN_HASH_SIZE - 1)];
+  while (*prev != item)
+    prev = &(*prev)->next;
+  *prev = item->next;
+
+  --intern_count;
+  xfree_tag(MEMORY_INTERN, item, sizeof(*item) + strlen(item->string) + 1);
+}
+
+/* intern_set()
+ *
+ * inputs       - pointer to a field holding an interned string, or NULL
+ *              - the new string
+ *              - maximum number of characters to keep of it
+ * output       - NONE
+ * side effects - the field points to the interned new string, and the
+ *                reference to the old one is dropped
+ */
+void
+intern_set(const char **field, const char *string, size_t max)
+{
+  const char *old = *field;
+
+  *field = intern_get(string, max);
+  intern_put(old);
+}
+
+void
+intern_get_stats(unsigned int *const number, size_t *const mem)
+{
+  (*number) = intern_count;
+  (*mem) = memory_get_stats(MEMORY_INTERN)->bytes + sizeof(intern_table);
+}
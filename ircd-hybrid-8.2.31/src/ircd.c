@@ -30,11 +30,13 @@
 #include "ircd.h"
 #include "channel.h"
 #include "channel_mode.h"
+#include "channel_stream.h"
 #include "client.h"
 #include "event.h"
 #include "fdlist.h"
 #include "hash.h"
 #include "id.h"
+#include "intern.h"
 #include "irc_string.h"
 #include "ircd_signal.h"
 #include "motd.h"
@@ -54,6 +56,9 @@
 #include "conf_db.h"
 #include "conf_class.h"
 #include "ipcache.h"
+#include "throttle.h"
+#include "ratelimit.h"
+#include "upgrade.h"
 #include "isupport.h"
 #include "patchlevel.h"
 #include "serno.h"
@@ -65,7 +70,8 @@ struct Counter Count;
 struct ServerState_t server_state;
 struct ServerStatistics ServerStats;
 struct Connection meConnection;  /* That's also part of me */
-struct Client me = { .connection = &meConnection };  /* That's me */
+static struct ClientCold meCold;  /* Rarely used parts of me */
+struct Client me = { .connection = &meConnection, .cold = &meCold };  /* That's me */
 
 char **myargv;
 const char *logFileName = LPATH;
@@ -75,6 +81,7 @@ bool dorehash;
 bool doremotd;
 
 static bool printVersion;
+static const char *upgradeFileName;
 
 static struct lgetopt myopts[] =
 {
@@ -92,8 +99,18 @@ static struct lgetopt myopts[] =
    STRING, "File to use for ircd.log" },
   { "pidfile",    &pidFileName,
    STRING, "File to use for process ID" },
+  { "modulepath", &module_core_path,
+   STRING, "Directory to load the core modules from" },
+  { "automodulepath", &module_auto_path,
+   STRING, "Directory to autoload modules from" },
   { "foreground", &server_state.foreground,
    BOOLEAN, "Run in foreground (don't detach)" },
+  { "reuseport",  &server_state.reuseport,
+   BOOLEAN, "Share client ports with other ircd processes" },
+  { "deferaccept", &server_state.deferaccept,
+   BOOLEAN, "Accept connections only once they have sent data" },
+  { "upgrade",    &upgradeFileName,
+   STRING, "Take over the clients handed over by RESTART UPGRADE" },
   { "version",    &printVersion,
    BOOLEAN, "Print version and exit" },
   { "help", NULL, USAGE, "Print this text" },
@@ -128,6 +145,13 @@ static struct event event_save_all_databases =
   .when = DATABASE_UPDATE_TIMEOUT
 };
 
+static struct event event_tls_rotate_ticket_keys =
+{
+  .name = "tls_rotate_ticket_keys",
+  .handler = tls_rotate_ticket_keys,
+  .when = TLS_TICKET_KEY_ROTATE
+};
+
 struct event event_write_links_file =
 {
   .name = "write_links_file",
@@ -140,6 +164,8 @@ io_loop(void)
 {
   while (true)
   {
+    const uintmax_t start = event_time_ns();
+
     if (listing_client_list.head)
     {
       dlink_node *node = NULL, *node_next = NULL;
@@ -147,10 +173,20 @@ io_loop(void)
         safe_list_channels(node->data, false);
     }
 
+    if (streaming_client_list.head)
+      channel_stream_run_all();
+
     /* Run pending events */
     event_run();
 
+    /* Write out everything queued since the last iteration */
+    send_queued_all();
+
+    const uintmax_t select_start = event_time_ns();
+    PerfStats.wait_last = 0;
     comm_select();
+    perf_add(&PerfStats.select, event_time_ns() - select_start - PerfStats.wait_last);
+
     exit_aborted_clients();
     free_exited_clients();
 
@@ -168,6 +204,8 @@ io_loop(void)
                            "Got signal SIGUSR1, reloading motd file(s)");
       doremotd = false;
     }
+
+    perf_add(&PerfStats.loop, event_time_ns() - start - PerfStats.wait_last);
   }
 }
 
@@ -188,6 +226,11 @@ initialize_global_set_options(void)
   GlobalSetOptions.floodtime = ConfigGeneral.default_floodtime;
   GlobalSetOptions.joinfloodcount = ConfigChannel.default_join_flood_count;
   GlobalSetOptions.joinfloodtime = ConfigChannel.default_join_flood_time;
+  GlobalSetOptions.tls_session_cache = TLS_SESSION_CACHE_SIZE;
+  GlobalSetOptions.perf_export = ConfigGeneral.perf_export_delay;
+  perf_set_export(GlobalSetOptions.perf_export);
+  GlobalSetOptions.prefix_rate = THROTTLE_RATE;
+  GlobalSetOptions.prefix_burst = THROTTLE_BURST;
 }
 
 /* write_pidfile()
@@ -242,7 +285,8 @@ check_pidfile(const char *filename)
     {
       pid_t pid = atoi(buf);
 
-      if (kill(pid, 0) == 0)
+      /* RESTART UPGRADE executes the new binary in the same process */
+      if (pid != getpid() && kill(pid, 0) == 0)
       {
         /* log(L_ERROR, "Server is already running"); */
         printf("ircd: daemon is already running\n");
@@ -407,8 +451,13 @@ main(int argc, char *argv[])
   /* Check if there is pidfile and daemon already running */
   check_pidfile(pidFileName);
 
+  /* Has to be done before conf_read_files() takes over the listening sockets */
+  if (upgradeFileName)
+    upgrade_load(upgradeFileName);
+
   isupport_init();
   ipcache_init();
+  ratelimit_init();
   client_init();
   class_init();
   resolver_init();      /* Needs to be setup before the io loop */
@@ -419,7 +468,6 @@ main(int argc, char *argv[])
   channel_mode_init();
   extban_init();
   read_links_file();
-  motd_init();
   user_modes_init();
 
   if (EmptyString(ConfigServerInfo.name))
@@ -429,6 +477,7 @@ main(int argc, char *argv[])
   }
 
   strlcpy(me.name, ConfigServerInfo.name, sizeof(me.name));
+  motd_init();  /* Has to be called after me.name is set */
 
   /* serverinfo {} description must exist.  If not, error out.*/
   if (EmptyString(ConfigServerInfo.description))
@@ -437,7 +486,7 @@ main(int argc, char *argv[])
     exit(EXIT_FAILURE);
   }
 
-  strlcpy(me.info, ConfigServerInfo.description, sizeof(me.info));
+  strlcpy(me.cold->info, ConfigServerInfo.description, sizeof(me.cold->info));
 
   if (EmptyString(ConfigServerInfo.sid))
   {
@@ -451,6 +500,9 @@ main(int argc, char *argv[])
 
   me.from = &me;
   me.servptr = &me;
+  me.host = intern_get("", 0);
+  me.cold->realhost = intern_get("", 0);
+  me.cold->sockhost = intern_get("", 0);
   me.connection->created_real = event_base->time.sec_real;
   me.connection->created_monotonic = event_base->time.sec_monotonic;
 
@@ -483,6 +535,7 @@ main(int argc, char *argv[])
   event_add(&event_comm_checktimeouts, NULL);
 
   event_addish(&event_save_all_databases, NULL);
+  event_add(&event_tls_rotate_ticket_keys, NULL);
 
   if (ConfigServerHide.flatten_links_delay && event_write_links_file.active == false)
   {
@@ -490,6 +543,8 @@ main(int argc, char *argv[])
     event_add(&event_write_links_file, NULL);
   }
 
+  upgrade_restore();
+
   ilog(LOG_TYPE_IRCD, "Server ready. Running version: %s(%s)", PATCHLEVEL, SERIALNUM);
   io_loop();
 
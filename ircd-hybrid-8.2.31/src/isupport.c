@@ -51,7 +51,8 @@ struct Isupport
 };
 
 static dlink_list isupport_list;
-static dlink_list isupport_list_lines;
+static struct Reply isupport_reply;  /* Preformatted RPL_ISUPPORT lines */
+static bool isupport_stale;  /* isupport_reply needs to be rebuilt */
 
 /*
  * isupport_init()
@@ -111,7 +112,7 @@ isupport_add(const char *name, const char *options, int n)
     support->options = xstrdup(options);
   support->number = n;
 
-  isupport_rebuild();
+  isupport_stale = true;
 }
 
 /*
@@ -140,7 +141,7 @@ isupport_delete(const char *name)
     }
   }
 
-  isupport_rebuild();
+  isupport_stale = true;
 }
 
 /*
@@ -148,25 +149,21 @@ isupport_delete(const char *name)
  *
  * input        - NONE
  * output       - NONE
- * side effects - Destroy the isupport MessageFile lines, and rebuild.
+ * side effects - Destroy the preformatted isupport lines, and rebuild.
  */
 void
 isupport_rebuild(void)
 {
   char isupportbuffer[IRCD_BUFSIZE];
   char *p = isupportbuffer;
-  dlink_node *node = NULL, *node_next = NULL;
+  dlink_node *node = NULL;
   int n = 0;
   int tokens = 0;
   size_t len = 0;
   size_t reserve = strlen(me.name) + HOSTLEN + strlen(numeric_form(RPL_ISUPPORT));
 
-  DLINK_FOREACH_SAFE(node, node_next, isupport_list_lines.head)
-  {
-    dlinkDelete(node, &isupport_list_lines);
-    xfree(node->data);
-    free_dlink_node(node);
-  }
+  reply_clear(&isupport_reply);
+  isupport_stale = false;
 
   DLINK_FOREACH(node, isupport_list.head)
   {
@@ -196,7 +193,7 @@ isupport_rebuild(void)
       if (*--p == ' ')
         *p = '\0';
 
-      dlinkAddTail(xstrdup(isupportbuffer), make_dlink_node(), &isupport_list_lines);
+      reply_add(&isupport_reply, RPL_ISUPPORT, isupportbuffer);
       p = isupportbuffer;
       len = 0;
       n = 0;
@@ -208,7 +205,7 @@ isupport_rebuild(void)
   {
     if (*--p == ' ')
       *p = '\0';
-    dlinkAddTail(xstrdup(isupportbuffer), make_dlink_node(), &isupport_list_lines);
+    reply_add(&isupport_reply, RPL_ISUPPORT, isupportbuffer);
   }
 }
 
@@ -221,8 +218,8 @@ isupport_rebuild(void)
 void
 isupport_show(struct Client *client)
 {
-  dlink_node *node;
+  if (isupport_stale == true)
+    isupport_rebuild();
 
-  DLINK_FOREACH(node, isupport_list_lines.head)
-    sendto_one_numeric(client, &me, RPL_ISUPPORT, node->data);
+  sendto_one_reply(client, &isupport_reply);
 }
@@ -38,7 +38,7 @@
 dlink_node *
 make_dlink_node(void)
 {
-  dlink_node *node = xcalloc(sizeof(*node));
+  dlink_node *node = xcalloc_tag(MEMORY_DLINK, sizeof(*node));
 
   return node;
 }
@@ -52,7 +52,7 @@ make_dlink_node(void)
 void
 free_dlink_node(dlink_node *node)
 {
-  xfree(node);
+  xfree_tag(MEMORY_DLINK, node, sizeof(*node));
 }
 
 /*
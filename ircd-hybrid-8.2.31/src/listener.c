@@ -25,6 +25,7 @@
  */
 
 #include "stdinc.h"
+#include <netinet/tcp.h>
 #include "list.h"
 #include "listener.h"
 #include "client.h"
@@ -36,6 +37,7 @@
 #include "conf.h"
 #include "send.h"
 #include "memory.h"
+#include "upgrade.h"
 
 #define TOOFAST_WARNING "ERROR :Your host is trying to (re)connect too fast -- throttled.\r\n"
 #define DLINE_WARNING "ERROR :You have been D-lined.\r\n"
@@ -186,10 +188,22 @@ inetport(struct Listener *listener)
   getnameinfo((const struct sockaddr *)&listener->addr, listener->addr.ss_len, listener->name,
               sizeof(listener->name), NULL, 0, NI_NUMERICHOST);
 
+  /*
+   * Take over the socket of the process we were upgraded from, if it
+   * listened on the same address already
+   */
+  int fd = upgrade_listener_take(&listener->addr);
+  if (fd > -1)
+  {
+    listener->fd = fd_open(fd, true, "Listener socket");
+    listener_accept_connection(listener->fd, listener);
+    return 1;
+  }
+
   /*
    * At first, open a new socket
    */
-  int fd = comm_socket(listener->addr.ss.ss_family, SOCK_STREAM, 0);
+  fd = comm_socket(listener->addr.ss.ss_family, SOCK_STREAM, 0);
   if (fd == -1)
   {
     report_error(L_ALL, "opening listener socket %s:%s",
@@ -205,6 +219,43 @@ inetport(struct Listener *listener)
     return 0;
   }
 
+#ifdef SO_REUSEPORT
+  /*
+   * With -reuseport, several ircd processes on the same box, linked
+   * together as ordinary servers, can all listen on the same client
+   * ports and the kernel spreads the incoming connections among them,
+   * so each process only does the I/O for its own share of the
+   * clients. Server-only ports are never shared, so every process
+   * stays reachable on its own for its links.
+   */
+  if (server_state.reuseport == true && !(listener->flags & LISTENER_SERVER))
+  {
+    if (setsockopt(fd, SOL_SOCKET, SO_REUSEPORT, &opt, sizeof(opt)))
+    {
+      report_error(L_ALL, "setting SO_REUSEPORT for listener %s:%s",
+                   listener_get_name(listener), errno);
+      close(fd);
+      return 0;
+    }
+  }
+#endif
+
+#ifdef TCP_DEFER_ACCEPT
+  /*
+   * With -deferaccept, the kernel completes the handshake but does not
+   * hand us the connection before the peer has sent data, or
+   * LISTENER_DEFER_ACCEPT seconds have passed.
+   */
+  if (server_state.deferaccept == true)
+  {
+    int secs = LISTENER_DEFER_ACCEPT;
+
+    if (setsockopt(fd, IPPROTO_TCP, TCP_DEFER_ACCEPT, &secs, sizeof(secs)))
+      report_error(L_ALL, "setting TCP_DEFER_ACCEPT for listener %s:%s",
+                   listener_get_name(listener), errno);
+  }
+#endif
+
   /*
    * Bind a port to listen for new connections if port is non-null,
    * else assume it is already open and try get something from it.
@@ -251,10 +302,10 @@ listener_find(int port, struct irc_ssaddr *addr)
       if (listener->fd)
       {
         assert(listener->fd->flags.open);
-        last_closed = listener;
+        return (listener);
       }
       else
-        return (listener);
+        last_closed = listener;
     }
   }
 
@@ -283,6 +334,22 @@ listener_close(struct Listener *listener)
   listener_free(listener);
 }
 
+/*
+ * listener_mark_for_deletion - mark all listeners before the configuration
+ * is read again; listener_add() unmarks those that are still configured
+ */
+void
+listener_mark_for_deletion(void)
+{
+  dlink_node *node;
+
+  DLINK_FOREACH(node, listener_list.head)
+  {
+    struct Listener *listener = node->data;
+    listener->active = 0;
+  }
+}
+
 /*
  * listener_close_marked - close and free all listeners that are not being used
  */
@@ -293,7 +360,12 @@ listener_close_marked(void)
 
   /* close all 'extra' listening ports we have */
   DLINK_FOREACH_SAFE(node, node_next, listener_list.head)
-    listener_close(node->data);
+  {
+    struct Listener *listener = node->data;
+
+    if (listener->active == 0)
+      listener_close(listener);
+  }
 }
 
 void
@@ -386,6 +458,7 @@ listener_add(int port, const char *vhost_ip, unsigned int flags)
     if (listener->fd)
     {
       assert(listener->fd->flags.open);
+      listener->active = 1;  /* Still configured; keep the socket open */
       return;
     }
   }
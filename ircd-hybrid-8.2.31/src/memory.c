@@ -30,6 +30,31 @@
 #include "restart.h"
 
 
+static struct MemoryStats memory_stats[MEMORY_TAG_LAST] =
+{
+  [MEMORY_CLIENT] = { .name = "Clients" },
+  [MEMORY_CLIENT_COLD] = { .name = "Client cold records" },
+  [MEMORY_CONNECTION] = { .name = "Connections" },
+  [MEMORY_SERVER] = { .name = "Servers" },
+  [MEMORY_AWAY] = { .name = "Away messages" },
+  [MEMORY_CHANNEL] = { .name = "Channels" },
+  [MEMORY_MEMBER] = { .name = "Channel members" },
+  [MEMORY_MEMBER_ARRAY] = { .name = "Channel member arrays" },
+  [MEMORY_CHANNEL_ROUTE] = { .name = "Channel server routes" },
+  [MEMORY_BAN] = { .name = "Bans/exceptions/invex" },
+  [MEMORY_INVITE] = { .name = "Invites" },
+  [MEMORY_LIST_TASK] = { .name = "Safelist" },
+  [MEMORY_CHANNEL_STREAM] = { .name = "NAMES/WHO streams" },
+  [MEMORY_WATCH] = { .name = "WATCH headers" },
+  [MEMORY_WHOWAS] = { .name = "Whowas users" },
+  [MEMORY_INTERN] = { .name = "Interned strings" },
+  [MEMORY_DBUF] = { .name = "Dbuf blocks" },
+  [MEMORY_DLINK] = { .name = "List nodes" },
+  [MEMORY_DNS] = { .name = "DNS requests" },
+  [MEMORY_TLS] = { .name = "TLS state" }
+};
+
+
 /*
  * xcalloc - allocate memory, call outofmemory on failure
  */
@@ -90,6 +115,110 @@ xstrndup(const char *s, size_t len)
   return ret;
 }
 
+/*
+ * The _tag variants below charge each allocation to a subsystem so that
+ * STATS z can report exact figures without walking any list.  The size
+ * passed on release must match the size allocated, which for every user
+ * is either a sizeof() or a length the object itself records.
+ */
+void
+memory_tag_add(enum MemoryTag tag, size_t size)
+{
+  struct MemoryStats *stats = &memory_stats[tag];
+
+  ++stats->count;
+  stats->bytes += size;
+
+  if (stats->peak < stats->bytes)
+    stats->peak = stats->bytes;
+}
+
+void
+memory_tag_sub(enum MemoryTag tag, size_t size)
+{
+  struct MemoryStats *stats = &memory_stats[tag];
+
+  assert(stats->count);
+  assert(stats->bytes >= size);
+
+  --stats->count;
+  stats->bytes -= size;
+}
+
+const struct MemoryStats *
+memory_get_stats(enum MemoryTag tag)
+{
+  return &memory_stats[tag];
+}
+
+void *
+xcalloc_tag(enum MemoryTag tag, size_t size)
+{
+  void *ret = xcalloc(size);
+
+  memory_tag_add(tag, size);
+  return ret;
+}
+
+/*
+ * xrealloc_tag - reallocate memory charged to 'tag'; 'old_size' is what
+ *                the block had, or 0 if 'x' is NULL.  A 'size' of 0 frees
+ *                the block and returns NULL.
+ */
+void *
+xrealloc_tag(enum MemoryTag tag, void *x, size_t old_size, size_t size)
+{
+  if (size == 0)
+  {
+    xfree_tag(tag, x, old_size);
+    return NULL;
+  }
+
+  void *ret = xrealloc(x, size);
+  struct MemoryStats *stats = &memory_stats[tag];
+
+  if (x == NULL)
+    ++stats->count;
+
+  stats->bytes = stats->bytes - old_size + size;
+
+  if (stats->peak < stats->bytes)
+    stats->peak = stats->bytes;
+
+  return ret;
+}
+
+void
+xfree_tag(enum MemoryTag tag, void *x, size_t size)
+{
+  if (x == NULL)
+    return;
+
+  memory_tag_sub(tag, size);
+  free(x);
+}
+
+/*
+ * xstrndup_tag - unlike xstrndup(), this only allocates as much as the
+ *                copy needs so that xfree_str_tag() can tell the size
+ */
+void *
+xstrndup_tag(enum MemoryTag tag, const char *s, size_t len)
+{
+  const size_t size = strnlen(s, len) + 1;
+  char *ret = xcalloc_tag(tag, size);
+
+  memcpy(ret, s, size - 1);
+  return ret;
+}
+
+void
+xfree_str_tag(enum MemoryTag tag, void *x)
+{
+  if (x)
+    xfree_tag(tag, x, strlen(x) + 1);
+}
+
 /* outofmemory()
  *
  * input        - NONE
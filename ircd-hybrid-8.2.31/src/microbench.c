@@ -0,0 +1,907 @@
+/*
+ *  ircd-hybrid: an advanced, lightweight Internet Relay Chat Daemon (ircd)
+ *
+ *  Copyright (c) 2020 ircd-hybrid development team
+ *
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301
+ *  USA
+ */
+
+/*! \file microbench.c
+ * \brief Times core data structures and string primitives in isolation.
+ * \version $Id$
+ *
+ * ircd-microbench is linked from the same objects as the ircd, except
+ * ircd.c, and never enters the event loop.  Each benchmark builds a
+ * corpus from a fixed seed, so runs of different commits time exactly
+ * the same work, and reports the average cost of a single operation.
+ */
+
+#include "stdinc.h"
+#include "list.h"
+#include "ircd.h"
+#include "client.h"
+#include "channel.h"
+#include "channel_mode.h"
+#include "conf.h"
+#include "conf_class.h"
+#include "dbuf.h"
+#include "event.h"
+#include "fdlist.h"
+#include "hash.h"
+#include "hostmask.h"
+#include "intern.h"
+#include "irc_string.h"
+#include "memory.h"
+#include "misc.h"
+#include "packet.h"
+#include "parse.h"
+#include "patricia.h"
+#include "send.h"
+#include "user.h"
+
+
+/* What ircd.c would otherwise provide */
+struct SetOptions GlobalSetOptions;
+struct Counter Count;
+struct ServerState_t server_state;
+struct ServerStatistics ServerStats;
+static struct Connection meConnection;
+static struct ClientCold meCold;
+struct Client me = { .connection = &meConnection, .cold = &meCold };
+struct event event_write_links_file = { .name = "write_links_file" };
+const char *logFileName = "/dev/null";
+const char *pidFileName = "/dev/null";
+char **myargv;
+bool dorehash;
+bool doremotd;
+
+enum
+{
+  CORPUS_NICKS   = 10000,
+  CORPUS_BANS    = 100,
+  CORPUS_KLINES  = 5000,
+  CORPUS_DLINES  = 10000,
+  CORPUS_LOOKUPS = 10000,
+  CORPUS_LINES   = 10000,
+  FANOUT_LOCAL   = 500,
+  FANOUT_LINKS   = 8,
+  FANOUT_REMOTE  = 500,  /* Members behind each link */
+  SCAN_LINKS     = 20,
+  SCAN_REMOTE    = 10000,  /* Members behind each link */
+  SCAN_HOSTS     = 2000  /* Distinct hosts the members of the scanned channel come from */
+};
+
+struct Bench
+{
+  const char *name;
+  void (*setup)(void);
+  uintmax_t (*run)(uintmax_t *);  /* Returns operations done; adds the ns spent to its argument */
+};
+
+static uint64_t rng_state;
+static volatile uintmax_t sink;  /* Keeps the compiler from dropping the work */
+static uintmax_t opt_time = 300;  /* Milliseconds each benchmark runs for */
+static bool opt_json;
+static const char *opt_only;
+static const char *opt_lines;
+
+static char nicks[CORPUS_NICKS][NICKLEN + 1];
+static char nicks_upper[CORPUS_NICKS][NICKLEN + 1];
+static char nuhs[CORPUS_NICKS][NICKLEN + USERLEN + HOSTLEN + 3];
+static char hosts[CORPUS_NICKS][HOSTLEN + 1];
+static char bans[CORPUS_BANS][NICKLEN + USERLEN + HOSTLEN + 3];
+static struct irc_ssaddr lookup_addr[CORPUS_LOOKUPS];
+static char **lines;
+static unsigned int lines_count;
+static patricia_tree_t *dline_trie_v4;
+static patricia_tree_t *dline_trie_v6;
+static struct Channel *fanout_channel;
+static struct Client *fanout_sender;
+static struct Channel *scan_channel;
+
+
+static uintmax_t
+bench_time_ns(void)
+{
+  struct timespec ts;
+
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return (uintmax_t)ts.tv_sec * 1000000000 + ts.tv_nsec;
+}
+
+static uint32_t
+rng(void)
+{
+  rng_state ^= rng_state << 13;
+  rng_state ^= rng_state >> 7;
+  rng_state ^= rng_state << 17;
+  return rng_state >> 32;
+}
+
+static void
+rng_word(char *buf, unsigned int min, unsigned int max)
+{
+  static const char chars[] = "abcdefghijklmnopqrstuvwxyz0123456789";
+  unsigned int len = min + rng() % (max - min + 1);
+
+  buf[0] = chars[rng() % 26];
+  for (unsigned int i = 1; i < len; ++i)
+    buf[i] = chars[rng() % (sizeof(chars) - 1)];
+  buf[len] = '\0';
+}
+
+static void
+rng_addr(struct irc_ssaddr *addr, bool v6)
+{
+  memset(addr, 0, sizeof(*addr));
+
+  if (v6)
+  {
+    struct sockaddr_in6 *v6addr = (struct sockaddr_in6 *)addr;
+
+    v6addr->sin6_family = AF_INET6;
+    v6addr->sin6_addr.s6_addr[0] = 0x20;
+    v6addr->sin6_addr.s6_addr[1] = 0x01;
+    for (unsigned int i = 2; i < 16; ++i)
+      v6addr->sin6_addr.s6_addr[i] = rng() & (i < 6 ? 0x0f : 0xff);
+    addr->ss_len = sizeof(struct sockaddr_in6);
+  }
+  else
+  {
+    struct sockaddr_in *v4addr = (struct sockaddr_in *)addr;
+
+    v4addr->sin_family = AF_INET;
+    /* Keep the first two octets in a small range so lookups hit the D-line set */
+    v4addr->sin_addr.s_addr = htonl((10u << 24) | ((rng() % 16) << 16) | (rng() & 0xffff));
+    addr->ss_len = sizeof(struct sockaddr_in);
+  }
+}
+
+
+/*
+ * Corpora
+ */
+
+static void
+setup_nicks(void)
+{
+  static bool done;
+
+  if (done)
+    return;
+  done = true;
+
+  for (unsigned int i = 0; i < CORPUS_NICKS; ++i)
+  {
+    char user[USERLEN + 1];
+
+    rng_word(nicks[i], 3, NICKLEN);
+    strlcpy(nicks_upper[i], nicks[i], sizeof(nicks_upper[i]));
+    for (char *p = nicks_upper[i]; *p; ++p)
+      *p = ToUpper(*p);
+
+    rng_word(user, 1, USERLEN);
+    snprintf(hosts[i], sizeof(hosts[i]), "host-%u-%u.cust%u.isp%u.example.net",
+             rng() % 256, rng() % 256, rng() % 64, rng() % 16);
+    snprintf(nuhs[i], sizeof(nuhs[i]), "%s!%s@%s", nicks[i], user, hosts[i]);
+  }
+
+  /* Typical channel bans: host masks, nick prefixes and user masks */
+  for (unsigned int i = 0; i < CORPUS_BANS; ++i)
+  {
+    char word[8];
+
+    rng_word(word, 2, 4);
+
+    switch (rng() % 4)
+    {
+      case 0:
+        snprintf(bans[i], sizeof(bans[i]), "*!*@*.cust%u.isp%u.example.net", rng() % 64, rng() % 16);
+        break;
+      case 1:
+        snprintf(bans[i], sizeof(bans[i]), "%s*!*@*", word);
+        break;
+      case 2:
+        snprintf(bans[i], sizeof(bans[i]), "*!*%s*@*", word);
+        break;
+      default:
+        snprintf(bans[i], sizeof(bans[i]), "*!*@host-%u-*.example.net", rng() % 256);
+        break;
+    }
+  }
+}
+
+static void
+setup_lookups(void)
+{
+  static bool done;
+
+  if (done)
+    return;
+  done = true;
+
+  for (unsigned int i = 0; i < CORPUS_LOOKUPS; ++i)
+    rng_addr(&lookup_addr[i], (i % 4) == 0);
+}
+
+static void
+setup_klines(void)
+{
+  static bool done;
+
+  if (done)
+    return;
+  done = true;
+
+  setup_nicks();
+  setup_lookups();
+
+  for (unsigned int i = 0; i < CORPUS_KLINES; ++i)
+  {
+    struct MaskItem *conf = conf_make(CONF_KLINE);
+    char host[HOSTLEN + 1];
+    char user[USERLEN + 1];
+
+    if (i % 2)
+      snprintf(host, sizeof(host), "*.cust%u.isp%u.example.net", rng() % 64, rng() % 16);
+    else
+      snprintf(host, sizeof(host), "10.%u.%u.0/24", rng() % 16, rng() % 256);
+
+    if (i % 3)
+      strlcpy(user, "*", sizeof(user));
+    else
+      rng_word(user, 2, USERLEN);
+
+    conf->host = xstrdup(host);
+    conf->user = xstrdup(user);
+    conf->reason = xstrdup("microbench");
+    add_conf_by_address(CONF_KLINE, conf);
+  }
+}
+
+static void
+setup_dlines(void)
+{
+  static bool done;
+
+  if (done)
+    return;
+  done = true;
+
+  setup_lookups();
+
+  dline_trie_v4 = patricia_new(32);
+  dline_trie_v6 = patricia_new(128);
+
+  for (unsigned int i = 0; i < CORPUS_DLINES; ++i)
+  {
+    struct MaskItem *conf = conf_make(CONF_DLINE);
+    struct irc_ssaddr addr;
+    char host[HOSTIPLEN + 5];
+    const bool v6 = (i % 4) == 0;
+    const int bits = v6 ? 32 + (rng() % 5) * 8 : 16 + (rng() % 17);
+
+    rng_addr(&addr, v6);
+    if (getnameinfo((struct sockaddr *)&addr, addr.ss_len, host, HOSTIPLEN, NULL, 0, NI_NUMERICHOST))
+      continue;
+
+    snprintf(host + strlen(host), sizeof(host) - strlen(host), "/%d", bits);
+
+    conf->host = xstrdup(host);
+    conf->reason = xstrdup("microbench");
+    add_conf_by_address(CONF_DLINE, conf);
+
+    patricia_node_t *pnode = patricia_make_and_lookup_addr(v6 ? dline_trie_v6 : dline_trie_v4,
+                                                           (struct sockaddr *)&addr, bits);
+    PATRICIA_DATA_SET(pnode, conf);
+  }
+}
+
+static void
+setup_lines(void)
+{
+  static const char *const templates[] =
+  {
+    "PRIVMSG #%s :%s %s %s, did anyone see the %s?",
+    "PRIVMSG %s :hey %s",
+    "NOTICE %s :\001VERSION %s\001",
+    "JOIN #%s,#%s",
+    "PART #%s :%s",
+    "MODE #%s +o %s",
+    "MODE #%s +b *!*@*.%s.example.net",
+    "TOPIC #%s :%s %s %s",
+    "WHO #%s",
+    "PING :%s.example.net",
+    "PONG :%s.example.net",
+    "AWAY :%s %s"
+  };
+
+  if (lines)
+    return;
+
+  setup_nicks();
+
+  if (opt_lines)
+  {
+    FILE *file = fopen(opt_lines, "r");
+    char buf[IRCD_BUFSIZE];
+
+    if (file == NULL)
+    {
+      perror(opt_lines);
+      exit(EXIT_FAILURE);
+    }
+
+    while (fgets(buf, sizeof(buf), file))
+    {
+      buf[strcspn(buf, "\r\n")] = '\0';
+
+      if (buf[0] == '\0')
+        continue;
+
+      lines = xrealloc(lines, (lines_count + 1) * sizeof(*lines));
+      lines[lines_count++] = xstrdup(buf);
+    }
+
+    fclose(file);
+
+    if (lines_count)
+      return;
+  }
+
+  lines = xcalloc(CORPUS_LINES * sizeof(*lines));
+
+  for (lines_count = 0; lines_count < CORPUS_LINES; ++lines_count)
+  {
+    char buf[IRCD_BUFSIZE];
+    const char *a = nicks[rng() % CORPUS_NICKS], *b = nicks[rng() % CORPUS_NICKS];
+    const char *c = nicks[rng() % CORPUS_NICKS], *d = nicks[rng() % CORPUS_NICKS];
+    const char *e = nicks[rng() % CORPUS_NICKS];
+
+    /* PRIVMSG dominates real traffic */
+    unsigned int t = rng() % 24;
+    if (t >= sizeof(templates) / sizeof(templates[0]))
+      t = 0;
+
+    snprintf(buf, sizeof(buf), templates[t], a, b, c, d, e);
+    lines[lines_count] = xstrdup(buf);
+  }
+}
+
+static void
+setup_parse(void)
+{
+  static const char *const commands[] =
+  {
+    "PRIVMSG", "NOTICE", "JOIN", "PART", "MODE", "TOPIC", "WHO", "PING", "PONG", "AWAY", NULL
+  };
+
+  setup_lines();
+
+  for (const char *const *cmd = commands; *cmd; ++cmd)
+  {
+    if (find_command(*cmd))
+      continue;
+
+    struct Message *msg = xcalloc(sizeof(*msg));
+    msg->cmd = *cmd;
+    msg->args_max = MAXPARA;
+
+    for (unsigned int i = 0; i < LAST_HANDLER_TYPE; ++i)
+      msg->handlers[i] = m_ignore;
+
+    mod_add_cmd(msg);
+  }
+}
+
+/* A local client whose writes all go to /dev/null */
+static struct Client *
+make_local(const char *name, bool server)
+{
+  struct Client *client = client_make(NULL);
+  int fd = open("/dev/null", O_WRONLY);
+
+  if (fd < 0 || fd >= hard_fdlimit)
+  {
+    perror("/dev/null");
+    exit(EXIT_FAILURE);
+  }
+
+  client->connection->fd = fd_open(fd, false, name);
+  dlinkDelete(&client->connection->lclient_node, &unknown_list);
+  strlcpy(client->name, name, sizeof(client->name));
+  strlcpy(client->username, "bench", sizeof(client->username));
+  intern_set(&client->host, "bench.example.net", HOSTLEN);
+  client->connection->registration = 0;
+  client->servptr = &me;
+
+  if (server)
+  {
+    SetServer(client);
+    client->handler = SERVER_HANDLER;
+  }
+  else
+  {
+    SetClient(client);
+    client->handler = CLIENT_HANDLER;
+  }
+
+  return client;
+}
+
+static void
+setup_fanout(void)
+{
+  char name[NICKLEN + 1];
+
+  if (fanout_channel)
+    return;
+
+  fanout_channel = channel_make("#fanout");
+
+  for (unsigned int i = 0; i < FANOUT_LOCAL; ++i)
+  {
+    snprintf(name, sizeof(name), "local%u", i);
+
+    struct Client *client = make_local(name, false);
+    snprintf(client->id, sizeof(client->id), "0BEA%05u", i);
+    add_user_to_channel(fanout_channel, client, 0, false);
+
+    if (fanout_sender == NULL)
+      fanout_sender = client;
+  }
+
+  for (unsigned int i = 0; i < FANOUT_LINKS; ++i)
+  {
+    snprintf(name, sizeof(name), "link%u.bench", i);
+
+    struct Client *link = make_local(name, true);
+    snprintf(link->id, sizeof(link->id), "%uLB", i);
+
+    for (unsigned int j = 0; j < FANOUT_REMOTE; ++j)
+    {
+      struct Client *client = client_make(link);
+
+      client->servptr = link;
+      SetClient(client);
+      snprintf(client->name, sizeof(client->name), "r%ux%u", i, j);
+      snprintf(client->id, sizeof(client->id), "%uLBA%05u", i, j);
+      add_user_to_channel(fanout_channel, client, 0, false);
+    }
+  }
+}
+
+/*
+ * A hub sized channel: 200000 remote members, none of them voiced, with
+ * hosts drawn from a smaller set the way cloaks and shared hosts repeat
+ */
+static void
+setup_scan(void)
+{
+  char name[NICKLEN + 1], host[HOSTLEN + 1];
+
+  if (scan_channel)
+    return;
+
+  setup_fanout();
+  scan_channel = channel_make("#scan");
+
+  for (unsigned int i = 0; i < SCAN_LINKS; ++i)
+  {
+    snprintf(name, sizeof(name), "scan%u.bench", i);
+
+    struct Client *link = make_local(name, true);
+    snprintf(link->id, sizeof(link->id), "%uS%c", i % 10, 'A' + i / 10);
+
+    for (unsigned int j = 0; j < SCAN_REMOTE; ++j)
+    {
+      struct Client *client = client_make(link);
+
+      client->servptr = link;
+      SetClient(client);
+      snprintf(client->name, sizeof(client->name), "s%ux%u", i, j);
+      snprintf(client->id, sizeof(client->id), "%sA%05u", link->id, j);
+      strlcpy(client->username, "bench", sizeof(client->username));
+      snprintf(host, sizeof(host), "user%u.cloak.example.net", rng() % SCAN_HOSTS);
+      intern_set(&client->host, host, HOSTLEN);
+      intern_set(&client->cold->realhost, host, HOSTLEN);
+      intern_set(&client->cold->sockhost, "0", HOSTIPLEN);
+      add_user_to_channel(scan_channel, client, 0, false);
+    }
+  }
+}
+
+
+/*
+ * Benchmarks
+ */
+
+static uintmax_t
+run_match_ban(uintmax_t *ns)
+{
+  const uintmax_t start = bench_time_ns();
+
+  for (unsigned int i = 0; i < 200; ++i)
+    for (unsigned int j = 0; j < CORPUS_BANS; ++j)
+      sink += match(bans[j], nuhs[i]);
+
+  *ns += bench_time_ns() - start;
+  return 200 * CORPUS_BANS;
+}
+
+static uintmax_t
+run_match_host(uintmax_t *ns)
+{
+  const uintmax_t start = bench_time_ns();
+
+  for (unsigned int i = 0; i < CORPUS_NICKS; ++i)
+    sink += match("*.cust1?.isp*.example.net", hosts[i]);
+
+  *ns += bench_time_ns() - start;
+  return CORPUS_NICKS;
+}
+
+static uintmax_t
+run_irccmp(uintmax_t *ns)
+{
+  const uintmax_t start = bench_time_ns();
+
+  for (unsigned int i = 0; i < CORPUS_NICKS; ++i)
+  {
+    sink += irccmp(nicks[i], nicks_upper[i]);  /* Equal, different case */
+    sink += irccmp(nicks[i], nicks[(i + 1) % CORPUS_NICKS]);
+  }
+
+  *ns += bench_time_ns() - start;
+  return CORPUS_NICKS * 2;
+}
+
+static uintmax_t
+run_strhash(uintmax_t *ns)
+{
+  const uintmax_t start = bench_time_ns();
+
+  for (unsigned int i = 0; i < CORPUS_NICKS; ++i)
+    sink += strhash(nicks[i]);
+
+  *ns += bench_time_ns() - start;
+  return CORPUS_NICKS;
+}
+
+static uintmax_t
+run_kline_lookup(uintmax_t *ns)
+{
+  const uintmax_t start = bench_time_ns();
+
+  for (unsigned int i = 0; i < CORPUS_LOOKUPS; ++i)
+    sink += find_conf_by_address(hosts[i % CORPUS_NICKS], &lookup_addr[i], CONF_KLINE,
+                                 nicks[i % CORPUS_NICKS], NULL, 1) != NULL;
+
+  *ns += bench_time_ns() - start;
+  return CORPUS_LOOKUPS;
+}
+
+static uintmax_t
+run_dline_lookup(uintmax_t *ns)
+{
+  const uintmax_t start = bench_time_ns();
+
+  for (unsigned int i = 0; i < CORPUS_LOOKUPS; ++i)
+    sink += find_dline_conf(&lookup_addr[i]) != NULL;
+
+  *ns += bench_time_ns() - start;
+  return CORPUS_LOOKUPS;
+}
+
+static uintmax_t
+run_patricia_lookup(uintmax_t *ns)
+{
+  const uintmax_t start = bench_time_ns();
+
+  for (unsigned int i = 0; i < CORPUS_LOOKUPS; ++i)
+  {
+    const bool v6 = lookup_addr[i].ss.ss_family == AF_INET6;
+
+    sink += patricia_try_search_best_addr(v6 ? dline_trie_v6 : dline_trie_v4,
+                                          (struct sockaddr *)&lookup_addr[i], v6 ? 128 : 32) != NULL;
+  }
+
+  *ns += bench_time_ns() - start;
+  return CORPUS_LOOKUPS;
+}
+
+static uintmax_t
+run_dbuf(uintmax_t *ns)
+{
+  struct dbuf_queue queue = { .pos = 0 };
+  const uintmax_t start = bench_time_ns();
+
+  for (unsigned int i = 0; i < lines_count; ++i)
+    dbuf_put(&queue, lines[i], strlen(lines[i]));
+
+  while (dbuf_length(&queue))
+    dbuf_delete(&queue, 100);
+
+  *ns += bench_time_ns() - start;
+  return lines_count;
+}
+
+static uintmax_t
+run_extract_one_line(uintmax_t *ns)
+{
+  struct dbuf_queue queue = { .pos = 0 };
+  char buf[IRCD_BUFSIZE];
+
+  for (unsigned int i = 0; i < lines_count; ++i)
+  {
+    dbuf_put(&queue, lines[i], strlen(lines[i]));
+    dbuf_put(&queue, "\r\n", 2);
+  }
+
+  const uintmax_t start = bench_time_ns();
+
+  while (dbuf_length(&queue))
+    sink += extract_one_line(&queue, buf);
+
+  *ns += bench_time_ns() - start;
+  return lines_count;
+}
+
+static uintmax_t
+run_parse(uintmax_t *ns)
+{
+  static struct Client *client;
+  char buf[IRCD_BUFSIZE];
+  uintmax_t spent = 0;
+
+  if (client == NULL)
+    client = make_local("parser", false);
+
+  for (unsigned int i = 0; i < lines_count; ++i)
+  {
+    const size_t len = strlen(lines[i]);
+
+    memcpy(buf, lines[i], len + 1);  /* parse() tokenizes in place */
+
+    const uintmax_t start = bench_time_ns();
+    parse(client, buf, buf + len);
+    spent += bench_time_ns() - start;
+  }
+
+  *ns += spent;
+  return lines_count;
+}
+
+static uintmax_t
+run_fanout(uintmax_t *ns)
+{
+  const uintmax_t start = bench_time_ns();
+
+  for (unsigned int i = 0; i < 100; ++i)
+  {
+    sendto_channel_butone(fanout_sender, fanout_sender, fanout_channel, 0, "PRIVMSG %s :%s",
+                          fanout_channel->name, lines[i % lines_count]);
+    send_queued_all();
+  }
+
+  *ns += bench_time_ns() - start;
+  return 100;
+}
+
+/* A message for voiced members only; every member is looked at, none is sent to */
+static uintmax_t
+run_scan(uintmax_t *ns)
+{
+  const uintmax_t start = bench_time_ns();
+
+  for (unsigned int i = 0; i < 10; ++i)
+    sendto_channel_butone(fanout_sender, fanout_sender, scan_channel, CHFL_VOICE, "PRIVMSG %s :%s",
+                          scan_channel->name, "scan");
+
+  *ns += bench_time_ns() - start;
+  return 10 * SCAN_LINKS * SCAN_REMOTE;
+}
+
+/* WHO on the fanout channel: one RPL_WHOREPLY per member to a single client */
+static uintmax_t
+run_who(uintmax_t *ns)
+{
+  const uintmax_t start = bench_time_ns();
+
+  for (unsigned int i = 0; i < fanout_channel->members.count; ++i)
+  {
+    show_who(fanout_sender, fanout_channel->members.entry[i].member->client, fanout_channel->name, "");
+
+    if (i % 100 == 99)
+      send_queued_all();
+  }
+
+  send_queued_all();
+
+  *ns += bench_time_ns() - start;
+  return fanout_channel->members.count;
+}
+
+static void
+setup_fanout_lines(void)
+{
+  setup_lines();
+  setup_fanout();
+}
+
+static const struct Bench bench_tab[] =
+{
+  { "match_ban",        setup_nicks,        run_match_ban        },
+  { "match_host",       setup_nicks,        run_match_host       },
+  { "irccmp",           setup_nicks,        run_irccmp           },
+  { "strhash",          setup_nicks,        run_strhash          },
+  { "kline_lookup",     setup_klines,       run_kline_lookup     },
+  { "dline_lookup",     setup_dlines,       run_dline_lookup     },
+  { "patricia_lookup",  setup_dlines,       run_patricia_lookup  },
+  { "dbuf_put_delete",  setup_lines,        run_dbuf             },
+  { "extract_one_line", setup_lines,        run_extract_one_line },
+  { "parse",            setup_parse,        run_parse            },
+  { "channel_fanout",   setup_fanout_lines, run_fanout           },
+  { "channel_scan",     setup_scan,         run_scan             },
+  { "who_reply",        setup_fanout,       run_who              },
+  { NULL, NULL, NULL }
+};
+
+/* Structure sizes, and what the benchmarks left allocated per subsystem */
+static void
+report_memory(void)
+{
+  static const struct
+  {
+    const char *name;
+    size_t size;
+  } sizes[] =
+  {
+    { "struct Client",     sizeof(struct Client)     },
+    { "struct ClientCold", sizeof(struct ClientCold) },
+    { "struct Connection", sizeof(struct Connection) },
+    { NULL, 0 }
+  };
+
+  if (opt_json == false)
+    printf("\n%-24s %12s %14s\n", "memory", "count", "bytes");
+
+  for (unsigned int i = 0; sizes[i].name; ++i)
+  {
+    if (opt_json)
+      printf("{\"sizeof\":\"%s\",\"bytes\":%zu}\n", sizes[i].name, sizes[i].size);
+    else
+      printf("%-24s %12s %14zu\n", sizes[i].name, "sizeof", sizes[i].size);
+  }
+
+  for (unsigned int tag = 0; tag < MEMORY_TAG_LAST; ++tag)
+  {
+    const struct MemoryStats *stats = memory_get_stats(tag);
+
+    if (stats->count == 0)
+      continue;
+
+    if (opt_json)
+      printf("{\"memory\":\"%s\",\"count\":%zu,\"bytes\":%zu}\n", stats->name, stats->count, stats->bytes);
+    else
+      printf("%-24s %12zu %14zu\n", stats->name, stats->count, stats->bytes);
+  }
+}
+
+static bool
+bench_selected(const char *name)
+{
+  if (opt_only == NULL)
+    return true;
+
+  const size_t len = strlen(name);
+
+  for (const char *p = opt_only; (p = strstr(p, name)); p += len)
+    if ((p == opt_only || p[-1] == ',') && (p[len] == '\0' || p[len] == ','))
+      return true;
+
+  return false;
+}
+
+static void
+usage(void)
+{
+  fprintf(stderr, "ircd-microbench [-b benchmarks] [-t milliseconds] [-f lines] [-s seed] [-j]\n"
+                  "-b benchmarks   comma separated list of benchmarks to run\n"
+                  "-t milliseconds time spent on each benchmark [%ju]\n"
+                  "-f lines        file of captured protocol lines for the line benchmarks\n"
+                  "-s seed         seed of the generated corpora\n"
+                  "-j              print one JSON object per benchmark\n"
+                  "Benchmarks:", opt_time);
+
+  for (const struct Bench *bench = bench_tab; bench->name; ++bench)
+    fprintf(stderr, " %s", bench->name);
+
+  fprintf(stderr, "\n");
+  exit(EXIT_FAILURE);
+}
+
+int
+main(int argc, char *argv[])
+{
+  rng_state = 0x9e3779b97f4a7c15ULL;
+
+  for (int c = 0; (c = getopt(argc, argv, "b:t:f:s:jh?")) != -1; )
+  {
+    switch (c)
+    {
+      case 'b': opt_only = optarg; break;
+      case 't': opt_time = strtoumax(optarg, NULL, 10); break;
+      case 'f': opt_lines = optarg; break;
+      case 's': rng_state = strtoull(optarg, NULL, 0) | 1; break;
+      case 'j': opt_json = true; break;
+      default: usage();
+    }
+  }
+
+  myargv = argv;
+  event_time_set();
+
+  /* Every fan-out member holds a descriptor of its own */
+  struct rlimit rlim;
+  if (getrlimit(RLIMIT_NOFILE, &rlim) == 0)
+  {
+    rlim.rlim_cur = IRCD_MIN(rlim.rlim_max, 0xFFFF);
+    if (setrlimit(RLIMIT_NOFILE, &rlim) == 0)
+      hard_fdlimit = rlim.rlim_cur;
+  }
+
+  fdlist_init();
+  class_init();  /* send_message() looks up the default sendq */
+
+  strlcpy(me.name, "bench.local", sizeof(me.name));
+  strlcpy(me.id, "0BE", sizeof(me.id));
+  me.from = me.servptr = &me;
+  me.host = intern_get("", 0);
+  me.cold->realhost = intern_get("", 0);
+  me.cold->sockhost = intern_get("", 0);
+  SetMe(&me);
+
+  if (opt_json == false)
+    printf("%-18s %12s %10s %12s\n", "benchmark", "ops", "ns/op", "ops/s");
+
+  for (const struct Bench *bench = bench_tab; bench->name; ++bench)
+  {
+    uintmax_t ns = 0, ops = 0;
+
+    if (bench_selected(bench->name) == false)
+      continue;
+
+    bench->setup();
+    bench->run(&ns);  /* Warm up the caches */
+
+    for (ns = 0; ns < opt_time * 1000000; )
+      ops += bench->run(&ns);
+
+    const double per_op = (double)ns / ops;
+
+    if (opt_json)
+      printf("{\"benchmark\":\"%s\",\"ops\":%ju,\"ns_per_op\":%.2f,\"ops_per_sec\":%.0f}\n",
+             bench->name, ops, per_op, 1e9 / per_op);
+    else
+      printf("%-18s %12ju %10.2f %12.0f\n", bench->name, ops, per_op, 1e9 / per_op);
+
+    fflush(stdout);
+  }
+
+  report_memory();
+  return 0;
+}
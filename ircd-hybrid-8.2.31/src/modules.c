@@ -45,6 +45,11 @@ static dlink_list modules_list;
 static dlink_list modules_path;
 static dlink_list modules_conf;
 
+/** Directory the core modules are loaded from; may be changed with -modulepath */
+const char *module_core_path = MODPATH;
+/** Directory whose modules are all loaded at startup; may be changed with -automodulepath */
+const char *module_auto_path = AUTOMODPATH;
+
 static const char *const unknown_ver = "<unknown>";
 static const char *const core_module_table[] =
 {
@@ -312,10 +317,10 @@ load_all_modules(bool warn)
   struct dirent *ldirent = NULL;
   char module_fq_name[HYB_PATH_MAX + 1];
 
-  if ((system_module_dir = opendir(AUTOMODPATH)) == NULL)
+  if ((system_module_dir = opendir(module_auto_path)) == NULL)
   {
     ilog(LOG_TYPE_IRCD, "Could not load modules from %s: %s",
-         AUTOMODPATH, strerror(errno));
+         module_auto_path, strerror(errno));
     return;
   }
 
@@ -324,7 +329,7 @@ load_all_modules(bool warn)
     if (modules_valid_suffix(ldirent->d_name))
     {
        snprintf(module_fq_name, sizeof(module_fq_name), "%s/%s",
-                AUTOMODPATH, ldirent->d_name);
+                module_auto_path, ldirent->d_name);
        load_a_module(module_fq_name, warn);
     }
   }
@@ -365,8 +370,8 @@ load_core_modules(bool warn)
 
   for (unsigned int i = 0; core_module_table[i]; ++i)
   {
-    snprintf(module_name, sizeof(module_name), "%s%s",
-             MODPATH, core_module_table[i]);
+    snprintf(module_name, sizeof(module_name), "%s/%s",
+             module_core_path, core_module_table[i]);
 
     if (load_a_module(module_name, warn) == false)
     {
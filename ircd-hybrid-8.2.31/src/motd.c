@@ -99,8 +99,6 @@ motd_cache(struct Motd *motd)
 {
   struct stat sb;
   char line[MOTD_LINESIZE + 2];  /* +2 for \r\n */
-  char *tmp = NULL;
-  unsigned int i = 0;
   dlink_node *node;
 
   assert(motd);
@@ -139,31 +137,30 @@ motd_cache(struct Motd *motd)
     return 0;
   }
 
-  /* Ok, allocate a structure; we'll realloc later to trim memory */
-  struct MotdCache *cache = xcalloc(sizeof(*cache) + (MOTD_LINESIZE * MOTD_MAXLINES));
+  struct MotdCache *cache = xcalloc(sizeof(*cache));
   cache->ref = 1;
   cache->path = xstrdup(motd->path);
   cache->maxcount = motd->maxcount;
   cache->modtime = sb.st_mtime;  /* Store modtime */
 
+  reply_add(&cache->reply, RPL_MOTDSTART, me.name);
+
   while (cache->count < cache->maxcount && fgets(line, sizeof(line), file))
   {
-    /* Copy over line, stopping when we overflow or hit line end */
-    for (tmp = line, i = 0; i < (MOTD_LINESIZE - 1) && *tmp && *tmp != '\r' && *tmp != '\n'; ++tmp, ++i)
-      cache->motd[cache->count][i] = *tmp;
-    cache->motd[cache->count][i] = '\0';
+    /* Strip line end and truncate overly long lines */
+    line[MOTD_LINESIZE - 1] = '\0';
+    line[strcspn(line, "\r\n")] = '\0';
 
+    reply_add(&cache->reply, RPL_MOTD, line);
     cache->count++;
   }
 
   fclose(file);  /* Close the file */
 
-  /* Trim memory usage a little */
-  motd->cache = xcalloc(sizeof(*motd->cache) + (MOTD_LINESIZE * cache->count));
-  memcpy(motd->cache, cache, sizeof(*motd->cache) + (MOTD_LINESIZE * cache->count));
-  xfree(cache);
+  reply_add(&cache->reply, RPL_ENDOFMOTD);
 
   /* Now link it in */
+  motd->cache = cache;
   dlinkAdd(motd->cache, &motd->cache->node, &MotdList.cachelist);
 
   return motd->cache;
@@ -187,8 +184,9 @@ motd_decache(struct Motd *motd)
   if (--cache->ref == 0)  /* Reduce reference count */
   {
     dlinkDelete(&cache->node, &MotdList.cachelist);
+    reply_clear(&cache->reply);
     xfree(cache->path);  /* Free path info */
-    xfree(cache);  /* Very simple for a reason */
+    xfree(cache);
   }
 }
 
@@ -242,8 +240,8 @@ motd_lookup(const struct Client *client)
         break;
       }
       case MOTD_HOSTMASK:
-        if (match(motd->mask, client->realhost) == 0 ||
-            match(motd->mask, client->sockhost) == 0 || match(motd->mask, client->host) == 0)
+        if (match(motd->mask, client->cold->realhost) == 0 ||
+            match(motd->mask, client->cold->sockhost) == 0 || match(motd->mask, client->host) == 0)
           return motd;
         break;
       case MOTD_IPMASKV4:
@@ -278,12 +276,7 @@ motd_forward(struct Client *client, const struct MotdCache *cache)
   }
 
   /* Send the motd */
-  sendto_one_numeric(client, &me, RPL_MOTDSTART, me.name);
-
-  for (unsigned int i = 0; i < cache->count; ++i)
-    sendto_one_numeric(client, &me, RPL_MOTD, cache->motd[i]);
-
-  sendto_one_numeric(client, &me, RPL_ENDOFMOTD);
+  sendto_one_reply(client, &cache->reply);
 }
 
 /*! \brief Find the MOTD for a client and send it.
@@ -450,7 +443,8 @@ motd_memory_count(struct Client *client)
     const struct MotdCache *cache = node->data;
 
     ++mtc;
-    mtcm += sizeof(struct MotdCache) + (MOTD_LINESIZE * (cache->count - 1));
+    mtcm += sizeof(struct MotdCache) + cache->reply.len +
+            (sizeof(struct ReplyLine) + 1) * dlink_list_length(&cache->reply.lines);
   }
 
   sendto_one_numeric(client, &me, RPL_STATSDEBUG | SND_EXPLICIT,
@@ -49,7 +49,7 @@ static const char *const replies[] =
   /* 208 */  [RPL_TRACENEWTYPE] = "<newtype> 0 %s",
   /* 209 */  [RPL_TRACECLASS] = "Class %s %u",
   /* 211 */  [RPL_STATSLINKINFO] = "%s %u %u %ju %u %ju :%ju %ju %s",
-  /* 212 */  [RPL_STATSCOMMANDS] = "%s %u %ju :%u",
+  /* 212 */  [RPL_STATSCOMMANDS] = "%s %u %ju :%u %ju",
   /* 213 */  [RPL_STATSCLINE] = "%c %s %s %s %u %s",
   /* 215 */  [RPL_STATSILINE] = "%c %s * %s@%s %u %s",
   /* 216 */  [RPL_STATSKLINE] = "%c %s * %s :%s",
@@ -120,7 +120,7 @@ static const char *const replies[] =
   /* 349 */  [RPL_ENDOFEXCEPTLIST] = "%s :End of Channel Exception List",
   /* 351 */  [RPL_VERSION] = "%s(%s). %s :%s",
   /* 352 */  [RPL_WHOREPLY] = "%s %s %s %s %s %s :%u %s",
-  /* 353 */  [RPL_NAMREPLY] = ":%s 353 %s %s %s :",
+  /* 353 */  [RPL_NAMREPLY] = "%s %s :%s",
   /* 362 */  [RPL_CLOSING] = "%s :Closed. Status = %u",
   /* 363 */  [RPL_CLOSEEND] = "%u: Connections closed",
   /* 364 */  [RPL_LINKS] = "%s %s :%u %s",
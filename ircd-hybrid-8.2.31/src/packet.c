@@ -78,7 +78,7 @@ client_dopacket(struct Client *client, char *buffer, unsigned int length)
  * output       - length of <buffer>
  * side effects - one line is copied and removed from the dbuf
  */
-static size_t
+size_t
 extract_one_line(struct dbuf_queue *qptr, char *buffer)
 {
   size_t line_bytes = 0, eol_bytes = 0;
@@ -133,7 +133,7 @@ out:
 /*
  * parse_client_queued - parse client queued messages
  */
-static void
+void
 parse_client_queued(struct Client *client)
 {
   if (IsUnknown(client))
@@ -198,6 +198,14 @@ parse_client_queued(struct Client *client)
       if (IsDefunct(client))
         break;
 
+      /*
+       * Leave the rest in the recvq while a NAMES or WHO reply is still
+       * being sent, so that nothing we reply with overtakes it.  The
+       * parsing is continued by channel_stream_run_all() once it is done.
+       */
+      if (client->connection->channel_streams.head)
+        break;
+
       /*
        * This flood protection works as follows:
        *
@@ -339,6 +347,15 @@ read_packet(fde_t *F, void *data)
     if (IsDefunct(client))
       return;
 
+    /*
+     * The rest of the input is held back while a NAMES or WHO reply is
+     * being sent, see parse_client_queued().  Stop reading until
+     * channel_stream_run_all() is done with it, rather than piling more
+     * into the recvq and counting it as a flood.
+     */
+    if (client->connection->channel_streams.head)
+      return;
+
     /* Check to make sure we're not flooding */
     if (!(IsServer(client) || IsHandshake(client) || IsConnecting(client)) &&
         (dbuf_length(&client->connection->buf_recvq) >
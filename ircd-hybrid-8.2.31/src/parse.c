@@ -40,61 +40,200 @@
 #include "user.h"
 #include "server.h"
 #include "packet.h"
+#include "event.h"
 
 
 /*
- * (based on orabidoo's parser code)
+ * Commands are looked up through a minimal perfect hash which is
+ * compiled from the list of registered commands whenever a command
+ * is added or removed (hash and displace).
  *
- * This has always just been a trie. Look at volume III of Knuth ACP
- *
- *
- * ok, you start out with an array of pointers, each one corresponds
- * to a letter at the current position in the command being examined.
- *
- * so roughly you have this for matching 'trie' or 'tie'
- *
- * 't' points -> [MessageTree *] 'r' -> [MessageTree *] -> 'i'
- *   -> [MessageTree *] -> [MessageTree *] -> 'e' and matches
- *
- *                               'i' -> [MessageTree *] -> 'e' and matches
- *
- * BUGS (Limitations!)
- *
- * I designed this trie to parse ircd commands. Hence it currently
- * casefolds. This is trivial to fix by increasing MAXPTRLEN.
- * This trie also "folds" '{' etc. down. This means, the input to this
- * trie must be alpha tokens only. This again, is a limitation that
- * can be overcome by increasing MAXPTRLEN to include upper/lower case
- * at the expense of more memory. At the extreme end, you could make
- * MAXPTRLEN 128.
- *
- * This is also not a patricia trie. On short ircd tokens, this is
- * not likely going to matter.
+ * While the command token is being split off the line, two FNV-1a
+ * hashes of the casefolded command are computed in the same pass.
+ * The first one selects a bucket, and the displacement stored for that
+ * bucket is mixed into the second one to select the slot in the
+ * command table. Displacements are chosen at build time such that no
+ * two commands share a slot, so a lookup is a single table probe
+ * followed by one string compare.
+ */
+enum { MSG_HASH_DISPLACE_MAX = 0xFFFF };  /* Largest displacement tried per bucket */
+
+static struct
+{
+  dlink_list list;  /* All registered commands, sorted by name */
+  struct Message **table;  /* Command table, indexed by slot */
+  uint16_t *displace;  /* Displacement of each bucket */
+  unsigned int table_mask;
+  unsigned int bucket_mask;
+} msg_hash;
+
+static inline void
+msg_hash_step(uint32_t *h1, uint32_t *h2, unsigned char c)
+{
+  c = ToUpper(c);
+  *h1 = (*h1 ^ c) * 16777619;
+  *h2 = (*h2 ^ c) * 16777619;
+}
+
+static inline void
+msg_hash_init(uint32_t *h1, uint32_t *h2)
+{
+  *h1 = 2166136261U;
+  *h2 = 0x9747B28CU;
+}
+
+static inline uint32_t
+msg_hash_slot(uint32_t h2, unsigned int displace)
+{
+  uint32_t h = h2 + displace * 0x9E3779B9U;
+
+  h ^= h >> 16;
+  h *= 0x85EBCA6BU;
+  h ^= h >> 13;
+  h *= 0xC2B2AE35U;
+  h ^= h >> 16;
+  return h;
+}
+
+static void
+msg_hash_string(const char *cmd, uint32_t *h1, uint32_t *h2)
+{
+  msg_hash_init(h1, h2);
+
+  while (*cmd)
+    msg_hash_step(h1, h2, *cmd++);
+}
+
+/* msg_hash_lookup()
  *
- * Diane Bruce (Dianora), June 6 2003
+ * inputs	- command name, not necessarily NUL terminated
+ *		- length of command name
+ *		- hashes of the command name as computed by msg_hash_step()
+ * output	- pointer to struct Message if found, NULL if not
+ * side effects	- none
  */
+static struct Message *
+msg_hash_lookup(const char *cmd, size_t len, uint32_t h1, uint32_t h2)
+{
+  if (msg_hash.table == NULL)
+    return NULL;
 
-/*
- * Must be a power of 2, and larger than 26 [a-z]|[A-Z]. It's used to allocate
- * the set of pointers at each node of the tree.
- * There are MAXPTRLEN pointers at each node. Obviously, there have to be more
- * pointers than ASCII letters. 32 is a nice number since there is then no need
- * to shift 'A'/'a' to base 0 index, at the expense of a few never used
- * pointers.
- * For a small parser like this, this is a good compromise and does
- * make it somewhat faster. - Dianora
+  unsigned int displace = msg_hash.displace[h1 & msg_hash.bucket_mask];
+  struct Message *msg = msg_hash.table[msg_hash_slot(h2, displace) & msg_hash.table_mask];
+
+  if (msg && msg->length == len && strncasecmp(msg->cmd, cmd, len) == 0)
+    return msg;
+  return NULL;
+}
+
+/* msg_hash_build()
+ *
+ * inputs	- number of slots of the command table
+ *		- number of buckets
+ * output	- true if a displacement was found for every bucket
+ * side effects	- builds the command table
  */
-enum { MAXPTRLEN = 32 };
+static bool
+msg_hash_build(unsigned int table_size, unsigned int bucket_size)
+{
+  const unsigned int count = dlink_list_length(&msg_hash.list);
+  uint32_t *h1 = xcalloc(count * sizeof(*h1));
+  uint32_t *h2 = xcalloc(count * sizeof(*h2));
+  struct Message **msgs = xcalloc(count * sizeof(*msgs));
+  unsigned int *bucket_count = xcalloc(bucket_size * sizeof(*bucket_count));
+  unsigned int *slots = xcalloc(count * sizeof(*slots));
+  unsigned int max_count = 0, i = 0;
+  bool success = true;
+  dlink_node *node;
+
+  xfree(msg_hash.table);
+  xfree(msg_hash.displace);
+  msg_hash.table = xcalloc(table_size * sizeof(*msg_hash.table));
+  msg_hash.displace = xcalloc(bucket_size * sizeof(*msg_hash.displace));
+  msg_hash.table_mask = table_size - 1;
+  msg_hash.bucket_mask = bucket_size - 1;
+
+  DLINK_FOREACH(node, msg_hash.list.head)
+  {
+    msgs[i] = node->data;
+    msg_hash_string(msgs[i]->cmd, &h1[i], &h2[i]);
+
+    unsigned int n = ++bucket_count[h1[i] & msg_hash.bucket_mask];
+    if (n > max_count)
+      max_count = n;
+    ++i;
+  }
+
+  /* Place the largest buckets first while the table is still mostly empty */
+  for (unsigned int size = max_count; size && success; --size)
+  {
+    for (unsigned int bucket = 0; bucket < bucket_size && success; ++bucket)
+    {
+      if (bucket_count[bucket] != size)
+        continue;
+
+      unsigned int displace = 0;
+      for (; displace <= MSG_HASH_DISPLACE_MAX; ++displace)
+      {
+        unsigned int placed = 0;
+
+        for (i = 0; i < count; ++i)
+        {
+          if ((h1[i] & msg_hash.bucket_mask) != bucket)
+            continue;
+
+          unsigned int slot = msg_hash_slot(h2[i], displace) & msg_hash.table_mask;
+          if (msg_hash.table[slot])
+            break;
 
+          msg_hash.table[slot] = msgs[i];
+          slots[placed++] = slot;
+        }
 
-static struct MessageTree
+        if (placed == size)
+          break;
+
+        while (placed)  /* Collision; undo and try the next displacement */
+          msg_hash.table[slots[--placed]] = NULL;
+      }
+
+      if (displace > MSG_HASH_DISPLACE_MAX)
+        success = false;
+      else
+        msg_hash.displace[bucket] = displace;
+    }
+  }
+
+  xfree(h1);
+  xfree(h2);
+  xfree(msgs);
+  xfree(bucket_count);
+  xfree(slots);
+
+  return success;
+}
+
+/* msg_hash_rebuild()
+ *
+ * inputs	- none
+ * output	- none
+ * side effects	- recompiles the command table from the list of commands
+ */
+static void
+msg_hash_rebuild(void)
 {
-  int links; /* Count of all pointers (including msg) at this node
-              * used as reference count for deletion of _this_ node.
-              */
-  struct Message *msg;
-  struct MessageTree *pointers[MAXPTRLEN];
-} msg_tree;
+  const unsigned int count = dlink_list_length(&msg_hash.list);
+  unsigned int table_size = 16;
+  unsigned int bucket_size = 4;
+
+  while (table_size < count * 2)
+    table_size <<= 1;
+  while (bucket_size < count / 2)
+    bucket_size <<= 1;
+
+  while (msg_hash_build(table_size, bucket_size) == false)
+    table_size <<= 1;
+}
 
 
 /* remove_unknown()
@@ -231,7 +370,11 @@ parse_handle_command(struct Message *message, struct Client *source,
   if (i < message->args_min)
     sendto_one_numeric(source, &me, ERR_NEEDMOREPARAMS, message->cmd);
   else
+  {
+    const uintmax_t start = event_time_ns();
     message->handlers[source->from->handler](source, i, para);
+    perf_add(&message->latency, event_time_ns() - start);
+  }
 }
 
 /*
@@ -340,10 +483,20 @@ parse(struct Client *client, char *pbuffer, char *bufend)
   }
   else
   {
-    if ((s = strchr(ch, ' ')))
+    uint32_t h1, h2;
+
+    /* Split off the command and hash it in the same pass */
+    msg_hash_init(&h1, &h2);
+    for (s = ch; *s && *s != ' '; ++s)
+      msg_hash_step(&h1, &h2, *s);
+
+    const size_t cmdlen = s - ch;
+    if (*s)
       *s++ = '\0';
+    else
+      s = NULL;
 
-    if ((message = find_command(ch)) == NULL)
+    if ((message = msg_hash_lookup(ch, cmdlen, h1, h2)) == NULL)
     {
       /*
        * Note: Give error message *only* to recognized
@@ -429,130 +582,6 @@ parse(struct Client *client, char *pbuffer, char *bufend)
     parse_handle_numeric(numeric, from, parc, para);
 }
 
-/* add_msg_element()
- *
- * inputs	- pointer to MessageTree
- *		- pointer to Message to add for given command
- *		- pointer to current portion of command being added
- * output	- NONE
- * side effects	- recursively build the Message Tree ;-)
- */
-/*
- * How this works.
- *
- * The code first checks to see if its reached the end of the command
- * If so, that struct MessageTree has a msg pointer updated and the links
- * count incremented, since a msg pointer is a reference.
- * Then the code descends recursively, building the trie.
- * If a pointer index inside the struct MessageTree is NULL a new
- * child struct MessageTree has to be allocated.
- * The links (reference count) is incremented as they are created
- * in the parent.
- */
-static void
-add_msg_element(struct MessageTree *mtree_p, struct Message *msg_p,
-                const char *cmd)
-{
-  if (*cmd == '\0')
-  {
-    mtree_p->msg = msg_p;
-    mtree_p->links++;  /* Have msg pointer, so up ref count */
-  }
-  else
-  {
-    /*
-     * *cmd & (MAXPTRLEN-1)
-     * convert the char pointed to at *cmd from ASCII to an integer
-     * between 0 and MAXPTRLEN.
-     * Thus 'A' -> 0x1 'B' -> 0x2 'c' -> 0x3 etc.
-     */
-    struct MessageTree *ntree_p = mtree_p->pointers[*cmd & (MAXPTRLEN - 1)];
-    if (ntree_p == NULL)
-    {
-      ntree_p = xcalloc(sizeof(*ntree_p));
-      mtree_p->pointers[*cmd & (MAXPTRLEN - 1)] = ntree_p;
-
-      mtree_p->links++;  /* Have new pointer, so up ref count */
-    }
-
-    add_msg_element(ntree_p, msg_p, cmd + 1);
-  }
-}
-
-/* del_msg_element()
- *
- * inputs	- Pointer to MessageTree to delete from
- *		- pointer to command name to delete
- * output	- NONE
- * side effects	- recursively deletes a token from the Message Tree ;-)
- */
-/*
- * How this works.
- *
- * Well, first off, the code recursively descends into the trie
- * until it finds the terminating letter of the command being removed.
- * Once it has done that, it marks the msg pointer as NULL then
- * reduces the reference count on that allocated struct MessageTree
- * since a command counts as a reference.
- *
- * Then it pops up the recurse stack. As it comes back up the recurse
- * The code checks to see if the child now has no pointers or msg
- * i.e. the links count has gone to zero. If it's no longer used, the
- * child struct MessageTree can be deleted. The parent reference
- * to this child is then removed and the parents link count goes down.
- * Thus, we continue to go back up removing all unused MessageTree(s)
- */
-static void
-del_msg_element(struct MessageTree *mtree_p, const char *cmd)
-{
-  /*
-   * In case this is called for a nonexistent command
-   * check that there is a msg pointer here, else links-- goes -ve
-   * -db
-   */
-  if (*cmd == '\0' && mtree_p->msg)
-  {
-    mtree_p->msg = NULL;
-    mtree_p->links--;
-  }
-  else
-  {
-    struct MessageTree *ntree_p = mtree_p->pointers[*cmd & (MAXPTRLEN - 1)];
-    if (ntree_p)
-    {
-      del_msg_element(ntree_p, cmd + 1);
-
-      if (ntree_p->links == 0)
-      {
-        mtree_p->pointers[*cmd & (MAXPTRLEN - 1)] = NULL;
-        mtree_p->links--;
-        xfree(ntree_p);
-      }
-    }
-  }
-}
-
-/* msg_tree_parse()
- *
- * inputs	- Pointer to command to find
- *		- Pointer to MessageTree root
- * output	- Find given command returning Message * if found NULL if not
- * side effects	- none
- */
-static struct Message *
-msg_tree_parse(const char *cmd)
-{
-  struct MessageTree *mtree = &msg_tree;
-
-  assert(!EmptyString(cmd));
-
-  while (IsAlpha(*cmd) && (mtree = mtree->pointers[*cmd & (MAXPTRLEN - 1)]))
-    if (*++cmd == '\0')
-      return mtree->msg;
-
-  return NULL;
-}
-
 /* mod_add_cmd()
  *
  * inputs	- pointer to struct Message
@@ -562,12 +591,31 @@ msg_tree_parse(const char *cmd)
 void
 mod_add_cmd(struct Message *msg)
 {
+  dlink_node *node;
+
   assert(msg);
   assert(msg->cmd);
 
   /* Command already added? */
-  if (msg_tree_parse(msg->cmd) == NULL)
-    add_msg_element(&msg_tree, msg, msg->cmd);
+  if (find_command(msg->cmd))
+    return;
+
+  msg->length = strlen(msg->cmd);
+
+  DLINK_FOREACH(node, msg_hash.list.head)
+  {
+    const struct Message *msg2 = node->data;
+
+    if (strcmp(msg2->cmd, msg->cmd) > 0)
+      break;
+  }
+
+  if (node)
+    dlinkAddBefore(node, msg, &msg->node, &msg_hash.list);
+  else
+    dlinkAddTail(msg, &msg->node, &msg_hash.list);
+
+  msg_hash_rebuild();
 }
 
 /* mod_del_cmd()
@@ -582,8 +630,12 @@ mod_del_cmd(struct Message *msg)
   assert(msg);
   assert(msg->cmd);
 
-  if (msg_tree_parse(msg->cmd))
-    del_msg_element(&msg_tree, msg->cmd);
+  struct Message *msg2 = find_command(msg->cmd);
+  if (msg2 == NULL)
+    return;
+
+  dlinkDelete(&msg2->node, &msg_hash.list);
+  msg_hash_rebuild();
 }
 
 /* find_command()
@@ -595,21 +647,24 @@ mod_del_cmd(struct Message *msg)
 struct Message *
 find_command(const char *cmd)
 {
-  return msg_tree_parse(cmd);
+  uint32_t h1, h2;
+
+  assert(!EmptyString(cmd));
+
+  msg_hash_string(cmd, &h1, &h2);
+  return msg_hash_lookup(cmd, strlen(cmd), h1, h2);
 }
 
-static void
-recurse_report_messages(struct Client *source, const struct MessageTree *mtree)
+/* command_get_list()
+ *
+ * inputs	- none
+ * output	- list of all registered commands, sorted by name
+ * side effects	- none
+ */
+const dlink_list *
+command_get_list(void)
 {
-  if (mtree->msg)
-    sendto_one_numeric(source, &me, RPL_STATSCOMMANDS,
-                       mtree->msg->cmd,
-                       mtree->msg->count, mtree->msg->bytes,
-                       mtree->msg->rcount);
-
-  for (unsigned int i = 0; i < MAXPTRLEN; ++i)
-    if (mtree->pointers[i])
-      recurse_report_messages(source, mtree->pointers[i]);
+  return &msg_hash.list;
 }
 
 /* report_messages()
@@ -621,11 +676,16 @@ recurse_report_messages(struct Client *source, const struct MessageTree *mtree)
 void
 report_messages(struct Client *source)
 {
-  const struct MessageTree *const mtree = &msg_tree;
+  dlink_node *node;
 
-  for (unsigned int i = 0; i < MAXPTRLEN; ++i)
-    if (mtree->pointers[i])
-      recurse_report_messages(source, mtree->pointers[i]);
+  DLINK_FOREACH(node, msg_hash.list.head)
+  {
+    const struct Message *msg = node->data;
+
+    sendto_one_numeric(source, &me, RPL_STATSCOMMANDS,
+                       msg->cmd, msg->count, msg->bytes,
+                       msg->rcount, msg->latency.total / 1000);
+  }
 }
 
 /* m_not_oper()
@@ -0,0 +1,257 @@
+/*
+ *  ircd-hybrid: an advanced, lightweight Internet Relay Chat Daemon (ircd)
+ *
+ *  Copyright (c) 1997-2020 ircd-hybrid development team
+ *
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301
+ *  USA
+ */
+
+/*! \file perf.c
+ * \brief Low overhead instrumentation of hot code paths.
+ * \version $Id$
+ */
+
+#include "stdinc.h"
+#include "list.h"
+#include "perf.h"
+#include "client.h"
+#include "conf.h"
+#include "event.h"
+#include "ircd.h"
+#include "irc_string.h"
+#include "log.h"
+#include "numeric.h"
+#include "parse.h"
+#include "send.h"
+
+
+struct PerfStatistics PerfStats;
+
+static void perf_export(void *);
+
+static struct event event_perf_export =
+{
+  .name = "perf_export",
+  .handler = perf_export
+};
+
+
+/*! \brief Adds a sample to a histogram.
+ * \param hist  Histogram to add the sample to
+ * \param value Sample; nanoseconds for timings
+ */
+void
+perf_add(struct PerfHistogram *hist, uintmax_t value)
+{
+  unsigned int n = 0;
+
+  for (uintmax_t v = value; v && n < PERF_BUCKETS - 1; v >>= 1)
+    ++n;
+
+  ++hist->bucket[n];
+  ++hist->count;
+  hist->total += value;
+
+  if (hist->max < value)
+    hist->max = value;
+}
+
+/*! \brief Records the time the poller spent waiting for I/O.
+ * \param value Nanoseconds spent waiting
+ */
+void
+perf_wait(uintmax_t value)
+{
+  perf_add(&PerfStats.wait, value);
+  PerfStats.wait_last = value;
+}
+
+/*! \brief Estimates a percentile of a histogram.
+ * \param hist Histogram
+ * \param pct  Percentile, 0-100
+ * \return Upper bound of the bucket containing the percentile
+ */
+uintmax_t
+perf_percentile(const struct PerfHistogram *hist, unsigned int pct)
+{
+  const uintmax_t rank = (hist->count * pct + 99) / 100;
+  uintmax_t seen = 0;
+
+  for (unsigned int n = 0; n < PERF_BUCKETS - 1; ++n)
+  {
+    seen += hist->bucket[n];
+
+    if (seen >= rank)
+    {
+      uintmax_t bound = n ? (UINTMAX_C(1) << n) - 1 : 0;
+      return bound < hist->max ? bound : hist->max;
+    }
+  }
+
+  return hist->max;
+}
+
+static void
+perf_report_line(struct Client *source, const char *type, const char *name,
+                 const struct PerfHistogram *hist, unsigned int div)
+{
+  if (hist->count == 0)
+    return;
+
+  sendto_one_numeric(source, &me, RPL_STATSDEBUG | SND_EXPLICIT,
+                     "j :%-7s %-20s %10ju %8ju %8ju %8ju %8ju", type, name, hist->count,
+                     hist->total / hist->count / div, perf_percentile(hist, 50) / div,
+                     perf_percentile(hist, 99) / div, hist->max / div);
+}
+
+/*! \brief Sends the instrumentation counters to a client (STATS j).
+ * \param source Client requesting the report
+ */
+void
+perf_report(struct Client *source)
+{
+  dlink_node *node;
+
+  sendto_one_numeric(source, &me, RPL_STATSDEBUG | SND_EXPLICIT,
+                     "j :Type    Name                      Count      Avg      p50      p99      Max");
+  perf_report_line(source, "loop", "busy (usec)", &PerfStats.loop, 1000);
+  perf_report_line(source, "loop", "select (usec)", &PerfStats.select, 1000);
+  perf_report_line(source, "loop", "wait (usec)", &PerfStats.wait, 1000);
+  perf_report_line(source, "fanout", "channel", &PerfStats.fanout, 1);
+  perf_report_line(source, "split", "netsplit (usec)", &PerfStats.split, 1000);
+
+  DLINK_FOREACH(node, event_get_list()->head)
+  {
+    const struct event *ev = node->data;
+    perf_report_line(source, "event", ev->name, &ev->runtime, 1000);
+  }
+
+  DLINK_FOREACH(node, command_get_list()->head)
+  {
+    const struct Message *msg = node->data;
+    perf_report_line(source, "command", msg->cmd, &msg->latency, 1000);
+  }
+}
+
+static void
+perf_export_line(FILE *file, const char *type, const char *name,
+                 const struct PerfHistogram *hist)
+{
+  unsigned int last = PERF_BUCKETS;
+
+  while (last && hist->bucket[last - 1] == 0)
+    --last;
+
+  fprintf(file, "%s %s count=%ju total=%ju max=%ju p50=%ju p90=%ju p99=%ju buckets=",
+          type, name, hist->count, hist->total, hist->max, perf_percentile(hist, 50),
+          perf_percentile(hist, 90), perf_percentile(hist, 99));
+
+  for (unsigned int n = 0; n < last; ++n)
+    fprintf(file, "%s%ju", n ? "," : "", hist->bucket[n]);
+  fputc('\n', file);
+}
+
+/*! \brief Writes the instrumentation counters to general::perf_export_file.
+ *
+ * One record per line, as "<type> <name> key=value...". Timings are in
+ * nanoseconds; bucket n counts the samples below 2^n. If the path is a
+ * unix domain socket, the report is sent to it as a single datagram
+ * instead.
+ */
+static void
+perf_export(void *unused)
+{
+  char *buf = NULL;
+  size_t len = 0;
+  char tmppath[HYB_PATH_MAX + 1];
+  dlink_node *node;
+  struct stat sb;
+  const char *const path = ConfigGeneral.perf_export_file;
+
+  if (EmptyString(path))
+    return;
+
+  FILE *file = open_memstream(&buf, &len);
+  if (file == NULL)
+    return;
+
+  fprintf(file, "time %ju\n", event_base->time.sec_real);
+  perf_export_line(file, "loop", "busy", &PerfStats.loop);
+  perf_export_line(file, "loop", "select", &PerfStats.select);
+  perf_export_line(file, "loop", "wait", &PerfStats.wait);
+  perf_export_line(file, "fanout", "channel", &PerfStats.fanout);
+  perf_export_line(file, "split", "netsplit", &PerfStats.split);
+
+  DLINK_FOREACH(node, event_get_list()->head)
+  {
+    const struct event *ev = node->data;
+    perf_export_line(file, "event", ev->name, &ev->runtime);
+  }
+
+  DLINK_FOREACH(node, command_get_list()->head)
+  {
+    const struct Message *msg = node->data;
+    perf_export_line(file, "command", msg->cmd, &msg->latency);
+  }
+
+  fclose(file);
+
+  if (stat(path, &sb) == 0 && S_ISSOCK(sb.st_mode))
+  {
+    struct sockaddr_un addr = { .sun_family = AF_UNIX };
+    int fd = socket(AF_UNIX, SOCK_DGRAM, 0);
+
+    strlcpy(addr.sun_path, path, sizeof(addr.sun_path));
+
+    if (fd == -1 || sendto(fd, buf, len, MSG_DONTWAIT, (struct sockaddr *)&addr, sizeof(addr)) == -1)
+      ilog(LOG_TYPE_IRCD, "Couldn't send performance counters to %s: %s", path, strerror(errno));
+
+    if (fd != -1)
+      close(fd);
+  }
+  else
+  {
+    snprintf(tmppath, sizeof(tmppath), "%s.tmp", path);
+    file = fopen(tmppath, "w");
+
+    if (file == NULL)
+      ilog(LOG_TYPE_IRCD, "Couldn't open %s: %s", tmppath, strerror(errno));
+    else
+    {
+      bool error = fwrite(buf, 1, len, file) != len;
+
+      if (fclose(file) || error || rename(tmppath, path) == -1)
+        ilog(LOG_TYPE_IRCD, "Couldn't write performance counters to %s: %s", path, strerror(errno));
+    }
+  }
+
+  free(buf);
+}
+
+/*! \brief Sets the interval of the machine readable export.
+ * \param interval Interval in seconds; 0 disables the export
+ */
+void
+perf_set_export(unsigned int interval)
+{
+  event_delete(&event_perf_export);
+
+  if (interval)
+  {
+    event_perf_export.when = interval;
+    event_add(&event_perf_export, NULL);
+  }
+}
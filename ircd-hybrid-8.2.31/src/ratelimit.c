@@ -0,0 +1,457 @@
+/*
+ *  ircd-hybrid: an advanced, lightweight Internet Relay Chat Daemon (ircd)
+ *
+ *  Copyright (c) 2020 ircd-hybrid development team
+ *
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301
+ *  USA
+ */
+
+/*! \file ratelimit.c
+ * \brief Sliding window event rates kept in fixed size count-min sketches.
+ * \version $Id$
+ *
+ * A sketch counts events per key in RATE_DEPTH rows of RATE_WIDTH
+ * counters; a key is counted in one counter of every row and its count
+ * is the smallest of them, so keys sharing a counter can only make each
+ * other look busier, never quieter.  Only counters holding that smallest
+ * value are raised ("conservative update"), which keeps the error low.
+ *
+ * Counters are kept for the current and the previous window.  The rate
+ * of a key is its count in the current window plus the part of its count
+ * in the previous window that still lies within one window from now.
+ *
+ * Memory use is the same however many keys are active, so a flood from
+ * many sources aimed at one target, or a connection flood from many
+ * network prefixes, costs no more to track than a single flooder.
+ *
+ * rate_sources, rate_targets and rate_prefixes count PRIVMSG and NOTICE
+ * per sending client, per receiving client or channel and per network
+ * prefix of the sender, and are enforced by m_message.c against the
+ * floodcount/floodtime settings.  rate_connects counts incoming
+ * connections per network prefix and is enforced by throttle_check()
+ * against prefix_burst/prefix_rate.
+ */
+
+#include "stdinc.h"
+#include "ratelimit.h"
+#include "client.h"
+#include "event.h"
+#include "hash.h"
+#include "irc_string.h"
+#include "ircd.h"
+#include "misc.h"
+#include "numeric.h"
+#include "rng_mt.h"
+#include "send.h"
+
+
+static void ratelimit_format_client(const struct RateTop *, char *, size_t);
+static void ratelimit_format_target(const struct RateTop *, char *, size_t);
+static void ratelimit_format_prefix(const struct RateTop *, char *, size_t);
+
+/** PRIVMSG and NOTICE per sending client */
+struct RateSketch rate_sources = { .name = "sources", .format = ratelimit_format_client };
+/** PRIVMSG and NOTICE per receiving client or channel */
+struct RateSketch rate_targets = { .name = "targets", .format = ratelimit_format_target, .casefold = true };
+/** PRIVMSG and NOTICE per IPv4 /24 and IPv6 /64 of the sending client */
+struct RateSketch rate_prefixes = { .name = "prefixes", .format = ratelimit_format_prefix };
+/** Incoming connections per IPv4 /24 and IPv6 /64 */
+struct RateSketch rate_connects = { .name = "connects", .format = ratelimit_format_prefix };
+
+static struct RateSketch *const rate_sketches[] = { &rate_sources, &rate_targets, &rate_prefixes, &rate_connects };
+
+
+/* The time of the current event loop iteration is close enough, and
+ * saves reading the clock for every message */
+static uintmax_t
+ratelimit_now(void)
+{
+  return event_base->time.msec_monotonic;
+}
+
+/* ratelimit_advance()
+ *
+ * inputs       - pointer to sketch
+ *              - length of a window in seconds
+ *              - current monotonic time in milliseconds
+ * output       - NONE
+ * side effects - counters of windows that have passed are cleared; the
+ *                sketch starts over if the window length changed
+ */
+static void
+ratelimit_advance(struct RateSketch *sketch, unsigned int seconds, uintmax_t now)
+{
+  const uintmax_t window = (uintmax_t)seconds * 1000;
+  const uintmax_t epoch = now / window;
+
+  if (sketch->window != window)
+  {
+    sketch->window = window;
+    sketch->epoch = epoch;
+    memset(sketch->counter, 0, sizeof(sketch->counter));
+    memset(sketch->top, 0, sizeof(sketch->top));
+    return;
+  }
+
+  if (sketch->epoch == epoch)
+    return;
+
+  if (sketch->epoch + 1 == epoch)
+    memset(sketch->counter[epoch & 1], 0, sizeof(sketch->counter[0]));
+  else
+    memset(sketch->counter, 0, sizeof(sketch->counter));
+
+  sketch->epoch = epoch;
+}
+
+/* ratelimit_index()
+ *
+ * inputs       - pointer to sketch
+ *              - key and its length
+ *              - array receiving the counter of every row
+ * output       - NONE
+ * side effects - NONE
+ *
+ * FNV-1a over the key, case-insensitive for sketches of IRC names, split
+ * in two halves that pick the counter of each row by double hashing.
+ */
+static void
+ratelimit_index(const struct RateSketch *sketch, const void *key, size_t len,
+                unsigned int index[RATE_DEPTH])
+{
+  const unsigned char *p = key;
+  uint64_t hash = UINT64_C(14695981039346656037) ^ sketch->seed;
+
+  while (len--)
+  {
+    hash ^= sketch->casefold ? ToLower(*p) : *p;
+    hash *= UINT64_C(1099511628211);
+    ++p;
+  }
+
+  const uint32_t h1 = (uint32_t)hash;
+  const uint32_t h2 = (uint32_t)(hash >> 32) | 1;
+
+  for (unsigned int i = 0; i < RATE_DEPTH; ++i)
+    index[i] = (h1 + i * h2) & (RATE_WIDTH - 1);
+}
+
+static unsigned int
+ratelimit_count(const struct RateSketch *sketch, const unsigned int index[RATE_DEPTH], uintmax_t now)
+{
+  const unsigned short (*const current)[RATE_WIDTH] = sketch->counter[sketch->epoch & 1];
+  const unsigned short (*const previous)[RATE_WIDTH] = sketch->counter[(sketch->epoch + 1) & 1];
+  const uintmax_t left = sketch->window - now % sketch->window;
+  unsigned int count = UINT_MAX;
+
+  for (unsigned int i = 0; i < RATE_DEPTH; ++i)
+  {
+    const unsigned int n = current[i][index[i]] + previous[i][index[i]] * left / sketch->window;
+
+    if (n < count)
+      count = n;
+  }
+
+  return count;
+}
+
+/* ratelimit_top()
+ *
+ * inputs       - pointer to sketch
+ *              - key and its length
+ *              - its current count
+ *              - whether the event was refused
+ *              - current monotonic time in milliseconds
+ * output       - NONE
+ * side effects - the key is remembered for STATS w if it is among the
+ *                busiest ones of the last two windows, along with how
+ *                many of its events were refused; older entries stay
+ *                until something else needs their slot
+ */
+static bool
+ratelimit_top_stale(const struct RateSketch *sketch, const struct RateTop *top, uintmax_t now)
+{
+  return top->len == 0 || now - top->when > sketch->window * 2;
+}
+
+/* Keys of IRC names match the way ratelimit_index() hashes them */
+static bool
+ratelimit_top_match(const struct RateSketch *sketch, const struct RateTop *top,
+                    const unsigned char *key, size_t len)
+{
+  if (top->len != len)
+    return false;
+
+  if (sketch->casefold == false)
+    return memcmp(top->key, key, len) == 0;
+
+  for (size_t i = 0; i < len; ++i)
+    if (ToLower(top->key[i]) != ToLower(key[i]))
+      return false;
+
+  return true;
+}
+
+static void
+ratelimit_top(struct RateSketch *sketch, const void *key, size_t len, unsigned int count,
+              bool rejected, uintmax_t now)
+{
+  struct RateTop *slot = NULL;
+
+  if (len > sizeof(slot->key))
+    len = sizeof(slot->key);
+
+  for (unsigned int i = 0; i < RATE_TOP; ++i)
+  {
+    struct RateTop *top = &sketch->top[i];
+
+    if (ratelimit_top_match(sketch, top, key, len))
+    {
+      if (ratelimit_top_stale(sketch, top, now) || top->count < count)
+        top->count = count;
+      if (rejected)
+        ++top->rejected;
+      top->when = now;
+      return;
+    }
+
+    /* Otherwise take an unused slot, one not recorded for two windows, or the quietest */
+    if (slot == NULL ||
+        (!ratelimit_top_stale(sketch, slot, now) &&
+         (ratelimit_top_stale(sketch, top, now) || top->count < slot->count)))
+      slot = top;
+  }
+
+  if (!ratelimit_top_stale(sketch, slot, now) && slot->count >= count)
+    return;
+
+  memcpy(slot->key, key, len);
+  slot->len = len;
+  slot->count = count;
+  slot->rejected = rejected;
+  slot->when = now;
+}
+
+/* ratelimit_hit()
+ *
+ * inputs       - pointer to sketch
+ *              - length of the window in seconds
+ *              - number of events allowed per window; 0 for no limit
+ *              - key and its length
+ * output       - number of events for the key within the last window,
+ *                not including this one
+ * side effects - the event is counted, unless the key already reached
+ *                the limit
+ */
+unsigned int
+ratelimit_hit(struct RateSketch *sketch, unsigned int window, unsigned int limit,
+              const void *key, size_t len)
+{
+  unsigned int index[RATE_DEPTH];
+  const uintmax_t now = ratelimit_now();
+
+  if (window == 0)
+    return 0;
+
+  ratelimit_advance(sketch, window, now);
+  ratelimit_index(sketch, key, len, index);
+
+  const unsigned int count = ratelimit_count(sketch, index, now);
+  if (limit && count >= limit)
+  {
+    ++sketch->rejected;
+    ratelimit_top(sketch, key, len, count, true, now);
+    return count;
+  }
+
+  unsigned short (*const current)[RATE_WIDTH] = sketch->counter[sketch->epoch & 1];
+  unsigned int lowest = USHRT_MAX;
+
+  for (unsigned int i = 0; i < RATE_DEPTH; ++i)
+    if (current[i][index[i]] < lowest)
+      lowest = current[i][index[i]];
+
+  if (lowest < USHRT_MAX)
+    for (unsigned int i = 0; i < RATE_DEPTH; ++i)
+      if (current[i][index[i]] == lowest)
+        ++current[i][index[i]];
+
+  ++sketch->events;
+
+  if (count)
+    ratelimit_top(sketch, key, len, count + 1, false, now);
+
+  return count;
+}
+
+/* ratelimit_estimate()
+ *
+ * inputs       - pointer to sketch
+ *              - length of the window in seconds
+ *              - key and its length
+ * output       - number of events for the key within the last window
+ * side effects - NONE
+ */
+unsigned int
+ratelimit_estimate(struct RateSketch *sketch, unsigned int window, const void *key, size_t len)
+{
+  unsigned int index[RATE_DEPTH];
+  const uintmax_t now = ratelimit_now();
+
+  if (window == 0)
+    return 0;
+
+  ratelimit_advance(sketch, window, now);
+  ratelimit_index(sketch, key, len, index);
+
+  return ratelimit_count(sketch, index, now);
+}
+
+/* ratelimit_prefix_key()
+ *
+ * inputs       - pointer to address
+ *              - buffer of RATE_PREFIX_KEYLEN bytes
+ * output       - length of the key written to the buffer; 0 for
+ *                addresses that are neither IPv4 nor IPv6
+ * side effects - NONE
+ *
+ * The key is the address family followed by the bytes of the IPv4 /24
+ * or IPv6 /64 the address belongs to.
+ */
+size_t
+ratelimit_prefix_key(const struct irc_ssaddr *addr, unsigned char *key)
+{
+  if (addr->ss.ss_family == AF_INET6)
+  {
+    key[0] = AF_INET6;
+    memcpy(key + 1, ((const struct sockaddr_in6 *)addr)->sin6_addr.s6_addr, RATE_PREFIX_V6 / 8);
+    return 1 + RATE_PREFIX_V6 / 8;
+  }
+
+  if (addr->ss.ss_family == AF_INET)
+  {
+    key[0] = AF_INET;
+    memcpy(key + 1, &((const struct sockaddr_in *)addr)->sin_addr.s_addr, RATE_PREFIX_V4 / 8);
+    return 1 + RATE_PREFIX_V4 / 8;
+  }
+
+  return 0;
+}
+
+/* RateTop::key need not be NUL terminated; copy no more than its length */
+static void
+ratelimit_copy_key(const struct RateTop *top, char *buf, size_t size)
+{
+  const size_t len = IRCD_MIN(top->len, size - 1);
+
+  memcpy(buf, top->key, len);
+  buf[len] = '\0';
+}
+
+static void
+ratelimit_format_client(const struct RateTop *top, char *buf, size_t size)
+{
+  char id[IDLEN + 1];
+
+  ratelimit_copy_key(top, id, sizeof(id));
+
+  const struct Client *client = hash_find_id(id);
+  if (client)
+    snprintf(buf, size, "%s (%s)", client->name, id);
+  else
+    strlcpy(buf, id, size);
+}
+
+static void
+ratelimit_format_target(const struct RateTop *top, char *buf, size_t size)
+{
+  if (IsChanPrefix(*top->key))
+    ratelimit_copy_key(top, buf, size);
+  else
+    ratelimit_format_client(top, buf, size);
+}
+
+static void
+ratelimit_format_prefix(const struct RateTop *top, char *buf, size_t size)
+{
+  unsigned char addr[16] = "";
+  char ip[HOSTIPLEN + 1];
+  const int family = top->key[0];
+  const int bits = family == AF_INET6 ? RATE_PREFIX_V6 : RATE_PREFIX_V4;
+
+  memcpy(addr, top->key + 1, top->len - 1);
+  inet_ntop(family, addr, ip, sizeof(ip));
+  snprintf(buf, size, "%s/%d", ip, bits);
+}
+
+/* ratelimit_report()
+ *
+ * inputs       - pointer to client requesting the report
+ * output       - NONE
+ * side effects - sends the window of every sketch, how many events it has
+ *                counted and refused, and the busiest keys recorded along
+ *                with their current and peak rate and how many of their
+ *                events were refused
+ */
+void
+ratelimit_report(struct Client *source_p)
+{
+  const uintmax_t now = ratelimit_now();
+
+  sendto_one_numeric(source_p, &me, RPL_STATSDEBUG | SND_EXPLICIT,
+                     "w :%ux%u counters per sketch; prefixes are /%d (IPv4) and /%d (IPv6)",
+                     RATE_DEPTH, RATE_WIDTH, RATE_PREFIX_V4, RATE_PREFIX_V6);
+
+  for (unsigned int i = 0; i < sizeof(rate_sketches) / sizeof(rate_sketches[0]); ++i)
+  {
+    struct RateSketch *const sketch = rate_sketches[i];
+    const unsigned int window = sketch->window / 1000;
+
+    sendto_one_numeric(source_p, &me, RPL_STATSDEBUG | SND_EXPLICIT,
+                       "w :%s window %us events %ju rejected %ju",
+                       sketch->name, window, sketch->events, sketch->rejected);
+
+    for (unsigned int j = 0; j < RATE_TOP; ++j)
+    {
+      const struct RateTop *top = &sketch->top[j];
+      char name[HOSTLEN + 1];
+
+      if (top->len == 0)
+        continue;
+
+      sketch->format(top, name, sizeof(name));
+      sendto_one_numeric(source_p, &me, RPL_STATSDEBUG | SND_EXPLICIT,
+                         "w :%s %s now %u peak %u rejected %u %jus ago",
+                         sketch->name, name,
+                         ratelimit_estimate(sketch, window, top->key, top->len),
+                         top->count, top->rejected, (now - top->when) / 1000);
+    }
+  }
+}
+
+void
+ratelimit_get_stats(unsigned int *const number, size_t *const mem)
+{
+  (*number) = sizeof(rate_sketches) / sizeof(rate_sketches[0]);
+  (*mem) = sizeof(rate_sketches) / sizeof(rate_sketches[0]) * sizeof(struct RateSketch);
+}
+
+void
+ratelimit_init(void)
+{
+  for (unsigned int i = 0; i < sizeof(rate_sketches) / sizeof(rate_sketches[0]); ++i)
+    rate_sketches[i]->seed = (uint64_t)genrand_int32() << 32 | genrand_int32();
+}
@@ -105,7 +105,7 @@ static void
 rem_request(struct reslist *request)
 {
   dlinkDelete(&request->node, &request_list);
-  xfree(request);
+  xfree_tag(MEMORY_DNS, request, sizeof(*request));
 }
 
 /*
@@ -114,7 +114,7 @@ rem_request(struct reslist *request)
 static struct reslist *
 make_request(dns_callback_fnc callback, void *ctx)
 {
-  struct reslist *request = xcalloc(sizeof(*request));
+  struct reslist *request = xcalloc_tag(MEMORY_DNS, sizeof(*request));
 
   request->sentat = event_base->time.sec_monotonic;
   request->retries = 2;
@@ -35,6 +35,7 @@
 #include "client.h"
 #include "memory.h"
 #include "conf_db.h"
+#include "upgrade.h"
 
 
 void
@@ -68,6 +69,7 @@ server_die(const char *message, bool restart)
 
   save_all_databases(NULL);
 
+  send_queued_all();
   close_fds();
 
   unlink(pidFileName);
@@ -80,3 +82,100 @@ server_die(const char *message, bool restart)
   else
     exit(EXIT_SUCCESS);
 }
+
+/* server_upgrade()
+ *
+ * inputs       - reason
+ * output       - none, does not return unless the server binary cannot
+ *                be executed
+ * side effects - executes the server binary again, handing it the
+ *                listeners and the registered plaintext clients along
+ *                with their channels. Server links, TLS clients and
+ *                connections still registering can't be handed over;
+ *                they are closed like on a restart.
+ */
+void
+server_upgrade(const char *message)
+{
+  char buffer[IRCD_BUFSIZE] = "";
+  dlink_node *node, *node_next;
+
+  /* Nothing has been torn down yet, so just keep running */
+  if (access(SPATH, X_OK))
+  {
+    ilog(LOG_TYPE_IRCD, "Cannot upgrade, %s is not executable: %s", SPATH, strerror(errno));
+    sendto_realops_flags(UMODE_SERVNOTICE, L_ALL, SEND_NOTICE,
+                         "Cannot upgrade, %s is not executable: %s",
+                         SPATH, strerror(errno));
+    return;
+  }
+
+  if (EmptyString(message))
+    snprintf(buffer, sizeof(buffer), "Server Restarting");
+  else
+    snprintf(buffer, sizeof(buffer), "Server Restarting: %s", message);
+
+  ilog(LOG_TYPE_IRCD, "%s (upgrade)", buffer);
+
+  DLINK_FOREACH_SAFE(node, node_next, local_server_list.head)
+    exit_client(node->data, buffer);
+
+  DLINK_FOREACH_SAFE(node, node_next, unknown_list.head)
+    exit_client(node->data, buffer);
+
+  DLINK_FOREACH_SAFE(node, node_next, local_client_list.head)
+  {
+    struct Client *client = node->data;
+
+    if (HasFlag(client, FLAGS_TLS))
+    {
+      sendto_one_notice(client, &me, ":%s", buffer);
+      exit_client(client, buffer);
+    }
+    else
+      sendto_one_notice(client, &me, ":*** Notice -- Server upgrading, your connection is kept");
+  }
+
+  save_all_databases(NULL);
+  send_queued_all();
+
+  if (upgrade_save(UPGRADEPATH) == false)
+  {
+    sendto_realops_flags(UMODE_SERVNOTICE, L_ALL, SEND_NOTICE,
+                         "Cannot write %s, restarting without handing over clients",
+                         UPGRADEPATH);
+    server_die(message, true);
+    return;
+  }
+
+  unsigned int argc = 0;
+  while (myargv[argc])
+    ++argc;
+
+  /* Same arguments, but with -upgrade pointing at the state file */
+  char **argv = xcalloc((argc + 3) * sizeof(*argv));
+  unsigned int n = 0;
+
+  for (unsigned int i = 0; i < argc; ++i)
+  {
+    if (strcmp(myargv[i], "-upgrade") == 0)
+      ++i;
+    else
+      argv[n++] = myargv[i];
+  }
+
+  argv[n++] = "-upgrade";
+  argv[n++] = UPGRADEPATH;
+
+  upgrade_set_cloexec();
+
+  execv(SPATH, argv);
+
+  /* The clients handed over are all still here; carry on with them */
+  ilog(LOG_TYPE_IRCD, "Cannot execute %s: %s", SPATH, strerror(errno));
+  sendto_realops_flags(UMODE_SERVNOTICE, L_ALL, SEND_NOTICE,
+                       "Cannot execute %s: %s, upgrade aborted",
+                       SPATH, strerror(errno));
+  upgrade_cancel(UPGRADEPATH);
+  xfree(argv);
+}
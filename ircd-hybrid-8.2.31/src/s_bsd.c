@@ -24,6 +24,10 @@
  * \version $Id: s_bsd.c 9249 2020-02-01 13:35:32Z michael $
  */
 
+#ifndef _GNU_SOURCE
+#define _GNU_SOURCE  /* accept4() */
+#endif
+
 #include "stdinc.h"
 #include <netinet/in_systm.h>
 #include <netinet/ip.h>
@@ -35,6 +39,7 @@
 #include "dbuf.h"
 #include "event.h"
 #include "irc_string.h"
+#include "intern.h"
 #include "ircd.h"
 #include "listener.h"
 #include "numeric.h"
@@ -122,7 +127,7 @@ report_error(int level, const char *text, const char *who, int error)
 /*
  * setup_socket()
  *
- * Set the socket non-blocking, and other wonderful bits.
+ * Set the socket options, and other wonderful bits.
  */
 static void
 setup_socket(int fd)
@@ -140,8 +145,6 @@ setup_socket(int fd)
   opt = 1;
   setsockopt(fd, SOL_SOCKET, TCP_QUICKACK, &opt, sizeof(opt));
 #endif
-
-  fcntl(fd, F_SETFL, fcntl(fd, F_GETFL, 0) | O_NONBLOCK);
 }
 
 /*
@@ -183,7 +186,11 @@ ssl_handshake(fde_t *F, void *data)
 
   comm_settimeout(F, 0, NULL, NULL);
 
-  if (tls_verify_certificate(&F->tls, ConfigServerInfo.message_digest_algorithm, &client->certfp) == false)
+  ++ServerStats.is_tls;
+  if (tls_session_reused(&F->tls) == true)
+    ++ServerStats.is_tlsr;
+
+  if (tls_verify_certificate(&F->tls, ConfigServerInfo.message_digest_algorithm, &client->cold->certfp) == false)
     ilog(LOG_TYPE_IRCD, "Client %s gave bad TLS client certificate",
          client_get_name(client, MASK_IP));
 
@@ -191,44 +198,63 @@ ssl_handshake(fde_t *F, void *data)
 }
 
 /*
- * add_connection - creates a client which has just connected to us on
- * the given fd. The sockhost field is initialized with the ip# of the host.
- * An unique id is calculated now, in case it is needed for auth.
+ * add_connection_timeout - drops a new connection that has not sent
+ * anything within ACCEPT_IDLE_TIMEOUT seconds.
+ */
+static void
+add_connection_timeout(fde_t *F, void *data)
+{
+  struct Listener *listener = data;
+
+  fd_close(F);
+  listener_release(listener);
+}
+
+/*
+ * add_connection_ready - creates a client for a new connection once its
+ * first bytes arrived. The sockhost field is initialized with the ip# of
+ * the host. An unique id is calculated now, in case it is needed for auth.
  * The client is sent to the auth module for verification, and not put in
  * any client list yet.
  */
-void
-add_connection(struct Listener *listener, struct irc_ssaddr *irn, int fd)
+static void
+add_connection_ready(fde_t *F, void *data)
 {
+  struct Listener *listener = data;
   struct Client *client = client_make(NULL);
+  char sockhost[HOSTIPLEN + 2] = "";  /* Room for a "0" in front of an IPv6 address */
 
-  client->connection->fd = fd_open(fd, true, (listener->flags & LISTENER_TLS) ?
-                                     "Incoming TLS connection" : "Incoming connection");
+  comm_settimeout(F, 0, NULL, NULL);
+
+  client->connection->fd = F;
+  fd_note(F, (listener->flags & LISTENER_TLS) ?
+          "Incoming TLS connection" : "Incoming connection");
 
   /*
    * copy address to 'sockhost' as a string, copy it to host too
    * so we have something valid to put into error messages...
    */
-  client->ip = *irn;
+  client->ip = F->connect.hostaddr;
 
-  getnameinfo((const struct sockaddr *)&client->ip,
-              client->ip.ss_len, client->sockhost,
-              sizeof(client->sockhost), NULL, 0, NI_NUMERICHOST);
+  if (client->ip.ss.ss_family == AF_INET6)
+    inet_ntop(AF_INET6, &((const struct sockaddr_in6 *)&client->ip)->sin6_addr,
+              sockhost + 1, sizeof(sockhost) - 1);
+  else
+    inet_ntop(AF_INET, &((const struct sockaddr_in *)&client->ip)->sin_addr,
+              sockhost + 1, sizeof(sockhost) - 1);
 
-  if (client->sockhost[0] == ':')
-  {
-    client->sockhost[0] = '0';
-    memmove(client->sockhost + 1, client->sockhost, sizeof(client->sockhost) - 1);
-  }
+  if (sockhost[1] == ':')
+    sockhost[0] = '0';
 
-  strlcpy(client->host, client->sockhost, sizeof(client->host));
+  intern_set(&client->cold->sockhost, sockhost + (sockhost[0] == '\0'), HOSTIPLEN);
+  intern_set(&client->host, client->cold->sockhost, HOSTLEN);
 
+  /* The reference taken by add_connection() now belongs to the client */
   client->connection->listener = listener;
-  ++listener->ref_count;
 
   if (listener->flags & LISTENER_TLS)
   {
-    if (tls_new(&client->connection->fd->tls, fd, TLS_ROLE_SERVER) == false)
+    if (tls_new(&F->tls, F->fd, TLS_ROLE_SERVER) == false)
     {
       SetDead(client);
       exit_client(client, "TLS context initialization failed");
@@ -242,6 +268,24 @@ add_connection(struct Listener *listener, struct irc_ssaddr *irn, int fd)
     auth_start(client);
 }
 
+/*
+ * add_connection - takes a connection which has just been accepted on
+ * the given fd. Nothing but the fd is set up for it until the peer sends
+ * its first bytes, so connections which never speak, such as half-open
+ * scans and connection floods, cost no client, TLS or auth allocations.
+ */
+void
+add_connection(struct Listener *listener, struct irc_ssaddr *irn, int fd)
+{
+  fde_t *F = fd_open(fd, true, "Pending connection");
+
+  F->connect.hostaddr = *irn;
+  ++listener->ref_count;
+
+  comm_settimeout(F, ACCEPT_IDLE_TIMEOUT, add_connection_timeout, listener);
+  comm_setselect(F, COMM_SELECT_READ, add_connection_ready, listener, 0);
+}
+
 /*
  * stolen from squid - its a neat (but overused! :) routine which we
  * can use to see whether we can ignore this errno or not. It is
@@ -510,6 +554,7 @@ comm_socket(int family, int sock_type, int proto)
     return -1; /* errno will be passed through, yay.. */
 
   setup_socket(fd);
+  fcntl(fd, F_SETFL, fcntl(fd, F_GETFL, 0) | O_NONBLOCK);
 
   return fd;
 }
@@ -539,10 +584,19 @@ comm_accept(fde_t *F, struct irc_ssaddr *addr)
    * reserved fd limit, but we can deal with that when comm_open()
    * also does it. XXX -- adrian
    */
+#if defined(SOCK_NONBLOCK) && defined(SOCK_CLOEXEC)
+  int fd = accept4(F->fd, (struct sockaddr *)addr, &addrlen, SOCK_NONBLOCK | SOCK_CLOEXEC);
+  if (fd < 0)
+    return -1;
+#else
   int fd = accept(F->fd, (struct sockaddr *)addr, &addrlen);
   if (fd < 0)
     return -1;
 
+  fcntl(fd, F_SETFL, fcntl(fd, F_GETFL, 0) | O_NONBLOCK);
+  fcntl(fd, F_SETFD, FD_CLOEXEC);
+#endif
+
   remove_ipv6_mapping(addr);
 
   setup_socket(fd);
@@ -149,7 +149,9 @@ comm_select(void)
   dopoll.dp_timeout = SELECT_DELAY;
   dopoll.dp_nfds = 128;
   dopoll.dp_fds = &pollfds[0];
+  const uintmax_t wait = event_time_ns();
   num = ioctl(devpoll_fd, DP_POLL, &dopoll);
+  perf_wait(event_time_ns() - wait);
 
   event_time_set();
 
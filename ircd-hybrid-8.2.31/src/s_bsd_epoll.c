@@ -147,7 +147,9 @@ comm_select(void)
   int num;
   void (*hdl)(fde_t *, void *);
 
+  const uintmax_t wait = event_time_ns();
   num = epoll_wait(epollop->fd, epollop->events, epollop->nevents, SELECT_DELAY);
+  perf_wait(event_time_ns() - wait);
   assert(num <= epollop->nevents);
 
   event_time_set();
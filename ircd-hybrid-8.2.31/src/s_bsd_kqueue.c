@@ -149,7 +149,9 @@ comm_select(void)
    */
   poll_time.tv_sec = 0;
   poll_time.tv_nsec = SELECT_DELAY * 1000000;
+  const uintmax_t wait = event_time_ns();
   num = kevent(kqueue_fd, kq_fdlist, kqoff, ke, KE_LENGTH, &poll_time);
+  perf_wait(event_time_ns() - wait);
   kqoff = 0;
 
   event_time_set();
@@ -152,7 +152,9 @@ comm_select(void)
   int num;
   void (*hdl)(fde_t *, void *);
 
+  const uintmax_t wait = event_time_ns();
   num = poll(pollfds, pollnum, SELECT_DELAY);
+  perf_wait(event_time_ns() - wait);
 
   event_time_set();
 
@@ -36,10 +36,20 @@
 #include "server_capab.h"
 #include "conf_class.h"
 #include "log.h"
+#include "memory.h"
+#include "misc.h"
+#include "perf.h"
 
 
 static uintmax_t current_serial;
 
+/*! \brief Prebuilt ":<me.name> " prefix of numerics sent to our own clients */
+static struct
+{
+  char text[HOSTLEN + 3];  /**< ':' + server name + ' ' + '\0' */
+  size_t len;
+} numeric_prefix;
+
 
 /* send_format()
  *
@@ -74,6 +84,90 @@ send_format(struct dbuf_block *buffer, const char *pattern, va_list args)
   buffer->data[buffer->size++] = '\n';
 }
 
+/* send_numeric_prefix()
+ *
+ * inputs	- buffer of at least HOSTLEN + NICKLEN + 8 bytes
+ *		- numeric
+ *		- name of the recipient
+ * output	- number of bytes written to buffer
+ * side effects	- writes ":<me.name> NNN <dest> " to buffer, using the
+ *		  prebuilt server prefix instead of formatting it again
+ */
+static size_t
+send_numeric_prefix(char *buf, unsigned int numeric, const char *dest)
+{
+  char *p = buf;
+  size_t len = strlen(dest);
+
+  if (numeric_prefix.len == 0)
+    numeric_prefix.len = snprintf(numeric_prefix.text, sizeof(numeric_prefix.text), ":%s ", me.name);
+
+  memcpy(p, numeric_prefix.text, numeric_prefix.len);
+  p += numeric_prefix.len;
+
+  *p++ = '0' + (numeric / 100) % 10;
+  *p++ = '0' + (numeric / 10) % 10;
+  *p++ = '0' + numeric % 10;
+  *p++ = ' ';
+
+  memcpy(p, dest, len);
+  p += len;
+  *p++ = ' ';
+
+  return p - buf;
+}
+
+/*
+ ** send_sendq_exceeded
+ **      Internal utility which checks whether appending len bytes
+ **      would exceed the sendq limit of a client and, if so, takes
+ **      care of exiting it.
+ */
+static bool
+send_sendq_exceeded(struct Client *to, size_t len)
+{
+  if (dbuf_length(&to->connection->buf_sendq) + len <= get_sendq(&to->connection->confs))
+    return false;
+
+  if (IsServer(to))
+    sendto_realops_flags(UMODE_SERVNOTICE, L_ALL, SEND_NOTICE,
+                         "Max SendQ limit exceeded for %s: %zu > %u",
+                         client_get_name(to, HIDE_IP),
+                         (dbuf_length(&to->connection->buf_sendq) + len),
+                         get_sendq(&to->connection->confs));
+
+  if (IsClient(to))
+    AddFlag(to, FLAGS_SENDQEX);
+
+  dead_link_on_write(to, 0);
+  return true;
+}
+
+/* Number of dbuf blocks handed to a single writev() */
+enum { SEND_IOV_MAX = 64 };
+
+/* Local clients with output queued by send_message() but not written yet */
+static dlink_list flush_list;
+
+/* send_queued_later()
+ *
+ * inputs	- pointer to local client
+ * output	- none
+ * side effects	- leaves the write to send_queued_all() at the end of the
+ *		  event loop iteration, so that everything queued for this
+ *		  client until then goes out with as few system calls as
+ *		  possible. Only writes right away once a sizable amount
+ *		  has piled up.
+ */
+static void
+send_queued_later(struct Client *to)
+{
+  if (dbuf_length(&to->connection->buf_sendq) >= BATCH_FLUSH_SIZE)
+    send_queued_write(to);
+  else if (to->connection->flush_node.data == NULL)
+    dlinkAddTail(to, &to->connection->flush_node, &flush_list);
+}
+
 /*
  ** send_message
  **      Internal utility which appends given buffer to the sockets
@@ -86,21 +180,8 @@ send_message(struct Client *to, struct dbuf_block *buf)
   assert(to != &me);
   assert(MyConnect(to));
 
-  if (dbuf_length(&to->connection->buf_sendq) + buf->size > get_sendq(&to->connection->confs))
-  {
-    if (IsServer(to))
-      sendto_realops_flags(UMODE_SERVNOTICE, L_ALL, SEND_NOTICE,
-                           "Max SendQ limit exceeded for %s: %zu > %u",
-                           client_get_name(to, HIDE_IP),
-                           (dbuf_length(&to->connection->buf_sendq) + buf->size),
-                           get_sendq(&to->connection->confs));
-
-    if (IsClient(to))
-      AddFlag(to, FLAGS_SENDQEX);
-
-    dead_link_on_write(to, 0);
+  if (send_sendq_exceeded(to, buf->size))
     return;
-  }
 
   dbuf_add(&to->connection->buf_sendq, buf);
 
@@ -112,7 +193,7 @@ send_message(struct Client *to, struct dbuf_block *buf)
   ++to->connection->send.messages;
   ++me.connection->send.messages;
 
-  send_queued_write(to);
+  send_queued_later(to);
 }
 
 /* send_message_remote()
@@ -140,6 +221,24 @@ send_message_remote(struct Client *to, const struct Client *from, struct dbuf_bl
     send_message(to, buf);
 }
 
+/* exceeding_sendq()
+ *
+ * inputs       - pointer to client to check
+ * output	- 1 if client is in danger of blowing its sendq
+ *		  0 if it is not.
+ * side effects -
+ *
+ * Sendq limit is fairly conservative at 1/2 (In original anyway)
+ */
+bool
+exceeding_sendq(const struct Client *to)
+{
+  if (dbuf_length(&to->connection->buf_sendq) > (get_sendq(&to->connection->confs) / 2))
+    return true;
+  else
+    return false;
+}
+
 /*
  ** sendq_unblocked
  **      Called when a socket is ready for writing.
@@ -191,8 +290,27 @@ send_queued_write(struct Client *to)
         return;  /* Retry later, don't register for write events */
     }
     else
-      retlen = send(to->connection->fd->fd, first->data + to->connection->buf_sendq.pos,
-                                            first->size - to->connection->buf_sendq.pos, 0);
+    {
+      /* Hand as many queued blocks as possible to the kernel at once */
+      struct iovec iov[SEND_IOV_MAX];
+      size_t pos = to->connection->buf_sendq.pos;
+      int count = 0;
+      dlink_node *node;
+
+      DLINK_FOREACH(node, to->connection->buf_sendq.blocks.head)
+      {
+        const struct dbuf_block *block = node->data;
+
+        iov[count].iov_base = (char *)block->data + pos;
+        iov[count].iov_len = block->size - pos;
+        pos = 0;
+
+        if (++count == SEND_IOV_MAX)
+          break;
+      }
+
+      retlen = writev(to->connection->fd->fd, iov, count);
+    }
 
     if (retlen <= 0)
     {
@@ -215,6 +333,49 @@ send_queued_write(struct Client *to)
   }
 }
 
+/* send_queued_all()
+ *
+ * inputs	- NONE
+ * output	- NONE
+ * side effects	- writes the output send_message() left queued for
+ *		  each local client. Called by io_loop() before waiting
+ *		  for I/O again, so nothing stays queued for longer than
+ *		  one iteration of the event loop.
+ */
+void
+send_queued_all(void)
+{
+  dlink_node *node;
+
+  while ((node = flush_list.head))
+  {
+    struct Client *client = node->data;
+
+    dlinkDelete(node, &flush_list);
+    node->data = NULL;
+
+    send_queued_write(client);
+  }
+}
+
+/* send_queued_cancel()
+ *
+ * inputs	- pointer to local client whose connection is closing
+ * output	- NONE
+ * side effects	- takes the client off the list used by send_queued_all()
+ */
+void
+send_queued_cancel(struct Client *client)
+{
+  dlink_node *node = &client->connection->flush_node;
+
+  if (node->data)
+  {
+    dlinkDelete(node, &flush_list);
+    node->data = NULL;
+  }
+}
+
 /* sendto_one()
  *
  * inputs	- pointer to destination client
@@ -255,7 +416,10 @@ sendto_one_numeric(struct Client *to, const struct Client *from, enum irc_numeri
     dest = "*";
 
   struct dbuf_block *buffer = dbuf_alloc();
-  dbuf_put_fmt(buffer, ":%s %03d %s ", ID_or_name(from, to), numeric & ~SND_EXPLICIT, dest);
+  if (from == &me && !IsServer(to->from))
+    buffer->size = send_numeric_prefix(buffer->data, numeric & ~SND_EXPLICIT, dest);
+  else
+    dbuf_put_fmt(buffer, ":%s %03d %s ", ID_or_name(from, to), numeric & ~SND_EXPLICIT, dest);
 
   va_start(args, numeric);
 
@@ -273,6 +437,278 @@ sendto_one_numeric(struct Client *to, const struct Client *from, enum irc_numeri
   dbuf_ref_free(buffer);
 }
 
+/* reply_format()
+ *
+ * inputs	- buffer of IRCD_BUFSIZE bytes
+ *		- format string of a numeric
+ *		- var args
+ * output	- length of the formatted text
+ * side effects	- formats the parameters of a numeric into buffer. The
+ *		  plain %s, %u, %d and %c conversions are done right here,
+ *		  which covers the replies sent line by line in bulk, such
+ *		  as NAMES, WHO and LIST; anything else is left to vsnprintf().
+ */
+static size_t
+reply_format(char *buf, const char *format, va_list args)
+{
+  char *p = buf, *const end = buf + IRCD_BUFSIZE - 1;
+  char num[16], *n;
+  const char *str;
+  va_list copy;
+
+  va_copy(copy, args);
+
+  for (const char *f = format; *f; ++f)
+  {
+    if (*f != '%')
+    {
+      if (p < end)
+        *p++ = *f;
+      continue;
+    }
+
+    switch (*++f)
+    {
+      case 's':
+        str = va_arg(args, const char *);
+        while (*str && p < end)
+          *p++ = *str++;
+        break;
+      case 'd':
+      case 'u':
+      {
+        unsigned int number;
+
+        if (*f == 'd')
+        {
+          const int value = va_arg(args, int);
+
+          if (value < 0 && p < end)
+            *p++ = '-';
+          number = value < 0 ? 0U - (unsigned int)value : (unsigned int)value;
+        }
+        else
+          number = va_arg(args, unsigned int);
+
+        n = num + sizeof(num);
+        do
+          *--n = '0' + number % 10;
+        while (number /= 10);
+
+        while (n < num + sizeof(num) && p < end)
+          *p++ = *n++;
+        break;
+      }
+      case 'c':
+        if (p < end)
+          *p++ = va_arg(args, int);
+        break;
+      case '%':
+        if (p < end)
+          *p++ = '%';
+        break;
+      default:
+      {
+        const int len = vsnprintf(buf, IRCD_BUFSIZE, format, copy);
+        va_end(copy);
+
+        if (len < 0)
+        {
+          buf[0] = '\0';
+          return 0;
+        }
+
+        return IRCD_MIN((size_t)len, IRCD_BUFSIZE - 1);
+      }
+    }
+  }
+
+  va_end(copy);
+
+  *p = '\0';
+  return p - buf;
+}
+
+/* reply_add()
+ *
+ * inputs	- pointer to reply template
+ *		- numeric
+ *		- var args for the numeric's format
+ * output	- none
+ * side effects	- formats the parameters of the numeric once and appends
+ *		  them to the template. Only the recipient's name is
+ *		  filled in when the template is sent.
+ */
+void
+reply_add(struct Reply *reply, enum irc_numerics numeric, ...)
+{
+  char buf[IRCD_BUFSIZE];
+  va_list args;
+
+  va_start(args, numeric);
+  const size_t len = reply_format(buf, numeric_form(numeric), args);
+  va_end(args);
+
+  struct ReplyLine *line = xcalloc(sizeof(*line) + len + 1);
+  line->numeric = numeric;
+  line->len = len;
+  memcpy(line->text, buf, len);
+
+  dlinkAddTail(line, &line->node, &reply->lines);
+  reply->len += len;
+}
+
+/* reply_body()
+ *
+ * inputs	- pointer to reply template
+ *		- numeric
+ *		- var args for the numeric's format
+ * output	- none
+ * side effects	- replaces the line sent after the lines of the template.
+ *		  Used for replies that differ for every line and recipient,
+ *		  such as those of NAMES, WHO and LIST.
+ */
+void
+reply_body(struct Reply *reply, enum irc_numerics numeric, ...)
+{
+  va_list args;
+
+  va_start(args, numeric);
+  reply->body_len = reply_format(reply->body, numeric_form(numeric), args);
+  va_end(args);
+
+  reply->body_numeric = numeric;
+}
+
+/* reply_body_room()
+ *
+ * inputs	- pointer to the client the reply is going to be sent to
+ *		- pointer to reply template
+ * output	- number of bytes that may still be added to the body
+ *		  before the line gets too long
+ * side effects	- none
+ */
+size_t
+reply_body_room(const struct Client *to, const struct Reply *reply)
+{
+  /* ":<me.name> NNN <nick> " */
+  const size_t len = strlen(me.name) + strlen(EmptyString(to->name) ? "*" : to->name) + 7 +
+                     reply->body_len;
+
+  if (len >= IRCD_BUFSIZE - 2)
+    return 0;
+  return IRCD_BUFSIZE - 2 - len;
+}
+
+/* reply_clear()
+ *
+ * inputs	- pointer to reply template
+ * output	- none
+ * side effects	- releases all lines of the template and drops its body
+ */
+void
+reply_clear(struct Reply *reply)
+{
+  dlink_node *node, *node_next;
+
+  DLINK_FOREACH_SAFE(node, node_next, reply->lines.head)
+  {
+    struct ReplyLine *line = node->data;
+
+    dlinkDelete(&line->node, &reply->lines);
+    xfree(line);
+  }
+
+  reply->len = 0;
+  reply->body_numeric = 0;
+  reply->body_len = 0;
+}
+
+/* reply_put_line()
+ *
+ * inputs	- pointer to local client
+ *		- numeric
+ *		- name of the recipient
+ *		- parameters of the numeric and their length
+ * output	- none
+ * side effects	- appends one line of a reply to the sendq
+ */
+static void
+reply_put_line(struct Client *to, enum irc_numerics numeric, const char *dest,
+               const char *text, size_t text_len)
+{
+  char buf[IRCD_BUFSIZE];
+  size_t len = send_numeric_prefix(buf, numeric, dest);
+
+  if (text_len > IRCD_BUFSIZE - 2 - len)
+    text_len = IRCD_BUFSIZE - 2 - len;
+
+  memcpy(buf + len, text, text_len);
+  len += text_len;
+  buf[len++] = '\r';
+  buf[len++] = '\n';
+
+  dbuf_put(&to->connection->buf_sendq, buf, len);
+}
+
+/* sendto_one_reply()
+ *
+ * inputs	- pointer to destination client
+ *		- pointer to reply template
+ * output	- none
+ * side effects	- sends all lines of the template, followed by its body
+ *		  if it has one. For local clients the lines are packed
+ *		  into the sendq back to back.
+ */
+void
+sendto_one_reply(struct Client *to, const struct Reply *reply)
+{
+  char buf[IRCD_BUFSIZE];
+  dlink_node *node;
+
+  if (IsDead(to->from))
+    return;  /* This socket has already been marked as dead */
+
+  const unsigned int count = dlink_list_length(&reply->lines) + (reply->body_numeric != 0);
+  if (count == 0)
+    return;
+
+  if (IsServer(to->from))
+  {
+    DLINK_FOREACH(node, reply->lines.head)
+    {
+      const struct ReplyLine *line = node->data;
+      sendto_one_numeric(to, &me, line->numeric | SND_EXPLICIT, "%s", line->text);
+    }
+
+    if (reply->body_numeric)
+      sendto_one_numeric(to, &me, reply->body_numeric | SND_EXPLICIT, "%s", reply->body);
+    return;
+  }
+
+  const char *dest = to->name;
+  if (EmptyString(dest))
+    dest = "*";
+
+  size_t prefix_len = send_numeric_prefix(buf, 0, dest);
+  if (send_sendq_exceeded(to->from, count * (prefix_len + 2) + reply->len + reply->body_len))
+    return;
+
+  DLINK_FOREACH(node, reply->lines.head)
+  {
+    const struct ReplyLine *line = node->data;
+    reply_put_line(to->from, line->numeric, dest, line->text, line->len);
+  }
+
+  if (reply->body_numeric)
+    reply_put_line(to->from, reply->body_numeric, dest, reply->body, reply->body_len);
+
+  to->from->connection->send.messages += count;
+  me.connection->send.messages += count;
+
+  send_queued_later(to->from);
+}
+
 void
 sendto_one_notice(struct Client *to, const struct Client *from, const char *pattern, ...)
 {
@@ -305,6 +741,9 @@ sendto_one_notice(struct Client *to, const struct Client *from, const char *patt
  *		- vargs message
  * output	- NONE
  * side effects	- message as given is sent to given channel members.
+ *		  Unless the message is for members with a given status
+ *		  only, the remote members are not looked at one by one:
+ *		  it goes to each server link in Channel::routes instead.
  *
  * WARNING - +D clients are ignored
  */
@@ -315,7 +754,6 @@ sendto_channel_butone(struct Client *one, const struct Client *from,
 {
   va_list alocal, aremote;
   struct dbuf_block *local_buf, *remote_buf;
-  dlink_node *node;
 
   local_buf = dbuf_alloc(), remote_buf = dbuf_alloc();
 
@@ -334,19 +772,18 @@ sendto_channel_butone(struct Client *one, const struct Client *from,
   va_end(aremote);
   va_end(alocal);
 
-  ++current_serial;
-
-  DLINK_FOREACH(node, channel->members.head)
+  unsigned int fanout = 0;
+  for (unsigned int i = 0; i < channel->members_local.count; ++i)
   {
-    struct ChannelMember *member = node->data;
-    struct Client *target = member->client;
+    struct ChannelMember *member = channel->members_local.entry[i].member;
+    struct Client *target = channel->members_local.entry[i].client;
 
     assert(IsClient(target));
 
-    if (IsDead(target->from))
+    if (IsDead(target))
       continue;
 
-    if (one && (target->from == one->from))
+    if (one && (target == one->from))
       continue;
 
     if (type && (member->flags & type) == 0)
@@ -355,18 +792,160 @@ sendto_channel_butone(struct Client *one, const struct Client *from,
     if (HasUMode(target, UMODE_DEAF))
       continue;
 
-    if (MyConnect(target))
-      send_message(target, local_buf);
-    else if (target->from->connection->serial != current_serial)
-      send_message_remote(target->from, from, remote_buf);
+    send_message(target, local_buf);
+    ++fanout;
+  }
 
-    target->from->connection->serial = current_serial;
+  if (type == 0)
+  {
+    /*
+     * The servers behind each link filter out their own +D clients,
+     * so every link with at least one member gets the message.
+     */
+    for (unsigned int i = 0; i < channel->routes_count; ++i)
+    {
+      struct Client *link = channel->routes[i].link;
+
+      if (IsDead(link))
+        continue;
+
+      if (one && (link == one->from))
+        continue;
+
+      send_message_remote(link, from, remote_buf);
+      ++fanout;
+    }
+  }
+  else
+  {
+    /* A link only gets the message if a member behind it has the status */
+    ++current_serial;
+
+    for (unsigned int i = 0; i < channel->members.count; ++i)
+    {
+      struct ChannelMember *member = channel->members.entry[i].member;
+      struct Client *target = channel->members.entry[i].client;
+
+      if (MyConnect(target))
+        continue;
+
+      if (target->from->connection->serial == current_serial)
+        continue;
+
+      if (IsDead(target->from))
+        continue;
+
+      if (one && (target->from == one->from))
+        continue;
+
+      if ((member->flags & type) == 0)
+        continue;
+
+      if (HasUMode(target, UMODE_DEAF))
+        continue;
+
+      send_message_remote(target->from, from, remote_buf);
+      target->from->connection->serial = current_serial;
+      ++fanout;
+    }
   }
 
+  perf_add(&PerfStats.fanout, fanout);
+
   dbuf_ref_free(local_buf);
   dbuf_ref_free(remote_buf);
 }
 
+/*! \brief Local server links with a given combination of capabilities */
+struct LinkSet
+{
+  unsigned int caps;  /**< Capabilities every link in the set has */
+  unsigned int nocaps;  /**< Capabilities none of the links in the set has */
+  unsigned int count;  /**< Number of items in LinkSet::links */
+  struct Client **links;  /**< Matching links, in local_server_list order */
+};
+
+/* Number of caps/nocaps combinations remembered by link_set_find() */
+enum { LINK_SET_MAX = 16 };
+
+static struct LinkSet link_sets[LINK_SET_MAX];
+static unsigned int link_set_count;
+static unsigned int link_set_next;
+
+/* link_set_find()
+ *
+ * inputs	- caps or'd together which must ALL be present
+ *		- caps or'd together which must ALL NOT be present
+ * output	- the local server links with these capabilities
+ * side effects	- the set is computed on first use and then remembered
+ *		  until send_links_changed() is called, so propagating a
+ *		  message does not check the capabilities of every link
+ *		  again. Once LINK_SET_MAX combinations are in use, the
+ *		  oldest one is replaced.
+ */
+static const struct LinkSet *
+link_set_find(unsigned int caps, unsigned int nocaps)
+{
+  dlink_node *node;
+  struct LinkSet *set;
+
+  for (unsigned int i = 0; i < link_set_count; ++i)
+    if (link_sets[i].caps == caps && link_sets[i].nocaps == nocaps)
+      return &link_sets[i];
+
+  if (link_set_count < LINK_SET_MAX)
+    set = &link_sets[link_set_count++];
+  else
+  {
+    set = &link_sets[link_set_next];
+    link_set_next = (link_set_next + 1) % LINK_SET_MAX;
+    xfree(set->links);
+  }
+
+  set->caps = caps;
+  set->nocaps = nocaps;
+  set->count = 0;
+  set->links = xcalloc((dlink_list_length(&local_server_list) + 1) * sizeof(*set->links));
+
+  DLINK_FOREACH(node, local_server_list.head)
+  {
+    struct Client *client = node->data;
+
+    /* check we have required capabs */
+    if ((client->connection->caps & caps) != caps)
+      continue;
+
+    /* check we don't have any forbidden capabs */
+    if ((client->connection->caps & nocaps))
+      continue;
+
+    set->links[set->count++] = client;
+  }
+
+  return set;
+}
+
+/* send_links_changed()
+ *
+ * inputs	- NONE
+ * output	- NONE
+ * side effects	- forgets all link sets computed by link_set_find().
+ *		  Must be called whenever a server is added to or removed
+ *		  from local_server_list.
+ */
+void
+send_links_changed(void)
+{
+  for (unsigned int i = 0; i < link_set_count; ++i)
+  {
+    xfree(link_sets[i].links);
+    link_sets[i].links = NULL;
+  }
+
+  link_set_count = 0;
+  link_set_next = 0;
+}
+
 /* sendto_server()
  *
  * inputs       - pointer to client to NOT send to
@@ -392,7 +971,10 @@ sendto_server(const struct Client *one,
               const char *format, ...)
 {
   va_list args;
-  dlink_node *node;
+  const struct LinkSet *const set = link_set_find(caps, nocaps);
+
+  if (set->count == 0)
+    return;
 
   va_start(args, format);
 
@@ -401,9 +983,9 @@ sendto_server(const struct Client *one,
 
   va_end(args);
 
-  DLINK_FOREACH(node, local_server_list.head)
+  for (unsigned int i = 0; i < set->count; ++i)
   {
-    struct Client *client = node->data;
+    struct Client *client = set->links[i];
 
     /* If dead already skip */
     if (IsDead(client))
@@ -413,20 +995,394 @@ sendto_server(const struct Client *one,
     if (one && (client == one->from))
       continue;
 
-    /* check we have required capabs */
-    if ((client->connection->caps & caps) != caps)
+    send_message(client, buffer);
+  }
+
+  dbuf_ref_free(buffer);
+}
+
+/* server_variant_find()
+ *
+ * inputs	- local server link
+ *		- forms of a message, ended by one with a NULL format
+ * output	- index of the first form the link's capabilities match, or
+ *		  of the terminating item if there is none
+ */
+static unsigned int
+server_variant_find(const struct Client *client, const struct ServerVariant *variants)
+{
+  unsigned int n = 0;
+
+  for (; variants[n].format; ++n)
+    if ((client->connection->caps & variants[n].caps) == variants[n].caps &&
+        (client->connection->caps & variants[n].nocaps) == 0)
+      break;
+
+  assert(n < SERVER_VARIANT_MAX);
+  return n;
+}
+
+/* sendto_one_variants()
+ *
+ * inputs	- pointer to server link to send to
+ *		- forms of the message, ended by one with a NULL format
+ *		- args to the format strings
+ * output	- NONE
+ * side effects	- sends the first form the link's capabilities match,
+ *		  as in sendto_server_variants()
+ */
+void
+sendto_one_variants(struct Client *to, const struct ServerVariant *variants, ...)
+{
+  va_list args;
+
+  if (IsDead(to->from))
+    return;  /* This socket has already been marked as dead */
+
+  const struct ServerVariant *const variant = &variants[server_variant_find(to->from, variants)];
+  if (variant->format == NULL)
+    return;
+
+  va_start(args, variants);
+
+  struct dbuf_block *buffer = dbuf_alloc();
+  send_format(buffer, variant->format, args);
+
+  va_end(args);
+
+  send_message(to->from, buffer);
+
+  dbuf_ref_free(buffer);
+}
+
+/* sendto_server_variants()
+ *
+ * inputs	- pointer to client to NOT send to
+ *		- forms of the message, ended by one with a NULL format
+ *		- args to the format strings
+ * output	- NONE
+ * side effects	- Like sendto_server(), but every server gets the first
+ *		  form its capabilities match, and none if no form does.
+ *		  All forms take the same arguments; a form that leaves
+ *		  one out skips it with %.0s. The links are walked once
+ *		  and each form is formatted at most once, rather than
+ *		  calling sendto_server() once per form.
+ */
+void
+sendto_server_variants(const struct Client *one, const struct ServerVariant *variants, ...)
+{
+  va_list args;
+  struct dbuf_block *buffer[SERVER_VARIANT_MAX] = { NULL };
+  const struct LinkSet *const set = link_set_find(0, 0);
+
+  va_start(args, variants);
+
+  for (unsigned int i = 0; i < set->count; ++i)
+  {
+    struct Client *client = set->links[i];
+
+    /* If dead already skip */
+    if (IsDead(client))
       continue;
 
-    /* check we don't have any forbidden capabs */
-    if ((client->connection->caps & nocaps))
+    /* check against 'one' */
+    if (one && (client == one->from))
       continue;
 
-    send_message(client, buffer);
+    const unsigned int n = server_variant_find(client, variants);
+    if (variants[n].format == NULL)
+      continue;
+
+    if (buffer[n] == NULL)
+    {
+      va_list copy;
+
+      va_copy(copy, args);
+      buffer[n] = dbuf_alloc();
+      send_format(buffer[n], variants[n].format, copy);
+      va_end(copy);
+    }
+
+    send_message(client, buffer[n]);
   }
 
+  va_end(args);
+
+  for (unsigned int n = 0; n < SERVER_VARIANT_MAX; ++n)
+    if (buffer[n])
+      dbuf_ref_free(buffer[n]);
+}
+
+/*! \brief Channel a departing client was on, used by sendto_split_quits() */
+struct SplitMember
+{
+  const struct Channel *channel;
+  unsigned int user;  /**< Index into the array of departing clients */
+};
+
+static int
+split_member_cmp(const void *a, const void *b)
+{
+  const struct SplitMember *const ma = a, *const mb = b;
+
+  if (ma->channel != mb->channel)
+    return ma->channel < mb->channel ? -1 : 1;
+  return ma->user < mb->user ? -1 : ma->user > mb->user;
+}
+
+/* split_find_channel()
+ *
+ * inputs	- sorted array of SplitMember items and its length
+ *		- channel to look for
+ * output	- index of the first item for that channel, or count
+ *		  if none of the departing clients is on it
+ */
+static unsigned int
+split_find_channel(const struct SplitMember *members, unsigned int count,
+                   const struct Channel *channel)
+{
+  unsigned int lo = 0, hi = count;
+
+  while (lo < hi)
+  {
+    const unsigned int mid = lo + (hi - lo) / 2;
+
+    if (members[mid].channel < channel)
+      lo = mid + 1;
+    else
+      hi = mid;
+  }
+
+  return (lo < count && members[lo].channel == channel) ? lo : count;
+}
+
+/* sendto_split_quits()
+ *
+ * inputs	- array of remote clients leaving in a netsplit
+ *		- number of clients in that array
+ *		- quit message
+ * output	- NONE
+ * side effects	- Sends the QUITs of all departing clients to the local
+ *		  clients sharing a channel with them. Unlike calling
+ *		  sendto_common_channels_local() for each departing client,
+ *		  every affected channel is visited only once to find the
+ *		  recipients, each recipient only walks the departing members
+ *		  of its own channels, and the QUITs are written to each
+ *		  recipient in batches of up to BATCH_FLUSH_SIZE bytes
+ *		  instead of with one write per message.
+ */
+void
+sendto_split_quits(struct Client *const *users, unsigned int count, const char *comment)
+{
+  unsigned int nmembers = 0, nrecipients = 0;
+  dlink_node *node;
+
+  for (unsigned int i = 0; i < count; ++i)
+    nmembers += dlink_list_length(&users[i]->channel);
+
+  if (nmembers == 0)
+    return;
+
+  struct SplitMember *members = xcalloc(nmembers * sizeof(*members));
+  char **lines = xcalloc(count * sizeof(*lines));
+  size_t *lengths = xcalloc(count * sizeof(*lengths));
+  unsigned int *sent = xcalloc(count * sizeof(*sent));
+  nmembers = 0;
+
+  for (unsigned int i = 0; i < count; ++i)
+  {
+    const struct Client *user = users[i];
+
+    DLINK_FOREACH(node, user->channel.head)
+    {
+      members[nmembers].channel = ((struct ChannelMember *)node->data)->channel;
+      members[nmembers++].user = i;
+    }
+
+    if (dlink_list_length(&user->channel))
+    {
+      char buf[IRCD_BUFSIZE];
+      int len = snprintf(buf, sizeof(buf) - 2, ":%s!%s@%s QUIT :%s",
+                         user->name, user->username, user->host, comment);
+
+      if (len < 0 || (size_t)len > sizeof(buf) - 3)
+        len = sizeof(buf) - 3;
+      buf[len++] = '\r';
+      buf[len++] = '\n';
+
+      lines[i] = xcalloc(len);
+      memcpy(lines[i], buf, len);
+      lengths[i] = len;
+    }
+  }
+
+  qsort(members, nmembers, sizeof(*members), split_member_cmp);
+
+  /* Collect the local clients sharing a channel with any departing client */
+  ++current_serial;
+
+  struct Client **recipients = xcalloc(dlink_list_length(&local_client_list) * sizeof(*recipients));
+
+  for (unsigned int i = 0; i < nmembers; ++i)
+  {
+    if (i && members[i].channel == members[i - 1].channel)
+      continue;
+
+    const struct MemberArray *const local = &members[i].channel->members_local;
+
+    for (unsigned int j = 0; j < local->count; ++j)
+    {
+      struct Client *target = local->entry[j].client;
+
+      if (IsDead(target) || target->connection->serial == current_serial)
+        continue;
+
+      target->connection->serial = current_serial;
+      recipients[nrecipients++] = target;
+    }
+  }
+
+  /* Send each recipient the QUITs of the departing clients it can see */
+  for (unsigned int r = 0; r < nrecipients; ++r)
+  {
+    struct Client *target = recipients[r];
+    size_t pending = 0;
+
+    DLINK_FOREACH(node, target->channel.head)
+    {
+      const struct Channel *channel = ((struct ChannelMember *)node->data)->channel;
+
+      for (unsigned int i = split_find_channel(members, nmembers, channel);
+           i < nmembers && members[i].channel == channel && !IsDead(target); ++i)
+      {
+        const unsigned int user = members[i].user;
+
+        if (sent[user] == r + 1)
+          continue;
+        sent[user] = r + 1;
+
+        if (send_sendq_exceeded(target, lengths[user]))
+          break;
+
+        dbuf_put(&target->connection->buf_sendq, lines[user], lengths[user]);
+        ++target->connection->send.messages;
+        ++me.connection->send.messages;
+
+        if ((pending += lengths[user]) >= BATCH_FLUSH_SIZE)
+        {
+          send_queued_write(target);
+          pending = 0;
+        }
+      }
+    }
+
+    if (pending)
+      send_queued_write(target);
+  }
+
+  for (unsigned int i = 0; i < count; ++i)
+    xfree(lines[i]);
+
+  xfree(members);
+  xfree(lines);
+  xfree(lengths);
+  xfree(sent);
+  xfree(recipients);
+}
+
+/* channel_batch_add()
+ *
+ * inputs	- batch to add to
+ *		- BATCH_* part the line belongs to
+ *		- format string and arguments
+ * output	- NONE
+ * side effects	- formats one line and appends it to the given part
+ */
+void
+channel_batch_add(struct ChannelBatch *batch, unsigned int part, const char *pattern, ...)
+{
+  va_list args;
+  struct dbuf_block *buffer = dbuf_alloc();
+
+  va_start(args, pattern);
+  send_format(buffer, pattern, args);
+  va_end(args);
+
+  dbuf_put(&batch->part[part], buffer->data, buffer->size);
+  ++batch->lines[part];
+
   dbuf_ref_free(buffer);
 }
 
+/* sendto_channel_batch()
+ *
+ * inputs	- channel the batch is for
+ *		- batch of lines built with channel_batch_add()
+ * output	- NONE
+ * side effects	- Sends every local member of the channel one of the JOIN
+ *		  parts depending on whether it has extended-join, the AWAY
+ *		  part if it has away-notify, and the MODE part. The lines
+ *		  are copied straight into each sendq and written once per
+ *		  BATCH_FLUSH_SIZE bytes, so a netjoin costs one walk of the
+ *		  member list per SJOIN instead of several walks per user.
+ *		  The batch is emptied afterwards.
+ */
+void
+sendto_channel_batch(struct Channel *channel, struct ChannelBatch *batch)
+{
+  dlink_node *node;
+
+  for (unsigned int m = 0; m < channel->members_local.count; ++m)
+  {
+    struct Client *target = channel->members_local.entry[m].client;
+    unsigned int parts[3], nparts = 0;
+    size_t pending = 0;
+
+    if (IsDead(target))
+      continue;
+
+    parts[nparts++] = HasCap(target, CAP_EXTENDED_JOIN) ? BATCH_JOIN_EXTENDED : BATCH_JOIN;
+    if (HasCap(target, CAP_AWAY_NOTIFY))
+      parts[nparts++] = BATCH_AWAY;
+    parts[nparts++] = BATCH_MODE;
+
+    for (unsigned int i = 0; i < nparts && !IsDead(target); ++i)
+    {
+      const struct dbuf_queue *queue = &batch->part[parts[i]];
+
+      if (dbuf_length(queue) == 0)
+        continue;
+
+      if (send_sendq_exceeded(target, dbuf_length(queue)))
+        break;
+
+      DLINK_FOREACH(node, queue->blocks.head)
+      {
+        const struct dbuf_block *block = node->data;
+        dbuf_put(&target->connection->buf_sendq, block->data, block->size);
+      }
+
+      target->connection->send.messages += batch->lines[parts[i]];
+      me.connection->send.messages += batch->lines[parts[i]];
+
+      if ((pending += dbuf_length(queue)) >= BATCH_FLUSH_SIZE)
+      {
+        send_queued_write(target);
+        pending = 0;
+      }
+    }
+
+    if (pending)
+      send_queued_write(target);
+  }
+
+  for (unsigned int i = 0; i < BATCH_PARTS; ++i)
+  {
+    dbuf_clear(&batch->part[i]);
+    batch->lines[i] = 0;
+  }
+}
+
 /* sendto_common_channels_local()
  *
  * inputs	- pointer to client
@@ -441,10 +1397,8 @@ sendto_common_channels_local(struct Client *user, bool touser, unsigned int posc
                              unsigned int negcap, const char *pattern, ...)
 {
   va_list args;
-  dlink_node *uptr;
   dlink_node *cptr;
   struct Channel *channel;
-  struct ChannelMember *member;
   struct Client *target;
   struct dbuf_block *buffer = dbuf_alloc();
 
@@ -458,10 +1412,9 @@ sendto_common_channels_local(struct Client *user, bool touser, unsigned int posc
   {
     channel = ((struct ChannelMember *)cptr->data)->channel;
 
-    DLINK_FOREACH(uptr, channel->members_local.head)
+    for (unsigned int i = 0; i < channel->members_local.count; ++i)
     {
-      member = uptr->data;
-      target = member->client;
+      target = channel->members_local.entry[i].client;
 
       if (IsDead(target))
         continue;
@@ -503,17 +1456,16 @@ sendto_channel_local(const struct Client *one, struct Channel *channel, unsigned
                      unsigned int poscap, unsigned int negcap, const char *pattern, ...)
 {
   va_list args;
-  dlink_node *node;
   struct dbuf_block *buffer = dbuf_alloc();
 
   va_start(args, pattern);
   send_format(buffer, pattern, args);
   va_end(args);
 
-  DLINK_FOREACH(node, channel->members_local.head)
+  for (unsigned int i = 0; i < channel->members_local.count; ++i)
   {
-    struct ChannelMember *member = node->data;
-    struct Client *target = member->client;
+    struct ChannelMember *member = channel->members_local.entry[i].member;
+    struct Client *target = channel->members_local.entry[i].client;
 
     if (IsDead(target))
       continue;
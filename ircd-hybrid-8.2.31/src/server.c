@@ -30,6 +30,7 @@
 #include "event.h"
 #include "hash.h"
 #include "irc_string.h"
+#include "intern.h"
 #include "ircd.h"
 #include "ircd_defs.h"
 #include "s_bsd.h"
@@ -99,7 +100,7 @@ write_links_file(void *unused)
      * Mostly for aesthetic reasons - makes it look pretty in mIRC ;)
      * - madmax
      */
-    snprintf(buf, sizeof(buf), "%s %s :1 %s", target_p->name, me.name, target_p->info);
+    snprintf(buf, sizeof(buf), "%s %s :1 %s", target_p->name, me.name, target_p->cold->info);
     dlinkAddTail(xstrdup(buf), make_dlink_node(), &flatten_links);
 
     strlcat(buf, "\n", sizeof(buf));
@@ -357,7 +358,7 @@ struct Server *
 server_make(struct Client *client)
 {
   if (client->serv == NULL)
-    client->serv = xcalloc(sizeof(*client->serv));
+    client->serv = xcalloc_tag(MEMORY_SERVER, sizeof(*client->serv));
 
   return client->serv;
 }
@@ -423,10 +424,10 @@ server_connect(struct MaskItem *conf, struct Client *by)
 
   /* Copy in the server, hostname, fd */
   strlcpy(client->name, conf->name, sizeof(client->name));
-  strlcpy(client->host, conf->host, sizeof(client->host));
+  intern_set(&client->host, conf->host, HOSTLEN);
 
   /* We already converted the ip once, so lets use it - stu */
-  strlcpy(client->sockhost, buf, sizeof(client->sockhost));
+  intern_set(&client->cold->sockhost, buf, HOSTIPLEN);
 
   client->ip = *conf->addr;
   client->connection->fd = fd_open(fd, true, NULL);
@@ -488,7 +489,7 @@ server_finish_tls_handshake(struct Client *client)
 
   sendto_one(client, "SERVER %s 1 :%s%s",
              me.name, ConfigServerHide.hidden ? "(H) " : "",
-             me.info);
+             me.cold->info);
 
   /* If we get here, we're ok, so lets start reading some data */
   read_packet(client->connection->fd, client); 
@@ -537,7 +538,7 @@ server_tls_handshake(fde_t *F, void *data)
 
   comm_settimeout(F, 0, NULL, NULL);
 
-  if (tls_verify_certificate(&F->tls, ConfigServerInfo.message_digest_algorithm, &client->certfp) == false)
+  if (tls_verify_certificate(&F->tls, ConfigServerInfo.message_digest_algorithm, &client->cold->certfp) == false)
     ilog(LOG_TYPE_IRCD, "Server %s gave bad TLS client certificate",
          client_get_name(client, MASK_IP));
 
@@ -632,7 +633,7 @@ server_connect_callback(fde_t *F, int status, void *data)
   sendto_one(client, "CAPAB :%s", capab_get(NULL));
 
   sendto_one(client, "SERVER %s 1 :%s%s", me.name,
-             ConfigServerHide.hidden ? "(H) " : "", me.info);
+             ConfigServerHide.hidden ? "(H) " : "", me.cold->info);
 
   /* If we get here, we're ok, so lets start reading some data */
   read_packet(client->connection->fd, client);
@@ -0,0 +1,64 @@
+/*
+ *  ircd-hybrid: an advanced, lightweight Internet Relay Chat Daemon (ircd)
+ *
+ *  Copyright (c) 2020 ircd-hybrid development team
+ *
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301
+ *  USA
+ */
+
+/*! \file throttle.c
+ * \brief Rate limiting of incoming connections per network prefix.
+ * \version $Id$
+ *
+ * Every IPv4 /24 and IPv6 /64 an incoming connection originates from may
+ * make GlobalSetOptions.prefix_burst connections within the time it takes
+ * to earn them back at GlobalSetOptions.prefix_rate connections per
+ * second.  Connections are counted in the rate_connects sketch of
+ * ratelimit.c, so a flood from many prefixes takes no memory beyond the
+ * sketch itself, and STATS w shows the busiest prefixes.  A prefix over
+ * its limit is refused before anything else is allocated for it.
+ */
+
+#include "stdinc.h"
+#include "throttle.h"
+#include "ircd.h"
+#include "ratelimit.h"
+
+
+/* throttle_check()
+ *
+ * inputs       - address of an incoming connection
+ * output       - true if the connection may proceed, false if its prefix
+ *                is over its limit
+ * side effects - the connection is counted against its prefix
+ */
+bool
+throttle_check(const struct irc_ssaddr *addr)
+{
+  unsigned char key[RATE_PREFIX_KEYLEN];
+
+  if (GlobalSetOptions.prefix_rate == 0)
+    return true;
+
+  const size_t len = ratelimit_prefix_key(addr, key);
+  if (len == 0)
+    return true;
+
+  const unsigned int window = (GlobalSetOptions.prefix_burst + GlobalSetOptions.prefix_rate - 1) /
+                              GlobalSetOptions.prefix_rate;
+  return ratelimit_hit(&rate_connects, window, GlobalSetOptions.prefix_burst, key, len) <
+         GlobalSetOptions.prefix_burst;
+}
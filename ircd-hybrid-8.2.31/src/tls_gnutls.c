@@ -64,6 +64,7 @@ tls_free_credentials(tls_context_t cred)
   gnutls_priority_deinit(cred->priorities);
   gnutls_dh_params_deinit(cred->dh_params);
   gnutls_certificate_free_credentials(cred->x509_cred);
+  gnutls_free(cred->ticket_key.data);
 
   gnutls_global_deinit();
 
@@ -98,6 +99,15 @@ tls_new_credentials(void)
     return false;
   }
 
+  ret = gnutls_session_ticket_key_generate(&context->ticket_key);
+  if (ret != GNUTLS_E_SUCCESS)
+  {
+    ilog(LOG_TYPE_IRCD, "ERROR: Could not generate the TLS session ticket key -- %s", gnutls_strerror(ret));
+    gnutls_certificate_free_credentials(context->x509_cred);
+    xfree(context);
+    return false;
+  }
+
   /* TBD: set ciphers based on serverinfo::tls_cipher_list */
 
   gnutls_priority_init(&context->priorities, tls_default_priority_string, NULL);
@@ -109,6 +119,7 @@ tls_new_credentials(void)
 
     gnutls_certificate_free_credentials(context->x509_cred);
     gnutls_priority_deinit(context->priorities);
+    gnutls_free(context->ticket_key.data);
     xfree(context);
     return false;
   }
@@ -270,12 +281,56 @@ tls_new(tls_data_t *tls_data, int fd, tls_role_t role)
   gnutls_transport_set_int(tls_data->session, fd);
 
   if (role == TLS_ROLE_SERVER)
+  {
     /* Request client certificate if any. */
     gnutls_certificate_server_set_request(tls_data->session, GNUTLS_CERT_REQUEST);
 
+    /* Allow resumption via session tickets; GnuTLS copies the key */
+    gnutls_session_ticket_enable_server(tls_data->session, &tls_data->context->ticket_key);
+    gnutls_db_set_cache_expiration(tls_data->session, TLS_SESSION_TIMEOUT);
+  }
+
   return true;
 }
 
+bool
+tls_session_reused(tls_data_t *tls_data)
+{
+  return gnutls_session_is_resumed(tls_data->session) != 0;
+}
+
+void
+tls_set_session_cache(unsigned int size)
+{
+  /* GnuTLS resumes sessions from tickets only; there is no server side cache to size */
+}
+
+/* tls_rotate_ticket_keys()
+ *
+ * inputs       - nothing
+ * output       - nothing
+ * side effects - replaces the session ticket master key of the current
+ *                credentials. GnuTLS has no notion of a previous key, so
+ *                tickets issued before the rotation fall back to a full
+ *                handshake.
+ */
+void
+tls_rotate_ticket_keys(void *unused)
+{
+  gnutls_datum_t key;
+  struct gnutls_context *context = ConfigServerInfo.tls_ctx;
+
+  if (context == NULL)
+    return;
+
+  if (gnutls_session_ticket_key_generate(&key) != GNUTLS_E_SUCCESS)
+    return;  /* Keep using the current key */
+
+  gnutls_memset(context->ticket_key.data, 0, context->ticket_key.size);
+  gnutls_free(context->ticket_key.data);
+  context->ticket_key = key;
+}
+
 bool
 tls_set_ciphers(tls_data_t *tls_data, const char *cipher_list)
 {
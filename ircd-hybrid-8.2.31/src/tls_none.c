@@ -100,6 +100,22 @@ tls_handshake(tls_data_t *tls_data, tls_role_t role, const char **errstr)
   return 0;
 }
 
+bool
+tls_session_reused(tls_data_t *tls_data)
+{
+  return false;
+}
+
+void
+tls_set_session_cache(unsigned int size)
+{
+}
+
+void
+tls_rotate_ticket_keys(void *unused)
+{
+}
+
 bool
 tls_set_ciphers(tls_data_t *tls_data, const char *cipher_list)
 {
@@ -40,6 +40,21 @@
 
 static bool TLS_initialized;
 
+/*
+ * Session ticket keys. ticket_keys[0] is used to encrypt new tickets,
+ * ticket_keys[1] is the previous key, which is still accepted for
+ * decryption until the next rotation so that tickets issued shortly
+ * before a rotation remain usable.
+ */
+static struct tls_ticket_key
+{
+  unsigned char name[16];
+  unsigned char aes_key[32];
+  unsigned char hmac_key[32];
+} ticket_keys[2];
+
+static const unsigned char tls_session_id_context[] = "ircd-hybrid";
+
 /*
  * report_crypto_errors - Dump crypto error list to log
  */
@@ -64,6 +79,185 @@ tls_is_initialized(void)
   return TLS_initialized;
 }
 
+static bool
+tls_ticket_key_generate(struct tls_ticket_key *key)
+{
+  if (RAND_bytes(key->name, sizeof(key->name)) != 1 ||
+      RAND_bytes(key->aes_key, sizeof(key->aes_key)) != 1 ||
+      RAND_bytes(key->hmac_key, sizeof(key->hmac_key)) != 1)
+  {
+    report_crypto_errors();
+    return false;
+  }
+
+  return true;
+}
+
+/*
+ * tls_ticket_key_cb - Encrypt/decrypt session tickets with our own, rotating
+ * set of keys. Returns 1 on success, 2 if the ticket was decrypted with the
+ * previous key and should be renewed, 0 if no matching key was found, and
+ * -1 on error.
+ */
+#if OPENSSL_VERSION_NUMBER >= 0x30000000L
+static int
+tls_ticket_key_cb(SSL *ssl, unsigned char key_name[16], unsigned char *iv,
+                  EVP_CIPHER_CTX *ctx, EVP_MAC_CTX *hctx, int enc)
+#else
+static int
+tls_ticket_key_cb(SSL *ssl, unsigned char key_name[16], unsigned char *iv,
+                  EVP_CIPHER_CTX *ctx, HMAC_CTX *hctx, int enc)
+#endif
+{
+  const struct tls_ticket_key *key = NULL;
+  int ret = 1;
+
+  if (enc)
+  {
+    key = &ticket_keys[0];
+
+    if (RAND_bytes(iv, EVP_CIPHER_iv_length(EVP_aes_256_cbc())) != 1)
+      return -1;
+
+    memcpy(key_name, key->name, sizeof(key->name));
+
+    if (EVP_EncryptInit_ex(ctx, EVP_aes_256_cbc(), NULL, key->aes_key, iv) != 1)
+      return -1;
+  }
+  else
+  {
+    for (unsigned int i = 0; i < sizeof(ticket_keys) / sizeof(ticket_keys[0]); ++i)
+    {
+      if (memcmp(key_name, ticket_keys[i].name, sizeof(ticket_keys[i].name)) == 0)
+      {
+        key = &ticket_keys[i];
+        ret = i == 0 ? 1 : 2;
+        break;
+      }
+    }
+
+    if (key == NULL)
+      return 0;  /* Unknown or expired key; do a full handshake */
+
+    if (EVP_DecryptInit_ex(ctx, EVP_aes_256_cbc(), NULL, key->aes_key, iv) != 1)
+      return -1;
+  }
+
+#if OPENSSL_VERSION_NUMBER >= 0x30000000L
+  OSSL_PARAM params[] =
+  {
+    OSSL_PARAM_construct_octet_string(OSSL_MAC_PARAM_KEY, (void *)key->hmac_key, sizeof(key->hmac_key)),
+    OSSL_PARAM_construct_utf8_string(OSSL_MAC_PARAM_DIGEST, "sha256", 0),
+    OSSL_PARAM_construct_end()
+  };
+
+  if (EVP_MAC_CTX_set_params(hctx, params) != 1)
+    return -1;
+#else
+  if (HMAC_Init_ex(hctx, key->hmac_key, sizeof(key->hmac_key), EVP_sha256(), NULL) != 1)
+    return -1;
+#endif
+
+  return ret;
+}
+
+/* tls_rotate_ticket_keys()
+ *
+ * inputs       - nothing
+ * output       - nothing
+ * side effects - retires the current session ticket key and generates a
+ *                new one. Called periodically from the event loop.
+ */
+void
+tls_rotate_ticket_keys(void *unused)
+{
+  struct tls_ticket_key key;
+
+  if (tls_ticket_key_generate(&key) == false)
+    return;  /* Keep using the current key */
+
+  ticket_keys[1] = ticket_keys[0];
+  ticket_keys[0] = key;
+
+  OPENSSL_cleanse(&key, sizeof(key));
+}
+
+/* tls_set_session_cache()
+ *
+ * inputs       - maximum number of sessions to cache, 0 disables the cache
+ * output       - nothing
+ * side effects - resizes the server side session cache
+ */
+void
+tls_set_session_cache(unsigned int size)
+{
+  SSL_CTX *ctx = ConfigServerInfo.tls_ctx.server_ctx;
+
+  if (size == 0)
+  {
+    SSL_CTX_set_session_cache_mode(ctx, SSL_SESS_CACHE_OFF);
+    SSL_CTX_flush_sessions(ctx, 0);  /* 0 means flush everything as if all expired */
+  }
+  else
+    SSL_CTX_set_session_cache_mode(ctx, SSL_SESS_CACHE_SERVER);
+
+  SSL_CTX_sess_set_cache_size(ctx, size);
+}
+
+/*
+ * OpenSSL allocates through these so its memory shows up in STATS z.
+ * The size of each block is kept in front of it since OpenSSL does not
+ * pass it on free.
+ */
+union tls_mem_header
+{
+  size_t size;
+  max_align_t align;
+};
+
+static void *
+tls_mem_malloc(size_t size, const char *file, int line)
+{
+  union tls_mem_header *header = malloc(sizeof(*header) + size);
+
+  if (header == NULL)
+    return NULL;
+
+  header->size = size;
+  memory_tag_add(MEMORY_TLS, size);
+  return header + 1;
+}
+
+static void *
+tls_mem_realloc(void *ptr, size_t size, const char *file, int line)
+{
+  if (ptr == NULL)
+    return tls_mem_malloc(size, file, line);
+
+  union tls_mem_header *header = (union tls_mem_header *)ptr - 1;
+  const size_t old_size = header->size;
+
+  if ((header = realloc(header, sizeof(*header) + size)) == NULL)
+    return NULL;
+
+  header->size = size;
+  memory_tag_sub(MEMORY_TLS, old_size);
+  memory_tag_add(MEMORY_TLS, size);
+  return header + 1;
+}
+
+static void
+tls_mem_free(void *ptr, const char *file, int line)
+{
+  if (ptr == NULL)
+    return;
+
+  union tls_mem_header *header = (union tls_mem_header *)ptr - 1;
+
+  memory_tag_sub(MEMORY_TLS, header->size);
+  free(header);
+}
+
 /* tls_init()
  *
  * inputs       - nothing
@@ -73,6 +267,10 @@ tls_is_initialized(void)
 void
 tls_init(void)
 {
+  /* Only possible before OpenSSL has allocated anything */
+  if (CRYPTO_set_mem_functions(tls_mem_malloc, tls_mem_realloc, tls_mem_free) == 0)
+    ilog(LOG_TYPE_IRCD, "Could not hook the OpenSSL allocator; its memory is missing from STATS z");
+
   if ((ConfigServerInfo.tls_ctx.server_ctx = SSL_CTX_new(TLS_server_method())) == NULL)
   {
     const char *s = ERR_lib_error_string(ERR_get_error());
@@ -83,11 +281,33 @@ tls_init(void)
   }
 
   SSL_CTX_set_min_proto_version(ConfigServerInfo.tls_ctx.server_ctx, TLS1_2_VERSION);
-  SSL_CTX_set_options(ConfigServerInfo.tls_ctx.server_ctx, SSL_OP_CIPHER_SERVER_PREFERENCE|SSL_OP_NO_TICKET);
+  SSL_CTX_set_options(ConfigServerInfo.tls_ctx.server_ctx, SSL_OP_CIPHER_SERVER_PREFERENCE);
   SSL_CTX_set_verify(ConfigServerInfo.tls_ctx.server_ctx, SSL_VERIFY_PEER|SSL_VERIFY_CLIENT_ONCE, always_accept_verify_cb);
-  SSL_CTX_set_session_cache_mode(ConfigServerInfo.tls_ctx.server_ctx, SSL_SESS_CACHE_OFF);
   SSL_CTX_set_cipher_list(ConfigServerInfo.tls_ctx.server_ctx, "EECDH+HIGH:EDH+HIGH:HIGH:!aNULL");
 
+  /*
+   * Allow clients to resume sessions, either from the server side session
+   * cache (TLS 1.2 session IDs) or from encrypted session tickets.
+   */
+  SSL_CTX_set_session_id_context(ConfigServerInfo.tls_ctx.server_ctx, tls_session_id_context,
+                                 sizeof(tls_session_id_context) - 1);
+  SSL_CTX_set_timeout(ConfigServerInfo.tls_ctx.server_ctx, TLS_SESSION_TIMEOUT);
+  tls_set_session_cache(TLS_SESSION_CACHE_SIZE);
+
+  if (tls_ticket_key_generate(&ticket_keys[0]) == false ||
+      tls_ticket_key_generate(&ticket_keys[1]) == false)
+  {
+    ilog(LOG_TYPE_IRCD, "ERROR: Could not generate TLS session ticket keys");
+    exit(EXIT_FAILURE);
+    return;  /* Not reached */
+  }
+
+#if OPENSSL_VERSION_NUMBER >= 0x30000000L
+  SSL_CTX_set_tlsext_ticket_key_evp_cb(ConfigServerInfo.tls_ctx.server_ctx, tls_ticket_key_cb);
+#else
+  SSL_CTX_set_tlsext_ticket_key_cb(ConfigServerInfo.tls_ctx.server_ctx, tls_ticket_key_cb);
+#endif
+
   if ((ConfigServerInfo.tls_ctx.client_ctx = SSL_CTX_new(TLS_client_method())) == NULL)
   {
     const char *s = ERR_lib_error_string(ERR_get_error());
@@ -324,6 +544,12 @@ tls_new(tls_data_t *tls_data, int fd, tls_role_t role)
   return true;
 }
 
+bool
+tls_session_reused(tls_data_t *tls_data)
+{
+  return SSL_session_reused(*tls_data) == 1;
+}
+
 bool
 tls_set_ciphers(tls_data_t *tls_data, const char *cipher_list)
 {
@@ -39,6 +39,7 @@
 #endif
 
 static bool TLS_initialized;
+static const unsigned char tls_session_id_context[] = "ircd-hybrid";
 
 /*
  * report_crypto_errors - Dump crypto error list to log
@@ -83,10 +84,19 @@ tls_init(void)
   }
 
   wolfSSL_CTX_SetMinVersion(ConfigServerInfo.tls_ctx.server_ctx, WOLFSSL_TLSV1_2);
-  wolfSSL_CTX_set_session_cache_mode(ConfigServerInfo.tls_ctx.server_ctx, SSL_SESS_CACHE_OFF);
   wolfSSL_CTX_set_verify(ConfigServerInfo.tls_ctx.server_ctx, SSL_VERIFY_PEER|SSL_VERIFY_CLIENT_ONCE, always_accept_verify_cb);
   wolfSSL_CTX_set_cipher_list(ConfigServerInfo.tls_ctx.server_ctx, "EECDH+HIGH:EDH+HIGH:HIGH:!aNULL");
 
+  /*
+   * Allow clients to resume sessions. Session tickets are handled by
+   * wolfSSL's built-in ticket encryption callback, which rotates its
+   * keys on its own.
+   */
+  wolfSSL_CTX_set_session_id_context(ConfigServerInfo.tls_ctx.server_ctx, tls_session_id_context,
+                                     sizeof(tls_session_id_context) - 1);
+  wolfSSL_CTX_set_timeout(ConfigServerInfo.tls_ctx.server_ctx, TLS_SESSION_TIMEOUT);
+  tls_set_session_cache(TLS_SESSION_CACHE_SIZE);
+
   if ((ConfigServerInfo.tls_ctx.client_ctx = wolfSSL_CTX_new(wolfTLS_client_method())) == NULL)
   {
     ilog(LOG_TYPE_IRCD, "ERROR: Could not initialize the TLS client context -- wolfSSL_CTX_new failed");
@@ -303,6 +313,32 @@ tls_new(tls_data_t *tls_data, int fd, tls_role_t role)
   return true;
 }
 
+bool
+tls_session_reused(tls_data_t *tls_data)
+{
+  return wolfSSL_session_reused(*tls_data) == 1;
+}
+
+/* tls_set_session_cache()
+ *
+ * inputs       - 0 disables the session cache, anything else enables it
+ * output       - nothing
+ * side effects - wolfSSL's session cache has a fixed, compile time size,
+ *                so it can only be switched on or off
+ */
+void
+tls_set_session_cache(unsigned int size)
+{
+  wolfSSL_CTX_set_session_cache_mode(ConfigServerInfo.tls_ctx.server_ctx,
+                                     size ? SSL_SESS_CACHE_SERVER : SSL_SESS_CACHE_OFF);
+}
+
+void
+tls_rotate_ticket_keys(void *unused)
+{
+  /* wolfSSL's default ticket encryption callback rotates its own keys */
+}
+
 bool
 tls_set_ciphers(tls_data_t *tls_data, const char *cipher_list)
 {
@@ -0,0 +1,761 @@
+/*
+ *  ircd-hybrid: an advanced, lightweight Internet Relay Chat Daemon (ircd)
+ *
+ *  Copyright (c) 2020 ircd-hybrid development team
+ *
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301
+ *  USA
+ */
+
+/*! \file upgrade.c
+ * \brief Hands listeners, clients and channels over to a newly executed ircd.
+ * \version $Id$
+ *
+ * Before RESTART UPGRADE execs the new binary, upgrade_save() writes the
+ * listening sockets, the registered plaintext clients and the channels
+ * they are in to a state file, and clears close-on-exec on their
+ * sockets. The new process picks the listeners up again while reading
+ * its configuration, and upgrade_restore() rebuilds the clients and
+ * channels right before entering the I/O loop, so none of the TCP
+ * connections is dropped.
+ *
+ * The state file has one item per line; the last argument may contain
+ * spaces if prefixed with ':'. SENDQ and RECVQ lines are followed by
+ * the given number of raw bytes and a newline. An AUTH line names the
+ * auth {} block the CLIENT line after it was let in by, so that clients
+ * that had to give its password are attached to it again.
+ */
+
+#include "stdinc.h"
+#include "list.h"
+#include "upgrade.h"
+#include "channel.h"
+#include "channel_mode.h"
+#include "client.h"
+#include "client_svstag.h"
+#include "conf.h"
+#include "dbuf.h"
+#include "fdlist.h"
+#include "hash.h"
+#include "hostmask.h"
+#include "ipcache.h"
+#include "irc_string.h"
+#include "intern.h"
+#include "ircd.h"
+#include "listener.h"
+#include "log.h"
+#include "memory.h"
+#include "numeric.h"
+#include "packet.h"
+#include "parse.h"
+#include "s_bsd.h"
+#include "send.h"
+#include "watch.h"
+
+
+/** Client flags that still hold for a client once it has been handed over */
+enum
+{
+  UPGRADE_FLAGS = FLAGS_GOTID | FLAGS_CANFLOOD | FLAGS_EXEMPTKLINE | FLAGS_NOLIMIT |
+                  FLAGS_PING_COOKIE | FLAGS_FLOODDONE | FLAGS_EXEMPTRESV | FLAGS_GOTUSER |
+                  FLAGS_FINISHED_AUTH | FLAGS_SERVICE | FLAGS_EXEMPTXLINE
+};
+
+/** Maximum number of arguments of a state file line */
+enum { UPGRADE_MAXPARA = 24 };
+
+static FILE *upgrade_file;
+static char *upgrade_path;
+static int upgrade_listener[UPGRADE_LISTENERS_MAX];
+static unsigned int upgrade_listener_count;
+static bool *upgrade_keep;
+
+
+/* upgrade_keep_fd()
+ *
+ * inputs       - file descriptor
+ * output       - NONE
+ * side effects - fd is left out by upgrade_set_cloexec() and survives execv()
+ */
+static void
+upgrade_keep_fd(int fd)
+{
+  upgrade_keep[fd] = true;
+  fcntl(fd, F_SETFD, fcntl(fd, F_GETFD, 0) & ~FD_CLOEXEC);
+}
+
+static void
+upgrade_save_dbuf(FILE *file, const char *what, const struct dbuf_queue *queue)
+{
+  const dlink_node *node;
+  size_t pos = queue->pos;
+
+  if (dbuf_length(queue) == 0)
+    return;
+
+  fprintf(file, "%s %zu\n", what, dbuf_length(queue));
+
+  DLINK_FOREACH(node, queue->blocks.head)
+  {
+    const struct dbuf_block *block = node->data;
+
+    fwrite(block->data + pos, 1, block->size - pos, file);
+    pos = 0;
+  }
+
+  fputc('\n', file);
+}
+
+static void
+upgrade_save_client(FILE *file, struct Client *client)
+{
+  const struct Connection *const connection = client->connection;
+  const char *opername = "*";
+  const dlink_node *node;
+
+  DLINK_FOREACH(node, connection->confs.head)
+  {
+    const struct MaskItem *conf = node->data;
+
+    if (conf->type == CONF_OPER)
+      opername = conf->name;
+    else if (conf->type == CONF_CLIENT && conf->user && conf->host)
+      fprintf(file, "AUTH %s :%s\n", conf->user, conf->host);
+  }
+
+  upgrade_keep_fd(connection->fd->fd);
+
+  fprintf(file, "CLIENT %d %d %s %s %ju %u %u %s %s %s %s %s %ju %ju %u %u %u %s :%s\n",
+          connection->fd->fd, connection->listener && connection->listener->fd ?
+          connection->listener->fd->fd : -1, client->id, client->name, client->tsinfo,
+          client->umodes, client->flags & UPGRADE_FLAGS, client->username, client->host,
+          client->cold->realhost, client->cold->sockhost, client->cold->account, connection->created_real,
+          connection->created_monotonic, connection->cap_client, connection->cap_active,
+          connection->operflags, opername, client->cold->info);
+
+  if (client->cold->away)
+    fprintf(file, "AWAY :%s\n", client->cold->away);
+
+  DLINK_FOREACH(node, client->cold->svstags.head)
+  {
+    const struct ServicesTag *svstag = node->data;
+    fprintf(file, "SVSTAG %u %u :%s\n", svstag->numeric, svstag->umodes, svstag->tag);
+  }
+
+  DLINK_FOREACH(node, connection->watches.head)
+  {
+    const struct Watch *watch = node->data;
+    fprintf(file, "WATCH %s\n", watch->name);
+  }
+
+  DLINK_FOREACH(node, connection->acceptlist.head)
+  {
+    const struct AcceptItem *accept_p = node->data;
+    fprintf(file, "ACCEPT %s %s %s\n", accept_p->nickptr, accept_p->userptr, accept_p->hostptr);
+  }
+
+  upgrade_save_dbuf(file, "SENDQ", &connection->buf_sendq);
+  upgrade_save_dbuf(file, "RECVQ", &connection->buf_recvq);
+}
+
+static void
+upgrade_save_bans(FILE *file, const dlink_list *list, char letter)
+{
+  const dlink_node *node;
+
+  /* Walk backwards, so restoring them one at a time to the head keeps the order */
+  DLINK_FOREACH_PREV(node, list->tail)
+  {
+    const struct Ban *ban = node->data;
+    fprintf(file, "BAN %c %ju %s :%s\n", letter, ban->when, ban->who, ban->banstr);
+  }
+}
+
+static void
+upgrade_save_channel(FILE *file, const struct Channel *channel)
+{
+  fprintf(file, "CHANNEL %s %ju %u %u :%s\n", channel->name, channel->creation_time,
+          channel->mode.mode, channel->mode.limit, channel->mode.key);
+
+  if (channel->topic[0])
+    fprintf(file, "TOPIC %ju %s :%s\n", channel->topic_time, channel->topic_info, channel->topic);
+
+  upgrade_save_bans(file, &channel->banlist, 'b');
+  upgrade_save_bans(file, &channel->exceptlist, 'e');
+  upgrade_save_bans(file, &channel->invexlist, 'I');
+
+  for (unsigned int i = 0; i < channel->members_local.count; ++i)
+  {
+    const struct ChannelMember *member = channel->members_local.entry[i].member;
+
+    if (!IsDefunct(member->client))
+      fprintf(file, "MEMBER %s %u\n", member->client->id, member->flags);
+  }
+}
+
+/* upgrade_save()
+ *
+ * inputs       - path of the state file
+ * output       - true if the state file has been written
+ * side effects - the sockets of all listeners and registered plaintext
+ *                clients are marked to survive execv()
+ */
+bool
+upgrade_save(const char *path)
+{
+  dlink_node *node;
+  FILE *file = fopen(path, "w");
+
+  if (file == NULL)
+  {
+    ilog(LOG_TYPE_IRCD, "Cannot write upgrade state file %s: %s", path, strerror(errno));
+    return false;
+  }
+
+  upgrade_keep = xcalloc((highest_fd + 1) * sizeof(*upgrade_keep));
+
+  DLINK_FOREACH(node, listener_get_list()->head)
+  {
+    const struct Listener *listener = node->data;
+
+    if (listener->fd)
+    {
+      upgrade_keep_fd(listener->fd->fd);
+      fprintf(file, "LISTENER %d\n", listener->fd->fd);
+    }
+  }
+
+  DLINK_FOREACH(node, local_client_list.head)
+  {
+    struct Client *client = node->data;
+
+    if (!IsDefunct(client) && !HasFlag(client, FLAGS_TLS))
+      upgrade_save_client(file, client);
+  }
+
+  DLINK_FOREACH(node, channel_get_list()->head)
+  {
+    const struct Channel *channel = node->data;
+
+    if (channel->members_local.count)
+      upgrade_save_channel(file, channel);
+  }
+
+  fprintf(file, "END\n");
+
+  if (fclose(file))
+  {
+    ilog(LOG_TYPE_IRCD, "Cannot write upgrade state file %s: %s", path, strerror(errno));
+    unlink(path);
+    return false;
+  }
+
+  return true;
+}
+
+/* upgrade_set_cloexec()
+ *
+ * inputs       - NONE
+ * output       - NONE
+ * side effects - every descriptor upgrade_save() did not hand over is
+ *                closed by execv(); they stay usable should it fail
+ */
+void
+upgrade_set_cloexec(void)
+{
+  for (int fd = LOWEST_SAFE_FD; fd <= highest_fd; ++fd)
+    if (upgrade_keep == NULL || upgrade_keep[fd] == false)
+      fcntl(fd, F_SETFD, fcntl(fd, F_GETFD, 0) | FD_CLOEXEC);
+}
+
+/* upgrade_cancel()
+ *
+ * inputs       - path of the state file
+ * output       - NONE
+ * side effects - undoes upgrade_save() after execv() failed: the state
+ *                file is removed and the descriptors handed over are
+ *                closed on exec again
+ */
+void
+upgrade_cancel(const char *path)
+{
+  unlink(path);
+
+  if (upgrade_keep == NULL)
+    return;
+
+  for (int fd = LOWEST_SAFE_FD; fd <= highest_fd; ++fd)
+    if (upgrade_keep[fd])
+      fcntl(fd, F_SETFD, fcntl(fd, F_GETFD, 0) | FD_CLOEXEC);
+
+  xfree(upgrade_keep);
+  upgrade_keep = NULL;
+}
+
+/* upgrade_load()
+ *
+ * inputs       - path of the state file
+ * output       - NONE
+ * side effects - reads the listening sockets handed over, so that
+ *                upgrade_listener_take() can find them while the
+ *                configuration is read
+ */
+void
+upgrade_load(const char *path)
+{
+  char line[IRCD_BUFSIZE];
+  long pos;
+
+  if ((upgrade_file = fopen(path, "r")) == NULL)
+  {
+    ilog(LOG_TYPE_IRCD, "Cannot read upgrade state file %s: %s", path, strerror(errno));
+    return;
+  }
+
+  upgrade_path = xstrdup(path);
+
+  while ((pos = ftell(upgrade_file)), fgets(line, sizeof(line), upgrade_file))
+  {
+    if (strncmp(line, "LISTENER ", 9))
+    {
+      fseek(upgrade_file, pos, SEEK_SET);
+      break;
+    }
+
+    if (upgrade_listener_count < UPGRADE_LISTENERS_MAX)
+      upgrade_listener[upgrade_listener_count++] = atoi(line + 9);
+  }
+}
+
+static bool
+upgrade_addr_equal(const struct irc_ssaddr *a, const struct irc_ssaddr *b)
+{
+  if (a->ss.ss_family != b->ss.ss_family)
+    return false;
+
+  if (a->ss.ss_family == AF_INET6)
+  {
+    const struct sockaddr_in6 *v6a = (const struct sockaddr_in6 *)a;
+    const struct sockaddr_in6 *v6b = (const struct sockaddr_in6 *)b;
+
+    return v6a->sin6_port == v6b->sin6_port &&
+           memcmp(&v6a->sin6_addr, &v6b->sin6_addr, sizeof(v6a->sin6_addr)) == 0;
+  }
+
+  const struct sockaddr_in *v4a = (const struct sockaddr_in *)a;
+  const struct sockaddr_in *v4b = (const struct sockaddr_in *)b;
+
+  return v4a->sin_port == v4b->sin_port && v4a->sin_addr.s_addr == v4b->sin_addr.s_addr;
+}
+
+/* upgrade_listener_take()
+ *
+ * inputs       - address a listener is about to be bound to
+ * output       - handed over listening socket bound to that address,
+ *                or -1 if there is none
+ * side effects - NONE
+ */
+int
+upgrade_listener_take(const struct irc_ssaddr *addr)
+{
+  for (unsigned int i = 0; i < upgrade_listener_count; ++i)
+  {
+    struct irc_ssaddr bound;
+    socklen_t len = sizeof(bound.ss);
+
+    if (upgrade_listener[i] < 0)
+      continue;
+
+    memset(&bound, 0, sizeof(bound));
+    if (getsockname(upgrade_listener[i], (struct sockaddr *)&bound.ss, &len))
+      continue;
+
+    if (upgrade_addr_equal(&bound, addr))
+    {
+      int fd = upgrade_listener[i];
+
+      upgrade_listener[i] = -1;
+      return fd;
+    }
+  }
+
+  return -1;
+}
+
+/* upgrade_split()
+ *
+ * Splits a state file line into its arguments like parse() does with
+ * protocol messages. Returns the number of arguments.
+ */
+static int
+upgrade_split(char *line, char *parv[])
+{
+  int parc = 0;
+  char *p = line;
+
+  while (*p && parc < UPGRADE_MAXPARA)
+  {
+    if (*p == ':')
+    {
+      parv[parc++] = p + 1;
+      break;
+    }
+
+    parv[parc++] = p;
+
+    if ((p = strchr(p, ' ')) == NULL)
+      break;
+    *p++ = '\0';
+  }
+
+  parv[parc] = NULL;
+  return parc;
+}
+
+static struct Listener *
+upgrade_find_listener(int fd)
+{
+  dlink_node *node;
+
+  DLINK_FOREACH(node, listener_get_list()->head)
+  {
+    struct Listener *listener = node->data;
+
+    if (listener->fd && listener->fd->fd == fd)
+      return listener;
+  }
+
+  return NULL;
+}
+
+/* upgrade_restore_client()
+ *
+ * auth     = auth {} block of the preceding AUTH line, if any
+ * parv[ 1] = fd              parv[ 2] = listener fd     parv[ 3] = id
+ * parv[ 4] = nick            parv[ 5] = ts              parv[ 6] = umodes
+ * parv[ 7] = flags           parv[ 8] = username        parv[ 9] = host
+ * parv[10] = realhost        parv[11] = sockhost        parv[12] = account
+ * parv[13] = created real    parv[14] = created mono    parv[15] = cap client
+ * parv[16] = cap active      parv[17] = operflags       parv[18] = operator name
+ * parv[19] = info
+ */
+static struct Client *
+upgrade_restore_client(struct MaskItem *auth, int parc, char *parv[])
+{
+  struct irc_ssaddr ip;
+  socklen_t len = sizeof(ip.ss);
+
+  if (parc < 20)
+    return NULL;
+
+  int fd = atoi(parv[1]);
+
+  memset(&ip, 0, sizeof(ip));
+  if (fd < LOWEST_SAFE_FD || fd >= hard_fdlimit)
+    return NULL;
+
+  if (getpeername(fd, (struct sockaddr *)&ip.ss, &len))
+  {
+    close(fd);
+    return NULL;
+  }
+
+  if (hash_find_id(parv[3]) || hash_find_client(parv[4]))
+  {
+    close(fd);
+    return NULL;
+  }
+
+  ip.ss_len = len;
+  remove_ipv6_mapping(&ip);
+
+  struct Client *client = client_make(NULL);
+  struct Connection *connection = client->connection;
+
+  connection->fd = fd_open(fd, true, NULL);
+  fd_note(connection->fd, "Nick: %s", parv[4]);
+
+  if ((connection->listener = upgrade_find_listener(atoi(parv[2]))))
+    ++connection->listener->ref_count;
+
+  client->ip = ip;
+  strlcpy(client->id, parv[3], sizeof(client->id));
+  strlcpy(client->name, parv[4], sizeof(client->name));
+  client->tsinfo = strtoumax(parv[5], NULL, 10);
+  client->umodes = strtoul(parv[6], NULL, 10);
+  client->flags = strtoul(parv[7], NULL, 10) & UPGRADE_FLAGS;
+  strlcpy(client->username, parv[8], sizeof(client->username));
+  intern_set(&client->host, parv[9], HOSTLEN);
+  intern_set(&client->cold->realhost, parv[10], HOSTLEN);
+  intern_set(&client->cold->sockhost, parv[11], HOSTIPLEN);
+  strlcpy(client->cold->account, parv[12], sizeof(client->cold->account));
+  strlcpy(client->cold->info, parv[19], sizeof(client->cold->info));
+
+  connection->created_real = strtoumax(parv[13], NULL, 10);
+  connection->created_monotonic = strtoumax(parv[14], NULL, 10);
+  connection->cap_client = strtoul(parv[15], NULL, 10);
+  connection->cap_active = strtoul(parv[16], NULL, 10);
+  connection->registration = 0;
+  connection->last_privmsg = event_base->time.sec_monotonic;
+
+  hash_add_client(client);
+  hash_add_id(client);
+
+  SetClient(client);
+  client->servptr = &me;
+
+  dlinkAdd(client, &client->lnode, &client->servptr->serv->client_list);
+  dlinkAdd(client, &client->node, &global_client_list);
+  dlink_move_node(&connection->lclient_node, &unknown_list, &local_client_list);
+
+  if (HasUMode(client, UMODE_INVISIBLE))
+    ++Count.invisi;
+
+  struct ip_entry *ipcache = ipcache_record_find_or_add(&client->ip);
+  ++ipcache->count_local;
+  AddFlag(client, FLAGS_IPHASH);
+
+  /*
+   * Prefer the auth {} block the client was let in by, it may need a password we no longer
+   * have. If the new configuration dropped it, take the best one that needs none.
+   * upgrade_restore() drops those left without one.
+   */
+  struct MaskItem *conf = auth;
+  if (conf == NULL)
+    conf = find_address_conf(client->cold->realhost, client->username, &client->ip, NULL);
+  else if (!IsConfExemptKline(conf) &&
+           find_conf_by_address(client->cold->realhost, &client->ip, CONF_KLINE, client->username, NULL, 1))
+    conf = NULL;
+
+  if (conf && IsConfClient(conf))
+    conf_attach(client, conf);
+
+  if (HasUMode(client, UMODE_OPER))
+  {
+    if (strcmp(parv[18], "*") && (conf = operator_find(NULL, parv[18])) && conf_attach(client, conf) == 0)
+    {
+      connection->operflags = strtoul(parv[17], NULL, 10);
+      client->handler = OPER_HANDLER;
+
+      ++Count.oper;
+      dlinkAdd(client, make_dlink_node(), &oper_list);
+    }
+    else
+    {
+      DelUMode(client, UMODE_OPER | UMODE_ADMIN);
+      svstag_detach(&client->cold->svstags, RPL_WHOISOPERATOR);
+    }
+  }
+
+  comm_setflush(connection->fd, 1, flood_recalc, client);
+  return client;
+}
+
+static void
+upgrade_restore_dbuf(struct dbuf_queue *queue, size_t length)
+{
+  char buf[DBUF_BLOCK_SIZE];
+
+  while (length)
+  {
+    size_t n = fread(buf, 1, length < sizeof(buf) ? length : sizeof(buf), upgrade_file);
+
+    if (n == 0)
+      break;
+
+    if (queue)
+      dbuf_put(queue, buf, n);
+    length -= n;
+  }
+
+  fgetc(upgrade_file);  /* Trailing newline */
+}
+
+static void
+upgrade_restore_svstag(struct Client *client, char *parv[])
+{
+  struct ServicesTag *svstag = xcalloc(sizeof(*svstag));
+
+  svstag->numeric = strtoul(parv[1], NULL, 10);
+  svstag->umodes = strtoul(parv[2], NULL, 10);
+  svstag->tag = xstrdup(parv[3]);
+
+  dlinkAddTail(svstag, &svstag->node, &client->cold->svstags);
+}
+
+static void
+upgrade_restore_ban(struct Channel *channel, char *parv[])
+{
+  dlink_list *list;
+  unsigned int type;
+
+  switch (*parv[1])
+  {
+    case 'b':
+      list = &channel->banlist;
+      type = CHFL_BAN;
+      break;
+    case 'e':
+      list = &channel->exceptlist;
+      type = CHFL_EXCEPTION;
+      break;
+    case 'I':
+      list = &channel->invexlist;
+      type = CHFL_INVEX;
+      break;
+    default:
+      return;
+  }
+
+  if (add_id(&me, channel, parv[4], list, type))
+  {
+    struct Ban *ban = list->head->data;
+
+    ban->when = strtoumax(parv[2], NULL, 10);
+    strlcpy(ban->who, parv[3], sizeof(ban->who));
+  }
+}
+
+static struct Channel *
+upgrade_restore_channel(int parc, char *parv[])
+{
+  if (parc < 6 || hash_find_channel(parv[1]))
+    return NULL;
+
+  struct Channel *channel = channel_make(parv[1]);
+  channel->creation_time = strtoumax(parv[2], NULL, 10);
+  channel->mode.mode = strtoul(parv[3], NULL, 10);
+  channel->mode.limit = strtoul(parv[4], NULL, 10);
+  strlcpy(channel->mode.key, parv[5], sizeof(channel->mode.key));
+
+  return channel;
+}
+
+static void
+upgrade_restore_channel_done(struct Channel *channel)
+{
+  /* All of its members may have been dropped */
+  if (channel && channel->members.count == 0)
+    channel_free(channel);
+}
+
+/* upgrade_restore()
+ *
+ * inputs       - NONE
+ * output       - NONE
+ * side effects - rebuilds the clients and channels saved by the old
+ *                process, flushes their pending output and removes
+ *                the state file
+ */
+void
+upgrade_restore(void)
+{
+  char line[IRCD_BUFSIZE * 2];
+  char *parv[UPGRADE_MAXPARA + 1];
+  struct Client *client = NULL;
+  struct Channel *channel = NULL;
+  struct MaskItem *auth = NULL;
+  dlink_node *node, *node_next;
+
+  if (upgrade_file == NULL)
+    return;
+
+  while (fgets(line, sizeof(line), upgrade_file))
+  {
+    char *p = strchr(line, '\n');
+    if (p)
+      *p = '\0';
+
+    int parc = upgrade_split(line, parv);
+    if (parc == 0)
+      continue;
+
+    if (strcmp(parv[0], "AUTH") == 0 && parc > 2)
+      auth = find_conf_by_mask(CONF_CLIENT, parv[1], parv[2]);
+    else if (strcmp(parv[0], "CLIENT") == 0)
+    {
+      client = upgrade_restore_client(auth, parc, parv);
+      auth = NULL;
+    }
+    else if (strcmp(parv[0], "SENDQ") == 0 && parc > 1)
+      upgrade_restore_dbuf(client ? &client->connection->buf_sendq : NULL, strtoul(parv[1], NULL, 10));
+    else if (strcmp(parv[0], "RECVQ") == 0 && parc > 1)
+      upgrade_restore_dbuf(client ? &client->connection->buf_recvq : NULL, strtoul(parv[1], NULL, 10));
+    else if (strcmp(parv[0], "AWAY") == 0 && parc > 1 && client)
+      client->cold->away = xstrndup_tag(MEMORY_AWAY, parv[1], AWAYLEN);
+    else if (strcmp(parv[0], "SVSTAG") == 0 && parc > 3 && client)
+      upgrade_restore_svstag(client, parv);
+    else if (strcmp(parv[0], "WATCH") == 0 && parc > 1 && client)
+      watch_add_to_hash_table(parv[1], client);
+    else if (strcmp(parv[0], "ACCEPT") == 0 && parc > 3 && client)
+      add_accept(parv[1], parv[2], parv[3], client);
+    else if (strcmp(parv[0], "CHANNEL") == 0)
+    {
+      upgrade_restore_channel_done(channel);
+      channel = upgrade_restore_channel(parc, parv);
+    }
+    else if (strcmp(parv[0], "TOPIC") == 0 && parc > 3 && channel)
+      channel_set_topic(channel, parv[3], parv[2], strtoumax(parv[1], NULL, 10), false);
+    else if (strcmp(parv[0], "BAN") == 0 && parc > 4 && channel)
+      upgrade_restore_ban(channel, parv);
+    else if (strcmp(parv[0], "MEMBER") == 0 && parc > 2 && channel)
+    {
+      struct Client *member = hash_find_id(parv[1]);
+
+      if (member && MyClient(member) && !IsMember(member, channel))
+        add_user_to_channel(channel, member, strtoul(parv[2], NULL, 10), false);
+    }
+    else if (strcmp(parv[0], "END") == 0)
+      break;
+  }
+
+  upgrade_restore_channel_done(channel);
+
+  fclose(upgrade_file);
+  upgrade_file = NULL;
+  unlink(upgrade_path);
+  xfree(upgrade_path);
+  upgrade_path = NULL;
+
+  /* Listening sockets the new configuration has no listen {} block for */
+  for (unsigned int i = 0; i < upgrade_listener_count; ++i)
+    if (upgrade_listener[i] >= 0)
+      close(upgrade_listener[i]);
+  upgrade_listener_count = 0;
+
+  if (dlink_list_length(&local_client_list) > Count.max_loc)
+    Count.max_loc = dlink_list_length(&local_client_list);
+  if (dlink_list_length(&local_client_list) > Count.max_loc_con)
+    Count.max_loc_con = dlink_list_length(&local_client_list);
+  if (dlink_list_length(&global_client_list) > Count.max_tot)
+    Count.max_tot = dlink_list_length(&global_client_list);
+
+  ilog(LOG_TYPE_IRCD, "Upgrade: restored %u clients and %u channels",
+       dlink_list_length(&local_client_list), dlink_list_length(channel_get_list()));
+
+  DLINK_FOREACH_SAFE(node, node_next, local_client_list.head)
+  {
+    client = node->data;
+
+    if (dlink_list_length(&client->connection->confs) == 0)
+    {
+      exit_client(client, "No auth {} block after server upgrade");
+      continue;
+    }
+
+    comm_setselect(client->connection->fd, COMM_SELECT_READ, read_packet, client, 0);
+    send_queued_write(client);
+  }
+}
@@ -33,6 +33,7 @@
 #include "hash.h"
 #include "id.h"
 #include "irc_string.h"
+#include "intern.h"
 #include "ircd.h"
 #include "listener.h"
 #include "motd.h"
@@ -89,6 +90,19 @@ const struct user_modes  umode_tab[] =
   { '\0', 0 }
 };
 
+/*
+ * UID as sent to other servers, by introduce_client() and in the burst.
+ * Servers without RHOST don't get the real host.
+ *
+ * TBR: compatibility mode
+ */
+const struct ServerVariant uid_variants[] =
+{
+  { CAPAB_RHOST, 0, ":%s UID %s %u %ju %s %s %s %s %s %s %s :%s" },
+  { 0, CAPAB_RHOST, ":%s UID %s %u %ju %s %s %s %.0s%s %s %s :%s" },
+  { 0, 0, NULL }
+};
+
 void
 user_modes_init(void)
 {
@@ -143,6 +157,41 @@ show_lusers(struct Client *client)
   }
 }
 
+/* show_who()
+ *
+ * inputs       - pointer to client requesting who
+ *              - pointer to client to do who on
+ *              - The reported name
+ *              - channel flags
+ * output       - NONE
+ * side effects - do a who on given person
+ */
+void
+show_who(struct Client *source_p, const struct Client *target_p,
+         const char *name, const char *op_flags)
+{
+  char status[8] = "";  /* sizeof("Gr*@%+") + 2 */
+
+  if (HasUMode(source_p, UMODE_OPER))
+    snprintf(status, sizeof(status), "%c%s%s%s", target_p->cold->away ? 'G' : 'H',
+             HasUMode(target_p, UMODE_REGISTERED) ? "r" : "",
+             HasUMode(target_p, UMODE_OPER) ? "*" : "", op_flags);
+  else
+    snprintf(status, sizeof(status), "%c%s%s%s", target_p->cold->away ? 'G' : 'H',
+             HasUMode(target_p, UMODE_REGISTERED) ? "r" : "",
+             HasUMode(target_p, UMODE_OPER) &&
+             !HasUMode(target_p, UMODE_HIDDEN) ? "*" : "", op_flags);
+
+  const bool hide = ConfigServerHide.hide_servers || IsHidden(target_p->servptr);
+  struct Reply reply = { .body_numeric = 0 };
+
+  reply_body(&reply, RPL_WHOREPLY, name ? name : "*", target_p->username, target_p->host,
+             hide && !HasUMode(source_p, UMODE_OPER) ? "*" : target_p->servptr->name,
+             target_p->name, status, hide && !HasUMode(source_p, UMODE_OPER) ? 0 : target_p->hopcount,
+             target_p->cold->info);
+  sendto_one_reply(source_p, &reply);
+}
+
 /* report_and_set_user_flags()
  *
  * inputs       - pointer to client
@@ -202,7 +251,6 @@ report_and_set_user_flags(struct Client *client, const struct MaskItem *conf)
 static void
 introduce_client(struct Client *client)
 {
-  dlink_node *node;
   char buf[UMODE_MAX_STR] = "";
 
   send_umode(client, MyConnect(client), 0, buf);
@@ -214,36 +262,17 @@ introduce_client(struct Client *client)
     buf[1] = '\0';
   }
 
-  DLINK_FOREACH(node, local_server_list.head)
-  {
-    struct Client *server = node->data;
-
-    if (server == client->from)
-      continue;
-
-    /* TBR: compatibility mode */
-    if (IsCapable(server, CAPAB_RHOST))
-      sendto_one(server, ":%s UID %s %u %ju %s %s %s %s %s %s %s :%s",
-                 client->servptr->id,
-                 client->name, client->hopcount+1,
-                 client->tsinfo,
-                 buf, client->username, client->host, client->realhost,
-                 client->sockhost, client->id,
-                 client->account,
-                 client->info);
-    else
-      sendto_one(server, ":%s UID %s %u %ju %s %s %s %s %s %s :%s",
-                 client->servptr->id,
-                 client->name, client->hopcount+1,
-                 client->tsinfo,
-                 buf, client->username, client->host,
-                 client->sockhost, client->id,
-                 client->account,
-                 client->info);
-
-    if (!EmptyString(client->certfp))
-      sendto_one(server, ":%s CERTFP %s", client->id, client->certfp);
-  }
+  sendto_server_variants(client, uid_variants,
+                         client->servptr->id,
+                         client->name, client->hopcount+1,
+                         client->tsinfo,
+                         buf, client->username, client->host, client->cold->realhost,
+                         client->cold->sockhost, client->id,
+                         client->cold->account,
+                         client->cold->info);
+
+  if (!EmptyString(client->cold->certfp))
+    sendto_server(client, 0, 0, ":%s CERTFP %s", client->id, client->cold->certfp);
 }
 
 /* user_welcome()
@@ -267,7 +296,7 @@ user_welcome(struct Client *client)
   }
 
   sendto_one_numeric(client, &me, RPL_WELCOME, ConfigServerInfo.network_name,
-                     client->name, client->username, client->realhost);
+                     client->name, client->username, client->cold->realhost);
   /*
   sendto_one_numeric(client, &me, RPL_YOURHOST,
                      listener_get_name(client->connection->listener), PATCHLEVEL);
@@ -400,14 +429,14 @@ register_local_user(struct Client *client)
 
   if (!HasFlag(client, FLAGS_EXEMPTXLINE))
   {
-    const struct GecosItem *gecos = gecos_find(client->info, match);
+    const struct GecosItem *gecos = gecos_find(client->cold->info, match);
     if (gecos)
     {
       sendto_realops_flags(UMODE_REJ, L_ALL, SEND_NOTICE,
                            "X-line Rejecting [%s] [%s], user %s [%s]",
-                           client->info, gecos->reason,
+                           client->cold->info, gecos->reason,
                            client_get_name(client, HIDE_IP),
-                           client->sockhost);
+                           client->cold->sockhost);
       ++ServerStats.is_ref;
       exit_client(client, "Bad user info");
       return;
@@ -423,10 +452,10 @@ register_local_user(struct Client *client)
 
   sendto_realops_flags(UMODE_CCONN, L_ALL, SEND_NOTICE,
                        "Client connecting: %s (%s@%s) [%s] {%s} [%s] <%s>",
-                       client->name, client->username, client->realhost,
-                       client->sockhost,
+                       client->name, client->username, client->cold->realhost,
+                       client->cold->sockhost,
                        get_client_class(&client->connection->confs),
-                       client->info, client->id);
+                       client->cold->info, client->id);
 
   if (ConfigGeneral.invisible_on_connect)
   {
@@ -504,8 +533,8 @@ register_remote_user(struct Client *client)
     sendto_realops_flags(UMODE_FARCONNECT, L_ALL, SEND_NOTICE,
                          "Client connecting at %s: %s (%s@%s) [%s] [%s] <%s>",
                          client->servptr->name,
-                         client->name, client->username, client->realhost,
-                         client->sockhost, client->info, client->id);
+                         client->name, client->username, client->cold->realhost,
+                         client->cold->sockhost, client->cold->info, client->id);
 
   introduce_client(client);
 }
@@ -705,7 +734,7 @@ user_set_hostmask(struct Client *client, const char *hostname)
                                client->name, client->username,
                                client->host, client->username, hostname);
 
-  strlcpy(client->host, hostname, sizeof(client->host));
+  intern_set(&client->host, hostname, HOSTLEN);
 
   if (MyConnect(client))
   {
@@ -747,7 +776,7 @@ user_set_hostmask(struct Client *client, const char *hostname)
     sendto_channel_local(client, member->channel, 0, CAP_EXTENDED_JOIN, CAP_CHGHOST, ":%s!%s@%s JOIN %s %s :%s",
                          client->name, client->username,
                          client->host, member->channel->name,
-                         client->account, client->info);
+                         client->cold->account, client->cold->info);
     sendto_channel_local(client, member->channel, 0, 0, CAP_EXTENDED_JOIN | CAP_CHGHOST, ":%s!%s@%s JOIN :%s",
                          client->name, client->username,
                          client->host, member->channel->name);
@@ -758,9 +787,9 @@ user_set_hostmask(struct Client *client, const char *hostname)
                            modebuf, nickbuf);
   }
 
-  if (client->away[0])
+  if (client->cold->away)
     sendto_common_channels_local(client, false, CAP_AWAY_NOTIFY, CAP_CHGHOST,
                                  ":%s!%s@%s AWAY :%s",
                                  client->name, client->username,
-                                 client->host, client->away);
+                                 client->host, client->cold->away);
 }
@@ -53,17 +53,6 @@ static dlink_list watchTable[HASHSIZE];
  *       |- client1
  */
 
-/*! \brief Counts up memory used by watch list headers
- */
-void
-watch_count_memory(unsigned int *const count, size_t *const bytes)
-{
-  for (unsigned int i = 0; i < HASHSIZE; ++i)
-    (*count) += dlink_list_length(&watchTable[i]);
-
-  (*bytes) = *count * sizeof(struct Watch);
-}
-
 /*! \brief Notifies all clients that have client's name on
  *         their watch list.
  * \param client Pointer to Client struct
@@ -87,7 +76,7 @@ watch_check_hash(const struct Client *client, const enum irc_numerics reply)
   DLINK_FOREACH(node, watch->watched_by.head)
     sendto_one_numeric(node->data, &me, reply, client->name,
                        client->username, client->host,
-                       watch->lasttime, client->info);
+                       watch->lasttime, client->cold->info);
 }
 
 /*! \brief Looks up the watch table for a given name
@@ -122,7 +111,7 @@ watch_add_to_hash_table(const char *name, struct Client *client)
   /* If found NULL (no header for this name), make one... */
   if ((watch = watch_find_hash(name)) == NULL)
   {
-    watch = xcalloc(sizeof(*watch));
+    watch = xcalloc_tag(MEMORY_WATCH, sizeof(*watch));
 
     strlcpy(watch->name, name, sizeof(watch->name));
     watch->hash_value = strhash(watch->name);
@@ -171,7 +160,7 @@ watch_del_from_hash_table(const char *name, struct Client *client)
   {
     assert(dlinkFind(&watchTable[watch->hash_value], watch));
     dlinkDelete(&watch->node, &watchTable[watch->hash_value]);
-    xfree(watch);
+    xfree_tag(MEMORY_WATCH, watch, sizeof(*watch));
   }
 }
 
@@ -200,7 +189,7 @@ watch_del_watch_list(struct Client *client)
       assert(dlinkFind(&watchTable[watch->hash_value], watch));
       dlinkDelete(&watch->node, &watchTable[watch->hash_value]);
 
-      xfree(watch);
+      xfree_tag(MEMORY_WATCH, watch, sizeof(*watch));
     }
 
     dlinkDelete(node, &client->connection->watches);
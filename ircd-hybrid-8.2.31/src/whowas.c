@@ -31,6 +31,7 @@
 #include "client.h"
 #include "hash.h"
 #include "irc_string.h"
+#include "intern.h"
 #include "ircd.h"
 #include "conf.h"
 
@@ -58,11 +59,16 @@ static struct Whowas *
 whowas_unlink(struct Whowas *whowas)
 {
   if (whowas->online)
-    dlinkDelete(&whowas->cnode, &whowas->online->whowas_list);
+    dlinkDelete(&whowas->cnode, &whowas->online->cold->whowas_list);
 
   dlinkDelete(&whowas->hnode, &whowas_hash[whowas->hash_value]);
   dlinkDelete(&whowas->lnode, &whowas_list);
 
+  intern_put(whowas->hostname);
+  intern_put(whowas->realhost);
+  intern_put(whowas->sockhost);
+  intern_put(whowas->servername);
+
   return whowas;
 }
 
@@ -74,7 +80,7 @@ static void
 whowas_free(struct Whowas *whowas)
 {
   whowas_unlink(whowas);
-  xfree(whowas);
+  xfree_tag(MEMORY_WHOWAS, whowas, sizeof(*whowas));
 }
 
 /*! \brief Returns a Whowas struct for further use. Either allocates
@@ -90,7 +96,7 @@ whowas_make(void)
       dlink_list_length(&whowas_list) >= ConfigGeneral.whowas_history_length)
     whowas = whowas_unlink(whowas_list.tail->data);  /* Re-use oldest item */
   else
-    whowas = xcalloc(sizeof(*whowas));
+    whowas = xcalloc_tag(MEMORY_WHOWAS, sizeof(*whowas));
 
   return whowas;
 }
@@ -124,19 +130,19 @@ whowas_add_history(struct Client *client, bool online)
   whowas->logoff = event_base->time.sec_real;
   whowas->server_hidden = IsHidden(client->servptr) != 0;
 
-  strlcpy(whowas->account, client->account, sizeof(whowas->account));
+  strlcpy(whowas->account, client->cold->account, sizeof(whowas->account));
   strlcpy(whowas->name, client->name, sizeof(whowas->name));
   strlcpy(whowas->username, client->username, sizeof(whowas->username));
-  strlcpy(whowas->hostname, client->host, sizeof(whowas->hostname));
-  strlcpy(whowas->realhost, client->realhost, sizeof(whowas->realhost));
-  strlcpy(whowas->sockhost, client->sockhost, sizeof(whowas->sockhost));
-  strlcpy(whowas->realname, client->info, sizeof(whowas->realname));
-  strlcpy(whowas->servername, client->servptr->name, sizeof(whowas->servername));
+  whowas->hostname = intern_ref(client->host);
+  whowas->realhost = intern_ref(client->cold->realhost);
+  whowas->sockhost = intern_ref(client->cold->sockhost);
+  strlcpy(whowas->realname, client->cold->info, sizeof(whowas->realname));
+  whowas->servername = intern_get(client->servptr->name, HOSTLEN);
 
   if (online == true)
   {
     whowas->online = client;
-    dlinkAdd(whowas, &whowas->cnode, &client->whowas_list);
+    dlinkAdd(whowas, &whowas->cnode, &client->cold->whowas_list);
   }
   else
     whowas->online = NULL;
@@ -153,12 +159,12 @@ whowas_add_history(struct Client *client, bool online)
 void
 whowas_off_history(struct Client *client)
 {
-  while (client->whowas_list.head)
+  while (client->cold->whowas_list.head)
   {
-    struct Whowas *whowas = client->whowas_list.head->data;
+    struct Whowas *whowas = client->cold->whowas_list.head->data;
 
     whowas->online = NULL;
-    dlinkDelete(&whowas->cnode, &client->whowas_list);
+    dlinkDelete(&whowas->cnode, &client->cold->whowas_list);
   }
 }
 
@@ -188,12 +194,3 @@ whowas_get_history(const char *name, uintmax_t timelimit)
 
   return NULL;
 }
-
-/*! \brief For debugging. Counts allocated structures stored in whowas_list
- */
-void
-whowas_count_memory(unsigned int *const count, size_t *const bytes)
-{
-  (*count) = dlink_list_length(&whowas_list);
-  (*bytes) = dlink_list_length(&whowas_list) * sizeof(struct Whowas);
-}
@@ -0,0 +1,1407 @@
+/*
+ *  ircd-hybrid: an advanced, lightweight Internet Relay Chat Daemon (ircd)
+ *
+ *  Copyright (c) 2020 ircd-hybrid development team
+ *
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301
+ *  USA
+ */
+
+/*! \file ircd-bench.c
+ * \brief Synthetic load generator and end-to-end benchmark for ircd.
+ * \version $Id$
+ *
+ * Starts the ircd of the build tree, or any other one given with -i, on
+ * loopback with a generated configuration,
+ * then drives simulated clients and simulated TS6 server links through
+ * a sequence of scenarios.  For every scenario the number of operations,
+ * their rate, the p50/p99 latency, and the CPU time and resident set
+ * size of the ircd process are reported, either as a table or as one
+ * JSON object per line for regression tracking.
+ *
+ * The upgrade scenario is not part of "all": RESTART UPGRADE executes
+ * the installed ircd, which need not be the one the other scenarios ran.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdarg.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <inttypes.h>
+#include <string.h>
+#include <limits.h>
+#include <errno.h>
+#include <time.h>
+#include <unistd.h>
+#include <fcntl.h>
+#include <signal.h>
+#include <dirent.h>
+#include <poll.h>
+#include <sys/types.h>
+#include <sys/socket.h>
+#include <sys/resource.h>
+#include <sys/wait.h>
+#include <netinet/in.h>
+#include <arpa/inet.h>
+
+#ifndef BENCH_IRCD_PATH
+#define BENCH_IRCD_PATH "ircd"
+#endif
+#ifndef BENCH_MODULE_PATH
+#define BENCH_MODULE_PATH ""
+#endif
+
+enum
+{
+  READBUF_SIZE   = 16384,
+  LINE_SIZE      = 512,
+  SJOIN_LENGTH   = 400,  /* Bytes of UIDs per SJOIN line */
+  POLL_INTERVAL  = 20,   /* Milliseconds */
+  START_TIMEOUT  = 10    /* Seconds to wait for the ircd to listen */
+};
+
+enum conn_type
+{
+  CONN_CLIENT,
+  CONN_SERVER,
+  CONN_TRANSIENT  /* Client of the reconnect scenario; freed once closed */
+};
+
+struct conn
+{
+  int fd;
+  enum conn_type type;
+  bool connecting;  /* Non-blocking connect() still in progress */
+  bool registered;
+  bool closed;
+  bool pending;  /* Waiting for the reply to a timed request */
+  uint64_t started;  /* When the connection or the timed request was started */
+  char sid[4];  /* Server connections only */
+  char name[32];
+  char *wbuf;
+  size_t wlen;
+  size_t wsize;
+  char rbuf[READBUF_SIZE];
+  size_t rlen;
+};
+
+struct result
+{
+  const char *name;
+  uintmax_t count;  /* Operations the rate is computed from */
+  uint64_t elapsed;  /* Microseconds */
+  uintmax_t cpu_ms;
+  uintmax_t rss_kb;
+  bool timeout;
+};
+
+static struct
+{
+  const char *ircd;
+  const char *modules;  /* Build tree modules/ directory; empty for the installed ones */
+  const char *scenarios;
+  unsigned int clients;
+  unsigned int servers;
+  unsigned int users;
+  unsigned int channels;
+  unsigned int messages;
+  unsigned int reconnects;
+  unsigned int window;
+  unsigned int timeout;
+  unsigned int port;
+  bool json;
+  bool keep;
+} opt =
+{
+  .ircd = BENCH_IRCD_PATH,
+  .modules = BENCH_MODULE_PATH,
+  .scenarios = "all",
+  .clients = 100,
+  .servers = 4,
+  .users = 1000,
+  .channels = 20,
+  .messages = 20000,
+  .reconnects = 2000,
+  .window = 64,
+  .timeout = 60,
+  .port = 16900
+};
+
+static struct conn **conns;
+static unsigned int conns_length;
+static unsigned int conns_size;
+
+static struct conn **clients;
+static unsigned int clients_length;
+static struct conn **links;
+static unsigned int links_length;
+
+static uint32_t *samples;
+static size_t samples_length;
+static size_t samples_size;
+
+static uintmax_t delivered;  /* PRIVMSGs received by clients and links */
+static unsigned int completed;  /* Timed requests answered */
+static unsigned int names_ended;  /* RPL_ENDOFNAMES received */
+static unsigned int lusers_servers;  /* Server count from the last RPL_LUSERCLIENT */
+static unsigned int transient_active;
+static unsigned int upgrade_notices;  /* Clients told their connection is kept */
+static unsigned int upgrade_verified;  /* Clients still in #upgrade under their own nick */
+
+static bool joined_flood;
+static bool joined_fanout;
+static bool joined_upgrade;
+
+static pid_t ircd_pid = -1;
+static char workdir[] = "/tmp/ircd-bench.XXXXXX";
+static bool header_printed;
+static bool failed;
+
+
+static uint64_t
+now_usec(void)
+{
+  struct timespec ts;
+
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return (uint64_t)ts.tv_sec * 1000000 + ts.tv_nsec / 1000;
+}
+
+static void *
+xrealloc(void *ptr, size_t size)
+{
+  void *ret = realloc(ptr, size);
+
+  if (ret == NULL)
+  {
+    fprintf(stderr, "ircd-bench: out of memory\n");
+    exit(EXIT_FAILURE);
+  }
+
+  return ret;
+}
+
+static void
+sample_add(uint64_t usec)
+{
+  if (samples_length == samples_size)
+  {
+    samples_size = samples_size ? samples_size * 2 : 4096;
+    samples = xrealloc(samples, samples_size * sizeof(*samples));
+  }
+
+  samples[samples_length++] = usec > UINT32_MAX ? UINT32_MAX : usec;
+}
+
+static int
+sample_cmp(const void *a, const void *b)
+{
+  const uint32_t x = *(const uint32_t *)a, y = *(const uint32_t *)b;
+
+  return (x > y) - (x < y);
+}
+
+static uint32_t
+sample_percentile(unsigned int pct)
+{
+  if (samples_length == 0)
+    return 0;
+
+  return samples[(samples_length - 1) * pct / 100];
+}
+
+
+/*
+ * Connections
+ */
+
+static void
+conn_write(struct conn *conn, const char *fmt, ...)
+{
+  char buf[LINE_SIZE];
+  va_list args;
+
+  va_start(args, fmt);
+  int len = vsnprintf(buf, sizeof(buf) - 2, fmt, args);
+  va_end(args);
+
+  if (len < 0)
+    return;
+  if ((size_t)len > sizeof(buf) - 3)
+    len = sizeof(buf) - 3;
+
+  buf[len++] = '\r';
+  buf[len++] = '\n';
+
+  if (conn->wlen + len > conn->wsize)
+  {
+    while (conn->wlen + len > conn->wsize)
+      conn->wsize = conn->wsize ? conn->wsize * 2 : 4096;
+    conn->wbuf = xrealloc(conn->wbuf, conn->wsize);
+  }
+
+  memcpy(conn->wbuf + conn->wlen, buf, len);
+  conn->wlen += len;
+}
+
+static void
+conn_close(struct conn *conn)
+{
+  if (conn->closed)
+    return;
+
+  close(conn->fd);
+  conn->fd = -1;
+  conn->closed = true;
+  conn->wlen = 0;
+
+  if (conn->type == CONN_TRANSIENT)
+  {
+    --transient_active;
+    ++completed;
+  }
+}
+
+static struct conn *
+conn_open(enum conn_type type)
+{
+  struct sockaddr_in sin = { .sin_family = AF_INET, .sin_port = htons(opt.port) };
+  int fd = socket(AF_INET, SOCK_STREAM, 0);
+
+  if (fd == -1)
+  {
+    perror("ircd-bench: socket");
+    exit(EXIT_FAILURE);
+  }
+
+  fcntl(fd, F_SETFL, fcntl(fd, F_GETFL) | O_NONBLOCK);
+  sin.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+
+  struct conn *conn = xrealloc(NULL, sizeof(*conn));
+  memset(conn, 0, sizeof(*conn));
+  conn->fd = fd;
+  conn->type = type;
+  conn->started = now_usec();
+
+  if (type == CONN_TRANSIENT)
+    ++transient_active;
+
+  if (connect(fd, (struct sockaddr *)&sin, sizeof(sin)) == -1)
+  {
+    if (errno != EINPROGRESS)
+      conn_close(conn);
+    else
+      conn->connecting = true;
+  }
+
+  if (conns_length == conns_size)
+  {
+    conns_size = conns_size ? conns_size * 2 : 256;
+    conns = xrealloc(conns, conns_size * sizeof(*conns));
+  }
+
+  conns[conns_length++] = conn;
+  return conn;
+}
+
+/* Only ever called between two rounds of bench_poll() */
+static void
+conn_free(struct conn *conn)
+{
+  conn_close(conn);
+
+  for (unsigned int i = 0; i < conns_length; ++i)
+  {
+    if (conns[i] == conn)
+    {
+      conns[i] = conns[--conns_length];
+      break;
+    }
+  }
+
+  free(conn->wbuf);
+  free(conn);
+}
+
+static void
+conn_line(struct conn *conn, char *line)
+{
+  char *command = line, *params;
+
+  if (*command == ':')
+  {
+    if ((command = strchr(command, ' ')) == NULL)
+      return;
+    ++command;
+  }
+
+  if ((params = strchr(command, ' ')))
+    *params++ = '\0';
+  else
+    params = command + strlen(command);
+
+  if (strcmp(command, "PING") == 0)
+  {
+    if (conn->type == CONN_SERVER)
+      conn_write(conn, ":%s PONG %s %s", conn->sid, conn->name, params);
+    else
+      conn_write(conn, "PONG %s", params);
+    return;
+  }
+
+  if (strcmp(command, "PRIVMSG") == 0)
+  {
+    const char *text = strstr(params, " :");
+
+    if (text && strncmp(text + 2, "BENCH ", 6) == 0)
+    {
+      sample_add(now_usec() - strtoull(text + 8, NULL, 10));
+      ++delivered;
+    }
+
+    return;
+  }
+
+  if (conn->type == CONN_SERVER)
+  {
+    if (strcmp(command, "PONG") == 0 && conn->pending)
+    {
+      conn->pending = false;
+      sample_add(now_usec() - conn->started);
+      ++completed;
+    }
+
+    return;
+  }
+
+  if (strcmp(command, "001") == 0)
+  {
+    conn->registered = true;
+
+    if (conn->type == CONN_TRANSIENT)
+    {
+      sample_add(now_usec() - conn->started);
+      conn_write(conn, "QUIT");
+    }
+  }
+  else if (strcmp(command, "366") == 0)
+    ++names_ended;
+  else if (strcmp(command, "NOTICE") == 0)
+  {
+    if (strstr(params, "your connection is kept"))
+      ++upgrade_notices;
+  }
+  else if (strcmp(command, "319") == 0)
+  {
+    /* RPL_WHOISCHANNELS of a client asking about itself: "<nick> <nick> :<channels>" */
+    const size_t len = strlen(conn->name);
+    const char *channels = strstr(params, " :");
+
+    if (channels && strncmp(params, conn->name, len) == 0 && params[len] == ' ' &&
+        strncmp(params + len + 1, conn->name, len) == 0 && strstr(channels, "#upgrade"))
+      ++upgrade_verified;
+  }
+  else if (strcmp(command, "323") == 0 || strcmp(command, "315") == 0 ||
+           strcmp(command, "318") == 0)
+  {
+    if (conn->pending)
+    {
+      conn->pending = false;
+      sample_add(now_usec() - conn->started);
+      ++completed;
+    }
+  }
+  else if (strcmp(command, "251") == 0)
+  {
+    const char *on = strstr(params, " on ");
+
+    if (on)
+      lusers_servers = strtoul(on + 4, NULL, 10);
+  }
+}
+
+static void
+conn_read(struct conn *conn)
+{
+  while (true)
+  {
+    ssize_t len = read(conn->fd, conn->rbuf + conn->rlen, sizeof(conn->rbuf) - conn->rlen - 1);
+
+    if (len == 0 || (len < 0 && errno != EAGAIN && errno != EINTR))
+    {
+      conn_close(conn);
+      return;
+    }
+
+    if (len < 0)
+      return;
+
+    conn->rlen += len;
+    conn->rbuf[conn->rlen] = '\0';
+
+    char *line = conn->rbuf, *eol;
+    while ((eol = strchr(line, '\n')))
+    {
+      *eol = '\0';
+      if (eol > line && eol[-1] == '\r')
+        eol[-1] = '\0';
+
+      conn_line(conn, line);
+
+      if (conn->closed)
+        return;
+      line = eol + 1;
+    }
+
+    conn->rlen -= line - conn->rbuf;
+    memmove(conn->rbuf, line, conn->rlen);
+
+    if (conn->rlen == sizeof(conn->rbuf) - 1)
+      conn->rlen = 0;  /* Overlong line; drop it */
+  }
+}
+
+static void
+conn_flush(struct conn *conn)
+{
+  if (conn->connecting)
+  {
+    int err = 0;
+    socklen_t len = sizeof(err);
+
+    getsockopt(conn->fd, SOL_SOCKET, SO_ERROR, &err, &len);
+
+    if (err)
+    {
+      conn_close(conn);
+      return;
+    }
+
+    conn->connecting = false;
+  }
+
+  if (conn->wlen == 0)
+    return;
+
+  ssize_t len = write(conn->fd, conn->wbuf, conn->wlen);
+
+  if (len < 0)
+  {
+    if (errno != EAGAIN && errno != EINTR)
+      conn_close(conn);
+    return;
+  }
+
+  conn->wlen -= len;
+  memmove(conn->wbuf, conn->wbuf + len, conn->wlen);
+}
+
+static void
+bench_poll(int timeout)
+{
+  static struct pollfd *pfd;
+  static unsigned int pfd_size;
+  const unsigned int count = conns_length;
+
+  if (pfd_size < count)
+  {
+    pfd_size = conns_size;
+    pfd = xrealloc(pfd, pfd_size * sizeof(*pfd));
+  }
+
+  for (unsigned int i = 0; i < count; ++i)
+  {
+    pfd[i].fd = conns[i]->fd;
+    pfd[i].events = POLLIN;
+    pfd[i].revents = 0;
+
+    if (conns[i]->connecting || conns[i]->wlen)
+      pfd[i].events |= POLLOUT;
+  }
+
+  if (poll(pfd, count, timeout) <= 0)
+    return;
+
+  for (unsigned int i = 0; i < count; ++i)
+  {
+    struct conn *conn = conns[i];
+
+    if (conn->closed)
+      continue;
+
+    if (pfd[i].revents & (POLLOUT | POLLERR))
+      conn_flush(conn);
+
+    if (conn->closed == false && (pfd[i].revents & (POLLIN | POLLHUP | POLLERR)))
+      conn_read(conn);
+  }
+}
+
+/* bench_run()
+ *
+ * inputs       - function deciding whether the scenario is done
+ *              - function called every round to generate load; may be NULL
+ * output       - true if done() became true, false on timeout
+ * side effects - processes traffic on every connection
+ */
+static bool
+bench_run(bool (*done)(void), void (*tick)(void))
+{
+  const uint64_t deadline = now_usec() + (uint64_t)opt.timeout * 1000000;
+
+  while (done() == false)
+  {
+    if (now_usec() > deadline)
+      return false;
+
+    if (tick)
+      tick();
+
+    /* Push freshly queued data out before waiting */
+    for (unsigned int i = 0; i < conns_length; ++i)
+      if (conns[i]->wlen && conns[i]->connecting == false && conns[i]->closed == false)
+        conn_flush(conns[i]);
+
+    bench_poll(POLL_INTERVAL);
+  }
+
+  return true;
+}
+
+
+/*
+ * The ircd process
+ */
+
+static void
+ircd_cpu_rss(uintmax_t *cpu_ms, uintmax_t *rss_kb)
+{
+  char path[64], buf[1024];
+  FILE *file;
+
+  *cpu_ms = *rss_kb = 0;
+
+  snprintf(path, sizeof(path), "/proc/%d/stat", (int)ircd_pid);
+  if ((file = fopen(path, "r")))
+  {
+    if (fgets(buf, sizeof(buf), file))
+    {
+      const char *p = strrchr(buf, ')');
+      unsigned long utime = 0, stime = 0;
+
+      /* Fields 14 and 15; the first one after the command name is field 3 */
+      if (p && sscanf(p + 2, "%*c %*d %*d %*d %*d %*d %*u %*u %*u %*u %*u %lu %lu",
+                      &utime, &stime) == 2)
+        *cpu_ms = (uintmax_t)(utime + stime) * 1000 / sysconf(_SC_CLK_TCK);
+    }
+
+    fclose(file);
+  }
+
+  snprintf(path, sizeof(path), "/proc/%d/status", (int)ircd_pid);
+  if ((file = fopen(path, "r")))
+  {
+    while (fgets(buf, sizeof(buf), file))
+      if (strncmp(buf, "VmRSS:", 6) == 0)
+        *rss_kb = strtoumax(buf + 6, NULL, 10);
+
+    fclose(file);
+  }
+}
+
+static void
+ircd_write_conf(const char *path)
+{
+  FILE *file = fopen(path, "w");
+
+  if (file == NULL)
+  {
+    perror("ircd-bench: ircd.conf");
+    exit(EXIT_FAILURE);
+  }
+
+  fprintf(file,
+          "serverinfo {\n"
+          "  name = \"bench.local\";\n"
+          "  sid = \"0BE\";\n"
+          "  description = \"ircd-bench\";\n"
+          "  network_name = \"BenchNet\";\n"
+          "  hub = yes;\n"
+          "  default_max_clients = 100000;\n"
+          "  max_nick_length = 30;\n"
+          "};\n"
+          "admin { name = \"bench\"; description = \"bench\"; email = \"bench\"; };\n"
+          "class { name = \"users\"; ping_time = 5 minutes; max_number = 100000;\n"
+          "        number_per_ip_local = 0; number_per_ip_global = 0;\n"
+          "        sendq = 64 megabytes; recvq = 8000 bytes; };\n"
+          "class { name = \"server\"; ping_time = 5 minutes; connectfreq = 5 minutes; max_number = 100;\n"
+          "        sendq = 256 megabytes; };\n"
+          "listen { host = \"127.0.0.1\"; port = %u; };\n"
+          "auth { user = \"*@*\"; password = \"bench\"; class = \"users\";\n"
+          "       flags = exceed_limit, no_tilde, can_flood; };\n"
+          "operator { name = \"bench\"; user = \"*@127.0.0.1\"; password = \"bench\"; encrypted = no;\n"
+          "           class = \"users\"; flags = restart; };\n"
+          "exempt { ip = \"127.0.0.0/8\"; };\n"
+          "general {\n"
+          "  throttle_time = 0;\n"
+          "  ping_cookie = no;\n"
+          "  disable_auth = yes;\n"
+          "};\n", opt.port);
+
+  for (unsigned int i = 0; i < opt.servers; ++i)
+    fprintf(file, "connect { name = \"bench%u.fake\"; host = \"127.0.0.1\"; port = %u;\n"
+                  "          send_password = \"bench\"; accept_password = \"bench\"; class = \"server\"; };\n",
+            i, opt.port);
+
+  fclose(file);
+}
+
+static void
+ircd_start(void)
+{
+  char conf[64], log[64], pid[64], kline[64], dline[64], xline[64], resv[64];
+
+  if (mkdtemp(workdir) == NULL)
+  {
+    perror("ircd-bench: mkdtemp");
+    exit(EXIT_FAILURE);
+  }
+
+  snprintf(conf, sizeof(conf), "%s/ircd.conf", workdir);
+  snprintf(log, sizeof(log), "%s/ircd.log", workdir);
+  snprintf(pid, sizeof(pid), "%s/ircd.pid", workdir);
+  snprintf(kline, sizeof(kline), "%s/kline.db", workdir);
+  snprintf(dline, sizeof(dline), "%s/dline.db", workdir);
+  snprintf(xline, sizeof(xline), "%s/xline.db", workdir);
+  snprintf(resv, sizeof(resv), "%s/resv.db", workdir);
+  ircd_write_conf(conf);
+
+  if ((ircd_pid = fork()) == -1)
+  {
+    perror("ircd-bench: fork");
+    exit(EXIT_FAILURE);
+  }
+
+  if (ircd_pid == 0)
+  {
+    int fd = open("/dev/null", O_RDWR);
+
+    dup2(fd, STDIN_FILENO);
+    dup2(fd, STDOUT_FILENO);
+    dup2(fd, STDERR_FILENO);
+
+    char core[PATH_MAX], *argv[] =
+    {
+      (char *)opt.ircd, "-foreground", "-configfile", conf, "-logfile", log,
+      "-pidfile", pid, "-klinefile", kline, "-dlinefile", dline,
+      "-xlinefile", xline, "-resvfile", resv, NULL, NULL, NULL, NULL, NULL
+    };
+
+    if (*opt.modules)
+    {
+      /* An ircd that has not been installed loads the modules of its build tree */
+      snprintf(core, sizeof(core), "%s/core", opt.modules);
+      argv[16] = "-modulepath";
+      argv[17] = core;
+      argv[18] = "-automodulepath";
+      argv[19] = (char *)opt.modules;
+    }
+
+    execv(opt.ircd, argv);
+    _exit(127);
+  }
+
+  const uint64_t deadline = now_usec() + START_TIMEOUT * 1000000;
+
+  while (now_usec() < deadline)
+  {
+    struct sockaddr_in sin = { .sin_family = AF_INET, .sin_port = htons(opt.port) };
+    int fd = socket(AF_INET, SOCK_STREAM, 0);
+
+    sin.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+
+    if (connect(fd, (struct sockaddr *)&sin, sizeof(sin)) == 0)
+    {
+      close(fd);
+      return;
+    }
+
+    close(fd);
+
+    if (waitpid(ircd_pid, NULL, WNOHANG) == ircd_pid)
+      break;
+
+    usleep(100000);
+  }
+
+  fprintf(stderr, "ircd-bench: %s did not start listening on port %u; see %s\n",
+          opt.ircd, opt.port, log);
+  opt.keep = true;
+  exit(EXIT_FAILURE);
+}
+
+static void
+ircd_stop(void)
+{
+  if (ircd_pid > 0)
+  {
+    kill(ircd_pid, SIGTERM);
+    waitpid(ircd_pid, NULL, 0);
+    ircd_pid = -1;
+  }
+
+  if (opt.keep)
+  {
+    fprintf(stderr, "ircd-bench: files kept in %s\n", workdir);
+    return;
+  }
+
+  DIR *dir = opendir(workdir);
+  if (dir)
+  {
+    const struct dirent *ent;
+    char path[sizeof(workdir) + 256];
+
+    while ((ent = readdir(dir)))
+    {
+      if (strcmp(ent->d_name, ".") && strcmp(ent->d_name, ".."))
+      {
+        snprintf(path, sizeof(path), "%s/%s", workdir, ent->d_name);
+        unlink(path);
+      }
+    }
+
+    closedir(dir);
+    rmdir(workdir);
+  }
+}
+
+
+/*
+ * Setup shared between the scenarios
+ */
+
+static bool
+done_clients_registered(void)
+{
+  for (unsigned int i = 0; i < clients_length; ++i)
+    if (clients[i]->registered == false && clients[i]->closed == false)
+      return false;
+  return true;
+}
+
+static void
+clients_ensure(void)
+{
+  if (clients)
+    return;
+
+  clients = xrealloc(NULL, opt.clients * sizeof(*clients));
+
+  for (clients_length = 0; clients_length < opt.clients; ++clients_length)
+  {
+    struct conn *conn = conn_open(CONN_CLIENT);
+
+    snprintf(conn->name, sizeof(conn->name), "bench%u", clients_length);
+    conn_write(conn, "PASS bench");
+    conn_write(conn, "NICK %s", conn->name);
+    conn_write(conn, "USER bench 0 * :ircd-bench client");
+    clients[clients_length] = conn;
+  }
+
+  if (bench_run(done_clients_registered, NULL) == false)
+  {
+    fprintf(stderr, "ircd-bench: clients failed to register\n");
+    exit(EXIT_FAILURE);
+  }
+}
+
+static unsigned int names_wanted;
+
+static bool
+done_names(void)
+{
+  return names_ended >= names_wanted;
+}
+
+static void
+clients_join(const char *channel, bool *joined)
+{
+  if (*joined)
+    return;
+
+  clients_ensure();
+  names_ended = 0;
+  names_wanted = clients_length;
+
+  for (unsigned int i = 0; i < clients_length; ++i)
+    conn_write(clients[i], "JOIN %s", channel);
+
+  if (bench_run(done_names, NULL) == false)
+  {
+    fprintf(stderr, "ircd-bench: clients failed to join %s\n", channel);
+    exit(EXIT_FAILURE);
+  }
+
+  *joined = true;
+}
+
+/* Introduces opt.users clients on a fake server and joins them to channels */
+static void
+link_burst(struct conn *conn, unsigned int server)
+{
+  const uintmax_t ts = time(NULL) - 3600;
+  char uids[SJOIN_LENGTH + 16];
+  char uid[10];
+  size_t len = 0;
+
+  conn_write(conn, "PASS bench TS 6 %s", conn->sid);
+  conn_write(conn, "CAPAB :QS EOB");
+  conn_write(conn, "SERVER %s 1 :ircd-bench link", conn->name);
+  conn_write(conn, "SVINFO 6 6 0 :%ju", (uintmax_t)time(NULL));
+
+  for (unsigned int i = 0; i < opt.users; ++i)
+  {
+    snprintf(uid, sizeof(uid), "%sA%05u", conn->sid, i % 100000);
+    conn_write(conn, ":%s UID s%uu%u 1 %ju +i bench user%u.bench%u.fake 127.0.0.1 %s * :ircd-bench user",
+               conn->sid, server, i, ts, i, server, uid);
+  }
+
+  /* Every user joins one of the shared channels and the big #fanout channel */
+  for (unsigned int chan = 0; chan <= opt.channels; ++chan)
+  {
+    char name[32];
+
+    if (chan == opt.channels)
+      strcpy(name, "#fanout");
+    else
+      snprintf(name, sizeof(name), "#bench%u", chan);
+
+    for (unsigned int i = 0; i < opt.users; ++i)
+    {
+      if (chan < opt.channels && i % opt.channels != chan)
+        continue;
+
+      len += snprintf(uids + len, sizeof(uids) - len, "%s%sA%05u", len ? " " : "", conn->sid, i % 100000);
+
+      if (len >= SJOIN_LENGTH)
+      {
+        conn_write(conn, ":%s SJOIN %ju %s +nt :%s", conn->sid, ts, name, uids);
+        len = 0;
+      }
+    }
+
+    if (len)
+    {
+      conn_write(conn, ":%s SJOIN %ju %s +nt :%s", conn->sid, ts, name, uids);
+      len = 0;
+    }
+  }
+
+  conn_write(conn, ":%s EOB", conn->sid);
+  conn_write(conn, ":%s PING %s", conn->sid, conn->name);
+  conn->pending = true;
+}
+
+static bool
+done_completed_links(void)
+{
+  return completed >= links_length;
+}
+
+static bool
+links_connect(void)
+{
+  links = xrealloc(NULL, opt.servers * sizeof(*links));
+  completed = 0;
+
+  for (links_length = 0; links_length < opt.servers; ++links_length)
+  {
+    struct conn *conn = conn_open(CONN_SERVER);
+
+    snprintf(conn->sid, sizeof(conn->sid), "%u%c%c", links_length % 10,
+             'B' + (links_length / 10) % 24, 'S');
+    snprintf(conn->name, sizeof(conn->name), "bench%u.fake", links_length);
+    link_burst(conn, links_length);
+    links[links_length] = conn;
+  }
+
+  return bench_run(done_completed_links, NULL);
+}
+
+static bool
+done_lusers(void)
+{
+  return lusers_servers == 1;
+}
+
+static uint64_t lusers_last;
+
+static void
+tick_lusers(void)
+{
+  if (now_usec() - lusers_last > POLL_INTERVAL * 1000)
+  {
+    conn_write(clients[0], "LUSERS");
+    lusers_last = now_usec();
+  }
+}
+
+static void
+links_free(void)
+{
+  for (unsigned int i = 0; i < links_length; ++i)
+    conn_free(links[i]);
+
+  free(links);
+  links = NULL;
+  links_length = 0;
+}
+
+static bool
+links_split(void)
+{
+  links_free();
+
+  lusers_servers = 0;
+  return bench_run(done_lusers, tick_lusers);
+}
+
+
+/*
+ * Scenarios
+ */
+
+static void
+report(struct result *res)
+{
+  const double seconds = res->elapsed / 1000000.0;
+  const double rate = res->elapsed ? res->count / seconds : 0;
+  char p50[16] = "-", p99[16] = "-";
+
+  qsort(samples, samples_length, sizeof(*samples), sample_cmp);
+
+  /* Scenarios that take no latency samples report none rather than 0 */
+  if (samples_length)
+  {
+    snprintf(p50, sizeof(p50), "%" PRIu32, sample_percentile(50));
+    snprintf(p99, sizeof(p99), "%" PRIu32, sample_percentile(99));
+  }
+
+  if (opt.json)
+    printf("{\"scenario\":\"%s\",\"count\":%ju,\"seconds\":%.6f,\"rate\":%.1f,"
+           "\"p50_us\":%s,\"p99_us\":%s,\"cpu_ms\":%ju,\"rss_kb\":%ju,"
+           "\"clients\":%u,\"servers\":%u,\"timeout\":%s}\n",
+           res->name, res->count, seconds, rate,
+           samples_length ? p50 : "null", samples_length ? p99 : "null",
+           res->cpu_ms, res->rss_kb, opt.clients, opt.servers, res->timeout ? "true" : "false");
+  else
+  {
+    if (header_printed == false)
+    {
+      printf("%-10s %10s %9s %12s %9s %9s %8s %8s\n", "scenario", "count", "seconds",
+             "rate/s", "p50(us)", "p99(us)", "cpu(ms)", "rss(kB)");
+      header_printed = true;
+    }
+
+    printf("%-10s %10ju %9.3f %12.1f %9s %9s %8ju %8ju%s\n",
+           res->name, res->count, seconds, rate, p50, p99,
+           res->cpu_ms, res->rss_kb, res->timeout ? " (timed out)" : "");
+  }
+
+  fflush(stdout);
+
+  if (res->timeout)
+    failed = true;
+}
+
+static uint64_t measure_start;
+static uintmax_t measure_cpu;
+
+static void
+measure_begin(void)
+{
+  uintmax_t rss;
+
+  samples_length = 0;
+  delivered = 0;
+  completed = 0;
+  ircd_cpu_rss(&measure_cpu, &rss);
+  measure_start = now_usec();
+}
+
+static void
+measure_end(struct result *res, const char *name, uintmax_t count, bool ok)
+{
+  res->name = name;
+  res->count = count;
+  res->elapsed = now_usec() - measure_start;
+  res->timeout = ok == false;
+  ircd_cpu_rss(&res->cpu_ms, &res->rss_kb);
+  res->cpu_ms -= measure_cpu;
+  report(res);
+}
+
+/* Messages to a channel, paced so no more than opt.window are in flight */
+static const char *msg_channel;
+static unsigned int msg_senders;
+static unsigned int msg_recipients;
+static uintmax_t msg_sent;
+
+static bool
+done_messages(void)
+{
+  return msg_sent == opt.messages && delivered >= msg_sent * msg_recipients;
+}
+
+static void
+tick_messages(void)
+{
+  while (msg_sent < opt.messages &&
+         msg_sent * msg_recipients - delivered < (uintmax_t)opt.window * msg_recipients)
+  {
+    conn_write(clients[msg_sent % msg_senders], "PRIVMSG %s :BENCH %" PRIu64,
+               msg_channel, now_usec());
+    ++msg_sent;
+  }
+}
+
+static void
+scenario_messages(const char *name, const char *channel, unsigned int senders,
+                  unsigned int recipients)
+{
+  struct result res;
+
+  msg_channel = channel;
+  msg_senders = senders;
+  msg_recipients = recipients;
+  msg_sent = 0;
+
+  measure_begin();
+  bool ok = bench_run(done_messages, tick_messages);
+  measure_end(&res, name, delivered, ok);
+}
+
+/* Every client talks in one channel only local clients are in */
+static void
+scenario_flood(void)
+{
+  clients_join("#flood", &joined_flood);
+
+  if (clients_length < 2)
+    return;
+  scenario_messages("flood", "#flood", clients_length, clients_length - 1);
+}
+
+/* One client talks in a channel shared by every client and every linked user */
+static void
+scenario_fanout(void)
+{
+  clients_join("#fanout", &joined_fanout);
+
+  /* A link gets a single copy for all of its users */
+  unsigned int recipients = clients_length - 1 + (opt.users ? links_length : 0);
+
+  scenario_messages("fanout", "#fanout", 1, recipients);
+}
+
+static void
+scenario_burst(void)
+{
+  struct result res;
+
+  if (links)
+    links_split();
+
+  measure_begin();
+  bool ok = links_connect();
+  measure_end(&res, "burst", (uintmax_t)opt.servers * opt.users, ok);
+}
+
+static void
+scenario_split(void)
+{
+  struct result res;
+
+  clients_ensure();
+
+  if (links == NULL && links_connect() == false)
+    return;
+
+  measure_begin();
+  bool ok = links_split();
+  measure_end(&res, "split", (uintmax_t)opt.servers * opt.users, ok);
+}
+
+static bool
+done_requests(void)
+{
+  return completed >= clients_length;
+}
+
+/* Every client sends the same request at once and waits for its end of list numeric */
+static void
+scenario_requests(const char *name, const char *request)
+{
+  struct result res;
+
+  clients_ensure();
+  measure_begin();
+
+  for (unsigned int i = 0; i < clients_length; ++i)
+  {
+    clients[i]->pending = true;
+    clients[i]->started = now_usec();
+    conn_write(clients[i], "%s", request);
+  }
+
+  bool ok = bench_run(done_requests, NULL);
+  measure_end(&res, name, completed, ok);
+}
+
+static void
+scenario_list(void)
+{
+  scenario_requests("list", "LIST");
+}
+
+static void
+scenario_who(void)
+{
+  scenario_requests("who", "WHO #fanout");
+}
+
+static unsigned int reconnect_started;
+
+static bool
+done_reconnect(void)
+{
+  return completed >= opt.reconnects;
+}
+
+static void
+tick_reconnect(void)
+{
+  for (unsigned int i = 0; i < conns_length; )
+  {
+    if (conns[i]->type == CONN_TRANSIENT && conns[i]->closed)
+      conn_free(conns[i]);
+    else
+      ++i;
+  }
+
+  while (reconnect_started < opt.reconnects && transient_active < opt.clients)
+  {
+    struct conn *conn = conn_open(CONN_TRANSIENT);
+
+    snprintf(conn->name, sizeof(conn->name), "r%u", reconnect_started++);
+    conn_write(conn, "PASS bench");
+    conn_write(conn, "NICK %s", conn->name);
+    conn_write(conn, "USER bench 0 * :ircd-bench reconnect");
+  }
+}
+
+/* Clients connect, register and quit again as fast as the server lets them */
+static void
+scenario_reconnect(void)
+{
+  struct result res;
+
+  reconnect_started = 0;
+  measure_begin();
+  bool ok = bench_run(done_reconnect, tick_reconnect);
+  measure_end(&res, "reconnect", completed, ok);
+  tick_reconnect();  /* Free what is left */
+}
+
+static bool
+done_upgrade_notices(void)
+{
+  return upgrade_notices >= clients_length;
+}
+
+static bool
+done_upgrade_delivered(void)
+{
+  return delivered >= clients_length - 1;
+}
+
+/*
+ * The ircd executes itself again while every client is in #upgrade.  Every
+ * client then asks about itself, which confirms it still has its nick and
+ * channel, and a message to #upgrade has to reach all of them.  The auth {}
+ * block needs a password, so the clients have to be attached to it again
+ * without one.
+ */
+static void
+scenario_upgrade(void)
+{
+  struct result res;
+
+  clients_join("#upgrade", &joined_upgrade);
+  conn_write(clients[0], "OPER bench bench");
+
+  measure_begin();
+  upgrade_notices = 0;
+  upgrade_verified = 0;
+
+  conn_write(clients[0], "RESTART bench.local UPGRADE");
+  bool ok = bench_run(done_upgrade_notices, NULL);
+
+  if (ok)
+  {
+    for (unsigned int i = 0; i < clients_length; ++i)
+    {
+      clients[i]->pending = true;
+      clients[i]->started = now_usec();
+      conn_write(clients[i], "WHOIS %s", clients[i]->name);
+    }
+
+    ok = bench_run(done_requests, NULL);
+  }
+
+  if (ok)
+  {
+    conn_write(clients[0], "PRIVMSG #upgrade :BENCH %" PRIu64, now_usec());
+    ok = bench_run(done_upgrade_delivered, NULL);
+  }
+
+  measure_end(&res, "upgrade", upgrade_verified, ok);
+
+  /* Server links are not handed over; the ircd has closed them */
+  links_free();
+
+  if (ok && upgrade_verified < clients_length)
+  {
+    fprintf(stderr, "ircd-bench: only %u of %u clients kept their nick and channel\n",
+            upgrade_verified, clients_length);
+    failed = true;
+  }
+}
+
+static const struct
+{
+  const char *name;
+  void (*handler)(void);
+} scenario_tab[] =
+{
+  { "flood",     scenario_flood     },
+  { "burst",     scenario_burst     },
+  { "fanout",    scenario_fanout    },
+  { "list",      scenario_list      },
+  { "who",       scenario_who       },
+  { "split",     scenario_split     },
+  { "reconnect", scenario_reconnect },
+  { "upgrade",   scenario_upgrade   },
+  { NULL, NULL }
+};
+
+static void
+usage(void)
+{
+  fprintf(stderr,
+          "ircd-bench [-i ircd] [-M modules] [-s scenarios] [-c clients] [-m servers] [-u users]\n"
+          "           [-C channels] [-n messages] [-r reconnects] [-w window]\n"
+          "           [-t timeout] [-p port] [-j] [-k]\n"
+          "-i ircd       ircd binary to start [%s]\n"
+          "-M modules    modules/ directory of the build tree the ircd comes from, or \"\"\n"
+          "              for the installed modules; -i alone implies \"\" [%s]\n"
+          "-s scenarios  comma separated list of scenarios to run, in order, or \"all\"\n"
+          "              (flood,burst,fanout,list,who,split,reconnect); upgrade executes\n"
+          "              the installed ircd and has to be asked for\n"
+          "-c clients    number of simulated clients [%u]\n"
+          "-m servers    number of simulated server links [%u]\n"
+          "-u users      users introduced by each server link [%u]\n"
+          "-C channels   channels the users of a link are spread over [%u]\n"
+          "-n messages   messages sent by the flood and fanout scenarios [%u]\n"
+          "-r reconnects connections made by the reconnect scenario [%u]\n"
+          "-w window     messages in flight at any time [%u]\n"
+          "-t timeout    seconds after which a scenario is given up [%u]\n"
+          "-p port       loopback port the ircd listens on [%u]\n"
+          "-j            print one JSON object per scenario\n"
+          "-k            keep the generated configuration and log files\n",
+          opt.ircd, opt.modules, opt.clients, opt.servers, opt.users, opt.channels, opt.messages,
+          opt.reconnects, opt.window, opt.timeout, opt.port);
+  exit(EXIT_FAILURE);
+}
+
+int
+main(int argc, char *argv[])
+{
+  bool modules_given = false, ircd_given = false;
+
+  for (int c = 0; (c = getopt(argc, argv, "i:M:s:c:m:u:C:n:r:w:t:p:jkh?")) != -1; )
+  {
+    switch (c)
+    {
+      case 'i': opt.ircd = optarg; ircd_given = true; break;
+      case 'M': opt.modules = optarg; modules_given = true; break;
+      case 's': opt.scenarios = optarg; break;
+      case 'c': opt.clients = strtoul(optarg, NULL, 10); break;
+      case 'm': opt.servers = strtoul(optarg, NULL, 10); break;
+      case 'u': opt.users = strtoul(optarg, NULL, 10); break;
+      case 'C': opt.channels = strtoul(optarg, NULL, 10); break;
+      case 'n': opt.messages = strtoul(optarg, NULL, 10); break;
+      case 'r': opt.reconnects = strtoul(optarg, NULL, 10); break;
+      case 'w': opt.window = strtoul(optarg, NULL, 10); break;
+      case 't': opt.timeout = strtoul(optarg, NULL, 10); break;
+      case 'p': opt.port = strtoul(optarg, NULL, 10); break;
+      case 'j': opt.json = true; break;
+      case 'k': opt.keep = true; break;
+      default: usage();
+    }
+  }
+
+  if (ircd_given && modules_given == false)
+    opt.modules = "";
+
+  if (opt.clients == 0 || opt.window == 0 || opt.channels == 0 || opt.servers > 240 ||
+      opt.users > 100000)
+    usage();
+
+  struct rlimit rlim;
+  if (getrlimit(RLIMIT_NOFILE, &rlim) == 0)
+  {
+    rlim.rlim_cur = rlim.rlim_max;
+    setrlimit(RLIMIT_NOFILE, &rlim);
+  }
+
+  signal(SIGPIPE, SIG_IGN);
+  atexit(ircd_stop);
+  ircd_start();
+
+  char *list = strdup(strcmp(opt.scenarios, "all") ? opt.scenarios :
+                      "flood,burst,fanout,list,who,split,reconnect");
+
+  for (char *name = strtok(list, ","); name; name = strtok(NULL, ","))
+  {
+    unsigned int i = 0;
+
+    while (scenario_tab[i].name && strcmp(scenario_tab[i].name, name))
+      ++i;
+
+    if (scenario_tab[i].name == NULL)
+    {
+      fprintf(stderr, "ircd-bench: unknown scenario %s\n", name);
+      exit(EXIT_FAILURE);
+    }
+
+    scenario_tab[i].handler();
+  }
+
+  free(list);
+  return failed ? EXIT_FAILURE : EXIT_SUCCESS;
+}